@@ -17,6 +17,12 @@ extern struct liquid_autotest_s agc_crcf_squelch_s;
 extern struct liquid_autotest_s agc_crcf_lock_s;
 extern struct liquid_autotest_s agc_crcf_config_s;
 extern struct liquid_autotest_s agc_crcf_copy_s;
+extern struct liquid_autotest_s agc_crcf_block_bt0p010_m1_s;
+extern struct liquid_autotest_s agc_crcf_block_bt0p001_m32_s;
+extern struct liquid_autotest_s agc_crcf_block_bt0p005_m33_s;
+extern struct liquid_autotest_s agc_crcf_block_bt0p010_m4_s;
+extern struct liquid_autotest_s agc_crcf_block_bt0p010_m20_s;
+extern struct liquid_autotest_s agc_crcf_block_bt0p020_m7_s;
 // ./src/audio/tests/cvsd_autotest.c
 extern struct liquid_autotest_s cvsd_rmse_sine_s;
 extern struct liquid_autotest_s cvsd_rmse_sine8_s;
@@ -25,26 +31,50 @@ extern struct liquid_autotest_s cvsd_config_s;
 extern struct liquid_autotest_s window_config_errors_s;
 extern struct liquid_autotest_s windowf_s;
 extern struct liquid_autotest_s window_copy_s;
+extern struct liquid_autotest_s window_mirrored_1_s;
+extern struct liquid_autotest_s window_mirrored_13_s;
+extern struct liquid_autotest_s window_mirrored_512_s;
+extern struct liquid_autotest_s window_mirrored_1500_s;
+extern struct liquid_autotest_s window_mirrored_default_s;
 // ./src/buffer/tests/cbuffer_autotest.c
 extern struct liquid_autotest_s cbufferf_s;
 extern struct liquid_autotest_s cbuffercf_s;
 extern struct liquid_autotest_s cbufferf_flow_s;
 extern struct liquid_autotest_s cbufferf_config_s;
 extern struct liquid_autotest_s cbuffer_copy_s;
+extern struct liquid_autotest_s cbufferf_mirrored_flow_s;
 // ./src/buffer/tests/wdelay_autotest.c
 extern struct liquid_autotest_s wdelayf_s;
 extern struct liquid_autotest_s wdelay_copy_s;
+extern struct liquid_autotest_s wdelay_mirrored_s;
+// ./src/core/tests/counters_autotest.c
+extern struct liquid_autotest_s counters_firfilt_s;
+extern struct liquid_autotest_s counters_copy_s;
+extern struct liquid_autotest_s counters_export_s;
+extern struct liquid_autotest_s counters_config_s;
 // ./src/core/tests/logging_autotest.c
 extern struct liquid_autotest_s logging_s;
 extern struct liquid_autotest_s logging_config_s;
+// ./src/core/tests/workers_autotest.c
+extern struct liquid_autotest_s workers_1_s;
+extern struct liquid_autotest_s workers_2_s;
+extern struct liquid_autotest_s workers_7_s;
+extern struct liquid_autotest_s workers_config_s;
+// ./src/core/tests/workqueue_autotest.c
+extern struct liquid_autotest_s workqueue_0_s;
+extern struct liquid_autotest_s workqueue_1_s;
+extern struct liquid_autotest_s workqueue_3_s;
+extern struct liquid_autotest_s workqueue_config_s;
 // ./src/dotprod/tests/dotprod_cccf_autotest.c
 extern struct liquid_autotest_s dotprod_cccf_rand16_s;
 extern struct liquid_autotest_s dotprod_cccf_struct_lengths_s;
 extern struct liquid_autotest_s dotprod_cccf_struct_vs_ordinal_s;
+extern struct liquid_autotest_s dotprod_cccf_block_s;
 // ./src/dotprod/tests/dotprod_crcf_autotest.c
 extern struct liquid_autotest_s dotprod_crcf_rand01_s;
 extern struct liquid_autotest_s dotprod_crcf_rand02_s;
 extern struct liquid_autotest_s dotprod_crcf_struct_vs_ordinal_s;
+extern struct liquid_autotest_s dotprod_crcf_block_s;
 // ./src/dotprod/tests/dotprod_rrrf_autotest.c
 extern struct liquid_autotest_s dotprod_rrrf_basic_s;
 extern struct liquid_autotest_s dotprod_rrrf_uneven_s;
@@ -54,6 +84,7 @@ extern struct liquid_autotest_s dotprod_rrrf_rand01_s;
 extern struct liquid_autotest_s dotprod_rrrf_rand02_s;
 extern struct liquid_autotest_s dotprod_rrrf_struct_lengths_s;
 extern struct liquid_autotest_s dotprod_rrrf_struct_vs_ordinal_s;
+extern struct liquid_autotest_s dotprod_rrrf_block_s;
 // ./src/dotprod/tests/sumsqcf_autotest.c
 extern struct liquid_autotest_s sumsqcf_3_s;
 extern struct liquid_autotest_s sumsqcf_4_s;
@@ -83,6 +114,20 @@ extern struct liquid_autotest_s eqlms_10_s;
 extern struct liquid_autotest_s eqlms_11_s;
 extern struct liquid_autotest_s eqlms_config_s;
 extern struct liquid_autotest_s eqlms_cccf_copy_s;
+extern struct liquid_autotest_s eqlms_cccf_block_p11_k1_s;
+extern struct liquid_autotest_s eqlms_cccf_block_p21_k2_s;
+extern struct liquid_autotest_s eqlms_cccf_block_p64_k4_s;
+extern struct liquid_autotest_s eqlms_cccf_block_p300_k2_s;
+extern struct liquid_autotest_s eqlms_cccf_block_p4_k1_s;
+extern struct liquid_autotest_s eqlms_cccf_block_p7_k3_s;
+extern struct liquid_autotest_s eqlms_cccf_train_p4_s;
+extern struct liquid_autotest_s eqlms_cccf_train_p21_s;
+// ./src/equalization/tests/eqlms_rrrf_autotest.c
+extern struct liquid_autotest_s eqlms_rrrf_block_p4_k1_s;
+extern struct liquid_autotest_s eqlms_rrrf_block_p11_k2_s;
+extern struct liquid_autotest_s eqlms_rrrf_block_p64_k1_s;
+extern struct liquid_autotest_s eqlms_rrrf_train_p4_s;
+extern struct liquid_autotest_s eqlms_rrrf_train_p21_s;
 // ./src/equalization/tests/eqrls_rrrf_autotest.c
 extern struct liquid_autotest_s eqrls_rrrf_01_s;
 extern struct liquid_autotest_s eqrls_rrrf_copy_s;
@@ -99,6 +144,8 @@ extern struct liquid_autotest_s crc8_testvector_s;
 extern struct liquid_autotest_s crc16_testvector_s;
 extern struct liquid_autotest_s crc24_testvector_s;
 extern struct liquid_autotest_s crc32_testvector_s;
+extern struct liquid_autotest_s crc_runtime_port_s;
+extern struct liquid_autotest_s crc_runtime_detect_s;
 extern struct liquid_autotest_s crc_config_s;
 // ./src/fec/tests/fec_autotest.c
 extern struct liquid_autotest_s fec_r3_s;
@@ -127,6 +174,9 @@ extern struct liquid_autotest_s fec_v29p56_s;
 extern struct liquid_autotest_s fec_v29p67_s;
 extern struct liquid_autotest_s fec_v29p78_s;
 extern struct liquid_autotest_s fec_rs8_s;
+extern struct liquid_autotest_s fec_ldpc12k1024_s;
+extern struct liquid_autotest_s fec_ldpc12k4096_s;
+extern struct liquid_autotest_s fec_ldpc34k3072_s;
 // ./src/fec/tests/fec_config_autotest.c
 extern struct liquid_autotest_s fec_config_s;
 extern struct liquid_autotest_s fec_str2fec_s;
@@ -134,6 +184,7 @@ extern struct liquid_autotest_s fec_is_convolutional_s;
 extern struct liquid_autotest_s fec_is_punctured_s;
 extern struct liquid_autotest_s fec_is_reedsolomon_s;
 extern struct liquid_autotest_s fec_is_hamming_s;
+extern struct liquid_autotest_s fec_is_ldpc_s;
 // ./src/fec/tests/fec_copy_autotest.c
 extern struct liquid_autotest_s fec_copy_r3_s;
 extern struct liquid_autotest_s fec_copy_r5_s;
@@ -161,6 +212,9 @@ extern struct liquid_autotest_s fec_copy_v29p56_s;
 extern struct liquid_autotest_s fec_copy_v29p67_s;
 extern struct liquid_autotest_s fec_copy_v29p78_s;
 extern struct liquid_autotest_s fec_copy_rs8_s;
+extern struct liquid_autotest_s fec_copy_ldpc12k1024_s;
+extern struct liquid_autotest_s fec_copy_ldpc12k4096_s;
+extern struct liquid_autotest_s fec_copy_ldpc34k3072_s;
 // ./src/fec/tests/fec_golay2412_autotest.c
 extern struct liquid_autotest_s golay2412_codec_s;
 // ./src/fec/tests/fec_hamming128_autotest.c
@@ -176,6 +230,25 @@ extern struct liquid_autotest_s hamming74_codec_soft_s;
 // ./src/fec/tests/fec_hamming84_autotest.c
 extern struct liquid_autotest_s hamming84_codec_s;
 extern struct liquid_autotest_s hamming84_codec_soft_s;
+// ./src/fec/tests/fec_ldpc_autotest.c
+extern struct liquid_autotest_s fec_ldpc_awgn_r12k1024_s;
+extern struct liquid_autotest_s fec_ldpc_awgn_r12k4096_s;
+extern struct liquid_autotest_s fec_ldpc_awgn_r34k3072_s;
+extern struct liquid_autotest_s fec_ldpc_encode_parity_s;
+extern struct liquid_autotest_s fec_ldpc_gen_qc_girth_s;
+extern struct liquid_autotest_s fec_sumproduct_h74_s;
+extern struct liquid_autotest_s fec_ldpc_r12k1024_port_s;
+extern struct liquid_autotest_s fec_ldpc_r12k4096_port_s;
+extern struct liquid_autotest_s fec_ldpc_r34k3072_port_s;
+extern struct liquid_autotest_s fec_ldpc_r12k1024_neon_s;
+extern struct liquid_autotest_s fec_ldpc_r12k4096_neon_s;
+extern struct liquid_autotest_s fec_ldpc_r34k3072_neon_s;
+extern struct liquid_autotest_s fec_ldpc_r12k1024_avx2_s;
+extern struct liquid_autotest_s fec_ldpc_r12k4096_avx2_s;
+extern struct liquid_autotest_s fec_ldpc_r34k3072_avx2_s;
+extern struct liquid_autotest_s fec_ldpc_layered_s;
+extern struct liquid_autotest_s fec_ldpc_gen_schemes_s;
+extern struct liquid_autotest_s fec_ldpc_gen_qc_config_s;
 // ./src/fec/tests/fec_reedsolomon_autotest.c
 extern struct liquid_autotest_s reedsolomon_223_255_s;
 // ./src/fec/tests/fec_rep3_autotest.c
@@ -217,6 +290,31 @@ extern struct liquid_autotest_s fecsoft_v29p56_s;
 extern struct liquid_autotest_s fecsoft_v29p67_s;
 extern struct liquid_autotest_s fecsoft_v29p78_s;
 extern struct liquid_autotest_s fecsoft_rs8_s;
+extern struct liquid_autotest_s fecsoft_ldpc12k1024_s;
+extern struct liquid_autotest_s fecsoft_ldpc12k4096_s;
+extern struct liquid_autotest_s fecsoft_ldpc34k3072_s;
+// ./src/fec/tests/fec_viterbi_autotest.c
+extern struct liquid_autotest_s fec_viterbi_v27_port_s;
+extern struct liquid_autotest_s fec_viterbi_v29_port_s;
+extern struct liquid_autotest_s fec_viterbi_v39_port_s;
+extern struct liquid_autotest_s fec_viterbi_v615_port_s;
+extern struct liquid_autotest_s fec_viterbi_v27_neon_s;
+extern struct liquid_autotest_s fec_viterbi_v29_neon_s;
+extern struct liquid_autotest_s fec_viterbi_v39_neon_s;
+extern struct liquid_autotest_s fec_viterbi_v615_neon_s;
+extern struct liquid_autotest_s fec_viterbi_v27_sse2_s;
+extern struct liquid_autotest_s fec_viterbi_v29_sse2_s;
+extern struct liquid_autotest_s fec_viterbi_v39_sse2_s;
+extern struct liquid_autotest_s fec_viterbi_v615_sse2_s;
+extern struct liquid_autotest_s fec_viterbi_v27_avx2_s;
+extern struct liquid_autotest_s fec_viterbi_v29_avx2_s;
+extern struct liquid_autotest_s fec_viterbi_v39_avx2_s;
+extern struct liquid_autotest_s fec_viterbi_v615_avx2_s;
+extern struct liquid_autotest_s fec_viterbi_v27_avx512_s;
+extern struct liquid_autotest_s fec_viterbi_v29_avx512_s;
+extern struct liquid_autotest_s fec_viterbi_v39_avx512_s;
+extern struct liquid_autotest_s fec_viterbi_v615_avx512_s;
+extern struct liquid_autotest_s fec_viterbi_config_s;
 // ./src/fec/tests/interleaver_autotest.c
 extern struct liquid_autotest_s interleaver_hard_8_s;
 extern struct liquid_autotest_s interleaver_hard_16_s;
@@ -226,6 +324,9 @@ extern struct liquid_autotest_s interleaver_soft_8_s;
 extern struct liquid_autotest_s interleaver_soft_16_s;
 extern struct liquid_autotest_s interleaver_soft_64_s;
 extern struct liquid_autotest_s interleaver_soft_256_s;
+extern struct liquid_autotest_s interleaver_reference_s;
+extern struct liquid_autotest_s interleaver_soft_hard_s;
+extern struct liquid_autotest_s interleaver_inplace_copy_s;
 // ./src/fec/tests/packetizer_autotest.c
 extern struct liquid_autotest_s packetizer_n16_0_0_s;
 extern struct liquid_autotest_s packetizer_n16_0_1_s;
@@ -239,6 +340,20 @@ extern struct liquid_autotest_s asgramcf_config_s;
 extern struct liquid_autotest_s fft_shift_4_s;
 extern struct liquid_autotest_s fft_shift_8_s;
 extern struct liquid_autotest_s fft_shift_5_s;
+// ./src/fft/tests/fft_many_autotest.c
+extern struct liquid_autotest_s fft_many_radix2_16_s;
+extern struct liquid_autotest_s fft_many_radix2_1024_s;
+extern struct liquid_autotest_s fft_many_radix2_256_s;
+extern struct liquid_autotest_s fft_many_interleaved_s;
+extern struct liquid_autotest_s fft_many_strided_s;
+extern struct liquid_autotest_s fft_many_inplace_s;
+extern struct liquid_autotest_s fft_many_radix2_2_s;
+extern struct liquid_autotest_s fft_many_composite_s;
+extern struct liquid_autotest_s fft_many_prime_s;
+extern struct liquid_autotest_s fft_many_composite_inplace_s;
+extern struct liquid_autotest_s fft_many_radix2_8192_s;
+extern struct liquid_autotest_s fft_many_single_s;
+extern struct liquid_autotest_s fft_many_config_s;
 // ./src/fft/tests/fft_r2r_autotest.c
 extern struct liquid_autotest_s fft_r2r_REDFT00_n8_s;
 extern struct liquid_autotest_s fft_r2r_REDFT10_n8_s;
@@ -264,6 +379,14 @@ extern struct liquid_autotest_s fft_r2r_RODFT00_n32_s;
 extern struct liquid_autotest_s fft_r2r_RODFT10_n32_s;
 extern struct liquid_autotest_s fft_r2r_RODFT01_n32_s;
 extern struct liquid_autotest_s fft_r2r_RODFT11_n32_s;
+// ./src/fft/tests/fft_radix4_autotest.c
+extern struct liquid_autotest_s fft_radix4_port_s;
+extern struct liquid_autotest_s fft_radix4_neon_s;
+extern struct liquid_autotest_s fft_radix4_sse2_s;
+extern struct liquid_autotest_s fft_radix4_avx2_s;
+extern struct liquid_autotest_s fft_radix4_avx512_s;
+extern struct liquid_autotest_s fft_radix4_method_s;
+extern struct liquid_autotest_s fft_radix4_config_s;
 // ./src/fft/tests/fft_transforms_autotest.c
 extern struct liquid_autotest_s fft_3_s;
 extern struct liquid_autotest_s fft_5_s;
@@ -325,6 +448,12 @@ extern struct liquid_autotest_s spgramcf_config_s;
 extern struct liquid_autotest_s spgramcf_standalone_s;
 extern struct liquid_autotest_s spgramcf_short_s;
 extern struct liquid_autotest_s spgramcf_copy_s;
+extern struct liquid_autotest_s spgramcf_threads_1_s;
+extern struct liquid_autotest_s spgramcf_threads_2_s;
+extern struct liquid_autotest_s spgramcf_threads_3_s;
+extern struct liquid_autotest_s spgramcf_threads_4_s;
+extern struct liquid_autotest_s spgramcf_threads_8_s;
+extern struct liquid_autotest_s spgramf_threads_s;
 extern struct liquid_autotest_s spgramcf_null_s;
 extern struct liquid_autotest_s spgram_gnuplot_s;
 // ./src/fft/tests/spwaterfall_autotest.c
@@ -334,6 +463,7 @@ extern struct liquid_autotest_s spwaterfallcf_noise_1024_s;
 extern struct liquid_autotest_s spwaterfallcf_noise_1200_s;
 extern struct liquid_autotest_s spwaterfall_operation_s;
 extern struct liquid_autotest_s spwaterfall_copy_s;
+extern struct liquid_autotest_s spwaterfall_threads_s;
 extern struct liquid_autotest_s spwaterfall_gnuplot_s;
 // ./src/filter/tests/dds_cccf_autotest.c
 extern struct liquid_autotest_s dds_cccf_0_s;
@@ -369,6 +499,13 @@ extern struct liquid_autotest_s fftfilt_cccf_data_h13x256_s;
 extern struct liquid_autotest_s fftfilt_cccf_data_h23x256_s;
 extern struct liquid_autotest_s fftfilt_config_s;
 extern struct liquid_autotest_s fftfilt_copy_s;
+extern struct liquid_autotest_s fftfilt_crcf_partitioned_h200_n256_s;
+extern struct liquid_autotest_s fftfilt_crcf_partitioned_h257_n256_s;
+extern struct liquid_autotest_s fftfilt_crcf_partitioned_h258_n256_s;
+extern struct liquid_autotest_s fftfilt_crcf_partitioned_h1000_n64_s;
+extern struct liquid_autotest_s fftfilt_crcf_partitioned_h4000_n48_s;
+extern struct liquid_autotest_s fftfilt_partitioned_reset_s;
+extern struct liquid_autotest_s fftfilt_autotune_s;
 // ./src/filter/tests/filter_crosscorr_autotest.c
 extern struct liquid_autotest_s filter_crosscorr_rrrf_s;
 // ./src/filter/tests/firdecim_autotest.c
@@ -443,6 +580,13 @@ extern struct liquid_autotest_s firfilt_cccf_notch_s;
 extern struct liquid_autotest_s firfilt_config_s;
 extern struct liquid_autotest_s firfilt_recreate_s;
 extern struct liquid_autotest_s firfilt_push_write_s;
+extern struct liquid_autotest_s firfilt_crcf_block_h1_n7_s;
+extern struct liquid_autotest_s firfilt_crcf_block_h13_n3_s;
+extern struct liquid_autotest_s firfilt_crcf_block_h13_n64_s;
+extern struct liquid_autotest_s firfilt_crcf_block_h63_n37_s;
+extern struct liquid_autotest_s firfilt_crcf_block_h127_n600_s;
+extern struct liquid_autotest_s firfilt_cccf_block_s;
+extern struct liquid_autotest_s firfilt_rrrf_block_s;
 // ./src/filter/tests/firfilt_cccf_notch_autotest.c
 extern struct liquid_autotest_s firfilt_cccf_notch_0_s;
 extern struct liquid_autotest_s firfilt_cccf_notch_1_s;
@@ -599,6 +743,13 @@ extern struct liquid_autotest_s msresamp2_crcf_interp_09_s;
 extern struct liquid_autotest_s msresamp2_crcf_interp_10_s;
 extern struct liquid_autotest_s msresamp2_crcf_interp_11_s;
 extern struct liquid_autotest_s msresamp2_copy_s;
+extern struct liquid_autotest_s msresamp2_crcf_block_decim_0_s;
+extern struct liquid_autotest_s msresamp2_crcf_block_decim_1_s;
+extern struct liquid_autotest_s msresamp2_crcf_block_decim_4_s;
+extern struct liquid_autotest_s msresamp2_crcf_block_decim_10_s;
+extern struct liquid_autotest_s msresamp2_crcf_block_interp_1_s;
+extern struct liquid_autotest_s msresamp2_crcf_block_interp_4_s;
+extern struct liquid_autotest_s msresamp2_crcf_block_interp_10_s;
 // ./src/filter/tests/msresamp_crcf_autotest.c
 extern struct liquid_autotest_s msresamp_crcf_01_s;
 extern struct liquid_autotest_s msresamp_crcf_02_s;
@@ -612,6 +763,10 @@ extern struct liquid_autotest_s msresamp_crcf_num_output_5_s;
 extern struct liquid_autotest_s msresamp_crcf_num_output_6_s;
 extern struct liquid_autotest_s msresamp_crcf_num_output_7_s;
 extern struct liquid_autotest_s msresamp_crcf_copy_s;
+extern struct liquid_autotest_s msresamp_crcf_split_0_s;
+extern struct liquid_autotest_s msresamp_crcf_split_1_s;
+extern struct liquid_autotest_s msresamp_crcf_split_2_s;
+extern struct liquid_autotest_s msresamp_crcf_split_3_s;
 // ./src/filter/tests/ordfilt_autotest.c
 extern struct liquid_autotest_s ordfilt_copy_s;
 // ./src/filter/tests/resamp2_crcf_autotest.c
@@ -625,6 +780,8 @@ extern struct liquid_autotest_s resamp2_crcf_filter_4_s;
 extern struct liquid_autotest_s resamp2_crcf_filter_5_s;
 extern struct liquid_autotest_s resamp2_config_s;
 extern struct liquid_autotest_s resamp2_copy_s;
+extern struct liquid_autotest_s resamp2_crcf_decim_block_s;
+extern struct liquid_autotest_s resamp2_crcf_interp_block_s;
 // ./src/filter/tests/resamp_crcf_autotest.c
 extern struct liquid_autotest_s resamp_crcf_00_s;
 extern struct liquid_autotest_s resamp_crcf_01_s;
@@ -643,6 +800,11 @@ extern struct liquid_autotest_s resamp_crcf_num_output_5_s;
 extern struct liquid_autotest_s resamp_crcf_num_output_6_s;
 extern struct liquid_autotest_s resamp_crcf_num_output_7_s;
 extern struct liquid_autotest_s resamp_crcf_copy_s;
+extern struct liquid_autotest_s resamp_crcf_block_0_s;
+extern struct liquid_autotest_s resamp_crcf_block_1_s;
+extern struct liquid_autotest_s resamp_crcf_block_2_s;
+extern struct liquid_autotest_s resamp_crcf_block_3_s;
+extern struct liquid_autotest_s resamp_crcf_scale_s;
 // ./src/filter/tests/rkaiser_autotest.c
 extern struct liquid_autotest_s liquid_rkaiser_config_s;
 // ./src/filter/tests/rresamp_crcf_autotest.c
@@ -720,6 +882,10 @@ extern struct liquid_autotest_s dsssframesync_s;
 extern struct liquid_autotest_s dsssframe_config_s;
 // ./src/framing/tests/flexframesync_autotest.c
 extern struct liquid_autotest_s flexframesync_s;
+extern struct liquid_autotest_s flexframesync_threads_0_s;
+extern struct liquid_autotest_s flexframesync_threads_1_s;
+extern struct liquid_autotest_s flexframesync_threads_3_s;
+extern struct liquid_autotest_s flexframesync_threads_reentry_s;
 extern struct liquid_autotest_s flexframe_config_s;
 // ./src/framing/tests/framesync64_autotest.c
 extern struct liquid_autotest_s framesync64_s;
@@ -732,6 +898,12 @@ extern struct liquid_autotest_s framesync64_debug_ndet_s;
 extern struct liquid_autotest_s framesync64_debug_head_s;
 extern struct liquid_autotest_s framesync64_debug_rand_s;
 extern struct liquid_autotest_s framesync64_estimation_s;
+// ./src/framing/tests/framesync64bank_autotest.c
+extern struct liquid_autotest_s framesync64bank_n1_s;
+extern struct liquid_autotest_s framesync64bank_n2_s;
+extern struct liquid_autotest_s framesync64bank_n7_s;
+extern struct liquid_autotest_s framesync64bank_n16_s;
+extern struct liquid_autotest_s framesync64bank_config_s;
 // ./src/framing/tests/fskframesync_autotest.c
 extern struct liquid_autotest_s fskframesync_s;
 extern struct liquid_autotest_s fskframe_config_s;
@@ -789,8 +961,16 @@ extern struct liquid_autotest_s qdetector_cccf_gmsk_n512_s;
 extern struct liquid_autotest_s qdetector_cccf_gmsk_n671_s;
 extern struct liquid_autotest_s qdetector_cccf_gmsk_n1024_s;
 extern struct liquid_autotest_s qdetector_cccf_gmsk_n1341_s;
+extern struct liquid_autotest_s qdetector_cccf_cfo_p100_s;
+extern struct liquid_autotest_s qdetector_cccf_cfo_m200_s;
+extern struct liquid_autotest_s qdetector_cccf_cfo_p010_s;
 // ./src/framing/tests/qdetector_cccf_copy_autotest.c
 extern struct liquid_autotest_s qdetector_cccf_copy_s;
+// ./src/framing/tests/qdetectorbank_cccf_autotest.c
+extern struct liquid_autotest_s qdetectorbank_cccf_k2_s;
+extern struct liquid_autotest_s qdetectorbank_cccf_k4_s;
+extern struct liquid_autotest_s qdetectorbank_cccf_add_busy_s;
+extern struct liquid_autotest_s qdetectorbank_cccf_config_s;
 // ./src/framing/tests/qdsync_cccf_autotest.c
 extern struct liquid_autotest_s qdsync_cccf_k2_s;
 extern struct liquid_autotest_s qdsync_cccf_k3_s;
@@ -983,6 +1163,7 @@ extern struct liquid_autotest_s smatrixb_vmul_s;
 extern struct liquid_autotest_s smatrixb_mul_s;
 extern struct liquid_autotest_s smatrixb_mulf_s;
 extern struct liquid_autotest_s smatrixb_vmulf_s;
+extern struct liquid_autotest_s smatrixb_get_row_s;
 // ./src/matrix/tests/smatrixf_autotest.c
 extern struct liquid_autotest_s smatrixf_vmul_s;
 extern struct liquid_autotest_s smatrixf_mul_s;
@@ -1020,6 +1201,9 @@ extern struct liquid_autotest_s cpfskmodem_bps1_h0p5_k2_m7_gmsk_s;
 extern struct liquid_autotest_s cpfskmodem_bps1_h0p5_k4_m7_gmsk_s;
 extern struct liquid_autotest_s cpfskmodem_bps1_h0p5_k6_m7_gmsk_s;
 extern struct liquid_autotest_s cpfskmodem_bps1_h0p5_k8_m7_gmsk_s;
+extern struct liquid_autotest_s cpfskmodem_block_bps1_h0p5000_k4_gmsk_s;
+extern struct liquid_autotest_s cpfskmodem_block_bps1_h0p2500_k8_square_s;
+extern struct liquid_autotest_s cpfskmodem_block_bps2_h0p2500_k4_square_s;
 extern struct liquid_autotest_s cpfskmodem_spectrum_s;
 extern struct liquid_autotest_s cpfskmodem_config_s;
 // ./src/modem/tests/freqmodem_autotest.c
@@ -1061,6 +1245,9 @@ extern struct liquid_autotest_s gmskmodem_k4_m8_b025_s;
 extern struct liquid_autotest_s gmskmodem_k4_m3_b020_s;
 extern struct liquid_autotest_s gmskmodem_k4_m3_b033_s;
 extern struct liquid_autotest_s gmskmodem_k4_m3_b050_s;
+extern struct liquid_autotest_s gmskmodem_block_k2_m3_b030_s;
+extern struct liquid_autotest_s gmskmodem_block_k4_m3_b025_s;
+extern struct liquid_autotest_s gmskmodem_block_k5_m2_b050_s;
 extern struct liquid_autotest_s gmskmod_copy_s;
 extern struct liquid_autotest_s gmskdem_copy_s;
 // ./src/modem/tests/modem_autotest.c
@@ -1220,6 +1407,35 @@ extern struct liquid_autotest_s demodsoft_arb128opt_s;
 extern struct liquid_autotest_s demodsoft_arb256opt_s;
 extern struct liquid_autotest_s demodsoft_arb64vt_s;
 extern struct liquid_autotest_s demodsoft_pi4dqpsk_s;
+// ./src/modem/tests/modem_demodsoft_block_autotest.c
+extern struct liquid_autotest_s demodsoft_block_psk2_s;
+extern struct liquid_autotest_s demodsoft_block_psk8_s;
+extern struct liquid_autotest_s demodsoft_block_psk64_s;
+extern struct liquid_autotest_s demodsoft_block_ask4_s;
+extern struct liquid_autotest_s demodsoft_block_ask16_s;
+extern struct liquid_autotest_s demodsoft_block_qam4_s;
+extern struct liquid_autotest_s demodsoft_block_qam8_s;
+extern struct liquid_autotest_s demodsoft_block_qam32_s;
+extern struct liquid_autotest_s demodsoft_block_qam256_s;
+extern struct liquid_autotest_s demodsoft_block_apsk16_s;
+extern struct liquid_autotest_s demodsoft_block_apsk128_s;
+extern struct liquid_autotest_s demodsoft_block_bpsk_s;
+extern struct liquid_autotest_s demodsoft_block_qpsk_s;
+extern struct liquid_autotest_s demodsoft_block_ook_s;
+extern struct liquid_autotest_s demodsoft_block_sqam32_s;
+extern struct liquid_autotest_s demodsoft_block_sqam128_s;
+extern struct liquid_autotest_s demodsoft_block_V29_s;
+extern struct liquid_autotest_s demodsoft_block_arb64opt_s;
+extern struct liquid_autotest_s demodsoft_block_dpsk4_s;
+extern struct liquid_autotest_s demodsoft_block_dpsk16_s;
+extern struct liquid_autotest_s demodsoft_block_pi4dqpsk_s;
+extern struct liquid_autotest_s demodsoft_block_nvar_s;
+extern struct liquid_autotest_s demodsoft_block_dispatch_psk32_s;
+extern struct liquid_autotest_s demodsoft_block_dispatch_psk64_s;
+extern struct liquid_autotest_s demodsoft_block_dispatch_apsk32_s;
+extern struct liquid_autotest_s demodsoft_block_dispatch_apsk256_s;
+extern struct liquid_autotest_s demodsoft_block_dispatch_qam256_s;
+extern struct liquid_autotest_s demodsoft_block_dispatch_arb64opt_s;
 // ./src/modem/tests/modem_demodstats_autotest.c
 extern struct liquid_autotest_s demodstats_psk2_s;
 extern struct liquid_autotest_s demodstats_psk4_s;
@@ -1284,6 +1500,21 @@ extern struct liquid_autotest_s firpfbch2_crcf_copy_s;
 extern struct liquid_autotest_s firpfbch2_crcf_config_s;
 // ./src/multichannel/tests/firpfbch_crcf_analyzer_autotest.c
 extern struct liquid_autotest_s firpfbch_crcf_analysis_s;
+extern struct liquid_autotest_s firpfbch_crcf_analysis_block_4_2_s;
+extern struct liquid_autotest_s firpfbch_crcf_analysis_block_17_3_s;
+extern struct liquid_autotest_s firpfbch_crcf_analysis_block_100_4_s;
+extern struct liquid_autotest_s firpfbch_crcf_analysis_block_256_2_s;
+extern struct liquid_autotest_s firpfbch_crcf_analysis_runtime_port_67_s;
+extern struct liquid_autotest_s firpfbch_crcf_analysis_runtime_neon_67_s;
+extern struct liquid_autotest_s firpfbch_crcf_analysis_runtime_avx2_67_s;
+extern struct liquid_autotest_s firpfbch_crcf_analysis_runtime_neon_256_s;
+extern struct liquid_autotest_s firpfbch_crcf_analysis_runtime_avx2_256_s;
+extern struct liquid_autotest_s firpfbch_cccf_analysis_runtime_port_67_s;
+extern struct liquid_autotest_s firpfbch_cccf_analysis_runtime_neon_67_s;
+extern struct liquid_autotest_s firpfbch_cccf_analysis_runtime_avx2_67_s;
+extern struct liquid_autotest_s firpfbch_cccf_analysis_runtime_neon_256_s;
+extern struct liquid_autotest_s firpfbch_cccf_analysis_runtime_avx2_256_s;
+extern struct liquid_autotest_s firpfbch_crcf_runtime_config_s;
 // ./src/multichannel/tests/firpfbch_crcf_autotest.c
 extern struct liquid_autotest_s firpfbch_crcf_config_s;
 // ./src/multichannel/tests/firpfbch_crcf_synthesizer_autotest.c
@@ -1296,6 +1527,16 @@ extern struct liquid_autotest_s ofdmframesync_acquire_n64_s;
 extern struct liquid_autotest_s ofdmframesync_acquire_n128_s;
 extern struct liquid_autotest_s ofdmframesync_acquire_n256_s;
 extern struct liquid_autotest_s ofdmframesync_acquire_n512_s;
+extern struct liquid_autotest_s ofdmframesync_block_n64_b1_s;
+extern struct liquid_autotest_s ofdmframesync_block_n64_b4_s;
+extern struct liquid_autotest_s ofdmframesync_block_n64_b4c_s;
+extern struct liquid_autotest_s ofdmframesync_block_n256_b3_s;
+extern struct liquid_autotest_s ofdmframesync_block_n256_b8_s;
+extern struct liquid_autotest_s ofdmframesync_block_reset_n64_b1_s;
+extern struct liquid_autotest_s ofdmframesync_block_reset_n64_b4_s;
+extern struct liquid_autotest_s ofdmframesync_block_reset_n64_b4c_s;
+extern struct liquid_autotest_s ofdmframesync_block_reset_n256_b8_s;
+extern struct liquid_autotest_s ofdmframesync_block_config_s;
 extern struct liquid_autotest_s ofdmframe_common_config_s;
 extern struct liquid_autotest_s ofdmframegen_config_s;
 extern struct liquid_autotest_s ofdmframesync_config_s;
@@ -1326,6 +1567,12 @@ extern struct liquid_autotest_s nco_crcf_mix_vco_6_s;
 extern struct liquid_autotest_s nco_crcf_mix_vco_7_s;
 extern struct liquid_autotest_s nco_crcf_mix_vco_8_s;
 extern struct liquid_autotest_s nco_crcf_mix_vco_9_s;
+extern struct liquid_autotest_s nco_crcf_mix_block_nco_up_s;
+extern struct liquid_autotest_s nco_crcf_mix_block_nco_down_s;
+extern struct liquid_autotest_s nco_crcf_mix_block_vcoi_up_s;
+extern struct liquid_autotest_s nco_crcf_mix_block_vcoi_down_s;
+extern struct liquid_autotest_s nco_crcf_mix_block_vcod_up_s;
+extern struct liquid_autotest_s nco_crcf_mix_block_vcod_down_s;
 // ./src/nco/tests/nco_crcf_phase_autotest.c
 extern struct liquid_autotest_s nco_crcf_phase_s;
 extern struct liquid_autotest_s nco_basic_s;
@@ -1503,12 +1750,20 @@ extern struct liquid_autotest_s rcircshift_s;
 // ./src/vector/tests/vectorcf_autotest.c
 extern struct liquid_autotest_s vectorcf_mul_16_s;
 extern struct liquid_autotest_s vectorcf_mul_35_s;
+extern struct liquid_autotest_s vectorcf_dotprod_conj_s;
+extern struct liquid_autotest_s vectorcf_runtime_neon_s;
+extern struct liquid_autotest_s vectorcf_runtime_avx2_s;
+extern struct liquid_autotest_s vectorcf_runtime_avx512_s;
 // ./src/vector/tests/vectorf_autotest.c
 extern struct liquid_autotest_s vectorf_mul_4_s;
 extern struct liquid_autotest_s vectorf_mul_16_s;
 extern struct liquid_autotest_s vectorf_mul_35_s;
 extern struct liquid_autotest_s vectorf_mulscalar_4_s;
 extern struct liquid_autotest_s vectorf_mulscalar_35_s;
+extern struct liquid_autotest_s vectorf_abs_s;
+extern struct liquid_autotest_s vectorf_dotprod_conj_s;
+extern struct liquid_autotest_s vectorf_runtime_avx2_s;
+extern struct liquid_autotest_s vectorf_runtime_avx512_s;
 
 // compile test registry
 liquid_autotest liquid_autotest_registry[] =
@@ -1524,27 +1779,54 @@ liquid_autotest liquid_autotest_registry[] =
     &agc_crcf_lock_s,
     &agc_crcf_config_s,
     &agc_crcf_copy_s,
+    &agc_crcf_block_bt0p010_m1_s,
+    &agc_crcf_block_bt0p001_m32_s,
+    &agc_crcf_block_bt0p005_m33_s,
+    &agc_crcf_block_bt0p010_m4_s,
+    &agc_crcf_block_bt0p010_m20_s,
+    &agc_crcf_block_bt0p020_m7_s,
     &cvsd_rmse_sine_s,
     &cvsd_rmse_sine8_s,
     &cvsd_config_s,
     &window_config_errors_s,
     &windowf_s,
     &window_copy_s,
+    &window_mirrored_1_s,
+    &window_mirrored_13_s,
+    &window_mirrored_512_s,
+    &window_mirrored_1500_s,
+    &window_mirrored_default_s,
     &cbufferf_s,
     &cbuffercf_s,
     &cbufferf_flow_s,
     &cbufferf_config_s,
     &cbuffer_copy_s,
+    &cbufferf_mirrored_flow_s,
     &wdelayf_s,
     &wdelay_copy_s,
+    &wdelay_mirrored_s,
+    &counters_firfilt_s,
+    &counters_copy_s,
+    &counters_export_s,
+    &counters_config_s,
     &logging_s,
     &logging_config_s,
+    &workers_1_s,
+    &workers_2_s,
+    &workers_7_s,
+    &workers_config_s,
+    &workqueue_0_s,
+    &workqueue_1_s,
+    &workqueue_3_s,
+    &workqueue_config_s,
     &dotprod_cccf_rand16_s,
     &dotprod_cccf_struct_lengths_s,
     &dotprod_cccf_struct_vs_ordinal_s,
+    &dotprod_cccf_block_s,
     &dotprod_crcf_rand01_s,
     &dotprod_crcf_rand02_s,
     &dotprod_crcf_struct_vs_ordinal_s,
+    &dotprod_crcf_block_s,
     &dotprod_rrrf_basic_s,
     &dotprod_rrrf_uneven_s,
     &dotprod_rrrf_struct_s,
@@ -1553,6 +1835,7 @@ liquid_autotest liquid_autotest_registry[] =
     &dotprod_rrrf_rand02_s,
     &dotprod_rrrf_struct_lengths_s,
     &dotprod_rrrf_struct_vs_ordinal_s,
+    &dotprod_rrrf_block_s,
     &sumsqcf_3_s,
     &sumsqcf_4_s,
     &sumsqcf_7_s,
@@ -1579,6 +1862,19 @@ liquid_autotest liquid_autotest_registry[] =
     &eqlms_11_s,
     &eqlms_config_s,
     &eqlms_cccf_copy_s,
+    &eqlms_cccf_block_p11_k1_s,
+    &eqlms_cccf_block_p21_k2_s,
+    &eqlms_cccf_block_p64_k4_s,
+    &eqlms_cccf_block_p300_k2_s,
+    &eqlms_cccf_block_p4_k1_s,
+    &eqlms_cccf_block_p7_k3_s,
+    &eqlms_cccf_train_p4_s,
+    &eqlms_cccf_train_p21_s,
+    &eqlms_rrrf_block_p4_k1_s,
+    &eqlms_rrrf_block_p11_k2_s,
+    &eqlms_rrrf_block_p64_k1_s,
+    &eqlms_rrrf_train_p4_s,
+    &eqlms_rrrf_train_p21_s,
     &eqrls_rrrf_01_s,
     &eqrls_rrrf_copy_s,
     &reverse_byte_s,
@@ -1593,6 +1889,8 @@ liquid_autotest liquid_autotest_registry[] =
     &crc16_testvector_s,
     &crc24_testvector_s,
     &crc32_testvector_s,
+    &crc_runtime_port_s,
+    &crc_runtime_detect_s,
     &crc_config_s,
     &fec_r3_s,
     &fec_r5_s,
@@ -1620,12 +1918,16 @@ liquid_autotest liquid_autotest_registry[] =
     &fec_v29p67_s,
     &fec_v29p78_s,
     &fec_rs8_s,
+    &fec_ldpc12k1024_s,
+    &fec_ldpc12k4096_s,
+    &fec_ldpc34k3072_s,
     &fec_config_s,
     &fec_str2fec_s,
     &fec_is_convolutional_s,
     &fec_is_punctured_s,
     &fec_is_reedsolomon_s,
     &fec_is_hamming_s,
+    &fec_is_ldpc_s,
     &fec_copy_r3_s,
     &fec_copy_r5_s,
     &fec_copy_h74_s,
@@ -1652,6 +1954,9 @@ liquid_autotest liquid_autotest_registry[] =
     &fec_copy_v29p67_s,
     &fec_copy_v29p78_s,
     &fec_copy_rs8_s,
+    &fec_copy_ldpc12k1024_s,
+    &fec_copy_ldpc12k4096_s,
+    &fec_copy_ldpc34k3072_s,
     &golay2412_codec_s,
     &hamming128_codec_s,
     &hamming128_codec_soft_s,
@@ -1661,6 +1966,24 @@ liquid_autotest liquid_autotest_registry[] =
     &hamming74_codec_soft_s,
     &hamming84_codec_s,
     &hamming84_codec_soft_s,
+    &fec_ldpc_awgn_r12k1024_s,
+    &fec_ldpc_awgn_r12k4096_s,
+    &fec_ldpc_awgn_r34k3072_s,
+    &fec_ldpc_encode_parity_s,
+    &fec_ldpc_gen_qc_girth_s,
+    &fec_sumproduct_h74_s,
+    &fec_ldpc_r12k1024_port_s,
+    &fec_ldpc_r12k4096_port_s,
+    &fec_ldpc_r34k3072_port_s,
+    &fec_ldpc_r12k1024_neon_s,
+    &fec_ldpc_r12k4096_neon_s,
+    &fec_ldpc_r34k3072_neon_s,
+    &fec_ldpc_r12k1024_avx2_s,
+    &fec_ldpc_r12k4096_avx2_s,
+    &fec_ldpc_r34k3072_avx2_s,
+    &fec_ldpc_layered_s,
+    &fec_ldpc_gen_schemes_s,
+    &fec_ldpc_gen_qc_config_s,
     &reedsolomon_223_255_s,
     &rep3_codec_s,
     &rep5_codec_s,
@@ -1695,6 +2018,30 @@ liquid_autotest liquid_autotest_registry[] =
     &fecsoft_v29p67_s,
     &fecsoft_v29p78_s,
     &fecsoft_rs8_s,
+    &fecsoft_ldpc12k1024_s,
+    &fecsoft_ldpc12k4096_s,
+    &fecsoft_ldpc34k3072_s,
+    &fec_viterbi_v27_port_s,
+    &fec_viterbi_v29_port_s,
+    &fec_viterbi_v39_port_s,
+    &fec_viterbi_v615_port_s,
+    &fec_viterbi_v27_neon_s,
+    &fec_viterbi_v29_neon_s,
+    &fec_viterbi_v39_neon_s,
+    &fec_viterbi_v615_neon_s,
+    &fec_viterbi_v27_sse2_s,
+    &fec_viterbi_v29_sse2_s,
+    &fec_viterbi_v39_sse2_s,
+    &fec_viterbi_v615_sse2_s,
+    &fec_viterbi_v27_avx2_s,
+    &fec_viterbi_v29_avx2_s,
+    &fec_viterbi_v39_avx2_s,
+    &fec_viterbi_v615_avx2_s,
+    &fec_viterbi_v27_avx512_s,
+    &fec_viterbi_v29_avx512_s,
+    &fec_viterbi_v39_avx512_s,
+    &fec_viterbi_v615_avx512_s,
+    &fec_viterbi_config_s,
     &interleaver_hard_8_s,
     &interleaver_hard_16_s,
     &interleaver_hard_64_s,
@@ -1703,6 +2050,9 @@ liquid_autotest liquid_autotest_registry[] =
     &interleaver_soft_16_s,
     &interleaver_soft_64_s,
     &interleaver_soft_256_s,
+    &interleaver_reference_s,
+    &interleaver_soft_hard_s,
+    &interleaver_inplace_copy_s,
     &packetizer_n16_0_0_s,
     &packetizer_n16_0_1_s,
     &packetizer_n16_0_2_s,
@@ -1712,6 +2062,19 @@ liquid_autotest liquid_autotest_registry[] =
     &fft_shift_4_s,
     &fft_shift_8_s,
     &fft_shift_5_s,
+    &fft_many_radix2_16_s,
+    &fft_many_radix2_1024_s,
+    &fft_many_radix2_256_s,
+    &fft_many_interleaved_s,
+    &fft_many_strided_s,
+    &fft_many_inplace_s,
+    &fft_many_radix2_2_s,
+    &fft_many_composite_s,
+    &fft_many_prime_s,
+    &fft_many_composite_inplace_s,
+    &fft_many_radix2_8192_s,
+    &fft_many_single_s,
+    &fft_many_config_s,
     &fft_r2r_REDFT00_n8_s,
     &fft_r2r_REDFT10_n8_s,
     &fft_r2r_REDFT01_n8_s,
@@ -1736,6 +2099,13 @@ liquid_autotest liquid_autotest_registry[] =
     &fft_r2r_RODFT10_n32_s,
     &fft_r2r_RODFT01_n32_s,
     &fft_r2r_RODFT11_n32_s,
+    &fft_radix4_port_s,
+    &fft_radix4_neon_s,
+    &fft_radix4_sse2_s,
+    &fft_radix4_avx2_s,
+    &fft_radix4_avx512_s,
+    &fft_radix4_method_s,
+    &fft_radix4_config_s,
     &fft_3_s,
     &fft_5_s,
     &fft_6_s,
@@ -1795,6 +2165,12 @@ liquid_autotest liquid_autotest_registry[] =
     &spgramcf_standalone_s,
     &spgramcf_short_s,
     &spgramcf_copy_s,
+    &spgramcf_threads_1_s,
+    &spgramcf_threads_2_s,
+    &spgramcf_threads_3_s,
+    &spgramcf_threads_4_s,
+    &spgramcf_threads_8_s,
+    &spgramf_threads_s,
     &spgramcf_null_s,
     &spgram_gnuplot_s,
     &spwaterfall_config_s,
@@ -1803,6 +2179,7 @@ liquid_autotest liquid_autotest_registry[] =
     &spwaterfallcf_noise_1200_s,
     &spwaterfall_operation_s,
     &spwaterfall_copy_s,
+    &spwaterfall_threads_s,
     &spwaterfall_gnuplot_s,
     &dds_cccf_0_s,
     &dds_cccf_1_s,
@@ -1835,6 +2212,13 @@ liquid_autotest liquid_autotest_registry[] =
     &fftfilt_cccf_data_h23x256_s,
     &fftfilt_config_s,
     &fftfilt_copy_s,
+    &fftfilt_crcf_partitioned_h200_n256_s,
+    &fftfilt_crcf_partitioned_h257_n256_s,
+    &fftfilt_crcf_partitioned_h258_n256_s,
+    &fftfilt_crcf_partitioned_h1000_n64_s,
+    &fftfilt_crcf_partitioned_h4000_n48_s,
+    &fftfilt_partitioned_reset_s,
+    &fftfilt_autotune_s,
     &filter_crosscorr_rrrf_s,
     &firdecim_config_s,
     &firdecim_block_s,
@@ -1903,6 +2287,13 @@ liquid_autotest liquid_autotest_registry[] =
     &firfilt_config_s,
     &firfilt_recreate_s,
     &firfilt_push_write_s,
+    &firfilt_crcf_block_h1_n7_s,
+    &firfilt_crcf_block_h13_n3_s,
+    &firfilt_crcf_block_h13_n64_s,
+    &firfilt_crcf_block_h63_n37_s,
+    &firfilt_crcf_block_h127_n600_s,
+    &firfilt_cccf_block_s,
+    &firfilt_rrrf_block_s,
     &firfilt_cccf_notch_0_s,
     &firfilt_cccf_notch_1_s,
     &firfilt_cccf_notch_2_s,
@@ -2040,6 +2431,13 @@ liquid_autotest liquid_autotest_registry[] =
     &msresamp2_crcf_interp_10_s,
     &msresamp2_crcf_interp_11_s,
     &msresamp2_copy_s,
+    &msresamp2_crcf_block_decim_0_s,
+    &msresamp2_crcf_block_decim_1_s,
+    &msresamp2_crcf_block_decim_4_s,
+    &msresamp2_crcf_block_decim_10_s,
+    &msresamp2_crcf_block_interp_1_s,
+    &msresamp2_crcf_block_interp_4_s,
+    &msresamp2_crcf_block_interp_10_s,
     &msresamp_crcf_01_s,
     &msresamp_crcf_02_s,
     &msresamp_crcf_03_s,
@@ -2052,6 +2450,10 @@ liquid_autotest liquid_autotest_registry[] =
     &msresamp_crcf_num_output_6_s,
     &msresamp_crcf_num_output_7_s,
     &msresamp_crcf_copy_s,
+    &msresamp_crcf_split_0_s,
+    &msresamp_crcf_split_1_s,
+    &msresamp_crcf_split_2_s,
+    &msresamp_crcf_split_3_s,
     &ordfilt_copy_s,
     &resamp2_analysis_s,
     &resamp2_synthesis_s,
@@ -2063,6 +2465,8 @@ liquid_autotest liquid_autotest_registry[] =
     &resamp2_crcf_filter_5_s,
     &resamp2_config_s,
     &resamp2_copy_s,
+    &resamp2_crcf_decim_block_s,
+    &resamp2_crcf_interp_block_s,
     &resamp_crcf_00_s,
     &resamp_crcf_01_s,
     &resamp_crcf_02_s,
@@ -2080,6 +2484,11 @@ liquid_autotest liquid_autotest_registry[] =
     &resamp_crcf_num_output_6_s,
     &resamp_crcf_num_output_7_s,
     &resamp_crcf_copy_s,
+    &resamp_crcf_block_0_s,
+    &resamp_crcf_block_1_s,
+    &resamp_crcf_block_2_s,
+    &resamp_crcf_block_3_s,
+    &resamp_crcf_scale_s,
     &liquid_rkaiser_config_s,
     &rresamp_crcf_baseline_P1_Q5_s,
     &rresamp_crcf_baseline_P2_Q5_s,
@@ -2145,6 +2554,10 @@ liquid_autotest liquid_autotest_registry[] =
     &dsssframesync_s,
     &dsssframe_config_s,
     &flexframesync_s,
+    &flexframesync_threads_0_s,
+    &flexframesync_threads_1_s,
+    &flexframesync_threads_3_s,
+    &flexframesync_threads_reentry_s,
     &flexframe_config_s,
     &framesync64_s,
     &framegen64_copy_s,
@@ -2156,6 +2569,11 @@ liquid_autotest liquid_autotest_registry[] =
     &framesync64_debug_head_s,
     &framesync64_debug_rand_s,
     &framesync64_estimation_s,
+    &framesync64bank_n1_s,
+    &framesync64bank_n2_s,
+    &framesync64bank_n7_s,
+    &framesync64bank_n16_s,
+    &framesync64bank_config_s,
     &fskframesync_s,
     &fskframe_config_s,
     &gmskframesync_process_s,
@@ -2208,7 +2626,14 @@ liquid_autotest liquid_autotest_registry[] =
     &qdetector_cccf_gmsk_n671_s,
     &qdetector_cccf_gmsk_n1024_s,
     &qdetector_cccf_gmsk_n1341_s,
+    &qdetector_cccf_cfo_p100_s,
+    &qdetector_cccf_cfo_m200_s,
+    &qdetector_cccf_cfo_p010_s,
     &qdetector_cccf_copy_s,
+    &qdetectorbank_cccf_k2_s,
+    &qdetectorbank_cccf_k4_s,
+    &qdetectorbank_cccf_add_busy_s,
+    &qdetectorbank_cccf_config_s,
     &qdsync_cccf_k2_s,
     &qdsync_cccf_k3_s,
     &qdsync_cccf_k4_s,
@@ -2380,6 +2805,7 @@ liquid_autotest liquid_autotest_registry[] =
     &smatrixb_mul_s,
     &smatrixb_mulf_s,
     &smatrixb_vmulf_s,
+    &smatrixb_get_row_s,
     &smatrixf_vmul_s,
     &smatrixf_mul_s,
     &smatrixi_vmul_s,
@@ -2413,6 +2839,9 @@ liquid_autotest liquid_autotest_registry[] =
     &cpfskmodem_bps1_h0p5_k4_m7_gmsk_s,
     &cpfskmodem_bps1_h0p5_k6_m7_gmsk_s,
     &cpfskmodem_bps1_h0p5_k8_m7_gmsk_s,
+    &cpfskmodem_block_bps1_h0p5000_k4_gmsk_s,
+    &cpfskmodem_block_bps1_h0p2500_k8_square_s,
+    &cpfskmodem_block_bps2_h0p2500_k4_square_s,
     &cpfskmodem_spectrum_s,
     &cpfskmodem_config_s,
     &freqmodem_kf_0_02_s,
@@ -2451,6 +2880,9 @@ liquid_autotest liquid_autotest_registry[] =
     &gmskmodem_k4_m3_b020_s,
     &gmskmodem_k4_m3_b033_s,
     &gmskmodem_k4_m3_b050_s,
+    &gmskmodem_block_k2_m3_b030_s,
+    &gmskmodem_block_k4_m3_b025_s,
+    &gmskmodem_block_k5_m2_b050_s,
     &gmskmod_copy_s,
     &gmskdem_copy_s,
     &mod_demod_psk2_s,
@@ -2607,6 +3039,34 @@ liquid_autotest liquid_autotest_registry[] =
     &demodsoft_arb256opt_s,
     &demodsoft_arb64vt_s,
     &demodsoft_pi4dqpsk_s,
+    &demodsoft_block_psk2_s,
+    &demodsoft_block_psk8_s,
+    &demodsoft_block_psk64_s,
+    &demodsoft_block_ask4_s,
+    &demodsoft_block_ask16_s,
+    &demodsoft_block_qam4_s,
+    &demodsoft_block_qam8_s,
+    &demodsoft_block_qam32_s,
+    &demodsoft_block_qam256_s,
+    &demodsoft_block_apsk16_s,
+    &demodsoft_block_apsk128_s,
+    &demodsoft_block_bpsk_s,
+    &demodsoft_block_qpsk_s,
+    &demodsoft_block_ook_s,
+    &demodsoft_block_sqam32_s,
+    &demodsoft_block_sqam128_s,
+    &demodsoft_block_V29_s,
+    &demodsoft_block_arb64opt_s,
+    &demodsoft_block_dpsk4_s,
+    &demodsoft_block_dpsk16_s,
+    &demodsoft_block_pi4dqpsk_s,
+    &demodsoft_block_nvar_s,
+    &demodsoft_block_dispatch_psk32_s,
+    &demodsoft_block_dispatch_psk64_s,
+    &demodsoft_block_dispatch_apsk32_s,
+    &demodsoft_block_dispatch_apsk256_s,
+    &demodsoft_block_dispatch_qam256_s,
+    &demodsoft_block_dispatch_arb64opt_s,
     &demodstats_psk2_s,
     &demodstats_psk4_s,
     &demodstats_psk8_s,
@@ -2667,6 +3127,21 @@ liquid_autotest liquid_autotest_registry[] =
     &firpfbch2_crcf_copy_s,
     &firpfbch2_crcf_config_s,
     &firpfbch_crcf_analysis_s,
+    &firpfbch_crcf_analysis_block_4_2_s,
+    &firpfbch_crcf_analysis_block_17_3_s,
+    &firpfbch_crcf_analysis_block_100_4_s,
+    &firpfbch_crcf_analysis_block_256_2_s,
+    &firpfbch_crcf_analysis_runtime_port_67_s,
+    &firpfbch_crcf_analysis_runtime_neon_67_s,
+    &firpfbch_crcf_analysis_runtime_avx2_67_s,
+    &firpfbch_crcf_analysis_runtime_neon_256_s,
+    &firpfbch_crcf_analysis_runtime_avx2_256_s,
+    &firpfbch_cccf_analysis_runtime_port_67_s,
+    &firpfbch_cccf_analysis_runtime_neon_67_s,
+    &firpfbch_cccf_analysis_runtime_avx2_67_s,
+    &firpfbch_cccf_analysis_runtime_neon_256_s,
+    &firpfbch_cccf_analysis_runtime_avx2_256_s,
+    &firpfbch_crcf_runtime_config_s,
     &firpfbch_crcf_config_s,
     &firpfbch_crcf_synthesis_s,
     &firpfbchr_crcf_s,
@@ -2675,6 +3150,16 @@ liquid_autotest liquid_autotest_registry[] =
     &ofdmframesync_acquire_n128_s,
     &ofdmframesync_acquire_n256_s,
     &ofdmframesync_acquire_n512_s,
+    &ofdmframesync_block_n64_b1_s,
+    &ofdmframesync_block_n64_b4_s,
+    &ofdmframesync_block_n64_b4c_s,
+    &ofdmframesync_block_n256_b3_s,
+    &ofdmframesync_block_n256_b8_s,
+    &ofdmframesync_block_reset_n64_b1_s,
+    &ofdmframesync_block_reset_n64_b4_s,
+    &ofdmframesync_block_reset_n64_b4c_s,
+    &ofdmframesync_block_reset_n256_b8_s,
+    &ofdmframesync_block_config_s,
     &ofdmframe_common_config_s,
     &ofdmframegen_config_s,
     &ofdmframesync_config_s,
@@ -2702,6 +3187,12 @@ liquid_autotest liquid_autotest_registry[] =
     &nco_crcf_mix_vco_7_s,
     &nco_crcf_mix_vco_8_s,
     &nco_crcf_mix_vco_9_s,
+    &nco_crcf_mix_block_nco_up_s,
+    &nco_crcf_mix_block_nco_down_s,
+    &nco_crcf_mix_block_vcoi_up_s,
+    &nco_crcf_mix_block_vcoi_down_s,
+    &nco_crcf_mix_block_vcod_up_s,
+    &nco_crcf_mix_block_vcod_down_s,
     &nco_crcf_phase_s,
     &nco_basic_s,
     &nco_mixing_s,
@@ -2856,11 +3347,19 @@ liquid_autotest liquid_autotest_registry[] =
     &rcircshift_s,
     &vectorcf_mul_16_s,
     &vectorcf_mul_35_s,
+    &vectorcf_dotprod_conj_s,
+    &vectorcf_runtime_neon_s,
+    &vectorcf_runtime_avx2_s,
+    &vectorcf_runtime_avx512_s,
     &vectorf_mul_4_s,
     &vectorf_mul_16_s,
     &vectorf_mul_35_s,
     &vectorf_mulscalar_4_s,
     &vectorf_mulscalar_35_s,
+    &vectorf_abs_s,
+    &vectorf_dotprod_conj_s,
+    &vectorf_runtime_avx2_s,
+    &vectorf_runtime_avx512_s,
     NULL
 };
 
@@ -98,6 +98,7 @@ function(liquid_print_config_summary)
     liquid_status("  LOGGING_LEVEL     :   ${LOGGING_LEVEL}")
     #liquid_status("  LIQUID_LOG_LEVEL_COMPILE  :   ${LIQUID_LOG_LEVEL_COMPILE}")
     liquid_status("  ENABLE_COLOR      :   ${ENABLE_COLOR}")
+    liquid_status("  ENABLE_COUNTERS   :   ${ENABLE_COUNTERS}")
     liquid_status("")
     liquid_status("Acceleration:")
     liquid_status("  AltiVec           : " C_ALTIVEC_FOUND THEN "Yes, flags='${C_ALTIVEC_FLAGS}'" ELSE "No")
@@ -117,7 +118,7 @@ function(liquid_print_config_summary)
     liquid_status("  AMX101            : " C_AMX101_FOUND THEN  "Yes, flags='${C_AMX101_FLAGS}'"  ELSE "No")
     liquid_status("  AMX102            : " C_AMX102_FOUND THEN  "Yes, flags='${C_AMX102_FLAGS}'"  ELSE "No")
     liquid_status("  Threads           : " Threads_FOUND THEN   "Yes" ELSE "No")
-    #liquid_status("  Pthread           : " USE_PTHREAD THEN "Yes" ELSE "No")
+    liquid_status("  Pthread           : " BUILD_PTHREADS THEN  "Yes" ELSE "No")
     #liquid_status("  TBB               : " USE_TBB AND TBB_FOUND THEN "Yes (ver. ${TBB_INTERFACE_VERSION})" ELSE "No")
     #liquid_status("  OMP               : " USE_OMP AND OMP_FOUND THEN "Yes" ELSE "No")
     liquid_status("")
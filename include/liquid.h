@@ -611,6 +611,52 @@ liquid_timer liquid_tic(void);
 // compact: destroy timer and retrieve runtime in seconds
 float liquid_toc(liquid_timer _q);
 
+
+// Performance counters: when the library is built with counters enabled
+// (ENABLE_COUNTERS), firfilt, firpfbch, fft plan, frame synchronizer,
+// qdetector and modem objects record calls, samples processed, elapsed
+// cycles and memory allocations into a global registry which can be
+// enumerated or exported. Otherwise the instrumentation compiles to
+// nothing and the registry is always empty.
+
+// counter values for a single object
+typedef struct {
+    const char *       name;    // object type, e.g. "firfilt_crcf"
+    unsigned int       id;      // unique object identifier
+    unsigned long long calls;   // number of execute calls
+    unsigned long long samples; // number of samples processed
+    unsigned long long cycles;  // elapsed cycles (rdtsc, cntvct, or ns)
+    unsigned long long allocs;  // number of memory allocations
+    unsigned long long bytes;   // number of bytes allocated
+} liquid_counter_s;
+
+// callback invoked for each registered counter
+//  _counter : counter values
+//  _context : user-defined context
+typedef int (*liquid_counters_callback)(liquid_counter_s * _counter,
+                                        void *             _context);
+
+// Return flag indicating if counters were enabled at compile time
+int liquid_counters_enabled(void);
+
+// Get number of objects currently registered
+unsigned int liquid_counters_get_num(void);
+
+// Invoke callback for each registered counter in order of creation,
+// stopping at the first non-zero return value
+int liquid_counters_foreach(liquid_counters_callback _callback,
+                            void *                   _context);
+
+// Clear values of all registered counters (allocations are retained)
+int liquid_counters_reset(void);
+
+// Print all registered counters to stdout
+int liquid_counters_print(void);
+
+// Export all registered counters to a JSON file
+//  _filename : output filename
+int liquid_counters_export_json(const char * _filename);
+
 // provide exit value based on global logging
 //int liquid_exit();
 
@@ -707,6 +753,8 @@ int AGC(_execute)(AGC() _q,                                                 \
                                                                             \
 /* Execute automatic gain control on block of samples pointed to by _x  */  \
 /* and store the result in the array of the same length _y.             */  \
+/* If the block size is greater than one (see set_block_size()), the    */  \
+/* gain is updated once per sub-block and ramped linearly across it.    */  \
 /*  _q      : automatic gain control object                             */  \
 /*  _x      : input data array, [size: _n x 1]                          */  \
 /*  _n      : number of input, output samples                           */  \
@@ -716,6 +764,21 @@ int AGC(_execute_block)(AGC()        _q,                                    \
                         unsigned int _n,                                    \
                         TC *         _y);                                   \
                                                                             \
+/* Set number of samples per gain update in execute_block(), default 1. */  \
+/* With _m > 1 the energy of each sub-block is computed with the vector */  \
+/* kernels and the _m loop updates are applied at once in the log       */  \
+/* domain, treating the output energy as constant over the sub-block.   */  \
+/* For _bt <= 0.02 and _bt*_m <= 0.2 the gain stays within 0.5 dB of    */  \
+/* the per-sample loop through level steps of up to 20 dB, and within   */  \
+/* 0.1 dB once settled.                                                 */  \
+/*  _q      : automatic gain control object                             */  \
+/*  _m      : samples per gain update, _m > 0                           */  \
+int AGC(_set_block_size)(AGC()        _q,                                   \
+                         unsigned int _m);                                  \
+                                                                            \
+/* Get number of samples per gain update in execute_block()             */  \
+unsigned int AGC(_get_block_size)(AGC() _q);                                \
+                                                                            \
 /* Lock agc object. When locked, the agc object still makes an estimate */  \
 /* of the signal level, but the gain setting is fixed and does not      */  \
 /* change.                                                              */  \
@@ -878,6 +941,22 @@ int cvsd_decode8(cvsd          _q,
 // MODULE : buffer
 //
 
+// Mirrored memory: window, cbuffer and wdelay objects can keep their
+// samples in a ring whose pages are mapped twice back-to-back in virtual
+// memory, so that any span of the ring can be read in place without
+// copying. This requires memfd_create() and mmap() (Linux).
+
+// Return flag indicating if mirrored memory is supported on this platform
+int liquid_mirror_is_available(void);
+
+// Set whether window, cbuffer and wdelay objects (including those created
+// internally by other objects) use mirrored memory by default
+//  _enable : use mirrored memory for new objects (1) or not (0)
+int liquid_mirror_set_default(int _enable);
+
+// Get whether new window, cbuffer and wdelay objects use mirrored memory
+int liquid_mirror_get_default(void);
+
 // circular buffer
 #define LIQUID_CBUFFER_MANGLE_FLOAT(name)  LIQUID_CONCAT(cbufferf,  name)
 #define LIQUID_CBUFFER_MANGLE_CFLOAT(name) LIQUID_CONCAT(cbuffercf, name)
@@ -903,6 +982,13 @@ CBUFFER() CBUFFER(_create)(unsigned int _max_size);                         \
 CBUFFER() CBUFFER(_create_max)(unsigned int _max_size,                      \
                                unsigned int _max_read);                     \
                                                                             \
+/* Create circular buffer object of a particular maximum storage length */  \
+/* using mirrored memory; any number of elements up to _max_size may be */  \
+/* read at once without copying. If mirrored memory is not available    */  \
+/* the object is created with regular memory.                           */  \
+/*  _max_size  : maximum buffer size, _max_size > 0                     */  \
+CBUFFER() CBUFFER(_create_mirrored)(unsigned int _max_size);                \
+                                                                            \
 /* Copy object including all internal objects and state                 */  \
 CBUFFER() CBUFFER(_copy)(CBUFFER() _q);                                     \
                                                                             \
@@ -971,6 +1057,9 @@ int CBUFFER(_read)(CBUFFER()      _q,                                       \
 /*  _n : number of elements to release                                  */  \
 int CBUFFER(_release)(CBUFFER()    _q,                                      \
                       unsigned int _n);                                     \
+                                                                            \
+/* Return flag indicating if the buffer uses mirrored memory            */  \
+int CBUFFER(_is_mirrored)(CBUFFER() _q);                                    \
 
 // Define buffer APIs
 LIQUID_CBUFFER_DEFINE_API(LIQUID_CBUFFER_MANGLE_FLOAT,  float)
@@ -995,6 +1084,12 @@ typedef struct WINDOW(_s) * WINDOW();                                       \
 /*  _n      : length of the window buffer [samples]                     */  \
 WINDOW() WINDOW(_create)(unsigned int _n);                                  \
                                                                             \
+/* Create window buffer object of a fixed length using mirrored memory. */  \
+/* Pushing samples never copies the window contents. If mirrored memory */  \
+/* is not available the object is created with regular memory.          */  \
+/*  _n      : length of the window buffer [samples]                     */  \
+WINDOW() WINDOW(_create_mirrored)(unsigned int _n);                         \
+                                                                            \
 /* Recreate window buffer object with new length.                       */  \
 /* This extends an existing window's size, similar to the standard C    */  \
 /* library's realloc() to n samples.                                    */  \
@@ -1064,6 +1159,9 @@ int WINDOW(_push)(WINDOW() _q,                                              \
 int WINDOW(_write)(WINDOW()     _q,                                         \
                    T *          _v,                                         \
                    unsigned int _n);                                        \
+                                                                            \
+/* Return flag indicating if the window uses mirrored memory            */  \
+int WINDOW(_is_mirrored)(WINDOW() _q);                                      \
 
 // Define window APIs
 LIQUID_WINDOW_DEFINE_API(LIQUID_WINDOW_MANGLE_FLOAT,  float)
@@ -1090,6 +1188,13 @@ typedef struct WDELAY(_s) * WDELAY();                                       \
 /*  _delay  :   number of samples of delay in the wdelay object         */  \
 WDELAY() WDELAY(_create)(unsigned int _delay);                              \
                                                                             \
+/* Create delay buffer object using mirrored memory, allowing blocks of */  \
+/* samples to be delayed without per-sample index wrapping. If          */  \
+/* mirrored memory is not available the object is created with regular  */  \
+/* memory.                                                              */  \
+/*  _delay  :   number of samples of delay in the wdelay object         */  \
+WDELAY() WDELAY(_create_mirrored)(unsigned int _delay);                     \
+                                                                            \
 /* Copy object including all internal objects and state                 */  \
 WDELAY() WDELAY(_copy)(WDELAY() _q);                                        \
                                                                             \
@@ -1121,6 +1226,20 @@ int WDELAY(_read)(WDELAY() _q,                                              \
 /*  _v  :   new value to be added to buffer                             */  \
 int WDELAY(_push)(WDELAY() _q,                                              \
                   T        _v);                                             \
+                                                                            \
+/* Push a block of samples into the delay buffer and read the delayed   */  \
+/* samples out; equivalent to pushing and then reading each sample      */  \
+/*  _q  :   delay buffer object                                         */  \
+/*  _x  :   input array, [size: _n x 1]                                 */  \
+/*  _n  :   number of samples                                           */  \
+/*  _y  :   output array, [size: _n x 1]                                */  \
+int WDELAY(_execute_block)(WDELAY()     _q,                                 \
+                           T *          _x,                                 \
+                           unsigned int _n,                                 \
+                           T *          _y);                                \
+                                                                            \
+/* Return flag indicating if the delay buffer uses mirrored memory      */  \
+int WDELAY(_is_mirrored)(WDELAY() _q);                                      \
 
 // Define wdelay APIs
 LIQUID_WDELAY_DEFINE_API(LIQUID_WDELAY_MANGLE_FLOAT,  float)
@@ -1393,6 +1512,19 @@ int DOTPROD(_runtime_select)(DOTPROD()        _q,                           \
 int DOTPROD(_execute)(DOTPROD() _q,                                         \
                       TI *      _x,                                         \
                       TO *      _y);                                        \
+                                                                            \
+/* Execute dot product on a block of sliding input windows, computing   */  \
+/* _y[k] = dotprod(_x[k], ..., _x[k+n-1]) for each k in [0,_n); this is */  \
+/* equivalent to invoking execute() _n times but allows the SIMD        */  \
+/* kernels to reuse each coefficient load across several outputs        */  \
+/*  _q      : dotprod object                                            */  \
+/*  _x      : input array, [size: _n+n-1 x 1]                           */  \
+/*  _n      : number of output samples                                  */  \
+/*  _y      : output array, [size: _n x 1]                              */  \
+int DOTPROD(_execute_block)(DOTPROD()    _q,                                \
+                            TI *         _x,                                \
+                            unsigned int _n,                                \
+                            TO *         _y);                               \
 
 LIQUID_DOTPROD_DEFINE_API(LIQUID_DOTPROD_MANGLE_RRRF,
                           float,
@@ -1747,9 +1879,20 @@ int crc_check_key(crc_scheme      _scheme,
 // get size of key (bytes)
 unsigned int crc_sizeof_key(crc_scheme _scheme);
 
+// Select runtime execution method for CRC key generation: carry-less
+// multiply folding (CRC-24 and CRC-32) or portable slicing tables. This is
+// set automatically on first use; however pulling this to a public method
+// allows the user to override automatic selection and simplifies internal
+// testing.
+//  _select : runtime preference
+int crc_runtime_select(liquid_runtime_t _select);
+
+// Detect and select the best available runtime execution method
+int crc_runtime_detect(void);
+
 
 // available FEC schemes
-#define LIQUID_FEC_NUM_SCHEMES  28
+#define LIQUID_FEC_NUM_SCHEMES  31
 typedef enum {
     LIQUID_FEC_UNKNOWN=0,       // unknown/unsupported scheme
     LIQUID_FEC_NONE,            // no error-correction
@@ -1786,7 +1929,12 @@ typedef enum {
     LIQUID_FEC_CONV_V29P78,     // r7/8, K=9, dfree=4
 
     // Reed-Solomon codes
-    LIQUID_FEC_RS_M8            // m=8, n=255, k=223
+    LIQUID_FEC_RS_M8,           // m=8, n=255, k=223
+
+    // quasi-cyclic low-density parity check codes
+    LIQUID_FEC_LDPC_R12_K1024,  // r1/2, n=2048, k=1024
+    LIQUID_FEC_LDPC_R12_K4096,  // r1/2, n=8192, k=4096
+    LIQUID_FEC_LDPC_R34_K3072   // r3/4, n=4096, k=3072
 } fec_scheme;
 
 // pretty names for fec schemes
@@ -2090,6 +2238,33 @@ FFT(plan) FFT(_create_plan)(unsigned int _n,                                \
                             int          _dir,                              \
                             int          _flags);                           \
                                                                             \
+/* Create plan for a batch of complex one-dimensional transforms of     */  \
+/* equal length, executed together with a single call to execute().     */  \
+/* Sample k of transform t is read from _x[t*_idist + k*_istride] and   */  \
+/* written to _y[t*_odist + k*_ostride]. Short radix-2 transforms are   */  \
+/* computed several at a time with samples interleaved across vector    */  \
+/* lanes.                                                               */  \
+/*  _n      :   transform size                                          */  \
+/*  _howmany:   number of transforms                                    */  \
+/*  _x      :   pointer to input array                                  */  \
+/*  _istride:   distance between input samples within a transform       */  \
+/*  _idist  :   distance between first samples of consecutive inputs    */  \
+/*  _y      :   pointer to output array                                 */  \
+/*  _ostride:   distance between output samples within a transform      */  \
+/*  _odist  :   distance between first samples of consecutive outputs   */  \
+/*  _dir    :   direction (e.g. LIQUID_FFT_FORWARD)                     */  \
+/*  _flags  :   options, optimization                                   */  \
+FFT(plan) FFT(_create_plan_many)(unsigned int _n,                           \
+                                 unsigned int _howmany,                     \
+                                 TC *         _x,                           \
+                                 unsigned int _istride,                     \
+                                 unsigned int _idist,                       \
+                                 TC *         _y,                           \
+                                 unsigned int _ostride,                     \
+                                 unsigned int _odist,                       \
+                                 int          _dir,                         \
+                                 int          _flags);                      \
+                                                                            \
 /* Create real-to-real one-dimensional transform                        */  \
 /*  _n      :   transform size                                          */  \
 /*  _x      :   pointer to input array,  [size: _n x 1]                 */  \
@@ -2143,6 +2318,16 @@ int FFT(_r2r_1d_run)(unsigned int _n,                                       \
 /*  _n      : input array size                                          */  \
 int FFT(_shift)(TC *         _x,                                            \
                 unsigned int _n);                                           \
+                                                                            \
+/* Select runtime execution method for the vectorized radix-4 kernels   */  \
+/* used by plans created hereafter. This is set automatically on first  */  \
+/* use; however pulling this to a public method allows the user to      */  \
+/* override automatic selection and simplifies internal testing.        */  \
+/*  _select : runtime preference                                        */  \
+int FFT(_runtime_select)(liquid_runtime_t _select);                         \
+                                                                            \
+/* Detect and select the best available runtime execution method        */  \
+int FFT(_runtime_detect)(void);                                             \
 
 
 LIQUID_FFT_DEFINE_API(LIQUID_FFT_MANGLE_FLOAT,float,liquid_float_complex)
@@ -2237,6 +2422,18 @@ int SPGRAM(_set_alpha)(SPGRAM() _q,                                         \
 /* squared magnitude outputs.                                           */  \
 float SPGRAM(_get_alpha)(SPGRAM() _q);                                      \
                                                                             \
+/* Set number of threads used to compute transforms when writing        */  \
+/* blocks of samples. Each thread runs its own transform on a share of  */  \
+/* the overlapping segments, and the periodograms are accumulated in    */  \
+/* segment order so the result is identical to serial processing.       */  \
+/*  _q           : spectral periodogram object                          */  \
+/*  _num_threads : number of threads, 1 for serial processing (default) */  \
+int SPGRAM(_set_num_threads)(SPGRAM()     _q,                               \
+                             unsigned int _num_threads);                    \
+                                                                            \
+/* Get number of threads used to compute transforms                     */  \
+unsigned int SPGRAM(_get_num_threads)(SPGRAM() _q);                         \
+                                                                            \
 /* Set the center frequency of the received signal.                     */  \
 /* This is for display purposes only when generating the output image.  */  \
 /*  _q      : spectral periodogram object                               */  \
@@ -2530,6 +2727,17 @@ int SPWATERFALL(_set_dims)(SPWATERFALL() _q,                                \
 int SPWATERFALL(_set_commands)(SPWATERFALL() _q,                            \
                                const char *  _commands);                    \
                                                                             \
+/* Set number of threads used by the internal periodogram to compute    */  \
+/* transforms when writing blocks of samples; the output is identical   */  \
+/* to serial processing.                                                */  \
+/*  _q           : spectral periodogram waterfall object                */  \
+/*  _num_threads : number of threads, 1 for serial processing (default) */  \
+int SPWATERFALL(_set_num_threads)(SPWATERFALL() _q,                         \
+                                  unsigned int  _num_threads);              \
+                                                                            \
+/* Get number of threads used by the internal periodogram               */  \
+unsigned int SPWATERFALL(_get_num_threads)(SPWATERFALL() _q);               \
+                                                                            \
 /* Push a single sample into the object, executing internal transform   */  \
 /* as necessary.                                                        */  \
 /*  _q  : spwaterfall object                                            */  \
@@ -3820,6 +4028,33 @@ FFTFILT() FFTFILT(_create)(TC *         _h,                                 \
                            unsigned int _h_len,                             \
                            unsigned int _n);                                \
                                                                             \
+/* Create FFT-based FIR filter using uniformly partitioned convolution. */  \
+/* The filter is split into partitions of _n taps whose spectra are     */  \
+/* applied to a frequency-domain delay line of past input blocks, so    */  \
+/* the latency is _n samples for any filter length.                     */  \
+/*  _h      : filter coefficients, [size: _h_len x 1]                   */  \
+/*  _h_len  : filter length, _h_len > 0                                 */  \
+/*  _n      : block size = nfft/2 = partition length, _n > 0            */  \
+FFTFILT() FFTFILT(_create_partitioned)(TC *         _h,                     \
+                                       unsigned int _h_len,                 \
+                                       unsigned int _n);                    \
+                                                                            \
+/* Create FFT-based FIR filter, selecting the block size with the       */  \
+/* highest throughput on this host. Candidate block sizes are timed on  */  \
+/* first use for a given filter length and the winner is cached for the */  \
+/* lifetime of the process. Use get_block_size() to retrieve the        */  \
+/* selected block size.                                                 */  \
+/*  _h          : filter coefficients, [size: _h_len x 1]               */  \
+/*  _h_len      : filter length, _h_len > 0                             */  \
+/*  _max_block  : maximum block size (latency), 0 for no limit          */  \
+FFTFILT() FFTFILT(_create_autotune)(TC *         _h,                        \
+                                    unsigned int _h_len,                    \
+                                    unsigned int _max_block);               \
+                                                                            \
+/* Estimate filter length above which fftfilt is faster than firfilt on */  \
+/* this host; measured on first call and cached                         */  \
+unsigned int FFTFILT(_autotune_crossover)(void);                            \
+                                                                            \
 /* Copy object including all internal objects and state                 */  \
 FFTFILT() FFTFILT(_copy)(FFTFILT() _q);                                     \
                                                                             \
@@ -3852,6 +4087,12 @@ int FFTFILT(_execute)(FFTFILT() _q,                                         \
                                                                             \
 /* Get length of filter object's internal coefficients                  */  \
 unsigned int FFTFILT(_get_length)(FFTFILT() _q);                            \
+                                                                            \
+/* Get block size (samples consumed and produced per execute call)      */  \
+unsigned int FFTFILT(_get_block_size)(FFTFILT() _q);                        \
+                                                                            \
+/* Get number of uniform filter partitions                              */  \
+unsigned int FFTFILT(_get_num_partitions)(FFTFILT() _q);                    \
 
 LIQUID_FFTFILT_DEFINE_API(LIQUID_FFTFILT_MANGLE_RRRF,
                           float,
@@ -4855,6 +5096,26 @@ int RESAMP2(_decim_execute)(RESAMP2() _q,                                   \
 int RESAMP2(_interp_execute)(RESAMP2() _q,                                  \
                              TI        _x,                                  \
                              TO *      _y);                                 \
+                                                                            \
+/* Execute resampler as half-band decimator on a block of samples       */  \
+/*  _q  : resampler object                                              */  \
+/*  _x  : input array, [size: 2*_n x 1]                                 */  \
+/*  _n  : number of output samples                                      */  \
+/*  _y  : output array, [size: _n x 1]                                  */  \
+int RESAMP2(_decim_execute_block)(RESAMP2()    _q,                          \
+                                  TI *         _x,                          \
+                                  unsigned int _n,                          \
+                                  TO *         _y);                         \
+                                                                            \
+/* Execute resampler as half-band interpolator on a block of samples    */  \
+/*  _q  : resampler object                                              */  \
+/*  _x  : input array, [size: _n x 1]                                   */  \
+/*  _n  : number of *input* samples                                     */  \
+/*  _y  : output array, [size: 2*_n x 1]                                */  \
+int RESAMP2(_interp_execute_block)(RESAMP2()    _q,                         \
+                                   TI *         _x,                         \
+                                   unsigned int _n,                         \
+                                   TO *         _y);                        \
 
 LIQUID_RESAMP2_DEFINE_API(LIQUID_RESAMP2_MANGLE_RRRF,
                           float,
@@ -5264,6 +5525,19 @@ float MSRESAMP2(_get_delay)(MSRESAMP2() _q);                                \
 int MSRESAMP2(_execute)(MSRESAMP2() _q,                                     \
                         TI *        _x,                                     \
                         TO *        _y);                                    \
+                                                                            \
+/* Execute multi-stage resampler _n times on a block of samples,        */  \
+/* running each half-band stage across the block before the next one    */  \
+/*  LIQUID_RESAMP_INTERP:   input: _n,    output: _n*M                  */  \
+/*  LIQUID_RESAMP_DECIM:    input: _n*M,  output: _n                    */  \
+/*  _q      : msresamp object                                           */  \
+/*  _x      : input sample array                                        */  \
+/*  _n      : number of executions                                      */  \
+/*  _y      : output sample array                                       */  \
+int MSRESAMP2(_execute_block)(MSRESAMP2()  _q,                              \
+                              TI *         _x,                              \
+                              unsigned int _n,                              \
+                              TO *         _y);                             \
 
 LIQUID_MSRESAMP2_DEFINE_API(LIQUID_MSRESAMP2_MANGLE_RRRF,
                             float,
@@ -6169,6 +6443,65 @@ int framesync64_set_csma_callbacks(framesync64             _q,
                                    void *                  _csma_userdata);
 #endif
 
+// Multi-stream frame synchronizer: receives framesync64 frames on many
+// independent streams (e.g. channelizer outputs) stepped in lockstep.
+// Input buffering, signal level tracking and the forward transforms of
+// the frame detector are computed across all streams at once; a stream
+// falls back to its own synchronizer only while aligning to and
+// decoding a detected frame.
+typedef struct framesync64bank_s * framesync64bank;
+
+// Create multi-stream frame synchronizer
+//  _num_streams:   number of streams, _num_streams > 0
+//  _callback   :   callback function invoked for every stream
+//  _userdata   :   user data pointer passed to callback for every stream
+framesync64bank framesync64bank_create(unsigned int       _num_streams,
+                                       framesync_callback _callback,
+                                       void *             _userdata);
+
+// Destroy multi-stream frame synchronizer, freeing all internal memory
+int framesync64bank_destroy(framesync64bank _q);
+
+// Print multi-stream frame synchronizer internal properties
+int framesync64bank_print(framesync64bank _q);
+
+// Reset multi-stream frame synchronizer internal state for all streams
+int framesync64bank_reset(framesync64bank _q);
+
+// Get number of streams
+unsigned int framesync64bank_get_num_streams(framesync64bank _q);
+
+// Set the user-defined data field passed to callback for a single stream
+//  _q      :   multi-stream frame synchronizer object
+//  _stream :   stream index, _stream < num_streams
+//  _userdata:  user data pointer passed to callback
+int framesync64bank_set_userdata(framesync64bank _q,
+                                 unsigned int    _stream,
+                                 void *          _userdata);
+
+// Push samples from all streams through frame synchronizer. Samples are
+// interleaved across streams such that sample _i of stream _s is at
+// _x[_i*num_streams + _s].
+//  _q      :   multi-stream frame synchronizer object
+//  _x      :   input samples, [size: _n x num_streams]
+//  _n      :   number of input samples per stream
+int framesync64bank_execute(framesync64bank        _q,
+                            liquid_float_complex * _x,
+                            unsigned int           _n);
+
+// Set frame detection threshold for all streams
+int framesync64bank_set_threshold(framesync64bank _q, float _threshold);
+
+// Set carrier frequency offset detection range for all streams
+int framesync64bank_set_range(framesync64bank _q, float _range);
+
+// Reset frame data statistics for all streams
+int framesync64bank_reset_framedatastats(framesync64bank _q);
+
+// Get frame data statistics for a single stream
+framedatastats_s framesync64bank_get_framedatastats(framesync64bank _q,
+                                                    unsigned int    _stream);
+
 //
 // Flexible frame : adjustable payload, mod scheme, etc.,
 //
@@ -6249,7 +6582,8 @@ typedef struct flexframesync_s * flexframesync;
 flexframesync flexframesync_create(framesync_callback _callback,
                                    void *             _userdata);
 
-// destroy frame synchronizer
+// destroy frame synchronizer, delivering any queued frames first; must
+// not be called from within the callback
 int flexframesync_destroy(flexframesync _q);
 
 // print frame synchronizer internal properties
@@ -6277,6 +6611,27 @@ int flexframesync_decode_payload_soft(flexframesync _q,
 int flexframesync_set_header_props(flexframesync          _q,
                                    flexframegenprops_s * _props);
 
+// Set number of background threads used to decode payloads. With zero
+// threads (default) each payload is decoded and the callback invoked
+// within flexframesync_execute(). Otherwise received payload symbols are
+// queued to the background threads so that sample processing is not
+// stalled by decoding; callbacks are invoked from those threads, one at a
+// time and in the order frames were received. The callback must not call
+// flexframesync_set_num_threads(), flexframesync_flush(), or
+// flexframesync_destroy() on its own synchronizer; these wait for the
+// callback to return and fail with LIQUID_EICONFIG instead. Any state
+// shared between the callback and the caller (including the userdata it
+// points to) should only be changed after flexframesync_flush().
+//  _q           :   frame synchronizer object
+//  _num_threads :   number of decoding threads
+int flexframesync_set_num_threads(flexframesync _q,
+                                  unsigned int  _num_threads);
+
+// Wait for all queued frames to be decoded and their callbacks invoked;
+// frame data statistics are only current after flushing. Must not be
+// called from within the callback.
+int flexframesync_flush(flexframesync _q);
+
 // push samples through frame synchronizer
 //  _q      :   frame synchronizer object
 //  _x      :   input samples, [size: _n x 1]
@@ -7265,6 +7620,66 @@ LIQUID_QDSYNC_DEFINE_API(LIQUID_QDSYNC_MANGLE_CCCF,
                          liquid_float_complex,
                          liquid_float_complex)
 
+//
+// qdetectorbank
+//
+#define LIQUID_QDETECTORBANK_MANGLE_CCCF(name) LIQUID_CONCAT(qdetectorbank_cccf,name)
+
+#define LIQUID_QDETECTORBANK_DEFINE_API(QDETECTORBANK,QDSYNC,TI)            \
+                                                                            \
+/* Detector bank: runs several qdsync frame synchronizers on a common   */  \
+/* input stream, taking the forward transform of each input block once  */  \
+/* and correlating it against the preamble template of every registered */  \
+/* synchronizer that is searching for a frame. A synchronizer that      */  \
+/* detects its frame receives subsequent samples directly until its     */  \
+/* callback resets it. The detectors of registered synchronizers are    */  \
+/* rebuilt to share the largest transform size.                         */  \
+typedef struct QDETECTORBANK(_s) * QDETECTORBANK();                         \
+                                                                            \
+/* Create empty detector bank                                           */  \
+QDETECTORBANK() QDETECTORBANK(_create)(void);                               \
+                                                                            \
+/* Destroy detector bank; registered synchronizers are not destroyed    */  \
+int QDETECTORBANK(_destroy)(QDETECTORBANK() _q);                            \
+                                                                            \
+/* Print detector bank object information to stdout                     */  \
+int QDETECTORBANK(_print)(QDETECTORBANK() _q);                              \
+                                                                            \
+/* Reset detector bank and all registered synchronizers                 */  \
+int QDETECTORBANK(_reset)(QDETECTORBANK() _q);                              \
+                                                                            \
+/* Register synchronizer with detector bank; the synchronizer must stay */  \
+/* valid for the lifetime of the bank and should no longer be executed  */  \
+/* on its own. If its preamble needs a larger transform, the shared     */  \
+/* input buffer is cleared and searching detectors are rebuilt; other   */  \
+/* registered synchronizers are not reset, and any aligning to or       */  \
+/* receiving a frame keep their detector until the frame completes.     */  \
+/*  _q      : detector bank object                                      */  \
+/*  _sync   : frame synchronizer                                        */  \
+int QDETECTORBANK(_add)(QDETECTORBANK() _q,                                 \
+                        QDSYNC()        _sync);                             \
+                                                                            \
+/* Get number of registered synchronizers                               */  \
+unsigned int QDETECTORBANK(_get_num_syncs)(QDETECTORBANK() _q);             \
+                                                                            \
+/* Get shared transform size                                            */  \
+unsigned int QDETECTORBANK(_get_buf_len)(QDETECTORBANK() _q);               \
+                                                                            \
+/* Get number of shared transforms taken since last reset               */  \
+unsigned int QDETECTORBANK(_get_num_transforms)(QDETECTORBANK() _q);        \
+                                                                            \
+/* Execute detector bank on block of samples                            */  \
+/*  _q      : detector bank object                                      */  \
+/*  _buf    : input samples, [size: _buf_len x 1]                       */  \
+/*  _buf_len: number of input samples                                   */  \
+int QDETECTORBANK(_execute)(QDETECTORBANK() _q,                             \
+                            TI *            _buf,                           \
+                            unsigned int    _buf_len);                      \
+
+LIQUID_QDETECTORBANK_DEFINE_API(LIQUID_QDETECTORBANK_MANGLE_CCCF,
+                                LIQUID_QDSYNC_MANGLE_CCCF,
+                                liquid_float_complex)
+
 //
 // Pre-demodulation detector
 //
@@ -8669,6 +9084,17 @@ T SMATRIX(_get)(SMATRIX()    _q,                                            \
                 unsigned int _m,                                            \
                 unsigned int _n);                                           \
                                                                             \
+/* Get column indices of all non-zero elements in a row, in the order   */  \
+/* they are stored                                                      */  \
+/*  _q     : sparse matrix object                                       */  \
+/*  _m     : row index                                                  */  \
+/*  _cols  : column indices (ignored if NULL), [size: _num x 1]         */  \
+/*  _num   : number of non-zero elements in row                         */  \
+int SMATRIX(_get_row)(SMATRIX()      _q,                                    \
+                      unsigned int   _m,                                    \
+                      unsigned int * _cols,                                 \
+                      unsigned int * _num);                                 \
+                                                                            \
 /* Initialize to identity matrix; set all diagonal elements to 1, all   */  \
 /* others to 0. This is done with both square and non-square matrices.  */  \
 int SMATRIX(_eye)(SMATRIX() _q);                                            \
@@ -8944,6 +9370,38 @@ int MODEM(_demodulate_soft)(MODEM()         _q,                             \
                             unsigned int  * _s,                             \
                             unsigned char * _soft_bits);                    \
                                                                             \
+/* Demodulate a block of input samples and provide soft bits for each.  */  \
+/* Symbols are processed in batches with exact max-log metrics, using   */  \
+/* independent per-axis searches for QAM and ASK and an exhaustive      */  \
+/* search otherwise; differential schemes are demodulated sequentially. */  \
+/* Following this call the demodulator EVM is the rms error over block. */  \
+/*  _q          : modem object                                          */  \
+/*  _x          : input samples, [size: _n x 1]                         */  \
+/*  _n          : number of input samples                               */  \
+/*  _syms       : output hard symbols (ignored if NULL), [size: _n x 1] */  \
+/*  _soft_bits  : output soft bits, [size: _n*log2(M) x 1]              */  \
+int MODEM(_demodulate_soft_block)(MODEM()         _q,                       \
+                                  TC *            _x,                       \
+                                  unsigned int    _n,                       \
+                                  unsigned int *  _syms,                    \
+                                  unsigned char * _soft_bits);              \
+                                                                            \
+/* Demodulate a block of input samples and provide floating-point log-  */  \
+/* likelihood ratios for each bit, positive values favoring a '1'. The  */  \
+/* max-log metric is divided by each sample's noise variance.           */  \
+/*  _q      : modem object                                              */  \
+/*  _x      : input samples, [size: _n x 1]                             */  \
+/*  _n      : number of input samples                                   */  \
+/*  _nvar   : noise variance per sample (unity if NULL), [size: _n x 1] */  \
+/*  _syms   : output hard symbols (ignored if NULL), [size: _n x 1]     */  \
+/*  _llr    : output log-likelihood ratios, [size: _n*log2(M) x 1]      */  \
+int MODEM(_demodulate_llr_block)(MODEM()        _q,                         \
+                                 TC *           _x,                         \
+                                 unsigned int   _n,                         \
+                                 float *        _nvar,                      \
+                                 unsigned int * _syms,                      \
+                                 float *        _llr);                      \
+                                                                            \
 /* Get demodulator's estimated transmit sample                          */  \
 int MODEM(_get_demodulator_sample)(MODEM() _q,                              \
                                    TC *    _x_hat);                         \
@@ -9028,6 +9486,28 @@ int gmskdem_demodulate(gmskdem                _q,
                        liquid_float_complex * _y,
                        unsigned int *         _sym);
 
+// demodulate block of symbols, assuming perfect symbol timing
+//  _q      : gmskdem object
+//  _x      : input sample buffer, [size: _k*_n x 1]
+//  _n      : number of symbols to demodulate
+//  _syms   : output symbols, [size: _n x 1]
+int gmskdem_demodulate_block(gmskdem                _q,
+                             liquid_float_complex * _x,
+                             unsigned int           _n,
+                             unsigned int *         _syms);
+
+// demodulate block of symbols to soft bits, assuming perfect symbol
+// timing; output is compatible with soft-decision decoding methods, e.g.
+// packetizer_decode_soft()
+//  _q          : gmskdem object
+//  _x          : input sample buffer, [size: _k*_n x 1]
+//  _n          : number of symbols to demodulate
+//  _soft_bits  : output soft bits, [size: _n x 1]
+int gmskdem_demodulate_soft_block(gmskdem                _q,
+                                  liquid_float_complex * _x,
+                                  unsigned int           _n,
+                                  unsigned char *        _soft_bits);
+
 //
 // continuous phase frequency-shift keying (CP-FSK) modems
 //
@@ -9189,7 +9669,16 @@ int CPFSKDEM(_get_type)(CPFSKDEM() _q);                                     \
 unsigned int CPFSKDEM(_demodulate)(CPFSKDEM() _q,                           \
                                    TC *       _y);                          \
                                                                             \
-/* demodulate_block */                                                      \
+/* demodulate block of symbols, assuming perfect timing                 */  \
+/*  _q      :   continuous-phase frequency demodulator object           */  \
+/*  _y      :   input sample array, [size: _k*_n x 1]                   */  \
+/*  _n      :   number of symbols to demodulate                         */  \
+/*  _syms   :   output symbol array, [size: _n x 1]                     */  \
+int CPFSKDEM(_demodulate_block)(CPFSKDEM()     _q,                          \
+                                TC *           _y,                          \
+                                unsigned int   _n,                          \
+                                unsigned int * _syms);                      \
+                                                                            \
 
 // define cpfskmod APIs
 LIQUID_CPFSKDEM_DEFINE_API(LIQUID_CPFSKDEM_MANGLE_FLOAT,float,liquid_float_complex)
@@ -9507,6 +9996,15 @@ int FIRPFBCH(_reset)(FIRPFBCH() _q);                                        \
 /* Print firpfbch internal parameters to stdout                         */  \
 int FIRPFBCH(_print)(FIRPFBCH() _q);                                        \
                                                                             \
+/* Select runtime execution method for the analyzer filter matrix.      */  \
+/* This is set automatically during object creation; however pulling    */  \
+/* this to a public method allows the user to override automatic        */  \
+/* selection and simplifies internal testing.                           */  \
+/*  _q      : filterbank channelizer object                             */  \
+/*  _select : runtime preference                                        */  \
+int FIRPFBCH(_runtime_select)(FIRPFBCH()       _q,                          \
+                              liquid_runtime_t _select);                    \
+                                                                            \
 /* Execute filterbank as synthesizer on block of samples                */  \
 /*  _q      : filterbank channelizer object                             */  \
 /*  _x      : channelized input, [size: num_channels x 1]               */  \
@@ -9522,6 +10020,20 @@ int FIRPFBCH(_synthesizer_execute)(FIRPFBCH() _q,                           \
 int FIRPFBCH(_analyzer_execute)(FIRPFBCH() _q,                              \
                                 TI *       _x,                              \
                                 TO *       _y);                             \
+                                                                            \
+/* Execute filterbank as analyzer on a batch of blocks of samples. The  */  \
+/* filter bank is stored as a channel-interleaved matrix so that all    */  \
+/* channels of all blocks are filtered together before each transform,  */  \
+/* equivalent to invoking analyzer_execute() on each block in turn.     */  \
+/*  _q      : filterbank channelizer object                             */  \
+/*  _x      : input time series, [size: _K*num_channels x 1]            */  \
+/*  _K      : number of blocks                                          */  \
+/*  _y      : channelized output, [size: _K*num_channels x 1]; must not */  \
+/*            overlap the input                                         */  \
+int FIRPFBCH(_analyzer_execute_block)(FIRPFBCH()   _q,                      \
+                                      TI *         _x,                      \
+                                      unsigned int _K,                      \
+                                      TO *         _y);                     \
 
 
 LIQUID_FIRPFBCH_DEFINE_API(LIQUID_FIRPFBCH_MANGLE_CRCF,
@@ -9816,6 +10328,20 @@ int ofdmframesync_execute(ofdmframesync _q,
                           liquid_float_complex * _x,
                           unsigned int _n);
 
+// Set number of payload symbols transformed and recovered as a block.
+// Symbols completed within a single call to execute() are buffered and
+// run through one batched transform before equalization; a partial block
+// is recovered at the end of each call, so no symbols are held between
+// calls. Carrier frequency corrections from the pilots take effect on
+// the samples following each block. Default is 1.
+//  _q          :   synchronizer object
+//  _block_size :   number of symbols per block, _block_size > 0
+int ofdmframesync_set_block_size(ofdmframesync _q,
+                                 unsigned int  _block_size);
+
+// Get number of payload symbols transformed and recovered as a block
+unsigned int ofdmframesync_get_block_size(ofdmframesync _q);
+
 // Get received signal strength indication (RSSI)
 float ofdmframesync_get_rssi(ofdmframesync _q);
 
@@ -11064,10 +11590,39 @@ TP VECTOR(_pnorm)(T *          _x,                                          \
                   unsigned int _n,                                          \
                   TP           _p);                                         \
                                                                             \
+/* Compute conjugate dot product: sum{ conj(x[i]) * y[i] }              */  \
+T VECTOR(_dotprod_conj)(T *          _x,                                    \
+                        T *          _y,                                    \
+                        unsigned int _n);                                   \
+                                                                            \
+/* Update array in place, w[i] += a * u[i], and compute conjugate dot   */  \
+/* product of result with second array: sum{ conj(w[i]) * v[i] }        */  \
+/*  _w  : input/output array, [size: _n x 1]                            */  \
+/*  _n  : array length                                                  */  \
+/*  _a  : scalar                                                        */  \
+/*  _u  : update array, [size: _n x 1]                                  */  \
+/*  _v  : second array for dot product, [size: _n x 1]                  */  \
+T VECTOR(_axpy_dotprod_conj)(T *          _w,                               \
+                             unsigned int _n,                               \
+                             T            _a,                               \
+                             T *          _u,                               \
+                             T *          _v);                              \
+                                                                            \
 /* Scale vector elements by l-2 norm: y[i] = x[i]/norm(x)               */  \
 void VECTOR(_normalize)(T *          _x,                                    \
                         unsigned int _n,                                    \
                         T *          _y);                                   \
+                                                                            \
+/* Select runtime execution method for all vector operations of this    */  \
+/* type. This is set automatically on first use; however pulling this   */  \
+/* to a public method allows the user to override automatic selection   */  \
+/* and simplifies internal testing. The selection is process-wide and   */  \
+/* applies atomically to subsequent calls on all threads.               */  \
+/*  _select : runtime preference                                        */  \
+int VECTOR(_runtime_select)(liquid_runtime_t _select);                      \
+                                                                            \
+/* Detect and select the best available runtime execution method        */  \
+int VECTOR(_runtime_detect)(void);                                          \
 
 LIQUID_VECTOR_DEFINE_API(LIQUID_VECTOR_MANGLE_RF, float,                float)
 LIQUID_VECTOR_DEFINE_API(LIQUID_VECTOR_MANGLE_CF, liquid_float_complex, float)
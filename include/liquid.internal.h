@@ -73,6 +73,171 @@ void _liquid_error_downgrade_disable(void);
 // MODULE : buffer
 //
 
+// allocate ring of at least *_size bytes whose pages are mapped twice
+// back-to-back, so that a span of up to *_size bytes starting anywhere in
+// the ring is contiguous; *_size is rounded up to a power-of-two multiple
+// of the page size; returns NULL if mirrored memory is unavailable
+void * liquid_mirror_malloc(size_t * _size);
+
+// free ring allocated with liquid_mirror_malloc()
+void liquid_mirror_free(void * _p,
+                        size_t _size);
+
+
+//
+// MODULE : core
+//
+
+// pool of worker threads used to split a computation into independent
+// shares; the calling thread acts as worker 0 and shares are run one
+// after another when threading is not available
+typedef struct liquid_workers_s * liquid_workers;
+
+// callback run for each share of a job
+//  _context     : user-defined context
+//  _index       : worker index, 0 <= _index < _num_workers
+//  _num_workers : total number of workers
+typedef int (liquid_workers_callback)(void *       _context,
+                                      unsigned int _index,
+                                      unsigned int _num_workers);
+
+// create pool of workers
+//  _num_workers : number of workers including caller, _num_workers > 0
+liquid_workers liquid_workers_create(unsigned int _num_workers);
+
+// destroy pool of workers, joining all threads
+int liquid_workers_destroy(liquid_workers _q);
+
+// get number of workers in pool
+unsigned int liquid_workers_get_num_workers(liquid_workers _q);
+
+// run callback once for each worker index and wait for all to finish,
+// returning the first error encountered
+int liquid_workers_run(liquid_workers            _q,
+                       liquid_workers_callback * _callback,
+                       void *                    _context);
+
+// ordered work queue: a single producer writes jobs into a ring of slots,
+// background threads process them concurrently and deliver them one at a
+// time in submission order; without threads (or with zero threads) each
+// job is processed and delivered as soon as it is submitted
+typedef struct liquid_workqueue_s * liquid_workqueue;
+
+// callback run for a job
+//  _context     : user-defined context
+//  _slot        : index of slot holding job, 0 <= _slot < num_slots
+typedef int (liquid_workqueue_callback)(void *       _context,
+                                        unsigned int _slot);
+
+// create work queue
+//  _num_threads : number of background threads (zero to run inline)
+//  _num_slots   : number of job slots, _num_slots > 0
+//  _process     : callback run concurrently for each job
+//  _deliver     : callback run for each job in submission order
+//  _context     : user-defined context passed to callbacks
+liquid_workqueue liquid_workqueue_create(unsigned int                _num_threads,
+                                         unsigned int                _num_slots,
+                                         liquid_workqueue_callback * _process,
+                                         liquid_workqueue_callback * _deliver,
+                                         void *                      _context);
+
+// destroy work queue, delivering all outstanding jobs and joining threads
+int liquid_workqueue_destroy(liquid_workqueue _q);
+
+// get number of background threads
+unsigned int liquid_workqueue_get_num_threads(liquid_workqueue _q);
+
+// get number of slots in ring
+unsigned int liquid_workqueue_get_num_slots(liquid_workqueue _q);
+
+// wait until the slot for the next job is free and return its index
+unsigned int liquid_workqueue_acquire(liquid_workqueue _q);
+
+// submit job written into the most recently acquired slot
+int liquid_workqueue_submit(liquid_workqueue _q);
+
+// wait until all submitted jobs have been delivered
+int liquid_workqueue_flush(liquid_workqueue _q);
+
+// get number of jobs submitted but not yet delivered
+unsigned int liquid_workqueue_get_num_pending(liquid_workqueue _q);
+
+// execute cpuid instruction on x86 architectures
+//  _leaf       : the main function number to pass to cpuid to execute
+//  _subleaf    : the variant selector for that leaf
+int liquid_runtime_cpuid_x86(uint32_t   _leaf,
+                             uint32_t   _subleaf,
+                             uint32_t * _a,
+                             uint32_t * _b,
+                             uint32_t * _c,
+                             uint32_t * _d);
+
+// performance counter entry embedded in each instrumented object and
+// linked into the global registry while the object exists
+struct liquid_counter_entry_s {
+    liquid_counter_s                value;  // counter values
+    struct liquid_counter_entry_s * prev;   // previous entry in registry
+    struct liquid_counter_entry_s * next;   // next entry in registry
+};
+
+// clear counter values and add entry to the global registry
+//  _entry  : counter entry
+//  _name   : object type name, e.g. "firfilt_crcf" (not copied)
+int liquid_counter_register(struct liquid_counter_entry_s * _entry,
+                            const char *                    _name);
+
+// remove entry from the global registry
+int liquid_counter_unregister(struct liquid_counter_entry_s * _entry);
+
+// Instrumentation macros: compile to nothing unless the library is built
+// with counters enabled. LIQUID_COUNTER_START() declares a local variable
+// and must appear at the top of a block; LIQUID_COUNTER_STOP() records
+// one call processing _n samples.
+#if COUNTERS_ENABLED
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  elif defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#  else
+#    include <time.h>
+#  endif
+
+// read free-running cycle counter (rdtsc, cntvct_el0, or nanoseconds)
+static inline unsigned long long liquid_counter_ticks(void)
+{
+#  if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#  elif defined(__aarch64__)
+    unsigned long long t;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(t));
+    return t;
+#  else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long long)t.tv_sec*1000000000ULL + t.tv_nsec;
+#  endif
+}
+
+#  define LIQUID_COUNTER_FIELD            struct liquid_counter_entry_s perf_counter;
+#  define LIQUID_COUNTER_REGISTER(Q,NAME) liquid_counter_register(&(Q)->perf_counter,NAME)
+#  define LIQUID_COUNTER_UNREGISTER(Q)    liquid_counter_unregister(&(Q)->perf_counter)
+#  define LIQUID_COUNTER_ALLOC(Q,BYTES)   { (Q)->perf_counter.value.allocs++;       \
+                                            (Q)->perf_counter.value.bytes += (BYTES); }
+#  define LIQUID_COUNTER_START(Q)         unsigned long long _liquid_counter_t0 =   \
+                                              liquid_counter_ticks()
+#  define LIQUID_COUNTER_STOP(Q,N)        { (Q)->perf_counter.value.calls++;        \
+                                            (Q)->perf_counter.value.samples += (N); \
+                                            (Q)->perf_counter.value.cycles +=       \
+                                              liquid_counter_ticks() - _liquid_counter_t0; }
+#else
+#  define LIQUID_COUNTER_FIELD
+#  define LIQUID_COUNTER_REGISTER(Q,NAME)
+#  define LIQUID_COUNTER_UNREGISTER(Q)
+#  define LIQUID_COUNTER_ALLOC(Q,BYTES)
+#  define LIQUID_COUNTER_START(Q)
+#  define LIQUID_COUNTER_STOP(Q,N)
+#endif
+
 
 //
 // MODULE : dotprod
@@ -83,6 +248,61 @@ void _liquid_error_downgrade_disable(void);
 // MODULE : fec (forward error-correction)
 //
 
+// cyclic redundancy check engine: slicing tables and carry-less folding
+// constants for a reflected CRC of a particular width, built on first use
+struct crc_engine_s {
+    unsigned int width;         // key width [bits]: 8, 16, 24, or 32
+    uint32_t     poly;          // reflected generator polynomial
+    uint32_t     T[16][256];    // slicing tables, T[k][i] = i followed by k zero bytes
+    uint64_t     k[4];          // folding constants (x^575, x^511, x^191, x^127) mod P
+};
+
+// update CRC state over message; the state is the 32-bit shift register
+// used by the bit-wise reference, so initialize with ~0 and invert the
+// result to obtain the key
+//  _q      :   CRC engine
+//  _s      :   input state
+//  _msg    :   input data message [size: _n x 1]
+//  _n      :   input data message size
+uint32_t crc_update_slice16(struct crc_engine_s * _q, uint32_t _s, unsigned char * _msg, unsigned int _n);
+uint32_t crc_update_pclmul (struct crc_engine_s * _q, uint32_t _s, unsigned char * _msg, unsigned int _n);
+uint32_t crc_update_pmull  (struct crc_engine_s * _q, uint32_t _s, unsigned char * _msg, unsigned int _n);
+
+// carry-less multiply kernels are only built when the compiler can target them
+#if BUILD_AVX && (defined(__i386__) || defined(__x86_64__))
+#  define CRC_BUILD_PCLMUL 1
+#else
+#  define CRC_BUILD_PCLMUL 0
+#endif
+#if BUILD_NEON && defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#  define CRC_BUILD_PMULL 1
+#else
+#  define CRC_BUILD_PMULL 0
+#endif
+
+// generate cyclic redundancy check keys one bit at a time (reference)
+//  _msg    :   input data message [size: _n x 1]
+//  _n      :   input data message size
+unsigned int crc8_generate_key_bitwise (unsigned char * _msg, unsigned int _n);
+unsigned int crc16_generate_key_bitwise(unsigned char * _msg, unsigned int _n);
+unsigned int crc24_generate_key_bitwise(unsigned char * _msg, unsigned int _n);
+unsigned int crc32_generate_key_bitwise(unsigned char * _msg, unsigned int _n);
+
+// low-density parity check graph: non-zero entries of the parity-check
+// matrix stored as edges in row-major order, along with an index of the
+// edges belonging to each column
+struct fec_ldpc_graph_s {
+    unsigned int   m;           // number of checks (rows)
+    unsigned int   n;           // number of variables (columns)
+    unsigned int   num_edges;   // number of non-zero entries
+    unsigned int   max_degree;  // maximum check degree (row weight)
+    unsigned int * row;         // first edge of each row, [size: m+1 x 1]
+    unsigned int * var;         // variable (column) of each edge, [size: num_edges x 1]
+    unsigned int * col;         // first entry of each column in col_edge, [size: n+1 x 1]
+    unsigned int * col_edge;    // edges grouped by column, [size: num_edges x 1]
+};
+typedef struct fec_ldpc_graph_s * fec_ldpc_graph;
+
 // fec : basic object
 struct fec_s {
     // common
@@ -135,6 +355,26 @@ struct fec_s {
     int * derrlocs;             // decoded error locations, [size: 1 x n]
     int erasures;               // number of erasures
 
+    // low-density parity check (block lengths as Reed-Solomon above)
+    fec_ldpc_graph  ldpc;       // parity-check graph
+    unsigned int    ldpc_k;     // information bits per block
+    unsigned int    ldpc_z;     // circulant size
+    unsigned int    ldpc_mb;    // number of layers (block rows)
+    unsigned int *  ldpc_layer; // first circulant of each layer, [size: 1 x mb+1]
+    unsigned int *  ldpc_base;  // first variable of each circulant's block column
+    unsigned int *  ldpc_shift; // shift of each circulant
+    unsigned char * ldpc_bits;  // code bits, [size: 1 x n]
+    int16_t *       ldpc_llr;   // posterior log-likelihood ratios, [size: 1 x n]
+    int16_t *       ldpc_msg;   // check-to-variable messages, [size: 1 x num_edges]
+    int16_t *       ldpc_v;     // posteriors aligned to layer rows, [size: 1 x max_degree*Z]
+    int8_t *        ldpc_llr8;  // posterior log-likelihood ratios (8-bit)
+    int8_t *        ldpc_msg8;  // check-to-variable messages (8-bit)
+    int8_t *        ldpc_v8;    // posteriors aligned to layer rows (8-bit)
+
+    // low-density parity check layer update kernels
+    int (*ldpc_update16)(int16_t*,int16_t*,unsigned int,unsigned int);
+    int (*ldpc_update8 )(int8_t*, int8_t*, unsigned int,unsigned int);
+
     // encode function pointer
     int (*encode_func)(fec _q,
                        unsigned int _dec_msg_len,
@@ -158,6 +398,7 @@ struct fec_s {
 int fec_scheme_is_convolutional(fec_scheme _scheme);
 int fec_scheme_is_punctured(fec_scheme _scheme);
 int fec_scheme_is_reedsolomon(fec_scheme _scheme);
+int fec_scheme_is_ldpc(fec_scheme _scheme);
 int fec_scheme_is_hamming(fec_scheme _scheme);
 int fec_scheme_is_repeat(fec_scheme _scheme);
 
@@ -544,6 +785,59 @@ int fec_conv_init_v29p56(fec _q);
 int fec_conv_init_v29p67(fec _q);
 int fec_conv_init_v29p78(fec _q);
 
+// Viterbi decoder (native add-compare-select engine, used for
+// convolutional codes when libfec is not available)
+typedef struct fec_viterbi_s * fec_viterbi;
+
+// create Viterbi decoder for rate 1/R code with constraint length K;
+// all polynomials must have their first and last taps set
+//  _K      :   constraint length, 7 <= _K <= 16
+//  _R      :   inverse rate (number of polynomials), 1 <= _R <= 8
+//  _poly   :   generator polynomials [size: _R x 1]
+//  _n      :   maximum number of decoded bits (excluding tail)
+fec_viterbi fec_viterbi_create(unsigned int _K,
+                               unsigned int _R,
+                               int *        _poly,
+                               unsigned int _n);
+
+// destroy Viterbi decoder, freeing all internal memory
+int fec_viterbi_destroy(fec_viterbi _q);
+
+// reset decoder state, setting initial trellis state
+int fec_viterbi_reset(fec_viterbi _q, unsigned int _state);
+
+// run add-compare-select over a block of soft symbols
+//  _q      :   decoder object
+//  _sym    :   soft input symbols (LIQUID_SOFTBIT_0..1) [size: _R x _n]
+//  _n      :   number of trellis steps (decoded bits, including tail)
+int fec_viterbi_update_blk(fec_viterbi     _q,
+                           unsigned char * _sym,
+                           unsigned int    _n);
+
+// trace back decisions and write decoded bits (msb first)
+//  _q          :   decoder object
+//  _data       :   output bytes [size: ceil(_nbits/8) x 1]
+//  _nbits      :   number of decoded bits (excluding tail)
+//  _endstate   :   terminal trellis state
+int fec_viterbi_chainback(fec_viterbi     _q,
+                          unsigned char * _data,
+                          unsigned int    _nbits,
+                          unsigned int    _endstate);
+
+// select runtime execution method for add-compare-select kernel
+int fec_viterbi_runtime_select(fec_viterbi      _q,
+                               liquid_runtime_t _select);
+
+// libfec-compatible interface for fec object function pointers
+void * fec_viterbi27_create (int _n);
+void * fec_viterbi29_create (int _n);
+void * fec_viterbi39_create (int _n);
+void * fec_viterbi615_create(int _n);
+int    fec_viterbi_init     (void * _vp, int _state);
+int    fec_viterbi_update   (void * _vp, unsigned char * _sym, int _n);
+int    fec_viterbi_traceback(void * _vp, unsigned char * _data, unsigned int _nbits, unsigned int _endstate);
+void   fec_viterbi_delete   (void * _vp);
+
 // Reed-Solomon
 
 // compute encoded message length for Reed-Solomon codes
@@ -571,6 +865,85 @@ int fec_rs_decode(fec _q,
                   unsigned char * _msg_enc,
                   unsigned char * _msg_dec);
 
+// low-density parity check codes
+unsigned int fec_ldpc_get_enc_msg_len(unsigned int _dec_msg_len,
+                                      unsigned int _k,
+                                      unsigned int _n);
+fec fec_ldpc_create(fec_scheme _fs);
+int fec_ldpc_destroy(fec _q);
+int fec_ldpc_setlength(fec _q,
+                       unsigned int _dec_msg_len);
+int fec_ldpc_encode(fec _q,
+                    unsigned int _dec_msg_len,
+                    unsigned char * _msg_dec,
+                    unsigned char * _msg_enc);
+int fec_ldpc_decode(fec _q,
+                    unsigned int _dec_msg_len,
+                    unsigned char * _msg_enc,
+                    unsigned char * _msg_dec);
+int fec_ldpc_decode_soft(fec _q,
+                         unsigned int _dec_msg_len,
+                         unsigned char * _msg_enc,
+                         unsigned char * _msg_dec);
+
+// generate quasi-cyclic parity-check matrix H = [Hs Hp] of size
+// _mb*_Z x (_kb+_mb)*_Z: Hs is an array of _Z x _Z circulant permutations,
+// _dv per block column, with shifts chosen to avoid cycles of length four;
+// Hp is block dual-diagonal with a weight-three first block column (as in
+// IEEE 802.11n) so that encoding is linear time
+//  _Z      :   circulant size
+//  _kb     :   number of information block columns
+//  _mb     :   number of parity block rows, at least 3
+//  _dv     :   number of circulants in each information block column
+smatrixb fec_ldpc_gen_qc(unsigned int _Z,
+                         unsigned int _kb,
+                         unsigned int _mb,
+                         unsigned int _dv);
+
+// create graph from sparse binary parity-check matrix
+fec_ldpc_graph fec_ldpc_graph_create(smatrixb _H);
+
+// destroy graph, freeing all internal memory
+int fec_ldpc_graph_destroy(fec_ldpc_graph _q);
+
+// check parity of hard decisions; returns 1 if all checks pass
+//  _q      :   parity-check graph
+//  _c      :   hard decisions, [size: n x 1]
+int fec_ldpc_graph_check(fec_ldpc_graph  _q,
+                         unsigned char * _c);
+
+// run layered, normalized min-sum decoder on fixed-point log-likelihood
+// ratios (positive values favor zero); returns 1 if parity checks
+//  _q          :   parity-check graph
+//  _llr        :   channel input, overwritten with posterior, [size: n x 1]
+//  _msg        :   check-to-variable messages, [size: num_edges x 1]
+//  _c_hat      :   hard decisions, [size: n x 1]
+//  _max_steps  :   maximum number of iterations
+int fec_ldpc_minsum(fec_ldpc_graph  _q,
+                    int16_t *       _llr,
+                    int16_t *       _msg,
+                    unsigned char * _c_hat,
+                    unsigned int    _max_steps);
+
+// update every check in a layer (block row) of a quasi-cyclic code with
+// the normalized min-sum rule; rows of a layer share no variables, so the
+// layer is updated as one circulant-sized vector per block column, with
+// 16-bit or 8-bit fixed-point log-likelihood ratios
+//  _v      :   posteriors aligned to rows of layer, overwritten, [size: _d*_z x 1]
+//  _msg    :   check-to-variable messages of layer, [size: _d*_z x 1]
+//  _d      :   number of circulants in layer (check degree)
+//  _z      :   circulant size
+int fec_ldpc_update16_port(int16_t * _v, int16_t * _msg, unsigned int _d, unsigned int _z);
+int fec_ldpc_update16_neon(int16_t * _v, int16_t * _msg, unsigned int _d, unsigned int _z);
+int fec_ldpc_update16_avx2(int16_t * _v, int16_t * _msg, unsigned int _d, unsigned int _z);
+int fec_ldpc_update8_port (int8_t *  _v, int8_t *  _msg, unsigned int _d, unsigned int _z);
+int fec_ldpc_update8_neon (int8_t *  _v, int8_t *  _msg, unsigned int _d, unsigned int _z);
+int fec_ldpc_update8_avx2 (int8_t *  _v, int8_t *  _msg, unsigned int _d, unsigned int _z);
+
+// select runtime execution method for layer update kernels
+int fec_ldpc_runtime_select(fec              _q,
+                            liquid_runtime_t _select);
+
 // phi(x) = -logf( tanhf( x/2 ) )
 float sumproduct_phi(float _x);
 
@@ -590,26 +963,20 @@ int fec_sumproduct(unsigned int    _m,
                    unsigned int    _max_steps);
 
 // sum-product algorithm, returns 1 if parity checks, 0 otherwise
-//  _m      :   rows
-//  _n      :   cols
-//  _H      :   sparse binary parity check matrix, [size: _m x _n]
+//  _G      :   parity-check graph
 //  _c_hat  :   estimated transmitted signal, [size: _n x 1]
 //
 // internal state arrays
-//  _Lq     :   [size: _m x _n]
-//  _Lr     :   [size: _m x _n]
+//  _Lq     :   variable-to-check messages, [size: num_edges x 1]
+//  _Lr     :   check-to-variable messages, [size: num_edges x 1]
 //  _Lc     :   [size: _n x 1]
 //  _LQ     :   [size: _n x 1]
-//  _parity :   _H * _c_hat, [size: _m x 1]
-int fec_sumproduct_step(unsigned int    _m,
-                        unsigned int    _n,
-                        smatrixb        _H,
+int fec_sumproduct_step(fec_ldpc_graph  _G,
                         unsigned char * _c_hat,
                         float *         _Lq,
                         float *         _Lr,
                         float *         _Lc,
-                        float *         _LQ,
-                        unsigned char * _parity);
+                        float *         _LQ);
 
 //
 // packetizer
@@ -626,10 +993,12 @@ int fec_sumproduct_step(unsigned int    _m,
 typedef enum {
     LIQUID_FFT_METHOD_UNKNOWN=0,    // unknown method
     LIQUID_FFT_METHOD_RADIX2,       // Radix-2 (decimation in time)
+    LIQUID_FFT_METHOD_RADIX4,       // Radix-4 Stockham autosort (vectorized)
     LIQUID_FFT_METHOD_MIXED_RADIX,  // Cooley-Tukey mixed-radix FFT (decimation in time)
     LIQUID_FFT_METHOD_RADER,        // Rader's method for FFTs of prime length
     LIQUID_FFT_METHOD_RADER2,       // Rader's method for FFTs of prime length (alternate)
     LIQUID_FFT_METHOD_DFT,          // regular discrete Fourier transform
+    LIQUID_FFT_METHOD_MANY,         // batch of equal-length transforms
 } liquid_fft_method;
 
 // Macro    :   FFT (internal)
@@ -654,6 +1023,7 @@ typedef int (FFT(_execute_t))(FFT(plan) _q);                    \
 /* FFT create methods */                                        \
 FFT(_create_t) FFT(_create_plan_dft);                           \
 FFT(_create_t) FFT(_create_plan_radix2);                        \
+FFT(_create_t) FFT(_create_plan_radix4);                        \
 FFT(_create_t) FFT(_create_plan_mixed_radix);                   \
 FFT(_create_t) FFT(_create_plan_rader);                         \
 FFT(_create_t) FFT(_create_plan_rader2);                        \
@@ -661,16 +1031,20 @@ FFT(_create_t) FFT(_create_plan_rader2);                        \
 /* FFT destroy methods */                                       \
 FFT(_destroy_t) FFT(_destroy_plan_dft);                         \
 FFT(_destroy_t) FFT(_destroy_plan_radix2);                      \
+FFT(_destroy_t) FFT(_destroy_plan_radix4);                      \
 FFT(_destroy_t) FFT(_destroy_plan_mixed_radix);                 \
 FFT(_destroy_t) FFT(_destroy_plan_rader);                       \
 FFT(_destroy_t) FFT(_destroy_plan_rader2);                      \
+FFT(_destroy_t) FFT(_destroy_plan_many);                        \
                                                                 \
 /* FFT execute methods */                                       \
 FFT(_execute_t) FFT(_execute_dft);                              \
 FFT(_execute_t) FFT(_execute_radix2);                           \
+FFT(_execute_t) FFT(_execute_radix4);                           \
 FFT(_execute_t) FFT(_execute_mixed_radix);                      \
 FFT(_execute_t) FFT(_execute_rader);                            \
 FFT(_execute_t) FFT(_execute_rader2);                           \
+FFT(_execute_t) FFT(_execute_many);                             \
                                                                 \
 /* specific codelets for small DFTs */                          \
 FFT(_execute_t) FFT(_execute_dft_2);                            \
@@ -682,6 +1056,27 @@ FFT(_execute_t) FFT(_execute_dft_7);                            \
 FFT(_execute_t) FFT(_execute_dft_8);                            \
 FFT(_execute_t) FFT(_execute_dft_16);                           \
                                                                 \
+/* radix-4 Stockham stage kernels */                            \
+typedef void (FFT(_radix4_stage_t))(unsigned int _n,            \
+                                    unsigned int _s,            \
+                                    TC *         _x,            \
+                                    TC *         _y,            \
+                                    TC *         _tw,           \
+                                    int          _dir);         \
+typedef void (FFT(_radix2_stage_t))(unsigned int _s,            \
+                                    TC *         _x,            \
+                                    TC *         _y);           \
+FFT(_radix4_stage_t) FFT(_radix4_stage_port);                   \
+FFT(_radix4_stage_t) FFT(_radix4_stage_neon);                   \
+FFT(_radix4_stage_t) FFT(_radix4_stage_sse2);                   \
+FFT(_radix4_stage_t) FFT(_radix4_stage_avx2);                   \
+FFT(_radix4_stage_t) FFT(_radix4_stage_avx512);                 \
+FFT(_radix2_stage_t) FFT(_radix2_stage_port);                   \
+FFT(_radix2_stage_t) FFT(_radix2_stage_neon);                   \
+FFT(_radix2_stage_t) FFT(_radix2_stage_sse2);                   \
+FFT(_radix2_stage_t) FFT(_radix2_stage_avx2);                   \
+FFT(_radix2_stage_t) FFT(_radix2_stage_avx512);                 \
+                                                                \
 /* additional methods */                                        \
 unsigned int FFT(_estimate_mixed_radix)(unsigned int _nfft);    \
                                                                 \
@@ -721,6 +1116,10 @@ LIQUID_FFT_DEFINE_INTERNAL_API(LIQUID_FFT_MANGLE_FLOAT, float, liquid_float_comp
 #   include <fftw3.h>
 #   define FFT_PLAN             fftwf_plan
 #   define FFT_CREATE_PLAN      fftwf_plan_dft_1d
+#   define FFT_CREATE_PLAN_MANY(n,howmany,x,istride,idist,y,ostride,odist,dir,flags) \
+        fftwf_plan_many_dft(1, (const int[]){(int)(n)}, howmany,        \
+                            x, NULL, istride, idist,                    \
+                            y, NULL, ostride, odist, dir, flags)
 #   define FFT_DESTROY_PLAN     fftwf_destroy_plan
 #   define FFT_EXECUTE          fftwf_execute
 #   define FFT_DIR_FORWARD      FFTW_FORWARD
@@ -731,6 +1130,7 @@ LIQUID_FFT_DEFINE_INTERNAL_API(LIQUID_FFT_MANGLE_FLOAT, float, liquid_float_comp
 #else
 #   define FFT_PLAN             fftplan
 #   define FFT_CREATE_PLAN      fft_create_plan
+#   define FFT_CREATE_PLAN_MANY fft_create_plan_many
 #   define FFT_DESTROY_PLAN     fft_destroy_plan
 #   define FFT_EXECUTE          fft_execute
 #   define FFT_DIR_FORWARD      LIQUID_FFT_FORWARD
@@ -978,6 +1378,26 @@ void bpacketgen_assemble_header(bpacketgen _q);
 #define DSSSFRAME_H_FEC0         (LIQUID_FEC_GOLAY2412)
 #define DSSSFRAME_H_FEC1         (LIQUID_FEC_NONE)
 
+//
+// qdetector, qdsync (methods shared with detector banks)
+//
+
+// correlate transform of external input buffer against template; on
+// detection, begin alignment from time buffer and return 1
+int qdetector_cccf_seek_spectrum(qdetector_cccf         _q,
+                                 liquid_float_complex * _buf_time,
+                                 liquid_float_complex * _buf_freq,
+                                 float                  _x2_prime);
+
+// is detector aligning to signal after initial detection?
+int qdetector_cccf_is_aligning(qdetector_cccf _q);
+
+// get internal detector object
+qdetector_cccf qdsync_cccf_get_detector(qdsync_cccf _q);
+
+// get internal frame synchronizer object
+qdsync_cccf framesync64_get_sync(framesync64 _q);
+
 //
 // multi-signal source for testing (no meaningful data, just signals)
 //
@@ -1231,6 +1651,9 @@ unsigned short int smatrix_indexsearch(unsigned short int * _list,
 #define ASK128_ALPHA    (1./sqrt(5461))
 #define ASK256_ALPHA    (1./sqrt(21845))
 
+// number of symbols demodulated together in block soft demodulation
+#define LIQUID_MODEM_SOFT_BLOCK (16)
+
 // Macro    :   MODEM
 //  MODEM   :   name-mangling macro
 //  T       :   primitive data type
@@ -1342,6 +1765,51 @@ int MODEM(_demodulate_soft_table)(MODEM()         _q,           \
                                   unsigned int *  _sym_out,     \
                                   unsigned char * _soft_bits);  \
                                                                 \
+/* block soft demodulation helpers; metrics _d are stored    */ \
+/* as [bit][symbol] with stride LIQUID_MODEM_SOFT_BLOCK      */ \
+T   MODEM(_demodsoft_block_scale)(MODEM() _q);                  \
+int MODEM(_demodsoft_block_is_differential)(MODEM() _q);        \
+int MODEM(_demodsoft_block_init_map)(MODEM() _q);              \
+int MODEM(_demodsoft_block_reduce)(T *          _dist,          \
+                                   unsigned int _m,             \
+                                   T *          _d);            \
+int MODEM(_demodsoft_block_pam)(T *            _v,              \
+                                unsigned int   _n,              \
+                                unsigned int   _m,              \
+                                T              _alpha,          \
+                                T *            _d,              \
+                                unsigned int * _s,              \
+                                T *            _e);             \
+int MODEM(_demodsoft_block_map)(TC *           _c,              \
+                                unsigned int   _m,              \
+                                T *            _xr,             \
+                                T *            _xi,             \
+                                unsigned int   _n,              \
+                                T *            _d,              \
+                                unsigned int * _s,              \
+                                T *            _e);             \
+int MODEM(_demodsoft_block_metric)(MODEM()        _q,           \
+                                   TC *           _x,           \
+                                   unsigned int   _n,           \
+                                   T *            _d,           \
+                                   unsigned int * _s,           \
+                                   T *            _e);          \
+int MODEM(_demodsoft_block_sequential)(MODEM()         _q,      \
+                                       TC *            _x,      \
+                                       unsigned int    _n,      \
+                                       unsigned int *  _syms,   \
+                                       unsigned char * _soft);  \
+                                                                \
+/* demodulate block with 8-bit soft-bit output, keeping the  */ \
+/* symbol-by-symbol demodulator for PSK and APSK with 64 or  */ \
+/* more points, where its neighbour table is faster than the */ \
+/* exhaustive batched search; used for frame payloads        */ \
+int MODEM(_demodsoft_block_dispatch)(MODEM()         _q,        \
+                                     TC *            _x,        \
+                                     unsigned int    _n,        \
+                                     unsigned int *  _syms,     \
+                                     unsigned char * _soft);    \
+                                                                \
 /* Demodulate a linear symbol constellation using           */  \
 /* referenced lookup table                                  */  \
 /*  _v      :   input value             */                      \
@@ -1481,5 +1949,45 @@ float randgammaf_delta(float _delta);
 // MODULE : utility
 //
 
+//
+// MODULE : vector
+//
+
+// vector kernels for a particular extension (port, avx2, etc.); the public
+// methods dispatch to these based on the runtime selection
+#define LIQUID_VECTOR_DEFINE_INTERNAL_API(VECTOR,T,TP,EXT)                  \
+void VECTOR(_add_##EXT)      (T * _x, T * _y, unsigned int _n, T * _z);     \
+void VECTOR(_addscalar_##EXT)(T * _x, unsigned int _n, T _v, T * _y);       \
+void VECTOR(_mul_##EXT)      (T * _x, T * _y, unsigned int _n, T * _z);     \
+void VECTOR(_mulscalar_##EXT)(T * _x, unsigned int _n, T _v, T * _y);       \
+void VECTOR(_cexpj_##EXT)    (TP * _theta, unsigned int _n, T * _x);        \
+void VECTOR(_carg_##EXT)     (T * _x, unsigned int _n, TP * _theta);        \
+void VECTOR(_abs_##EXT)      (T * _x, unsigned int _n, TP * _y);            \
+TP   VECTOR(_norm_##EXT)     (T * _x, unsigned int _n);                     \
+void VECTOR(_normalize_##EXT)(T * _x, unsigned int _n, T * _y);             \
+T    VECTOR(_dotprod_conj_##EXT)(T * _x, T * _y, unsigned int _n);          \
+T    VECTOR(_axpy_dotprod_conj_##EXT)(T *          _w,                      \
+                                      unsigned int _n,                      \
+                                      T            _a,                      \
+                                      T *          _u,                      \
+                                      T *          _v);                     \
+
+LIQUID_VECTOR_DEFINE_INTERNAL_API(LIQUID_VECTOR_MANGLE_RF, float,                float, port)
+LIQUID_VECTOR_DEFINE_INTERNAL_API(LIQUID_VECTOR_MANGLE_RF, float,                float, avx2)
+LIQUID_VECTOR_DEFINE_INTERNAL_API(LIQUID_VECTOR_MANGLE_RF, float,                float, avx512)
+LIQUID_VECTOR_DEFINE_INTERNAL_API(LIQUID_VECTOR_MANGLE_CF, liquid_float_complex, float, port)
+LIQUID_VECTOR_DEFINE_INTERNAL_API(LIQUID_VECTOR_MANGLE_CF, liquid_float_complex, float, avx2)
+LIQUID_VECTOR_DEFINE_INTERNAL_API(LIQUID_VECTOR_MANGLE_CF, liquid_float_complex, float, avx512)
+
+// complex multiplication (ARM Neon)
+void liquid_vectorcf_mul_neon(liquid_float_complex * _x,
+                              liquid_float_complex * _y,
+                              unsigned int           _n,
+                              liquid_float_complex * _z);
+void liquid_vectorcf_mulscalar_neon(liquid_float_complex * _x,
+                                    unsigned int           _n,
+                                    liquid_float_complex   _v,
+                                    liquid_float_complex * _y);
+
 #endif // __LIQUID_INTERNAL_H__
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -57,3 +57,47 @@ void benchmark_agc_crcf(struct rusage *     _start,
     agc_crcf_destroy(q);
 }
 
+
+// helper function to keep code base small
+void agc_crcf_block_bench(struct rusage *     _start,
+                          struct rusage *     _finish,
+                          unsigned long int * _num_iterations,
+                          unsigned int        _m)
+{
+    // normalize number of iterations to block length
+    unsigned int buf_len = 256;
+    *_num_iterations /= buf_len;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // initialize AGC object
+    agc_crcf q = agc_crcf_create();
+    agc_crcf_set_bandwidth (q, 0.01f);
+    agc_crcf_set_block_size(q, _m);
+
+    unsigned long int i;
+    float complex x[buf_len];   // input block
+    float complex y[buf_len];   // output block
+    for (i=0; i<buf_len; i++)
+        x[i] = 1e-3f*(randnf() + _Complex_I*randnf());
+
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        agc_crcf_execute_block(q, x, buf_len, y);
+    getrusage(RUSAGE_SELF, _finish);
+
+    *_num_iterations *= buf_len;
+
+    // destroy object
+    agc_crcf_destroy(q);
+}
+
+#define AGC_CRCF_BLOCK_BENCH_API(M)             \
+(   struct rusage *     _start,                 \
+    struct rusage *     _finish,                \
+    unsigned long int * _num_iterations)        \
+{ agc_crcf_block_bench(_start, _finish, _num_iterations, M); }
+
+void benchmark_agc_crcf_block_m1    AGC_CRCF_BLOCK_BENCH_API(1)
+void benchmark_agc_crcf_block_m8    AGC_CRCF_BLOCK_BENCH_API(8)
+void benchmark_agc_crcf_block_m16   AGC_CRCF_BLOCK_BENCH_API(16)
+void benchmark_agc_crcf_block_m64   AGC_CRCF_BLOCK_BENCH_API(64)
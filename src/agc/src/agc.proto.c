@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007 - 2024 Joseph Gaeddert
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -35,7 +35,22 @@
 #define AGC_DEFAULT_BW   (1e-2f)
 
 // internal method definition
-int AGC(_squelch_update_mode)(AGC() _q);
+int AGC(_squelch_update_mode)(AGC() _q, unsigned int _n);
+
+// execute gain control on a sub-block of samples with a single gain update
+int AGC(_execute_subblock)(AGC()        _q,
+                           TC *         _x,
+                           unsigned int _n,
+                           T            _beta_mid,
+                           T            _beta,
+                           TC *         _y);
+
+// compute gain at end of sub-block for a given mean output energy
+T AGC(_subblock_gain)(AGC()        _q,
+                      unsigned int _n,
+                      T            _y2,
+                      T            _beta_mid,
+                      T            _beta);
 
 // agc structure object
 struct AGC(_s) {
@@ -47,6 +62,11 @@ struct AGC(_s) {
     float bandwidth;// bandwidth-time constant
     T alpha;        // feed-back gain
 
+    // block processing
+    unsigned int block_size;    // samples per gain update in execute_block()
+    T beta_mid;                 // (1-alpha)^((block_size+1)/2)
+    T beta;                     // (1-alpha)^block_size
+
     // signal level estimate
     T y2_prime;     // filtered output signal energy estimate
 
@@ -70,6 +90,9 @@ AGC() AGC(_create)(void)
     // create object and initialize to default parameters
     AGC() _q = (AGC()) malloc(sizeof(struct AGC(_s)));
 
+    // update gain every sample by default
+    _q->block_size = 1;
+
     // initialize bandwidth
     AGC(_set_bandwidth)(_q, AGC_DEFAULT_BW);
 
@@ -170,7 +193,7 @@ int AGC(_execute)(AGC() _q,
     _q->g = (_q->g > 1e6f) ? 1e6f : _q->g;
 
     // update squelch mode appropriately
-    AGC(_squelch_update_mode)(_q);
+    AGC(_squelch_update_mode)(_q, 1);
 
     // apply output scale
     *_y *= _q->scale;
@@ -190,10 +213,24 @@ int AGC(_execute_block)(AGC()        _q,
 {
     unsigned int i;
     int rc = LIQUID_OK;
-    for (i=0; i<_n; i++) {
-        rc |= AGC(_execute)(_q, _x[i], &_y[i]);
+    if (_q->block_size == 1) {
+        for (i=0; i<_n; i++)
+            rc |= AGC(_execute)(_q, _x[i], &_y[i]);
+        return rc;
     }
 
+    // run full sub-blocks with pre-computed filter decay
+    unsigned int m = _q->block_size;
+    for (i=0; i+m<=_n; i+=m)
+        rc |= AGC(_execute_subblock)(_q, _x+i, m, _q->beta_mid, _q->beta, _y+i);
+
+    // run remaining samples
+    if (i < _n) {
+        m = _n - i;
+        T beta_mid = powf(1.0f - _q->alpha, 0.5f*(float)(m+1));
+        T beta     = powf(1.0f - _q->alpha,      (float)(m  ));
+        rc |= AGC(_execute_subblock)(_q, _x+i, m, beta_mid, beta, _y+i);
+    }
     return rc;
 }
 
@@ -241,10 +278,33 @@ int AGC(_set_bandwidth)(AGC() _q,
 
     // compute filter coefficient based on bandwidth
     _q->alpha = _q->bandwidth;
+
+    // compute filter decay over a sub-block
+    _q->beta_mid = powf(1.0f - _q->alpha, 0.5f*(float)(_q->block_size+1));
+    _q->beta     = powf(1.0f - _q->alpha,      (float)(_q->block_size  ));
     
     return LIQUID_OK;
 }
 
+// get number of samples per gain update in execute_block()
+unsigned int AGC(_get_block_size)(AGC() _q)
+{
+    return _q->block_size;
+}
+
+// set number of samples per gain update in execute_block()
+int AGC(_set_block_size)(AGC()        _q,
+                         unsigned int _m)
+{
+    if (_m == 0)
+        return liquid_error(LIQUID_EICONFIG,"agc_%s_set_block_size(), block size must be greater than zero", EXTENSION_FULL);
+
+    _q->block_size = _m;
+    _q->beta_mid = powf(1.0f - _q->alpha, 0.5f*(float)(_q->block_size+1));
+    _q->beta     = powf(1.0f - _q->alpha,      (float)(_q->block_size  ));
+    return LIQUID_OK;
+}
+
 // get estimated signal level (linear)
 float AGC(_get_signal_level)(AGC() _q)
 {
@@ -418,8 +478,92 @@ int AGC(_squelch_get_status)(AGC() _q)
 // internal methods
 //
 
+// execute gain control on a sub-block of samples with a single gain update
+//  _q          : automatic gain control object
+//  _x          : input data array, [size: _n x 1]
+//  _n          : number of input, output samples
+//  _beta_mid   : filter decay to middle of sub-block, (1-alpha)^((_n+1)/2)
+//  _beta       : filter decay over sub-block, (1-alpha)^_n
+//  _y          : output data array, [size: _n x 1]
+int AGC(_execute_subblock)(AGC()        _q,
+                           TC *         _x,
+                           unsigned int _n,
+                           T            _beta_mid,
+                           T            _beta,
+                           TC *         _y)
+{
+    // mean input energy over sub-block
+    T x2 = SUMSQ(_x, _n) / (T)_n;
+    T g0 = _q->g;
+    unsigned int i;
+
+    if (_q->is_locked) {
+        // gain is fixed; no output scale is applied (see execute())
+        _q->y2_prime = _beta*_q->y2_prime + (1.0f - _beta)*g0*g0*x2;
+        for (i=0; i<_n; i++)
+            _y[i] = _x[i] * g0;
+        return LIQUID_OK;
+    }
+
+    // predict gain at end of sub-block holding the gain fixed, then
+    // correct using the mean squared gain along a linear ramp
+    T g1 = AGC(_subblock_gain)(_q, _n, g0*g0*x2, _beta_mid, _beta);
+    T y2 = x2 * (g0*g0 + g0*g1 + g1*g1) / 3.0f;
+    g1 = AGC(_subblock_gain)(_q, _n, y2, _beta_mid, _beta);
+
+    // advance filtered energy estimate and gain
+    _q->y2_prime = _beta*_q->y2_prime + (1.0f - _beta)*y2;
+    _q->g = g1;
+
+    // update squelch mode appropriately
+    AGC(_squelch_update_mode)(_q, _n);
+
+    // apply gain ramp from g0 to g1 and output scale
+    T gs = g0 * _q->scale;
+    T dg = (g1 - g0) * _q->scale / (T)_n;
+    for (i=0; i<_n; i++)
+        _y[i] = _x[i] * (gs + dg*(T)i);
+
+    return LIQUID_OK;
+}
+
+// compute gain at end of sub-block for a given mean output energy
+//  _q          : automatic gain control object
+//  _n          : number of samples in sub-block
+//  _y2         : mean output signal energy over sub-block
+//  _beta_mid   : filter decay to middle of sub-block, (1-alpha)^((_n+1)/2)
+//  _beta       : filter decay over sub-block, (1-alpha)^_n
+T AGC(_subblock_gain)(AGC()        _q,
+                      unsigned int _n,
+                      T            _y2,
+                      T            _beta_mid,
+                      T            _beta)
+{
+    // With constant output energy the filtered estimate decays
+    // exponentially from its current value toward _y2. The gain update
+    // accumulates the log of each estimate; approximate their sum with
+    // Simpson's rule at the first, middle, and last samples.
+    T v[3] = {_q->y2_prime*(1.0f - _q->alpha), _q->y2_prime*_beta_mid, _q->y2_prime*_beta};
+    T w[3] = {1.0f, 4.0f, 1.0f};
+    T b[3] = {1.0f - _q->alpha, _beta_mid, _beta};
+    T log_sum = 0.0f;
+    unsigned int i;
+    for (i=0; i<3; i++) {
+        v[i] += (1.0f - b[i])*_y2;
+        if (v[i] > 1e-6f)
+            log_sum += w[i]*logf(v[i]);
+    }
+
+    // apply accumulated gain update, clamping to 120 dB gain
+    T g = _q->g * expf( -0.5f*_q->alpha*(T)_n*log_sum/6.0f );
+    return (g > 1e6f) ? 1e6f : g;
+}
+
 // update squelch mode appropriately
-int AGC(_squelch_update_mode)(AGC() _q)
+//  _q      : automatic gain control object
+//  _n      : number of samples since last update
+int AGC(_squelch_update_mode)(AGC()        _q,
+                              unsigned int _n)
 {
     //
     int threshold_exceeded = (AGC(_get_rssi)(_q) > _q->squelch_threshold);
@@ -440,7 +584,7 @@ int AGC(_squelch_update_mode)(AGC() _q)
         _q->squelch_timer = _q->squelch_timeout;
         break;
     case LIQUID_AGC_SQUELCH_SIGNALLO:
-        _q->squelch_timer--;
+        _q->squelch_timer = _q->squelch_timer > _n ? _q->squelch_timer - _n : 0;
         if (_q->squelch_timer == 0)
             _q->squelch_mode = LIQUID_AGC_SQUELCH_TIMEOUT;
         else if (threshold_exceeded)
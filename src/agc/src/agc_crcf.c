@@ -32,6 +32,7 @@
 
 // macros
 #define AGC(name)           LIQUID_CONCAT(agc_crcf,name)
+#define SUMSQ               liquid_sumsqcf
 
 #define T                   float           // general
 #define TC                  float complex   // input/output
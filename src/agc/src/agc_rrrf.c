@@ -32,6 +32,7 @@
 
 // macros
 #define AGC(name)           LIQUID_CONCAT(agc_rrrf,name)
+#define SUMSQ               liquid_sumsqf
 
 #define T                   float           // general
 #define TC                  float           // input/output
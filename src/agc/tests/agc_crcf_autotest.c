@@ -20,6 +20,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "liquid.internal.h"
 #include "liquid.autotest.h"
 
@@ -299,6 +301,10 @@ LIQUID_AUTOTEST(agc_crcf_config,"configuration", "", 0.1)
     // initialize gain on input array, but array has length 0
     LIQUID_CHECK( LIQUID_OK != agc_crcf_init(q, NULL, 0))
 
+    // invalid block size
+    LIQUID_CHECK( LIQUID_OK != agc_crcf_set_block_size(q, 0))
+    LIQUID_CHECK( agc_crcf_get_block_size(q) == 1 );
+
     // destroy object
     agc_crcf_destroy(q);
     _liquid_error_downgrade_disable();
@@ -336,3 +342,74 @@ LIQUID_AUTOTEST(agc_crcf_copy,"copy test", "", 0.1)
     agc_crcf_destroy(q1);
 }
 
+
+// compare block gain updates against per-sample loop on a signal with
+// level steps, checking gain error at each block boundary
+void testbench_agc_crcf_block(liquid_autotest __q__,
+                              float           _bt,
+                              unsigned int    _m)
+{
+    // run per-sample and block gain control in parallel
+    agc_crcf q0 = agc_crcf_create();
+    agc_crcf q1 = agc_crcf_create();
+    agc_crcf_set_bandwidth (q0, _bt);
+    agc_crcf_set_bandwidth (q1, _bt);
+    agc_crcf_set_block_size(q1, _m);
+    LIQUID_CHECK( agc_crcf_get_block_size(q1) == _m );
+
+    // settling time after each step (samples), with each segment long
+    // enough to leave a settled window before the next step
+    unsigned int num_settle  = (unsigned int)(20.0f / _bt);
+    unsigned int seg_len     = num_settle + 1000;
+    unsigned int num_samples = 3*seg_len;
+
+    // noise with steps of +12 dB and -20 dB
+    float complex * x  = (float complex*) malloc(num_samples*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(num_samples*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(num_samples*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<num_samples; i++) {
+        float gamma = i < seg_len ? 0.1f : (i < 2*seg_len ? 0.4f : 0.04f);
+        x[i] = gamma*(randnf() + _Complex_I*randnf())*M_SQRT1_2;
+    }
+
+    float e_max    = 0.0f;  // largest gain error overall [dB]
+    float e_settle = 0.0f;  // largest gain error after settling [dB]
+    unsigned int num_settled[3] = {0,0,0}; // blocks checked after settling, per step
+    for (i=0; i<num_samples; i+=_m) {
+        unsigned int n = (i + _m <= num_samples) ? _m : num_samples - i;
+        agc_crcf_execute_block(q0, x+i, n, y0+i);
+        agc_crcf_execute_block(q1, x+i, n, y1+i);
+
+        float e = fabsf(20*log10f(agc_crcf_get_gain(q0) / agc_crcf_get_gain(q1)));
+        e_max = e > e_max ? e : e_max;
+        if ((i+n) % seg_len > num_settle) {
+            e_settle = e > e_settle ? e : e_settle;
+            num_settled[(i+n-1) / seg_len]++;
+        }
+    }
+    liquid_log_debug("bt=%.3f, m=%3u, max error: %.4f dB, settled: %.4f dB (%u/%u/%u blocks)",
+            _bt, _m, e_max, e_settle, num_settled[0], num_settled[1], num_settled[2]);
+    LIQUID_CHECK( num_settled[0] > 0 );
+    LIQUID_CHECK( num_settled[1] > 0 );
+    LIQUID_CHECK( num_settled[2] > 0 );
+    LIQUID_CHECK( e_max    < 0.5f  );
+    LIQUID_CHECK( e_settle < 0.1f  );
+
+    // outputs are identical when updating every sample
+    if (_m == 1)
+        LIQUID_CHECK( memcmp(y0, y1, num_samples*sizeof(float complex)) == 0 );
+
+    free(x);
+    free(y0);
+    free(y1);
+    agc_crcf_destroy(q0);
+    agc_crcf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(agc_crcf_block_bt0p010_m1, "block gain control, bt=0.010, m=1", "",0.1) { testbench_agc_crcf_block(__q__,0.010f, 1); }
+LIQUID_AUTOTEST(agc_crcf_block_bt0p001_m32,"block gain control, bt=0.001, m=32","",0.1) { testbench_agc_crcf_block(__q__,0.001f,32); }
+LIQUID_AUTOTEST(agc_crcf_block_bt0p005_m33,"block gain control, bt=0.005, m=33","",0.1) { testbench_agc_crcf_block(__q__,0.005f,33); }
+LIQUID_AUTOTEST(agc_crcf_block_bt0p010_m4, "block gain control, bt=0.010, m=4", "",0.1) { testbench_agc_crcf_block(__q__,0.010f, 4); }
+LIQUID_AUTOTEST(agc_crcf_block_bt0p010_m20,"block gain control, bt=0.010, m=20","",0.1) { testbench_agc_crcf_block(__q__,0.010f,20); }
+LIQUID_AUTOTEST(agc_crcf_block_bt0p020_m7, "block gain control, bt=0.020, m=7", "",0.1) { testbench_agc_crcf_block(__q__,0.020f, 7); }
@@ -27,20 +27,27 @@
 (   struct rusage *_start,              \
     struct rusage *_finish,             \
     unsigned long int *_num_iterations) \
-{ window_push_bench(_start, _finish, _num_iterations, N); }
+{ window_push_bench(_start, _finish, _num_iterations, N, 0); }
+
+#define WINDOW_PUSH_MIRRORED_BENCH_API(N)   \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ window_push_bench(_start, _finish, _num_iterations, N, 1); }
 
 // Helper function to keep code base small
 void window_push_bench(struct rusage *_start,
                        struct rusage *_finish,
                        unsigned long int *_num_iterations,
-                       unsigned int _n)
+                       unsigned int _n,
+                       int _mirrored)
 {
     // normalize number of iterations
     *_num_iterations *= 8;
     if (*_num_iterations < 1) *_num_iterations = 1;
 
     // initialize port
-    windowcf w = windowcf_create(_n);
+    windowcf w = _mirrored ? windowcf_create_mirrored(_n) : windowcf_create(_n);
 
     unsigned long int i;
 
@@ -65,4 +72,11 @@ void benchmark_windowcf_push_n32     WINDOW_PUSH_BENCH_API(32)
 void benchmark_windowcf_push_n64     WINDOW_PUSH_BENCH_API(64)
 void benchmark_windowcf_push_n128    WINDOW_PUSH_BENCH_API(128)
 void benchmark_windowcf_push_n256    WINDOW_PUSH_BENCH_API(256)
+void benchmark_windowcf_push_n1024   WINDOW_PUSH_BENCH_API(1024)
+void benchmark_windowcf_push_n4096   WINDOW_PUSH_BENCH_API(4096)
 
+// mirrored memory
+void benchmark_windowcf_push_mirrored_n16    WINDOW_PUSH_MIRRORED_BENCH_API(16)
+void benchmark_windowcf_push_mirrored_n256   WINDOW_PUSH_MIRRORED_BENCH_API(256)
+void benchmark_windowcf_push_mirrored_n1024  WINDOW_PUSH_MIRRORED_BENCH_API(1024)
+void benchmark_windowcf_push_mirrored_n4096  WINDOW_PUSH_MIRRORED_BENCH_API(4096)
@@ -53,8 +53,19 @@ struct CBUFFER(_s) {
     
     // index to write
     unsigned int write_index;
+
+    // index modulus: max_size, or length of mirrored ring
+    unsigned int ring_size;
+
+    // memory is mapped twice (v[i] == v[i+ring_size])
+    int mirrored;
 };
 
+// create circular buffer object with regular or mirrored memory
+CBUFFER() CBUFFER(_create_internal)(unsigned int _max_size,
+                                    unsigned int _max_read,
+                                    int          _mirrored);
+
 // create circular buffer object of a particular size
 CBUFFER() CBUFFER(_create)(unsigned int _max_size)
 {
@@ -70,19 +81,52 @@ CBUFFER() CBUFFER(_create)(unsigned int _max_size)
 // at any given time.
 CBUFFER() CBUFFER(_create_max)(unsigned int _max_size,
                                unsigned int _max_read)
+{
+    return CBUFFER(_create_internal)(_max_size, _max_read, liquid_mirror_get_default());
+}
+
+// create circular buffer object of a particular size using mirrored
+// memory; any number of elements up to the buffer size may be read
+CBUFFER() CBUFFER(_create_mirrored)(unsigned int _max_size)
+{
+    return CBUFFER(_create_internal)(_max_size, _max_size, 1);
+}
+
+// create circular buffer object with regular or mirrored memory
+CBUFFER() CBUFFER(_create_internal)(unsigned int _max_size,
+                                    unsigned int _max_read,
+                                    int          _mirrored)
 {
     // create main object
     CBUFFER() q = (CBUFFER()) malloc(sizeof(struct CBUFFER(_s)));
 
     // set internal properties
-    q->max_size = _max_size;
-    q->max_read = _max_read;
+    q->max_size  = _max_size;
+    q->max_read  = _max_read;
+    q->ring_size = _max_size;
+    q->v         = NULL;
+
+    // mirrored memory: reads never need to be linearized
+    q->mirrored = 0;
+    if (_mirrored) {
+        size_t size = q->max_size*sizeof(T);
+        q->v = (T*) liquid_mirror_malloc(&size);
+        if (q->v != NULL) {
+            q->mirrored      = 1;
+            q->ring_size     = size / sizeof(T);
+            q->num_allocated = q->ring_size;
+        } else {
+            liquid_log_debug("cbuffer%s_create(), mirrored memory not available", EXTENSION);
+        }
+    }
 
-    // internal memory allocation
-    q->num_allocated = q->max_size + q->max_read - 1;
+    if (!q->mirrored) {
+        // internal memory allocation
+        q->num_allocated = q->max_size + q->max_read - 1;
 
-    // allocate internal memory array
-    q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+        // allocate internal memory array
+        q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+    }
 
     // reset object
     CBUFFER(_reset)(q);
@@ -103,7 +147,16 @@ CBUFFER() CBUFFER(_copy)(CBUFFER() q_orig)
     memmove(q_copy, q_orig, sizeof(struct CBUFFER(_s)));
 
     // allocate and copy full memory array
-    q_copy->v = (T*) malloc((q_copy->num_allocated)*sizeof(T));
+    if (q_orig->mirrored) {
+        size_t size = q_orig->ring_size*sizeof(T);
+        q_copy->v = (T*) liquid_mirror_malloc(&size);
+        if (q_copy->v == NULL) {
+            free(q_copy);
+            return liquid_error_config("cbuffer%s_copy(), could not allocate mirrored memory", EXTENSION);
+        }
+    } else {
+        q_copy->v = (T*) malloc((q_copy->num_allocated)*sizeof(T));
+    }
     memmove(q_copy->v, q_orig->v, q_copy->num_allocated*sizeof(T));
 
     // return new object
@@ -113,7 +166,10 @@ CBUFFER() CBUFFER(_copy)(CBUFFER() q_orig)
 // destroy cbuffer object, freeing all internal memory
 int CBUFFER(_destroy)(CBUFFER() _q)
 {
-    free(_q->v);
+    if (_q->mirrored)
+        liquid_mirror_free(_q->v, _q->ring_size*sizeof(T));
+    else
+        free(_q->v);
     free(_q);
     return LIQUID_OK;
 }
@@ -121,8 +177,9 @@ int CBUFFER(_destroy)(CBUFFER() _q)
 // print cbuffer object properties
 int CBUFFER(_print)(CBUFFER() _q)
 {
-    printf("<liquid.cbuffer%s, max_size:%u, max_read:%u, elements:%u>\n",
-            EXTENSION, _q->max_size, _q->max_read, _q->num_elements);
+    printf("<liquid.cbuffer%s, max_size:%u, max_read:%u, elements:%u, mirrored:%s>\n",
+            EXTENSION, _q->max_size, _q->max_read, _q->num_elements,
+            _q->mirrored ? "true" : "false");
     return LIQUID_OK;
 }
 
@@ -187,7 +244,7 @@ int CBUFFER(_push)(CBUFFER() _q,
     _q->v[_q->write_index] = _v;
 
     // update write index
-    _q->write_index = (_q->write_index+1) % _q->max_size;
+    _q->write_index = (_q->write_index+1) % _q->ring_size;
 
     // increment number of elements
     _q->num_elements++;
@@ -208,6 +265,14 @@ int CBUFFER(_write)(CBUFFER()    _q,
     }
 
     _q->num_elements += _n;
+
+    // mirrored memory: single copy through the alias
+    if (_q->mirrored) {
+        memmove(_q->v + _q->write_index, _v, _n*sizeof(T));
+        _q->write_index = (_q->write_index + _n) % _q->ring_size;
+        return LIQUID_OK;
+    }
+
     // space available at end of buffer
     unsigned int k = _q->max_size - _q->write_index;
     //printf("n : %u, k : %u\n", _n, k);
@@ -240,7 +305,7 @@ int CBUFFER(_pop)(CBUFFER() _q,
         *_v = _q->v[ _q->read_index ];
 
     // increment read index
-    _q->read_index = (_q->read_index + 1) % _q->max_size;
+    _q->read_index = (_q->read_index + 1) % _q->ring_size;
 
     // decrement number of elements in the buffer
     _q->num_elements--;
@@ -266,7 +331,7 @@ int CBUFFER(_read)(CBUFFER()      _q,
         _num_requested = _q->max_read;
 
     // linearize tail end of buffer if necessary
-    if (_num_requested > (_q->max_size - _q->read_index))
+    if (!_q->mirrored && _num_requested > (_q->max_size - _q->read_index))
         CBUFFER(_linearize)(_q);
     
     // set output pointer appropriately
@@ -284,12 +349,19 @@ int CBUFFER(_release)(CBUFFER()    _q,
         return liquid_error(LIQUID_EIRANGE,"cbuffer%s_release(), cannot release more elements in buffer than exist",EXTENSION);
     }
 
-    _q->read_index = (_q->read_index + _n) % _q->max_size;
+    _q->read_index = (_q->read_index + _n) % _q->ring_size;
     _q->num_elements -= _n;
     return LIQUID_OK;
 }
 
 
+// is buffer using mirrored memory?
+int CBUFFER(_is_mirrored)(CBUFFER() _q)
+{
+    return _q->mirrored;
+}
+
+
 //
 // internal methods
 //
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// mirrored memory for ring buffers
+//
+// The same physical pages are mapped twice back-to-back in virtual memory
+// so that a ring of n bytes starting at any offset can be accessed as one
+// contiguous span without copying.
+//
+
+// memfd_create() is a GNU extension
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+#if BUILD_MEMFD
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// use mirrored memory for window/cbuffer/wdelay objects by default
+static int liquid_mirror_default = 0;
+
+// is mirrored memory supported on this platform?
+int liquid_mirror_is_available(void)
+{
+    static int available = -1;
+    if (available < 0) {
+        // attempt to map a single page
+        size_t size = 1;
+        void * p = liquid_mirror_malloc(&size);
+        available = p != NULL;
+        if (p != NULL)
+            liquid_mirror_free(p, size);
+    }
+    return available;
+}
+
+// set default backend for window/cbuffer/wdelay objects
+int liquid_mirror_set_default(int _enable)
+{
+    if (_enable && !liquid_mirror_is_available())
+        return liquid_error(LIQUID_ENOIMP,"liquid_mirror_set_default(), mirrored memory not available");
+    liquid_mirror_default = _enable ? 1 : 0;
+    return LIQUID_OK;
+}
+
+// get default backend for window/cbuffer/wdelay objects
+int liquid_mirror_get_default(void)
+{
+    return liquid_mirror_default;
+}
+
+// allocate ring of at least *_size bytes mapped twice back-to-back
+void * liquid_mirror_malloc(size_t * _size)
+{
+#if BUILD_MEMFD
+    // round size up to power-of-two multiple of page size
+    size_t page = (size_t) sysconf(_SC_PAGESIZE);
+    size_t size = page;
+    while (size < *_size)
+        size <<= 1;
+
+    // create anonymous file backing the ring
+    int fd = memfd_create("liquid-mirror", MFD_CLOEXEC);
+    if (fd < 0)
+        return NULL;
+    if (ftruncate(fd, (off_t)size) != 0) {
+        close(fd);
+        return NULL;
+    }
+
+    // reserve 2*size of address space, then map the file over both halves
+    unsigned char * p = (unsigned char *) mmap(NULL, 2*size, PROT_NONE,
+                                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+    if (mmap(p,      size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(p+size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        munmap(p, 2*size);
+        close(fd);
+        return NULL;
+    }
+
+    // mappings keep the file alive
+    close(fd);
+    *_size = size;
+    return p;
+#else
+    return NULL;
+#endif
+}
+
+// free ring allocated with liquid_mirror_malloc()
+void liquid_mirror_free(void * _p,
+                        size_t _size)
+{
+#if BUILD_MEMFD
+    munmap(_p, 2*_size);
+#endif
+}
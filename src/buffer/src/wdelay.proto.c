@@ -34,19 +34,56 @@ struct WDELAY(_s) {
     T *          v;             // allocated array pointer
     unsigned int delay;         // length of window
     unsigned int read_index;    // index for reading
+    unsigned int num_allocated; // delay+1, or length of mirrored ring
+    int          mirrored;      // memory is mapped twice
 };
 
+// create delay buffer object with regular or mirrored memory
+WDELAY() WDELAY(_create_internal)(unsigned int _delay,
+                                  int          _mirrored);
+
 // create delay buffer object with '_delay' samples
 WDELAY() WDELAY(_create)(unsigned int _delay)
+{
+    return WDELAY(_create_internal)(_delay, liquid_mirror_get_default());
+}
+
+// create delay buffer object with '_delay' samples using mirrored memory
+WDELAY() WDELAY(_create_mirrored)(unsigned int _delay)
+{
+    return WDELAY(_create_internal)(_delay, 1);
+}
+
+// create delay buffer object with regular or mirrored memory
+WDELAY() WDELAY(_create_internal)(unsigned int _delay,
+                                  int          _mirrored)
 {
     // create main object
     WDELAY() q = (WDELAY()) malloc(sizeof(struct WDELAY(_s)));
 
     // set internal values
     q->delay = _delay;
+    q->v     = NULL;
+
+    // mirrored memory: ring of at least delay+1 elements (power of two)
+    // where read_index is the position of the next write
+    q->mirrored = 0;
+    if (_mirrored) {
+        size_t size = (q->delay+1)*sizeof(T);
+        q->v = (T*) liquid_mirror_malloc(&size);
+        if (q->v != NULL) {
+            q->mirrored      = 1;
+            q->num_allocated = size / sizeof(T);
+        } else {
+            liquid_log_debug("wdelay%s_create(), mirrored memory not available", EXTENSION);
+        }
+    }
 
     // allocate memory
-    q->v = (T*) malloc((q->delay+1)*sizeof(T));
+    if (!q->mirrored) {
+        q->num_allocated = q->delay+1;
+        q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+    }
     q->read_index = 0;
 
     // clear window
@@ -65,12 +102,14 @@ WDELAY() WDELAY(_recreate)(WDELAY()     _q,
     unsigned int ktmp = _q->delay+1;
     T * vtmp = (T*) malloc((_q->delay+1) * sizeof(T));
     unsigned int i;
+    unsigned int offset = _q->mirrored ? _q->num_allocated - _q->delay - 1 : 0;
     for (i=0; i<_q->delay+1; i++)
-        vtmp[i] = _q->v[ (i + _q->read_index) % (_q->delay+1) ];
+        vtmp[i] = _q->v[ (i + _q->read_index + offset) % _q->num_allocated ];
     
     // destroy object and re-create it
+    int mirrored = _q->mirrored;
     WDELAY(_destroy)(_q);
-    _q = WDELAY(_create)(_delay);
+    _q = WDELAY(_create_internal)(_delay, mirrored);
 
     // push old values
     for (i=0; i<ktmp; i++)
@@ -95,8 +134,17 @@ WDELAY() WDELAY(_copy)(WDELAY() q_orig)
     memmove(q_copy, q_orig, sizeof(struct WDELAY(_s)));
 
     // allocate and copy full memory array
-    q_copy->v = (T*) malloc((q_copy->delay+1)*sizeof(T));
-    memmove(q_copy->v, q_orig->v, (q_copy->delay+1)*sizeof(T));
+    if (q_orig->mirrored) {
+        size_t size = q_orig->num_allocated*sizeof(T);
+        q_copy->v = (T*) liquid_mirror_malloc(&size);
+        if (q_copy->v == NULL) {
+            free(q_copy);
+            return liquid_error_config("wdelay%s_copy(), could not allocate mirrored memory", EXTENSION);
+        }
+    } else {
+        q_copy->v = (T*) malloc((q_copy->num_allocated)*sizeof(T));
+    }
+    memmove(q_copy->v, q_orig->v, (q_copy->num_allocated)*sizeof(T));
 
     // return new object
     return q_copy;
@@ -106,7 +154,10 @@ WDELAY() WDELAY(_copy)(WDELAY() q_orig)
 int WDELAY(_destroy)(WDELAY() _q)
 {
     // free internal array buffer
-    free(_q->v);
+    if (_q->mirrored)
+        liquid_mirror_free(_q->v, _q->num_allocated*sizeof(T));
+    else
+        free(_q->v);
 
     // free main object memory
     free(_q);
@@ -124,7 +175,7 @@ int WDELAY(_print)(WDELAY() _q)
 int WDELAY(_reset)(WDELAY() _q)
 {
     _q->read_index = 0;
-    memset(_q->v, 0, (_q->delay+1)*sizeof(T));
+    memset(_q->v, 0, (_q->num_allocated)*sizeof(T));
     return LIQUID_OK;
 }
 
@@ -135,7 +186,10 @@ int WDELAY(_read)(WDELAY() _q,
                   T *      _v)
 {
     // return value at end of buffer
-    *_v = _q->v[_q->read_index];
+    if (_q->mirrored)
+        *_v = _q->v[(_q->read_index + _q->num_allocated - _q->delay - 1) & (_q->num_allocated-1)];
+    else
+        *_v = _q->v[_q->read_index];
     return LIQUID_OK;
 }
 
@@ -152,7 +206,49 @@ int WDELAY(_push)(WDELAY() _q,
     _q->read_index++;
 
     // wrap around pointer
-    _q->read_index %= (_q->delay+1);
+    _q->read_index %= _q->num_allocated;
+    return LIQUID_OK;
+}
+
+// push block of samples into delay buffer object and read the delayed
+// samples out, equivalent to _n push/read operations
+//  _q  :   delay buffer object
+//  _x  :   input array [size: _n x 1]
+//  _n  :   number of samples
+//  _y  :   output array [size: _n x 1]
+int WDELAY(_execute_block)(WDELAY()     _q,
+                           T *          _x,
+                           unsigned int _n,
+                           T *          _y)
+{
+    unsigned int i;
+    if (!_q->mirrored) {
+        for (i=0; i<_n; i++) {
+            WDELAY(_push)(_q, _x[i]);
+            WDELAY(_read)(_q, &_y[i]);
+        }
+        return LIQUID_OK;
+    }
+
+    // mirrored memory: copy contiguous runs in and out of the ring; each
+    // run may overwrite only samples that have already been delayed
+    unsigned int N    = _q->num_allocated;
+    unsigned int mask = N - 1;
+    while (_n > 0) {
+        unsigned int k = _n < N - _q->delay ? _n : N - _q->delay;
+        memmove(_q->v + _q->read_index, _x, k*sizeof(T));
+        memmove(_y, _q->v + ((_q->read_index + N - _q->delay) & mask), k*sizeof(T));
+        _q->read_index = (_q->read_index + k) & mask;
+        _x += k;
+        _y += k;
+        _n -= k;
+    }
     return LIQUID_OK;
 }
 
+// is delay buffer using mirrored memory?
+int WDELAY(_is_mirrored)(WDELAY() _q)
+{
+    return _q->mirrored;
+}
+
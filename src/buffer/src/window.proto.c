@@ -39,10 +39,28 @@ struct WINDOW(_s) {
     unsigned int num_allocated; // number of elements allocated
                                 // in memory
     unsigned int read_index;
+    int mirrored;               // memory is mapped twice (v[i] == v[i+n])
 };
 
+// create window buffer object with regular or mirrored memory
+WINDOW() WINDOW(_create_internal)(unsigned int _n,
+                                  int          _mirrored);
+
 // create window buffer object of length _n
 WINDOW() WINDOW(_create)(unsigned int _n)
+{
+    return WINDOW(_create_internal)(_n, liquid_mirror_get_default());
+}
+
+// create window buffer object of length _n using mirrored memory
+WINDOW() WINDOW(_create_mirrored)(unsigned int _n)
+{
+    return WINDOW(_create_internal)(_n, 1);
+}
+
+// create window buffer object with regular or mirrored memory
+WINDOW() WINDOW(_create_internal)(unsigned int _n,
+                                  int          _mirrored)
 {
     // validate input
     if (_n == 0)
@@ -56,12 +74,31 @@ WINDOW() WINDOW(_create)(unsigned int _n)
     q->m    = liquid_msb_index(_n); // effectively floor(log2(len))+1
     q->n    = 1<<(q->m);            // 2^m
     q->mask = q->n - 1;             // bit mask
+    q->v    = NULL;
+
+    // mirrored memory: ring of n >= len elements, read any window in place
+    q->mirrored = 0;
+    if (_mirrored) {
+        size_t size = q->len*sizeof(T);
+        q->v = (T*) liquid_mirror_malloc(&size);
+        if (q->v != NULL) {
+            q->mirrored      = 1;
+            q->n             = size / sizeof(T);
+            q->mask          = q->n - 1;
+            q->num_allocated = q->n;
+        } else {
+            liquid_log_debug("window%s_create(), mirrored memory not available", EXTENSION);
+        }
+    }
 
-    // number of elements to allocate to memory
-    q->num_allocated = q->n + q->len - 1;
+    // regular memory: copy last len-1 elements to start of array on wrap
+    if (!q->mirrored) {
+        // number of elements to allocate to memory
+        q->num_allocated = q->n + q->len - 1;
 
-    // allocate memory
-    q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+        // allocate memory
+        q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+    }
     q->read_index = 0;
 
     // reset window
@@ -82,7 +119,7 @@ WINDOW() WINDOW(_recreate)(WINDOW() _q, unsigned int _n)
         return _q;
 
     // create new window
-    WINDOW() w = WINDOW(_create)(_n);
+    WINDOW() w = WINDOW(_create_internal)(_n, _q->mirrored);
 
     // copy old values
     T* r;
@@ -119,7 +156,17 @@ WINDOW() WINDOW(_copy)(WINDOW() q_orig)
     memmove(q_copy, q_orig, sizeof(struct WINDOW(_s)));
 
     // allocate and copy full memory array
-    q_copy->v = (T*) liquid_malloc_copy(q_copy->v, q_copy->num_allocated, sizeof(T));
+    if (q_orig->mirrored) {
+        size_t size = q_orig->n*sizeof(T);
+        q_copy->v = (T*) liquid_mirror_malloc(&size);
+        if (q_copy->v == NULL) {
+            free(q_copy);
+            return liquid_error_config("window%s_copy(), could not allocate mirrored memory", EXTENSION);
+        }
+        memmove(q_copy->v, q_orig->v, q_orig->n*sizeof(T));
+    } else {
+        q_copy->v = (T*) liquid_malloc_copy(q_copy->v, q_copy->num_allocated, sizeof(T));
+    }
 
     // return new object
     return q_copy;
@@ -129,7 +176,10 @@ WINDOW() WINDOW(_copy)(WINDOW() q_orig)
 int WINDOW(_destroy)(WINDOW() _q)
 {
     // free internal memory array
-    free(_q->v);
+    if (_q->mirrored)
+        liquid_mirror_free(_q->v, _q->n*sizeof(T));
+    else
+        free(_q->v);
 
     // free main object memory
     free(_q);
@@ -224,6 +274,12 @@ int WINDOW(_push)(WINDOW() _q, T _v)
     // wrap around pointer
     _q->read_index &= _q->mask;
 
+    // mirrored memory: write through the alias, no copy needed on wrap
+    if (_q->mirrored) {
+        _q->v[(_q->read_index + _q->len - 1) & _q->mask] = _v;
+        return LIQUID_OK;
+    }
+
     // if pointer wraps around, copy excess memory
     if (_q->read_index == 0)
         memmove(_q->v, _q->v + _q->n, (_q->len-1)*sizeof(T));
@@ -241,6 +297,18 @@ int WINDOW(_write)(WINDOW()     _q,
                    T *          _v,
                    unsigned int _n)
 {
+    // mirrored memory: copy contiguous runs of up to n elements
+    if (_q->mirrored) {
+        while (_n > 0) {
+            unsigned int k = _n < _q->n ? _n : _q->n;
+            memmove(_q->v + ((_q->read_index + _q->len) & _q->mask), _v, k*sizeof(T));
+            _q->read_index = (_q->read_index + k) & _q->mask;
+            _v += k;
+            _n -= k;
+        }
+        return LIQUID_OK;
+    }
+
     // TODO make this more efficient
     unsigned int i;
     for (i=0; i<_n; i++)
@@ -248,3 +316,9 @@ int WINDOW(_write)(WINDOW()     _q,
     return LIQUID_OK;
 }
 
+// is window using mirrored memory?
+int WINDOW(_is_mirrored)(WINDOW() _q)
+{
+    return _q->mirrored;
+}
+
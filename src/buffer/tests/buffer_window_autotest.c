@@ -175,3 +175,89 @@ LIQUID_AUTOTEST(window_copy,"","",0.1)
     windowcf_destroy(q1);
 }
 
+
+// compare mirrored window against regular window
+void testbench_window_mirrored(liquid_autotest __q__,
+                               unsigned int    _wlen)
+{
+    windowcf q0 = windowcf_create(_wlen);
+    windowcf q1 = windowcf_create_mirrored(_wlen);
+    if (!liquid_mirror_is_available())
+        LIQUID_WARN("mirrored memory unavailable; testing regular memory");
+    LIQUID_CHECK(windowcf_is_mirrored(q0) == 0);
+    LIQUID_CHECK(windowcf_is_mirrored(q1) == liquid_mirror_is_available());
+
+    // push and write random amounts, wrapping the ring several times
+    unsigned int i, j, buf_len = 3*_wlen + 7;
+    float complex buf[buf_len], v0, v1;
+    float complex * r0, * r1;
+    for (i=0; i<200; i++) {
+        unsigned int n = rand() % buf_len;
+        for (j=0; j<n; j++)
+            buf[j] = randnf() + _Complex_I*randnf();
+        if (i % 3) {
+            windowcf_write(q0, buf, n);
+            windowcf_write(q1, buf, n);
+        } else {
+            for (j=0; j<n; j++) {
+                windowcf_push(q0, buf[j]);
+                windowcf_push(q1, buf[j]);
+            }
+        }
+        windowcf_read(q0, &r0);
+        windowcf_read(q1, &r1);
+        LIQUID_CHECK_ARRAY(r0, r1, _wlen*sizeof(float complex));
+        windowcf_index(q0, _wlen-1, &v0);
+        windowcf_index(q1, _wlen-1, &v1);
+        LIQUID_CHECK(v0 == v1);
+    }
+
+    // copy and recreate retain memory type and contents
+    windowcf q2 = windowcf_copy(q1);
+    LIQUID_CHECK(windowcf_is_mirrored(q2) == windowcf_is_mirrored(q1));
+    q0 = windowcf_recreate(q0, 2*_wlen);
+    q2 = windowcf_recreate(q2, 2*_wlen);
+    LIQUID_CHECK(windowcf_is_mirrored(q2) == windowcf_is_mirrored(q1));
+    windowcf_read(q0, &r0);
+    windowcf_read(q2, &r1);
+    LIQUID_CHECK_ARRAY(r0, r1, 2*_wlen*sizeof(float complex));
+
+    // reset
+    windowcf_reset(q2);
+    windowcf_read(q2, &r1);
+    for (i=0; i<2*_wlen; i++)
+        LIQUID_CHECK(r1[i] == 0);
+
+    windowcf_destroy(q0);
+    windowcf_destroy(q1);
+    windowcf_destroy(q2);
+}
+
+LIQUID_AUTOTEST(window_mirrored_1,   "","",0.1) { testbench_window_mirrored(__q__,    1); }
+LIQUID_AUTOTEST(window_mirrored_13,  "","",0.1) { testbench_window_mirrored(__q__,   13); }
+LIQUID_AUTOTEST(window_mirrored_512, "","",0.1) { testbench_window_mirrored(__q__,  512); }
+LIQUID_AUTOTEST(window_mirrored_1500,"","",0.1) { testbench_window_mirrored(__q__, 1500); }
+
+LIQUID_AUTOTEST(window_mirrored_default,"","",0.1)
+{
+    // objects created internally pick up the default memory type
+    LIQUID_CHECK(liquid_mirror_get_default() == 0);
+    if (!liquid_mirror_is_available()) {
+        LIQUID_WARN("mirrored memory unavailable");
+        return;
+    }
+    liquid_mirror_set_default(1);
+    windowf  q0 = windowf_create(20);
+    cbufferf q1 = cbufferf_create(20);
+    wdelayf  q2 = wdelayf_create(20);
+    liquid_mirror_set_default(0);
+    windowf  q3 = windowf_create(20);
+    LIQUID_CHECK(windowf_is_mirrored (q0) == 1);
+    LIQUID_CHECK(cbufferf_is_mirrored(q1) == 1);
+    LIQUID_CHECK(wdelayf_is_mirrored (q2) == 1);
+    LIQUID_CHECK(windowf_is_mirrored (q3) == 0);
+    windowf_destroy (q0);
+    cbufferf_destroy(q1);
+    wdelayf_destroy (q2);
+    windowf_destroy (q3);
+}
@@ -372,3 +372,76 @@ LIQUID_AUTOTEST(cbuffer_copy,"test cbuffer copy","",0.1)
     cbuffercf_destroy(q1);
 }
 
+
+LIQUID_AUTOTEST(cbufferf_mirrored_flow,"test mirrored cbuffer flow","",0.1)
+{
+    // options: odd buffer size so ring and buffer lengths differ
+    unsigned int max_size     =   1000; // maximum number of elements in buffer
+    unsigned int num_elements = 100000; // total number of elements for run
+
+    // create new circular buffer
+    cbufferf q = cbufferf_create_mirrored(max_size);
+    if (!liquid_mirror_is_available())
+        LIQUID_WARN("mirrored memory unavailable; testing regular memory");
+    LIQUID_CHECK(cbufferf_is_mirrored(q) == liquid_mirror_is_available());
+    LIQUID_CHECK(cbufferf_max_read(q) == max_size);
+
+    float write_buffer[max_size];
+    unsigned int i;
+    unsigned int write_id = 0;  // running total number of values written
+    unsigned int read_id  = 0;  // running total number of values read
+    int success = 1;
+    while (success && read_id < num_elements) {
+        // write random number of samples, occasionally one at a time
+        unsigned int num_available_to_write = cbufferf_space_available(q);
+        if (num_available_to_write > 0) {
+            unsigned int num_to_write = (rand() % num_available_to_write) + 1;
+            if (rand() % 4) {
+                for (i=0; i<num_to_write; i++)
+                    write_buffer[i] = (float)(write_id++);
+                cbufferf_write(q, write_buffer, num_to_write);
+            } else {
+                cbufferf_push(q, (float)(write_id++));
+            }
+        }
+
+        // read random number of samples, spanning the ring boundary
+        unsigned int num_available_to_read = cbufferf_size(q);
+        if (num_available_to_read > 0) {
+            unsigned int num_to_read = (rand() % num_available_to_read) + 1;
+            float *r;
+            unsigned int num_read;
+            cbufferf_read(q, num_to_read, &r, &num_read);
+            success &= (num_read == num_to_read);
+            for (i=0; i<num_read; i++)
+                success &= (r[i] == (float)(read_id + i));
+
+            // release all but possibly the last value, which is popped
+            if (num_read > 1 && (rand() % 2)) {
+                float v;
+                cbufferf_release(q, num_read-1);
+                cbufferf_pop(q, &v);
+                success &= (v == (float)(read_id + num_read - 1));
+            } else {
+                cbufferf_release(q, num_read);
+            }
+            read_id += num_read;
+        }
+    }
+    LIQUID_CHECK(success == 1);
+
+    // copy retains state and memory type
+    cbufferf q_copy = cbufferf_copy(q);
+    LIQUID_CHECK(cbufferf_is_mirrored(q_copy) == cbufferf_is_mirrored(q));
+    LIQUID_CHECK(cbufferf_size(q_copy) == cbufferf_size(q));
+    float *r0, *r1;
+    unsigned int n0, n1;
+    cbufferf_read(q,      max_size, &r0, &n0);
+    cbufferf_read(q_copy, max_size, &r1, &n1);
+    LIQUID_CHECK(n0 == n1);
+    LIQUID_CHECK_ARRAY(r0, r1, n0*sizeof(float));
+
+    // destroy objects
+    cbufferf_destroy(q);
+    cbufferf_destroy(q_copy);
+}
@@ -117,3 +117,59 @@ LIQUID_AUTOTEST(wdelay_copy,"test wdelay copy method","",0.1)
     wdelaycf_destroy(q1);
 }
 
+
+LIQUID_AUTOTEST(wdelay_mirrored,"test mirrored wdelay block execution","",0.1)
+{
+    unsigned int i, j, delay = 700;
+    wdelaycf q0 = wdelaycf_create(delay);
+    wdelaycf q1 = wdelaycf_create_mirrored(delay);
+    if (!liquid_mirror_is_available())
+        LIQUID_WARN("mirrored memory unavailable; testing regular memory");
+    LIQUID_CHECK(wdelaycf_is_mirrored(q1) == liquid_mirror_is_available());
+
+    // run blocks of random length, including longer than the delay
+    float complex x[3000], y0[3000], y1[3000], v0, v1;
+    for (i=0; i<40; i++) {
+        unsigned int n = rand() % 3000;
+        for (j=0; j<n; j++)
+            x[j] = randnf() + _Complex_I*randnf();
+        for (j=0; j<n; j++) {
+            wdelaycf_push(q0, x[j]);
+            wdelaycf_read(q0, &y0[j]);
+        }
+        if (i % 4) {
+            wdelaycf_execute_block(q1, x, n, y1);
+        } else {
+            for (j=0; j<n; j++) {
+                wdelaycf_push(q1, x[j]);
+                wdelaycf_read(q1, &y1[j]);
+            }
+        }
+        LIQUID_CHECK_ARRAY(y0, y1, n*sizeof(float complex));
+    }
+
+    // in-place block execution
+    for (j=0; j<500; j++)
+        x[j] = y0[j] = randnf();
+    wdelaycf_execute_block(q0, y0, 500, y0);
+    wdelaycf_execute_block(q1, x,  500, x);
+    LIQUID_CHECK_ARRAY(x, y0, 500*sizeof(float complex));
+
+    // copy and recreate retain state
+    wdelaycf q2 = wdelaycf_copy(q1);
+    q0 = wdelaycf_recreate(q0, delay+50);
+    q2 = wdelaycf_recreate(q2, delay+50);
+    LIQUID_CHECK(wdelaycf_is_mirrored(q2) == wdelaycf_is_mirrored(q1));
+    for (j=0; j<2000; j++)
+        x[j] = randnf();
+    wdelaycf_execute_block(q0, x, 2000, y0);
+    wdelaycf_execute_block(q2, x, 2000, y1);
+    LIQUID_CHECK_ARRAY(y0, y1, 2000*sizeof(float complex));
+    wdelaycf_read(q0, &v0);
+    wdelaycf_read(q2, &v1);
+    LIQUID_CHECK(v0 == v1);
+
+    wdelaycf_destroy(q0);
+    wdelaycf_destroy(q1);
+    wdelaycf_destroy(q2);
+}
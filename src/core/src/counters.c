@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// performance counter registry
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+#if BUILD_PTHREADS
+#include <pthread.h>
+static pthread_mutex_t liquid_counters_lock = PTHREAD_MUTEX_INITIALIZER;
+#  define LIQUID_COUNTERS_LOCK()   pthread_mutex_lock  (&liquid_counters_lock)
+#  define LIQUID_COUNTERS_UNLOCK() pthread_mutex_unlock(&liquid_counters_lock)
+#else
+#  define LIQUID_COUNTERS_LOCK()
+#  define LIQUID_COUNTERS_UNLOCK()
+#endif
+
+// registry: doubly-linked list of entries in order of creation
+static struct liquid_counter_entry_s * liquid_counters_head = NULL;
+static struct liquid_counter_entry_s * liquid_counters_tail = NULL;
+static unsigned int liquid_counters_num     = 0;
+static unsigned int liquid_counters_next_id = 0;
+
+// clear counter values and add entry to the global registry
+int liquid_counter_register(struct liquid_counter_entry_s * _entry,
+                            const char *                    _name)
+{
+    LIQUID_COUNTERS_LOCK();
+    _entry->value.name    = _name;
+    _entry->value.id      = liquid_counters_next_id++;
+    _entry->value.calls   = 0;
+    _entry->value.samples = 0;
+    _entry->value.cycles  = 0;
+    _entry->value.allocs  = 0;
+    _entry->value.bytes   = 0;
+
+    // append to end of list
+    _entry->prev = liquid_counters_tail;
+    _entry->next = NULL;
+    if (liquid_counters_tail != NULL)
+        liquid_counters_tail->next = _entry;
+    else
+        liquid_counters_head = _entry;
+    liquid_counters_tail = _entry;
+    liquid_counters_num++;
+    LIQUID_COUNTERS_UNLOCK();
+    return LIQUID_OK;
+}
+
+// remove entry from the global registry
+int liquid_counter_unregister(struct liquid_counter_entry_s * _entry)
+{
+    LIQUID_COUNTERS_LOCK();
+    if (_entry->prev != NULL) _entry->prev->next = _entry->next;
+    else                      liquid_counters_head = _entry->next;
+    if (_entry->next != NULL) _entry->next->prev = _entry->prev;
+    else                      liquid_counters_tail = _entry->prev;
+    _entry->prev = NULL;
+    _entry->next = NULL;
+    liquid_counters_num--;
+    LIQUID_COUNTERS_UNLOCK();
+    return LIQUID_OK;
+}
+
+// return flag indicating if counters were enabled at compile time
+int liquid_counters_enabled(void)
+{
+    return COUNTERS_ENABLED;
+}
+
+// get number of objects currently registered
+unsigned int liquid_counters_get_num(void)
+{
+    LIQUID_COUNTERS_LOCK();
+    unsigned int num = liquid_counters_num;
+    LIQUID_COUNTERS_UNLOCK();
+    return num;
+}
+
+// invoke callback for each registered counter in order of creation
+int liquid_counters_foreach(liquid_counters_callback _callback,
+                            void *                   _context)
+{
+    LIQUID_COUNTERS_LOCK();
+    int rc = LIQUID_OK;
+    struct liquid_counter_entry_s * e;
+    for (e=liquid_counters_head; e!=NULL && rc==LIQUID_OK; e=e->next)
+        rc = _callback(&e->value, _context);
+    LIQUID_COUNTERS_UNLOCK();
+    return rc;
+}
+
+// clear values of all registered counters (allocations are retained)
+int liquid_counters_reset(void)
+{
+    LIQUID_COUNTERS_LOCK();
+    struct liquid_counter_entry_s * e;
+    for (e=liquid_counters_head; e!=NULL; e=e->next) {
+        e->value.calls   = 0;
+        e->value.samples = 0;
+        e->value.cycles  = 0;
+    }
+    LIQUID_COUNTERS_UNLOCK();
+    return LIQUID_OK;
+}
+
+// print single counter as a row of a table
+static int liquid_counters_print_callback(liquid_counter_s * _c,
+                                          void *             _context)
+{
+    printf("  %-24s %6u %12llu %14llu %16llu %8.2f %6llu %10llu\n",
+        _c->name, _c->id, _c->calls, _c->samples, _c->cycles,
+        _c->samples > 0 ? (double)_c->cycles / (double)_c->samples : 0.0,
+        _c->allocs, _c->bytes);
+    return LIQUID_OK;
+}
+
+// print all registered counters to stdout
+int liquid_counters_print(void)
+{
+    if (!COUNTERS_ENABLED) {
+        printf("<liquid.counters, disabled>\n");
+        return LIQUID_OK;
+    }
+    printf("<liquid.counters, objects=%u>\n", liquid_counters_get_num());
+    printf("  %-24s %6s %12s %14s %16s %8s %6s %10s\n",
+        "name", "id", "calls", "samples", "cycles", "cyc/samp", "allocs", "bytes");
+    return liquid_counters_foreach(liquid_counters_print_callback, NULL);
+}
+
+// write single counter as JSON object
+static int liquid_counters_json_callback(liquid_counter_s * _c,
+                                         void *             _context)
+{
+    FILE ** fid = (FILE**) _context;
+    fprintf(fid[0], "%s\n    {\"name\":\"%s\", \"id\":%u, \"calls\":%llu, \"samples\":%llu, "
+                    "\"cycles\":%llu, \"allocs\":%llu, \"bytes\":%llu}",
+        fid[1] == NULL ? "" : ",",
+        _c->name, _c->id, _c->calls, _c->samples, _c->cycles, _c->allocs, _c->bytes);
+    fid[1] = fid[0]; // mark first entry written
+    return LIQUID_OK;
+}
+
+// export all registered counters to a JSON file
+int liquid_counters_export_json(const char * _filename)
+{
+    FILE * fid = fopen(_filename,"w");
+    if (fid == NULL)
+        return liquid_error(LIQUID_EIO,"liquid_counters_export_json(), could not open '%s' for writing", _filename);
+
+    fprintf(fid,"{\n");
+    fprintf(fid,"  \"enabled\": %s,\n", COUNTERS_ENABLED ? "true" : "false");
+    fprintf(fid,"  \"counters\": [");
+    FILE * context[2] = {fid, NULL};
+    liquid_counters_foreach(liquid_counters_json_callback, context);
+    fprintf(fid,"%s]\n}\n", context[1] == NULL ? "" : "\n  ");
+    fclose(fid);
+    return LIQUID_OK;
+}
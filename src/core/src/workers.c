@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// pool of worker threads
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+#if BUILD_PTHREADS
+#include <pthread.h>
+#endif
+
+// worker pool data structure
+struct liquid_workers_s
+{
+    unsigned int num_workers;       // number of workers, including caller
+
+#if BUILD_PTHREADS
+    pthread_t *  threads;           // helper threads [size: num_workers-1]
+    pthread_mutex_t lock;           // protects all fields below
+    pthread_cond_t  cond_start;     // signals new job (or shutdown)
+    pthread_cond_t  cond_done;      // signals all helpers have finished
+    unsigned long   job;            // job counter
+    unsigned int    num_pending;    // number of helpers still running job
+    int             shutdown;       // flag to exit helper threads
+    int             rc;             // first error returned by a helper
+    liquid_workers_callback * callback; // current job
+    void *          context;        // current job context
+#endif
+};
+
+#if BUILD_PTHREADS
+// arguments passed to each helper thread on creation
+struct liquid_workers_arg_s {
+    liquid_workers q;
+    unsigned int   index;
+};
+
+// helper thread main loop: wait for job, run it, report, repeat
+static void * liquid_workers_main(void * _arg)
+{
+    struct liquid_workers_arg_s * arg = (struct liquid_workers_arg_s *) _arg;
+    liquid_workers q = arg->q;
+    unsigned int index = arg->index;
+    free(arg);
+
+    unsigned long job = 0;
+    pthread_mutex_lock(&q->lock);
+    while (1) {
+        while (!q->shutdown && q->job == job)
+            pthread_cond_wait(&q->cond_start, &q->lock);
+        if (q->shutdown)
+            break;
+        job = q->job;
+        liquid_workers_callback * callback = q->callback;
+        void * context = q->context;
+        pthread_mutex_unlock(&q->lock);
+
+        int rc = callback(context, index, q->num_workers);
+
+        pthread_mutex_lock(&q->lock);
+        if (rc != LIQUID_OK && q->rc == LIQUID_OK)
+            q->rc = rc;
+        if (--q->num_pending == 0)
+            pthread_cond_signal(&q->cond_done);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return NULL;
+}
+#endif
+
+// create pool of workers
+liquid_workers liquid_workers_create(unsigned int _num_workers)
+{
+    if (_num_workers == 0)
+        return liquid_error_config("liquid_workers_create(), number of workers must be greater than zero");
+
+    liquid_workers q = (liquid_workers) malloc(sizeof(struct liquid_workers_s));
+    q->num_workers = _num_workers;
+
+#if BUILD_PTHREADS
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->cond_start, NULL);
+    pthread_cond_init(&q->cond_done, NULL);
+    q->job         = 0;
+    q->num_pending = 0;
+    q->shutdown    = 0;
+    q->rc          = LIQUID_OK;
+    q->callback    = NULL;
+    q->context     = NULL;
+
+    // caller acts as worker 0; spawn helpers for the remainder
+    q->threads = (pthread_t *) malloc((_num_workers-1)*sizeof(pthread_t));
+    unsigned int i;
+    for (i=1; i<_num_workers; i++) {
+        struct liquid_workers_arg_s * arg = (struct liquid_workers_arg_s *) malloc(sizeof(struct liquid_workers_arg_s));
+        arg->q     = q;
+        arg->index = i;
+        if (pthread_create(&q->threads[i-1], NULL, liquid_workers_main, arg) != 0) {
+            free(arg);
+            liquid_log_warn("liquid_workers_create(), could not create thread; using %u worker(s)", i);
+            q->num_workers = i;
+            break;
+        }
+    }
+#endif
+    return q;
+}
+
+// destroy pool of workers, joining all threads
+int liquid_workers_destroy(liquid_workers _q)
+{
+    if (_q == NULL)
+        return liquid_error(LIQUID_EIOBJ,"liquid_workers_destroy(), invalid null pointer passed");
+
+#if BUILD_PTHREADS
+    pthread_mutex_lock(&_q->lock);
+    _q->shutdown = 1;
+    pthread_cond_broadcast(&_q->cond_start);
+    pthread_mutex_unlock(&_q->lock);
+
+    unsigned int i;
+    for (i=1; i<_q->num_workers; i++)
+        pthread_join(_q->threads[i-1], NULL);
+    free(_q->threads);
+
+    pthread_cond_destroy(&_q->cond_done);
+    pthread_cond_destroy(&_q->cond_start);
+    pthread_mutex_destroy(&_q->lock);
+#endif
+    free(_q);
+    return LIQUID_OK;
+}
+
+// get number of workers in pool
+unsigned int liquid_workers_get_num_workers(liquid_workers _q)
+{
+    return _q->num_workers;
+}
+
+// run callback once for each worker index and wait for all to finish
+int liquid_workers_run(liquid_workers            _q,
+                       liquid_workers_callback * _callback,
+                       void *                    _context)
+{
+#if BUILD_PTHREADS
+    if (_q->num_workers > 1) {
+        // hand job to helper threads
+        pthread_mutex_lock(&_q->lock);
+        _q->callback    = _callback;
+        _q->context     = _context;
+        _q->rc          = LIQUID_OK;
+        _q->num_pending = _q->num_workers - 1;
+        _q->job++;
+        pthread_cond_broadcast(&_q->cond_start);
+        pthread_mutex_unlock(&_q->lock);
+
+        // run share of caller
+        int rc = _callback(_context, 0, _q->num_workers);
+
+        // wait for helpers to finish
+        pthread_mutex_lock(&_q->lock);
+        while (_q->num_pending > 0)
+            pthread_cond_wait(&_q->cond_done, &_q->lock);
+        if (rc == LIQUID_OK)
+            rc = _q->rc;
+        pthread_mutex_unlock(&_q->lock);
+        return rc;
+    }
+#endif
+
+    // run each share in turn
+    unsigned int i;
+    for (i=0; i<_q->num_workers; i++) {
+        int rc = _callback(_context, i, _q->num_workers);
+        if (rc != LIQUID_OK)
+            return rc;
+    }
+    return LIQUID_OK;
+}
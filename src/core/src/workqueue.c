@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// ordered work queue
+//
+// Jobs are written into a ring of slots by a single producer, processed
+// concurrently by background threads, and delivered one at a time in the
+// order in which they were submitted.  Each job carries a sequence number;
+// job n occupies slot n % num_slots, which becomes free again once job n
+// has been delivered.
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+#if BUILD_PTHREADS
+#include <pthread.h>
+#endif
+
+// work queue data structure
+struct liquid_workqueue_s
+{
+    unsigned int num_threads;       // number of background threads
+    unsigned int num_slots;         // number of job slots in ring
+    liquid_workqueue_callback * process;    // run concurrently per job
+    liquid_workqueue_callback * deliver;    // run in order per job
+    void *       context;           // user-defined context
+
+    unsigned long seq_submitted;    // number of jobs submitted
+    unsigned long seq_claimed;      // number of jobs claimed by a thread
+    unsigned long seq_delivered;    // number of jobs delivered
+
+#if BUILD_PTHREADS
+    pthread_t *     threads;        // background threads [size: num_threads]
+    pthread_mutex_t lock;           // protects sequence counters, shutdown
+    pthread_cond_t  cond;           // signals any change in state
+    int             shutdown;       // flag to exit background threads
+#endif
+};
+
+#if BUILD_PTHREADS
+// background thread main loop: claim next job, process it, wait for its
+// turn, deliver it, repeat
+static void * liquid_workqueue_main(void * _arg)
+{
+    liquid_workqueue q = (liquid_workqueue) _arg;
+
+    pthread_mutex_lock(&q->lock);
+    while (1) {
+        while (!q->shutdown && q->seq_claimed == q->seq_submitted)
+            pthread_cond_wait(&q->cond, &q->lock);
+        if (q->seq_claimed == q->seq_submitted)
+            break;  // shutting down with no outstanding work
+        unsigned long seq = q->seq_claimed++;
+        pthread_mutex_unlock(&q->lock);
+
+        unsigned int slot = seq % q->num_slots;
+        q->process(q->context, slot);
+
+        // deliver strictly in submission order
+        pthread_mutex_lock(&q->lock);
+        while (q->seq_delivered != seq)
+            pthread_cond_wait(&q->cond, &q->lock);
+        pthread_mutex_unlock(&q->lock);
+
+        q->deliver(q->context, slot);
+
+        pthread_mutex_lock(&q->lock);
+        q->seq_delivered++;
+        pthread_cond_broadcast(&q->cond);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return NULL;
+}
+#endif
+
+// create work queue
+liquid_workqueue liquid_workqueue_create(unsigned int                _num_threads,
+                                         unsigned int                _num_slots,
+                                         liquid_workqueue_callback * _process,
+                                         liquid_workqueue_callback * _deliver,
+                                         void *                      _context)
+{
+    if (_num_slots == 0)
+        return liquid_error_config("liquid_workqueue_create(), number of slots must be greater than zero");
+    if (_process == NULL || _deliver == NULL)
+        return liquid_error_config("liquid_workqueue_create(), callbacks cannot be NULL");
+
+    liquid_workqueue q = (liquid_workqueue) malloc(sizeof(struct liquid_workqueue_s));
+    q->num_threads   = 0;
+    q->num_slots     = _num_slots;
+    q->process       = _process;
+    q->deliver       = _deliver;
+    q->context       = _context;
+    q->seq_submitted = 0;
+    q->seq_claimed   = 0;
+    q->seq_delivered = 0;
+
+#if BUILD_PTHREADS
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->cond, NULL);
+    q->shutdown = 0;
+
+    q->threads = (pthread_t *) malloc(_num_threads*sizeof(pthread_t));
+    unsigned int i;
+    for (i=0; i<_num_threads; i++) {
+        if (pthread_create(&q->threads[i], NULL, liquid_workqueue_main, q) != 0) {
+            liquid_log_warn("liquid_workqueue_create(), could not create thread; using %u thread(s)", i);
+            break;
+        }
+        q->num_threads++;
+    }
+#endif
+    return q;
+}
+
+// destroy work queue, delivering all outstanding jobs and joining threads
+int liquid_workqueue_destroy(liquid_workqueue _q)
+{
+    if (_q == NULL)
+        return liquid_error(LIQUID_EIOBJ,"liquid_workqueue_destroy(), invalid null pointer passed");
+
+#if BUILD_PTHREADS
+    pthread_mutex_lock(&_q->lock);
+    _q->shutdown = 1;
+    pthread_cond_broadcast(&_q->cond);
+    pthread_mutex_unlock(&_q->lock);
+
+    unsigned int i;
+    for (i=0; i<_q->num_threads; i++)
+        pthread_join(_q->threads[i], NULL);
+    free(_q->threads);
+
+    pthread_cond_destroy(&_q->cond);
+    pthread_mutex_destroy(&_q->lock);
+#endif
+    free(_q);
+    return LIQUID_OK;
+}
+
+// get number of background threads
+unsigned int liquid_workqueue_get_num_threads(liquid_workqueue _q)
+{
+    return _q->num_threads;
+}
+
+// get number of slots in ring
+unsigned int liquid_workqueue_get_num_slots(liquid_workqueue _q)
+{
+    return _q->num_slots;
+}
+
+// wait until the slot for the next job is free and return its index
+unsigned int liquid_workqueue_acquire(liquid_workqueue _q)
+{
+#if BUILD_PTHREADS
+    if (_q->num_threads > 0) {
+        pthread_mutex_lock(&_q->lock);
+        while (_q->seq_submitted - _q->seq_delivered >= _q->num_slots)
+            pthread_cond_wait(&_q->cond, &_q->lock);
+        pthread_mutex_unlock(&_q->lock);
+    }
+#endif
+    return _q->seq_submitted % _q->num_slots;
+}
+
+// submit job written into most recently acquired slot
+int liquid_workqueue_submit(liquid_workqueue _q)
+{
+#if BUILD_PTHREADS
+    if (_q->num_threads > 0) {
+        pthread_mutex_lock(&_q->lock);
+        _q->seq_submitted++;
+        pthread_cond_broadcast(&_q->cond);
+        pthread_mutex_unlock(&_q->lock);
+        return LIQUID_OK;
+    }
+#endif
+
+    // no background threads: process and deliver immediately
+    unsigned int slot = _q->seq_submitted % _q->num_slots;
+    _q->seq_submitted++;
+    _q->seq_claimed++;
+    _q->process(_q->context, slot);
+    _q->deliver(_q->context, slot);
+    _q->seq_delivered++;
+    return LIQUID_OK;
+}
+
+// wait until all submitted jobs have been delivered
+int liquid_workqueue_flush(liquid_workqueue _q)
+{
+#if BUILD_PTHREADS
+    if (_q->num_threads > 0) {
+        pthread_mutex_lock(&_q->lock);
+        while (_q->seq_delivered != _q->seq_submitted)
+            pthread_cond_wait(&_q->cond, &_q->lock);
+        pthread_mutex_unlock(&_q->lock);
+    }
+#endif
+    return LIQUID_OK;
+}
+
+// get number of jobs submitted but not yet delivered
+unsigned int liquid_workqueue_get_num_pending(liquid_workqueue _q)
+{
+#if BUILD_PTHREADS
+    pthread_mutex_lock(&_q->lock);
+    unsigned int n = _q->seq_submitted - _q->seq_delivered;
+    pthread_mutex_unlock(&_q->lock);
+    return n;
+#else
+    return _q->seq_submitted - _q->seq_delivered;
+#endif
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "liquid.internal.h"
+#include "liquid.autotest.h"
+
+// find counter by name, copying its values
+static int counters_autotest_find(liquid_counter_s * _c,
+                                  void *             _context)
+{
+    liquid_counter_s * c = (liquid_counter_s*) _context;
+    if (strcmp(_c->name, c->name) != 0)
+        return LIQUID_OK;
+    memmove(c, _c, sizeof(liquid_counter_s));
+    return LIQUID_EICONFIG; // stop iterating
+}
+
+LIQUID_AUTOTEST(counters_firfilt,"firfilt counters","",0.1)
+{
+    unsigned int num_start = liquid_counters_get_num();
+    firfilt_crcf q = firfilt_crcf_create_kaiser(21, 0.2f, 60.0f, 0.0f);
+    LIQUID_CHECK(liquid_counters_get_num() == num_start + (liquid_counters_enabled() ? 1 : 0));
+
+    // run one sample at a time and then in a block
+    float complex buf[64];
+    unsigned int i;
+    for (i=0; i<64; i++)
+        buf[i] = 1.0f;
+    for (i=0; i<10; i++)
+        firfilt_crcf_execute_one(q, buf[i], buf+i);
+    firfilt_crcf_execute_block(q, buf, 64, buf);
+
+    liquid_counter_s c = {.name = "firfilt_crcf"};
+    int rc = liquid_counters_foreach(counters_autotest_find, &c);
+    if (!liquid_counters_enabled()) {
+        LIQUID_WARN("counters disabled at compile time; skipping value checks");
+        LIQUID_CHECK(rc == LIQUID_OK);
+    } else {
+        LIQUID_CHECK(rc      == LIQUID_EICONFIG);
+        LIQUID_CHECK(c.calls   == 11);
+        LIQUID_CHECK(c.samples == 74);
+        LIQUID_CHECK(c.cycles  >  0);
+        LIQUID_CHECK(c.allocs  >  0);
+        LIQUID_CHECK(c.bytes   >  0);
+
+        // reset clears run-time values but keeps allocations
+        LIQUID_CHECK(liquid_counters_reset() == LIQUID_OK);
+        liquid_counters_foreach(counters_autotest_find, &c);
+        LIQUID_CHECK(c.calls   == 0);
+        LIQUID_CHECK(c.samples == 0);
+        LIQUID_CHECK(c.cycles  == 0);
+        LIQUID_CHECK(c.allocs  >  0);
+    }
+
+    // destroying object removes it from the registry
+    firfilt_crcf_destroy(q);
+    LIQUID_CHECK(liquid_counters_get_num() == num_start);
+}
+
+LIQUID_AUTOTEST(counters_copy,"copied objects register separately","",0.1)
+{
+    unsigned int num_start = liquid_counters_get_num();
+    unsigned int num_obj   = liquid_counters_enabled() ? 1 : 0;
+    modemcf q0 = modemcf_create(LIQUID_MODEM_QPSK);
+    modemcf q1 = modemcf_copy(q0);
+    LIQUID_CHECK(liquid_counters_get_num() == num_start + 2*num_obj);
+    modemcf_destroy(q0);
+    LIQUID_CHECK(liquid_counters_get_num() == num_start + num_obj);
+
+    // copy remains valid after original is removed
+    unsigned int sym;
+    float complex x;
+    modemcf_modulate  (q1, 3, &x);
+    modemcf_demodulate(q1, x, &sym);
+    LIQUID_CHECK(sym == 3);
+    modemcf_destroy(q1);
+    LIQUID_CHECK(liquid_counters_get_num() == num_start);
+}
+
+LIQUID_AUTOTEST(counters_export,"export counters to file","",0.1)
+{
+    const char * filename = "autotest/logs/counters_autotest.json";
+    firfilt_rrrf q = firfilt_rrrf_create_kaiser(11, 0.2f, 60.0f, 0.0f);
+    float y;
+    firfilt_rrrf_execute_one(q, 1.0f, &y);
+    LIQUID_CHECK(liquid_counters_print() == LIQUID_OK);
+    LIQUID_CHECK(liquid_counters_export_json(filename) == LIQUID_OK);
+    firfilt_rrrf_destroy(q);
+
+    // check file contents
+    FILE * fid = fopen(filename,"r");
+    LIQUID_CHECK(fid != NULL);
+    if (fid == NULL)
+        return;
+    char buf[4096];
+    size_t n = fread(buf, 1, sizeof(buf)-1, fid);
+    buf[n] = '\0';
+    fclose(fid);
+    remove(filename);
+    LIQUID_CHECK(strstr(buf,"\"counters\"") != NULL);
+    if (liquid_counters_enabled())
+        LIQUID_CHECK(strstr(buf,"\"firfilt_rrrf\"") != NULL);
+}
+
+LIQUID_AUTOTEST(counters_config,"","",0.1)
+{
+    _liquid_error_downgrade_enable();
+    LIQUID_CHECK(liquid_counters_export_json("/dev/null/nonexistent.json") == LIQUID_EIO);
+    _liquid_error_downgrade_disable();
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+#include "liquid.internal.h"
+#include "liquid.autotest.h"
+
+// mark each element owned by worker
+static int workers_autotest_mark(void *       _context,
+                                 unsigned int _index,
+                                 unsigned int _num_workers)
+{
+    unsigned int * v = (unsigned int *) _context;
+    unsigned int i;
+    for (i=_index; i<1000; i+=_num_workers)
+        v[i] += _index + 1;
+    return LIQUID_OK;
+}
+
+// fail on last worker only
+static int workers_autotest_fail(void *       _context,
+                                 unsigned int _index,
+                                 unsigned int _num_workers)
+{
+    return _index == _num_workers-1 ? LIQUID_EINT : LIQUID_OK;
+}
+
+void testbench_workers(liquid_autotest __q__,
+                       unsigned int    _num_workers)
+{
+    liquid_workers q = liquid_workers_create(_num_workers);
+    LIQUID_CHECK(liquid_workers_get_num_workers(q) == _num_workers);
+
+    // run several jobs on same pool
+    unsigned int v[1000];
+    memset(v, 0x00, sizeof(v));
+    unsigned int i, k, num_jobs = 20;
+    for (k=0; k<num_jobs; k++)
+        LIQUID_CHECK(liquid_workers_run(q, workers_autotest_mark, v) == LIQUID_OK);
+    for (i=0; i<1000; i++)
+        LIQUID_CHECK(v[i] == num_jobs*(i % _num_workers + 1));
+
+    // error from any worker is returned
+    LIQUID_CHECK(liquid_workers_run(q, workers_autotest_fail, NULL) == LIQUID_EINT);
+    LIQUID_CHECK(liquid_workers_run(q, workers_autotest_mark, v) == LIQUID_OK);
+
+    liquid_workers_destroy(q);
+}
+
+LIQUID_AUTOTEST(workers_1,"single worker","",0.1) { testbench_workers(__q__, 1); }
+LIQUID_AUTOTEST(workers_2,"two workers",  "",0.1) { testbench_workers(__q__, 2); }
+LIQUID_AUTOTEST(workers_7,"seven workers","",0.1) { testbench_workers(__q__, 7); }
+
+LIQUID_AUTOTEST(workers_config,"","",0.1)
+{
+    _liquid_error_downgrade_enable();
+    LIQUID_CHECK(liquid_workers_create(0) == NULL);
+    LIQUID_CHECK(liquid_workers_destroy(NULL) != LIQUID_OK);
+    _liquid_error_downgrade_disable();
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+#include "liquid.internal.h"
+#include "liquid.autotest.h"
+
+// job slots and delivery log shared with callbacks
+struct workqueue_autotest_s {
+    unsigned int input [4];     // job input per slot
+    unsigned int output[4];     // job output per slot
+    unsigned int log[200];      // delivered outputs, in order
+    unsigned int num_delivered; // number of jobs delivered
+};
+
+// process job with variable amount of work so jobs finish out of order
+static int workqueue_autotest_process(void * _context, unsigned int _slot)
+{
+    struct workqueue_autotest_s * c = (struct workqueue_autotest_s *) _context;
+    unsigned int v = c->input[_slot];
+    unsigned int i, n = (v % 7) * 2000;
+    volatile unsigned int y = v;
+    for (i=0; i<n; i++)
+        y = y*1103515245u + 12345u;
+    c->output[_slot] = 3*v + 1;
+    return LIQUID_OK;
+}
+
+// log job output
+static int workqueue_autotest_deliver(void * _context, unsigned int _slot)
+{
+    struct workqueue_autotest_s * c = (struct workqueue_autotest_s *) _context;
+    c->log[c->num_delivered++] = c->output[_slot];
+    return LIQUID_OK;
+}
+
+void testbench_workqueue(liquid_autotest __q__,
+                         unsigned int    _num_threads)
+{
+    struct workqueue_autotest_s c;
+    memset(&c, 0x00, sizeof(c));
+    liquid_workqueue q = liquid_workqueue_create(_num_threads, 4,
+        workqueue_autotest_process, workqueue_autotest_deliver, &c);
+    LIQUID_CHECK(liquid_workqueue_get_num_slots(q) == 4);
+
+    // submit jobs, flushing partway through
+    unsigned int i, num_jobs = 200;
+    for (i=0; i<num_jobs; i++) {
+        unsigned int slot = liquid_workqueue_acquire(q);
+        LIQUID_CHECK(slot < 4);
+        c.input[slot] = i;
+        liquid_workqueue_submit(q);
+        if (i == num_jobs/2) {
+            liquid_workqueue_flush(q);
+            LIQUID_CHECK(c.num_delivered == i+1);
+            LIQUID_CHECK(liquid_workqueue_get_num_pending(q) == 0);
+        }
+    }
+
+    // destroying queue delivers outstanding jobs
+    liquid_workqueue_destroy(q);
+
+    // check all jobs were delivered in submission order
+    LIQUID_CHECK(c.num_delivered == num_jobs);
+    for (i=0; i<num_jobs; i++)
+        LIQUID_CHECK(c.log[i] == 3*i + 1);
+}
+
+LIQUID_AUTOTEST(workqueue_0,"inline",      "",0.1) { testbench_workqueue(__q__, 0); }
+LIQUID_AUTOTEST(workqueue_1,"one thread",  "",0.1) { testbench_workqueue(__q__, 1); }
+LIQUID_AUTOTEST(workqueue_3,"three threads","",0.1) { testbench_workqueue(__q__, 3); }
+
+LIQUID_AUTOTEST(workqueue_config,"","",0.1)
+{
+    _liquid_error_downgrade_enable();
+    LIQUID_CHECK(liquid_workqueue_create(1, 0, workqueue_autotest_process, workqueue_autotest_deliver, NULL) == NULL);
+    LIQUID_CHECK(liquid_workqueue_create(1, 4, NULL, workqueue_autotest_deliver, NULL) == NULL);
+    LIQUID_CHECK(liquid_workqueue_destroy(NULL) != LIQUID_OK);
+    _liquid_error_downgrade_disable();
+}
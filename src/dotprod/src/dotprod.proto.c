@@ -41,6 +41,11 @@ int DOTPROD(_execute_sse)   (DOTPROD() _q, TI * _x, TO * _y);
 int DOTPROD(_execute_avx)   (DOTPROD() _q, TI * _x, TO * _y);
 int DOTPROD(_execute_avx512)(DOTPROD() _q, TI * _x, TO * _y);
 
+// block execution methods
+int DOTPROD(_execute_block_port)  (DOTPROD() _q, TI * _x, unsigned int _n, TO * _y);
+int DOTPROD(_execute_block_avx)   (DOTPROD() _q, TI * _x, unsigned int _n, TO * _y);
+int DOTPROD(_execute_block_avx512)(DOTPROD() _q, TI * _x, unsigned int _n, TO * _y);
+
 // portable structured dot product object
 struct DOTPROD(_s) {
     // coefficients array; note that complex coefficients are
@@ -57,6 +62,9 @@ struct DOTPROD(_s) {
 
     // runtime execution method
     int (*execute)(DOTPROD() _q, TI * _x, TO * _y);
+
+    // runtime execution method (block of sliding outputs)
+    int (*execute_block)(DOTPROD() _q, TI * _x, unsigned int _n, TO * _y);
 };
 
 // basic dot product
@@ -242,8 +250,9 @@ DOTPROD() DOTPROD(_copy)(DOTPROD() q_orig)
     memmove(q_copy->hq, q_orig->hq, 2*(q_copy->n)*sizeof(T));
 #endif
 
-    // copy execution method
-    q_copy->execute = q_orig->execute;
+    // copy execution methods
+    q_copy->execute       = q_orig->execute;
+    q_copy->execute_block = q_orig->execute_block;
 
     // return new object
     return q_copy;
@@ -279,28 +288,34 @@ int DOTPROD(_runtime_select)(DOTPROD()        _q,
     switch (_select) {
     case LIQUID_RUNTIME_PORT:
         liquid_log_trace("dotprod_%s_runtime_select(), port", EXTENSION_FULL);
-        _q->execute = &DOTPROD(_execute_port);
+        _q->execute       = &DOTPROD(_execute_port);
+        _q->execute_block = &DOTPROD(_execute_block_port);
         return LIQUID_OK;
     case LIQUID_RUNTIME_NEON:
         liquid_log_trace("dotprod_%s_runtime_select(), neon", EXTENSION_FULL);
-        _q->execute = &DOTPROD(_execute_neon);
+        _q->execute       = &DOTPROD(_execute_neon);
+        _q->execute_block = &DOTPROD(_execute_block_port);
         return LIQUID_OK;
     case LIQUID_RUNTIME_SSE:
         liquid_log_trace("dotprod_%s_runtime_select(), sse", EXTENSION_FULL);
-        _q->execute = &DOTPROD(_execute_sse);
+        _q->execute       = &DOTPROD(_execute_sse);
+        _q->execute_block = &DOTPROD(_execute_block_port);
         return LIQUID_OK;
     case LIQUID_RUNTIME_AVX:
         liquid_log_trace("dotprod_%s_runtime_select(), avx", EXTENSION_FULL);
-        _q->execute = &DOTPROD(_execute_avx);
+        _q->execute       = &DOTPROD(_execute_avx);
+        _q->execute_block = &DOTPROD(_execute_block_avx);
         return LIQUID_OK;
     case LIQUID_RUNTIME_AVX512:
         liquid_log_trace("dotprod_%s_runtime_select(), avx512", EXTENSION_FULL);
-        _q->execute = &DOTPROD(_execute_avx512);
+        _q->execute       = &DOTPROD(_execute_avx512);
+        _q->execute_block = &DOTPROD(_execute_block_avx512);
         return LIQUID_OK;
     default:;
     }
 
-    _q->execute = &DOTPROD(_execute_port);
+    _q->execute       = &DOTPROD(_execute_port);
+    _q->execute_block = &DOTPROD(_execute_block_port);
     return liquid_error(LIQUID_EINT,
         "dotprod_%s_runtime_select(), invalid selection or mode not available (%d), falling back to portable version",
         EXTENSION_FULL, _select);
@@ -318,6 +333,21 @@ int DOTPROD(_execute)(DOTPROD() _q,
     return _q->execute(_q, _x, _y);
 }
 
+// execute structured dot product on a block of sliding inputs, viz.
+// _y[k] = dotprod(_x[k], ..., _x[k+n-1]) for k in [0,_n)
+//  _q      :   dot product object
+//  _x      :   input array [size: _n + n - 1 x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+int DOTPROD(_execute_block)(DOTPROD()    _q,
+                            TI *         _x,
+                            unsigned int _n,
+                            TO *         _y)
+{
+    // invoke runtime-specific method
+    return _q->execute_block(_q, _x, _n, _y);
+}
+
 //
 // internal
 //
@@ -404,3 +434,21 @@ int DOTPROD(_execute_port)(DOTPROD() _q,
     return LIQUID_OK;
 }
 
+
+// execute structured dot product on a block of sliding inputs
+// (portable version); this simply invokes the selected single-output
+// method for each output sample
+//  _q      :   dot product object
+//  _x      :   input array [size: _n + n - 1 x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+int DOTPROD(_execute_block_port)(DOTPROD()    _q,
+                                 TI *         _x,
+                                 unsigned int _n,
+                                 TO *         _y)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _q->execute(_q, &_x[i], &_y[i]);
+    return LIQUID_OK;
+}
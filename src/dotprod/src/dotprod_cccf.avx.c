@@ -241,6 +241,99 @@ dotprod_cccf_execute_avx(dotprod_cccf    _q,
     return dotprod_cccf_execute_avx_4(_q, _x, _y);
 }
 
+// execute structured dot product on a block of sliding inputs; each
+// pair of coefficient vectors is loaded once and applied to four
+// consecutive output samples before moving on
+//  _q      :   dotprod object
+//  _x      :   input array [size: _n + n - 1 x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+int __attribute__((target("avx")))
+dotprod_cccf_execute_block_avx(dotprod_cccf    _q,
+                               float complex * _x,
+                               unsigned int    _n,
+                               float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (n >> 3) << 3;
+
+    __m256 v;                       // input vector
+    __m256 hi;                      // coefficients vector (real)
+    __m256 hq;                      // coefficients vector (imag)
+    __m256 ci0, ci1, ci2, ci3;      // accumulators (v * hi), one for each output
+    __m256 cq0, cq1, cq2, cq3;      // accumulators (v * hq), one for each output
+
+    // aligned output array
+    float w[4][8] __attribute__((aligned(32)));
+
+    unsigned int i, j, k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast input as floating point array, offset by output index
+        float * x = (float*) &_x[k];
+
+        ci0 = _mm256_setzero_ps(); cq0 = _mm256_setzero_ps();
+        ci1 = _mm256_setzero_ps(); cq1 = _mm256_setzero_ps();
+        ci2 = _mm256_setzero_ps(); cq2 = _mm256_setzero_ps();
+        ci3 = _mm256_setzero_ps(); cq3 = _mm256_setzero_ps();
+
+        for (i=0; i<t; i+=8) {
+            // load coefficients into registers (aligned)
+            hi = _mm256_load_ps(&_q->hi[i]);
+            hq = _mm256_load_ps(&_q->hq[i]);
+
+            // multiply with four consecutive input windows and accumulate
+            v = _mm256_loadu_ps(&x[i+0]);
+            ci0 = _mm256_add_ps(ci0, _mm256_mul_ps(v, hi));
+            cq0 = _mm256_add_ps(cq0, _mm256_mul_ps(v, hq));
+
+            v = _mm256_loadu_ps(&x[i+2]);
+            ci1 = _mm256_add_ps(ci1, _mm256_mul_ps(v, hi));
+            cq1 = _mm256_add_ps(cq1, _mm256_mul_ps(v, hq));
+
+            v = _mm256_loadu_ps(&x[i+4]);
+            ci2 = _mm256_add_ps(ci2, _mm256_mul_ps(v, hi));
+            cq2 = _mm256_add_ps(cq2, _mm256_mul_ps(v, hq));
+
+            v = _mm256_loadu_ps(&x[i+6]);
+            ci3 = _mm256_add_ps(ci3, _mm256_mul_ps(v, hi));
+            cq3 = _mm256_add_ps(cq3, _mm256_mul_ps(v, hq));
+        }
+
+        // shuffle quadrature values and combine using addsub_ps()
+        ci0 = _mm256_addsub_ps(ci0, _mm256_shuffle_ps(cq0, cq0, _MM_SHUFFLE(2,3,0,1)));
+        ci1 = _mm256_addsub_ps(ci1, _mm256_shuffle_ps(cq1, cq1, _MM_SHUFFLE(2,3,0,1)));
+        ci2 = _mm256_addsub_ps(ci2, _mm256_shuffle_ps(cq2, cq2, _MM_SHUFFLE(2,3,0,1)));
+        ci3 = _mm256_addsub_ps(ci3, _mm256_shuffle_ps(cq3, cq3, _MM_SHUFFLE(2,3,0,1)));
+
+        // unload packed arrays
+        _mm256_store_ps(w[0], ci0);
+        _mm256_store_ps(w[1], ci1);
+        _mm256_store_ps(w[2], ci2);
+        _mm256_store_ps(w[3], ci3);
+
+        for (j=0; j<4; j++) {
+            // add in-phase and quadrature components
+            float complex total = (w[j][0] + w[j][2] + w[j][4] + w[j][6]) +
+                                  (w[j][1] + w[j][3] + w[j][5] + w[j][7]) * _Complex_I;
+
+            // cleanup
+            for (i=t/2; i<_q->n; i++)
+                total += _x[k+j+i] * ( _q->hi[2*i] + _q->hq[2*i]*_Complex_I );
+
+            // set return value
+            _y[k+j] = total;
+        }
+    }
+
+    // compute remaining outputs individually
+    for ( ; k<_n; k++)
+        dotprod_cccf_execute_avx(_q, &_x[k], &_y[k]);
+    return LIQUID_OK;
+}
+
 // build guard
 #else
 
@@ -252,6 +345,14 @@ int dotprod_cccf_execute_avx(dotprod_cccf    _q,
     return liquid_error(LIQUID_EICONFIG,"avx extensions not available");
 }
 
+int dotprod_cccf_execute_block_avx(dotprod_cccf    _q,
+                                   float complex * _x,
+                                   unsigned int    _n,
+                                   float complex * _y)
+{
+    return liquid_error(LIQUID_EICONFIG,"avx extensions not available");
+}
+
 // build guard
 #endif
 
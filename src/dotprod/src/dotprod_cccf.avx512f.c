@@ -242,6 +242,94 @@ dotprod_cccf_execute_avx512(dotprod_cccf    _q,
     return dotprod_cccf_execute_avx512_4(_q, _x, _y);
 }
 
+// execute structured dot product on a block of sliding inputs; each
+// pair of coefficient vectors is loaded once and applied to four
+// consecutive output samples before moving on
+//  _q      :   dotprod object
+//  _x      :   input array [size: _n + n - 1 x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+int __attribute__((target("avx512f,avx512dq,avx512vl,avx512bw,fma")))
+dotprod_cccf_execute_block_avx512(dotprod_cccf    _q,
+                                  float complex * _x,
+                                  unsigned int    _n,
+                                  float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (n >> 4) << 4;
+
+    __m512 v;                       // input vector
+    __m512 hi;                      // coefficients vector (real)
+    __m512 hq;                      // coefficients vector (imag)
+    __m512 ci0, ci1, ci2, ci3;      // accumulators (v * hi), one for each output
+    __m512 cq0, cq1, cq2, cq3;      // accumulators (v * hq), one for each output
+    __m512 one = _mm512_set1_ps(1.0f); // load ones into register
+
+    unsigned int i, j, k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast input as floating point array, offset by output index
+        float * x = (float*) &_x[k];
+
+        ci0 = _mm512_setzero_ps(); cq0 = _mm512_setzero_ps();
+        ci1 = _mm512_setzero_ps(); cq1 = _mm512_setzero_ps();
+        ci2 = _mm512_setzero_ps(); cq2 = _mm512_setzero_ps();
+        ci3 = _mm512_setzero_ps(); cq3 = _mm512_setzero_ps();
+
+        for (i=0; i<t; i+=16) {
+            // load coefficients into registers (aligned)
+            hi = _mm512_load_ps(&_q->hi[i]);
+            hq = _mm512_load_ps(&_q->hq[i]);
+
+            // multiply with four consecutive input windows and accumulate
+            v = _mm512_loadu_ps(&x[i+0]);
+            ci0 = _mm512_fmadd_ps(v, hi, ci0);
+            cq0 = _mm512_fmadd_ps(v, hq, cq0);
+
+            v = _mm512_loadu_ps(&x[i+2]);
+            ci1 = _mm512_fmadd_ps(v, hi, ci1);
+            cq1 = _mm512_fmadd_ps(v, hq, cq1);
+
+            v = _mm512_loadu_ps(&x[i+4]);
+            ci2 = _mm512_fmadd_ps(v, hi, ci2);
+            cq2 = _mm512_fmadd_ps(v, hq, cq2);
+
+            v = _mm512_loadu_ps(&x[i+6]);
+            ci3 = _mm512_fmadd_ps(v, hi, ci3);
+            cq3 = _mm512_fmadd_ps(v, hq, cq3);
+        }
+
+        // shuffle quadrature values and combine using fmaddsub_ps()
+        ci0 = _mm512_fmaddsub_ps(ci0, one, _mm512_shuffle_ps(cq0, cq0, _MM_SHUFFLE(2,3,0,1)));
+        ci1 = _mm512_fmaddsub_ps(ci1, one, _mm512_shuffle_ps(cq1, cq1, _MM_SHUFFLE(2,3,0,1)));
+        ci2 = _mm512_fmaddsub_ps(ci2, one, _mm512_shuffle_ps(cq2, cq2, _MM_SHUFFLE(2,3,0,1)));
+        ci3 = _mm512_fmaddsub_ps(ci3, one, _mm512_shuffle_ps(cq3, cq3, _MM_SHUFFLE(2,3,0,1)));
+
+        // fold down I/Q components into single values
+        float complex total[4];
+        total[0] = _mm512_mask_reduce_add_ps(0x5555, ci0) + _mm512_mask_reduce_add_ps(0xAAAA, ci0) * _Complex_I;
+        total[1] = _mm512_mask_reduce_add_ps(0x5555, ci1) + _mm512_mask_reduce_add_ps(0xAAAA, ci1) * _Complex_I;
+        total[2] = _mm512_mask_reduce_add_ps(0x5555, ci2) + _mm512_mask_reduce_add_ps(0xAAAA, ci2) * _Complex_I;
+        total[3] = _mm512_mask_reduce_add_ps(0x5555, ci3) + _mm512_mask_reduce_add_ps(0xAAAA, ci3) * _Complex_I;
+
+        for (j=0; j<4; j++) {
+            // cleanup
+            for (i=t/2; i<_q->n; i++)
+                total[j] += _x[k+j+i] * ( _q->hi[2*i] + _q->hq[2*i]*_Complex_I );
+
+            // set return value
+            _y[k+j] = total[j];
+        }
+    }
+
+    // compute remaining outputs individually
+    for ( ; k<_n; k++)
+        dotprod_cccf_execute_avx512(_q, &_x[k], &_y[k]);
+    return LIQUID_OK;
+}
+
 // build guard
 #else
 
@@ -253,6 +341,14 @@ int dotprod_cccf_execute_avx512(dotprod_cccf    _q,
     return liquid_error(LIQUID_EICONFIG,"avx512f extensions not available");
 }
 
+int dotprod_cccf_execute_block_avx512(dotprod_cccf    _q,
+                                      float complex * _x,
+                                      unsigned int    _n,
+                                      float complex * _y)
+{
+    return liquid_error(LIQUID_EICONFIG,"avx512f extensions not available");
+}
+
 // build guard
 #endif
 
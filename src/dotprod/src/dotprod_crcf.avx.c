@@ -181,6 +181,80 @@ dotprod_crcf_execute_avx(dotprod_crcf    _q,
     return dotprod_crcf_execute_avx_4(_q, _x, _y);
 }
 
+// execute structured dot product on a block of sliding inputs; each
+// coefficient vector is loaded once and applied to four consecutive
+// output samples before moving on
+//  _q      :   dotprod object
+//  _x      :   input array [size: _n + n - 1 x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+int __attribute__((target("avx")))
+dotprod_crcf_execute_block_avx(dotprod_crcf    _q,
+                               float complex * _x,
+                               unsigned int    _n,
+                               float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (n >> 3) << 3;
+
+    __m256 h;                   // coefficients vector
+    __m256 s0, s1, s2, s3;      // accumulators, one for each output
+
+    // aligned output array
+    float w[4][8] __attribute__((aligned(32)));
+
+    unsigned int i, j, k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast input as floating point array, offset by output index
+        float * x = (float*) &_x[k];
+
+        s0 = _mm256_setzero_ps();
+        s1 = _mm256_setzero_ps();
+        s2 = _mm256_setzero_ps();
+        s3 = _mm256_setzero_ps();
+
+        for (i=0; i<t; i+=8) {
+            // load coefficients into register (aligned)
+            h = _mm256_load_ps(&_q->h[i]);
+
+            // multiply with four consecutive input windows and accumulate
+            s0 = _mm256_add_ps(s0, _mm256_mul_ps(_mm256_loadu_ps(&x[i+0]), h));
+            s1 = _mm256_add_ps(s1, _mm256_mul_ps(_mm256_loadu_ps(&x[i+2]), h));
+            s2 = _mm256_add_ps(s2, _mm256_mul_ps(_mm256_loadu_ps(&x[i+4]), h));
+            s3 = _mm256_add_ps(s3, _mm256_mul_ps(_mm256_loadu_ps(&x[i+6]), h));
+        }
+
+        // unload packed arrays
+        _mm256_store_ps(w[0], s0);
+        _mm256_store_ps(w[1], s1);
+        _mm256_store_ps(w[2], s2);
+        _mm256_store_ps(w[3], s3);
+
+        for (j=0; j<4; j++) {
+            // add in-phase and quadrature components
+            float yi = w[j][0] + w[j][2] + w[j][4] + w[j][6];
+            float yq = w[j][1] + w[j][3] + w[j][5] + w[j][7];
+
+            // cleanup (note: n _must_ be even)
+            for (i=t; i<n; i+=2) {
+                yi += x[2*j+i  ] * _q->h[i  ];
+                yq += x[2*j+i+1] * _q->h[i+1];
+            }
+
+            // set return value
+            _y[k+j] = yi + _Complex_I*yq;
+        }
+    }
+
+    // compute remaining outputs individually
+    for ( ; k<_n; k++)
+        dotprod_crcf_execute_avx(_q, &_x[k], &_y[k]);
+    return LIQUID_OK;
+}
+
 // build guard
 #else
 
@@ -192,6 +266,14 @@ int dotprod_crcf_execute_avx(dotprod_crcf    _q,
     return liquid_error(LIQUID_EICONFIG,"avx extensions not available");
 }
 
+int dotprod_crcf_execute_block_avx(dotprod_crcf    _q,
+                                   float complex * _x,
+                                   unsigned int    _n,
+                                   float complex * _y)
+{
+    return liquid_error(LIQUID_EICONFIG,"avx extensions not available");
+}
+
 // build guard
 #endif
 
@@ -177,6 +177,74 @@ dotprod_crcf_execute_avx512(dotprod_crcf    _q,
     return dotprod_crcf_execute_avx512_4(_q, _x, _y);
 }
 
+// execute structured dot product on a block of sliding inputs; each
+// coefficient vector is loaded once and applied to four consecutive
+// output samples before moving on
+//  _q      :   dotprod object
+//  _x      :   input array [size: _n + n - 1 x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+int __attribute__((target("avx512f,avx512dq,avx512vl,avx512bw,fma")))
+dotprod_crcf_execute_block_avx512(dotprod_crcf    _q,
+                                  float complex * _x,
+                                  unsigned int    _n,
+                                  float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (n >> 4) << 4;
+
+    __m512 h;                   // coefficients vector
+    __m512 s0, s1, s2, s3;      // accumulators, one for each output
+
+    unsigned int i, j, k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast input as floating point array, offset by output index
+        float * x = (float*) &_x[k];
+
+        s0 = _mm512_setzero_ps();
+        s1 = _mm512_setzero_ps();
+        s2 = _mm512_setzero_ps();
+        s3 = _mm512_setzero_ps();
+
+        for (i=0; i<t; i+=16) {
+            // load coefficients into register (aligned)
+            h = _mm512_load_ps(&_q->h[i]);
+
+            // multiply with four consecutive input windows and accumulate
+            s0 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+0]), h, s0);
+            s1 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+2]), h, s1);
+            s2 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+4]), h, s2);
+            s3 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+6]), h, s3);
+        }
+
+        // reduce in-phase and quadrature components
+        float yi[4], yq[4];
+        yi[0] = _mm512_mask_reduce_add_ps(0x5555, s0); yq[0] = _mm512_mask_reduce_add_ps(0xAAAA, s0);
+        yi[1] = _mm512_mask_reduce_add_ps(0x5555, s1); yq[1] = _mm512_mask_reduce_add_ps(0xAAAA, s1);
+        yi[2] = _mm512_mask_reduce_add_ps(0x5555, s2); yq[2] = _mm512_mask_reduce_add_ps(0xAAAA, s2);
+        yi[3] = _mm512_mask_reduce_add_ps(0x5555, s3); yq[3] = _mm512_mask_reduce_add_ps(0xAAAA, s3);
+
+        for (j=0; j<4; j++) {
+            // cleanup (note: n _must_ be even)
+            for (i=t; i<n; i+=2) {
+                yi[j] += x[2*j+i  ] * _q->h[i  ];
+                yq[j] += x[2*j+i+1] * _q->h[i+1];
+            }
+
+            // set return value
+            _y[k+j] = yi[j] + _Complex_I*yq[j];
+        }
+    }
+
+    // compute remaining outputs individually
+    for ( ; k<_n; k++)
+        dotprod_crcf_execute_avx512(_q, &_x[k], &_y[k]);
+    return LIQUID_OK;
+}
+
 // build guard
 #else
 
@@ -188,6 +256,14 @@ int dotprod_crcf_execute_avx512(dotprod_crcf    _q,
     return liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
 }
 
+int dotprod_crcf_execute_block_avx512(dotprod_crcf    _q,
+                                      float complex * _x,
+                                      unsigned int    _n,
+                                      float complex * _y)
+{
+    return liquid_error(LIQUID_EICONFIG,"avx512f extensions not available");
+}
+
 // build guard
 #endif
 
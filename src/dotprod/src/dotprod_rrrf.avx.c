@@ -167,6 +167,72 @@ dotprod_rrrf_execute_avx(dotprod_rrrf _q,
     return dotprod_rrrf_execute_avx_4(_q, _x, _y);
 }
 
+// execute structured dot product on a block of sliding inputs; each
+// coefficient vector is loaded once and applied to four consecutive
+// output samples before moving on
+//  _q      :   dotprod object
+//  _x      :   input array [size: _n + n - 1 x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+int __attribute__((target("avx")))
+dotprod_rrrf_execute_block_avx(dotprod_rrrf _q,
+                               float *      _x,
+                               unsigned int _n,
+                               float *      _y)
+{
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_q->n >> 3) << 3;
+
+    __m256 h;                   // coefficients vector
+    __m256 s0, s1, s2, s3;      // accumulators, one for each output
+
+    // aligned output array
+    float w[8] __attribute__((aligned(32)));
+
+    unsigned int i, j, k;
+    for (k=0; k+4<=_n; k+=4) {
+        float * x = &_x[k];
+
+        s0 = _mm256_setzero_ps();
+        s1 = _mm256_setzero_ps();
+        s2 = _mm256_setzero_ps();
+        s3 = _mm256_setzero_ps();
+
+        for (i=0; i<t; i+=8) {
+            // load coefficients into register (aligned)
+            h = _mm256_load_ps(&_q->h[i]);
+
+            // multiply with four consecutive input windows and accumulate
+            s0 = _mm256_add_ps(s0, _mm256_mul_ps(_mm256_loadu_ps(&x[i+0]), h));
+            s1 = _mm256_add_ps(s1, _mm256_mul_ps(_mm256_loadu_ps(&x[i+1]), h));
+            s2 = _mm256_add_ps(s2, _mm256_mul_ps(_mm256_loadu_ps(&x[i+2]), h));
+            s3 = _mm256_add_ps(s3, _mm256_mul_ps(_mm256_loadu_ps(&x[i+3]), h));
+        }
+
+        // fold down into four values: {s0, s1, s2, s3, s0, s1, s2, s3}
+        s0 = _mm256_hadd_ps(s0, s1);
+        s2 = _mm256_hadd_ps(s2, s3);
+        s0 = _mm256_hadd_ps(s0, s2);
+        _mm256_store_ps(w, s0);
+
+        for (j=0; j<4; j++) {
+            float total = w[j] + w[j+4];
+
+            // cleanup
+            for (i=t; i<_q->n; i++)
+                total += x[j+i] * _q->h[i];
+
+            // set return value
+            _y[k+j] = total;
+        }
+    }
+
+    // compute remaining outputs individually
+    for ( ; k<_n; k++)
+        dotprod_rrrf_execute_avx(_q, &_x[k], &_y[k]);
+    return LIQUID_OK;
+}
+
 // build guard
 #else
 
@@ -178,6 +244,14 @@ int dotprod_rrrf_execute_avx(dotprod_rrrf _q,
     return liquid_error(LIQUID_EICONFIG,"avx extensions not available");
 }
 
+int dotprod_rrrf_execute_block_avx(dotprod_rrrf _q,
+                                   float *      _x,
+                                   unsigned int _n,
+                                   float *      _y)
+{
+    return liquid_error(LIQUID_EICONFIG,"avx extensions not available");
+}
+
 // build guard
 #endif
 
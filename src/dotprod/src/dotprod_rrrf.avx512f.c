@@ -149,6 +149,68 @@ dotprod_rrrf_execute_avx512(dotprod_rrrf _q,
     return dotprod_rrrf_execute_avx512_4(_q, _x, _y);
 }
 
+// execute structured dot product on a block of sliding inputs; each
+// coefficient vector is loaded once and applied to four consecutive
+// output samples before moving on
+//  _q      :   dotprod object
+//  _x      :   input array [size: _n + n - 1 x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+int __attribute__((target("avx512f,avx512dq,avx512vl,avx512bw,fma")))
+dotprod_rrrf_execute_block_avx512(dotprod_rrrf _q,
+                                  float *      _x,
+                                  unsigned int _n,
+                                  float *      _y)
+{
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_q->n >> 4) << 4;
+
+    __m512 h;                   // coefficients vector
+    __m512 s0, s1, s2, s3;      // accumulators, one for each output
+
+    unsigned int i, j, k;
+    for (k=0; k+4<=_n; k+=4) {
+        float * x = &_x[k];
+
+        s0 = _mm512_setzero_ps();
+        s1 = _mm512_setzero_ps();
+        s2 = _mm512_setzero_ps();
+        s3 = _mm512_setzero_ps();
+
+        for (i=0; i<t; i+=16) {
+            // load coefficients into register (aligned)
+            h = _mm512_load_ps(&_q->h[i]);
+
+            // multiply with four consecutive input windows and accumulate
+            s0 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+0]), h, s0);
+            s1 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+1]), h, s1);
+            s2 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+2]), h, s2);
+            s3 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+3]), h, s3);
+        }
+
+        // fold down into single values
+        float total[4];
+        total[0] = _mm512_reduce_add_ps(s0);
+        total[1] = _mm512_reduce_add_ps(s1);
+        total[2] = _mm512_reduce_add_ps(s2);
+        total[3] = _mm512_reduce_add_ps(s3);
+
+        for (j=0; j<4; j++) {
+            // cleanup
+            for (i=t; i<_q->n; i++)
+                total[j] += x[j+i] * _q->h[i];
+
+            // set return value
+            _y[k+j] = total[j];
+        }
+    }
+
+    // compute remaining outputs individually
+    for ( ; k<_n; k++)
+        dotprod_rrrf_execute_avx512(_q, &_x[k], &_y[k]);
+    return LIQUID_OK;
+}
+
 // build guard
 #else
 
@@ -160,6 +222,14 @@ int dotprod_rrrf_execute_avx512(dotprod_rrrf _q,
     return liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
 }
 
+int dotprod_rrrf_execute_block_avx512(dotprod_rrrf _q,
+                                      float *      _x,
+                                      unsigned int _n,
+                                      float *      _y)
+{
+    return liquid_error(LIQUID_EICONFIG,"avx512f extensions not available");
+}
+
 // build guard
 #endif
 
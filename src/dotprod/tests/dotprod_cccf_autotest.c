@@ -222,3 +222,37 @@ LIQUID_AUTOTEST(dotprod_cccf_struct_vs_ordinal,"compare structured object to ord
         testbench_dotprod_cccf(__q__, i);
 }
 
+
+// helper function (compare block execution to individual outputs)
+void testbench_dotprod_cccf_block(liquid_autotest __q__, unsigned int _n)
+{
+    float tol = 1e-3;
+    unsigned int num_outputs = 19;
+    float complex h[_n];
+    float complex x[_n + num_outputs - 1];
+
+    // generate random coefficients and inputs
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        h[i] = randnf() + randnf() * _Complex_I;
+    for (i=0; i<_n + num_outputs - 1; i++)
+        x[i] = randnf() + randnf() * _Complex_I;
+
+    // compute outputs with block and single-sample methods
+    dotprod_cccf dp = dotprod_cccf_create(h,_n);
+    float complex y_block[num_outputs], y_test;
+    dotprod_cccf_execute_block(dp, x, num_outputs, y_block);
+    for (i=0; i<num_outputs; i++) {
+        dotprod_cccf_execute(dp, &x[i], &y_test);
+        LIQUID_CHECK_DELTA(crealf(y_block[i]), crealf(y_test), tol);
+        LIQUID_CHECK_DELTA(cimagf(y_block[i]), cimagf(y_test), tol);
+    }
+    dotprod_cccf_destroy(dp);
+}
+
+LIQUID_AUTOTEST(dotprod_cccf_block,"compare block execution to individual outputs","",0.1)
+{
+    unsigned int i;
+    for (i=1; i<=80; i++)
+        testbench_dotprod_cccf_block(__q__, i);
+}
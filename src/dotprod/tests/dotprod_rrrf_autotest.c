@@ -375,3 +375,36 @@ LIQUID_AUTOTEST(dotprod_rrrf_struct_vs_ordinal,"compare structured object to ord
         testbench_dotprod_rrrf(__q__, i);
 }
 
+
+// helper function (compare block execution to individual outputs)
+void testbench_dotprod_rrrf_block(liquid_autotest __q__, unsigned int _n)
+{
+    float tol = 1e-3;
+    unsigned int num_outputs = 19;
+    float h[_n];
+    float x[_n + num_outputs - 1];
+
+    // generate random coefficients and inputs
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        h[i] = randnf();
+    for (i=0; i<_n + num_outputs - 1; i++)
+        x[i] = randnf();
+
+    // compute outputs with block and single-sample methods
+    dotprod_rrrf dp = dotprod_rrrf_create(h,_n);
+    float y_block[num_outputs], y_test;
+    dotprod_rrrf_execute_block(dp, x, num_outputs, y_block);
+    for (i=0; i<num_outputs; i++) {
+        dotprod_rrrf_execute(dp, &x[i], &y_test);
+        LIQUID_CHECK_DELTA(y_block[i], y_test, tol);
+    }
+    dotprod_rrrf_destroy(dp);
+}
+
+LIQUID_AUTOTEST(dotprod_rrrf_block,"compare block execution to individual outputs","",0.1)
+{
+    unsigned int i;
+    for (i=1; i<=80; i++)
+        testbench_dotprod_rrrf_block(__q__, i);
+}
@@ -84,3 +84,47 @@ void benchmark_eqlms_cccf_n16   EQLMS_CCCF_TRAIN_BENCH_API(16)
 void benchmark_eqlms_cccf_n32   EQLMS_CCCF_TRAIN_BENCH_API(32)
 void benchmark_eqlms_cccf_n64   EQLMS_CCCF_TRAIN_BENCH_API(64)
 
+
+#define EQLMS_CCCF_BLOCK_BENCH_API(N)   \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ eqlms_cccf_block_bench(_start, _finish, _num_iterations, N); }
+
+// Helper function to keep code base small
+void eqlms_cccf_block_bench(struct rusage *_start,
+                            struct rusage *_finish,
+                            unsigned long int *_num_iterations,
+                            unsigned int _h_len)
+{
+    // scale number of iterations appropriately, with block of 256 samples
+    *_num_iterations *= 3200;
+    *_num_iterations /= (unsigned int) expf(5.63f + 0.767f*logf(_h_len));
+    *_num_iterations /= 256;
+    *_num_iterations = (*_num_iterations < 4) ? 4 : *_num_iterations;
+
+    eqlms_cccf eq = eqlms_cccf_create(NULL,_h_len);
+
+    // generate input block
+    unsigned long int i;
+    float complex x[256];
+    float complex y[256];
+    for (i=0; i<256; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials: run equalizer on block, updating blindly on each sample
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        eqlms_cccf_execute_block(eq, 1, x, 256, y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 256;
+
+    eqlms_cccf_destroy(eq);
+}
+
+// 
+void benchmark_eqlms_cccf_block_n4    EQLMS_CCCF_BLOCK_BENCH_API(4)
+void benchmark_eqlms_cccf_block_n8    EQLMS_CCCF_BLOCK_BENCH_API(8)
+void benchmark_eqlms_cccf_block_n16   EQLMS_CCCF_BLOCK_BENCH_API(16)
+void benchmark_eqlms_cccf_block_n32   EQLMS_CCCF_BLOCK_BENCH_API(32)
+void benchmark_eqlms_cccf_block_n64   EQLMS_CCCF_BLOCK_BENCH_API(64)
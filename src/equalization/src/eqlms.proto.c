@@ -29,6 +29,13 @@
 #include <string.h>
 #include <stdio.h>
 
+// number of input samples processed at a time by block methods
+#define EQLMS_BLOCK_LEN (256)
+
+// filter length at which the vector kernels are used; shorter filters use
+// inline loops as the kernel dispatch overhead would dominate
+#define EQLMS_VECTOR_MIN_LEN (16)
+
 struct EQLMS(_s) {
     unsigned int h_len;     // filter length
     float        mu;        // LMS step size
@@ -36,18 +43,38 @@ struct EQLMS(_s) {
     // internal matrices
     T *          h0;        // initial coefficients
     T *          w0;        // weights [px1]
-    T *          w1;        // weights [px1]
 
     unsigned int count;     // input sample count
     int          buf_full;  // input buffer full flag
     WINDOW()     buffer;    // input buffer
     wdelayf      x2;        // buffer of |x|^2 values
     float        x2_sum;    // sum{ |x|^2 }
+
+    // block processing
+    T *          buf;       // contiguous input buffer [size: h_len+EQLMS_BLOCK_LEN x 1]
 };
 
 // update sum{|x|^2}
 int EQLMS(_update_sumsq)(EQLMS() _q, T _x);
 
+// compute weight update scale for one training cycle, zero if no update
+T EQLMS(_step_scale)(EQLMS() _q, T _d, T _d_hat);
+
+// compute conjugate dot product of weights with input vector _v
+static T EQLMS(_dotprod)(EQLMS() _q, T * _v);
+
+// update weights with _c*_u, then compute conjugate dot product with _v
+static T EQLMS(_update_dotprod)(EQLMS() _q, T _c, T * _u, T * _v);
+
+// run block of samples through equalizer, training on each output with
+// either the desired response or blindly at a decimation rate of _k
+int EQLMS(_run_block)(EQLMS()      _q,
+                      T *          _x,
+                      T *          _d,
+                      unsigned int _k,
+                      unsigned int _n,
+                      T *          _y);
+
 // create least mean-squares (LMS) equalizer object
 //  _h      :   initial coefficients [size: _h_len x 1], default if NULL
 //  _p      :   equalizer length (number of taps)
@@ -62,7 +89,7 @@ EQLMS() EQLMS(_create)(T *          _h,
 
     q->h0 = (T*) malloc((q->h_len)*sizeof(T));
     q->w0 = (T*) malloc((q->h_len)*sizeof(T));
-    q->w1 = (T*) malloc((q->h_len)*sizeof(T));
+    q->buf = (T*) malloc((q->h_len + EQLMS_BLOCK_LEN)*sizeof(T));
     q->buffer = WINDOW(_create)(q->h_len);
     q->x2     = wdelayf_create(q->h_len);
 
@@ -192,10 +219,11 @@ EQLMS() EQLMS(_copy)(EQLMS() q_orig)
     // create and copy buffers
     q_copy->h0 = (T*) malloc((q_copy->h_len)*sizeof(T));
     q_copy->w0 = (T*) malloc((q_copy->h_len)*sizeof(T));
-    q_copy->w1 = (T*) malloc((q_copy->h_len)*sizeof(T));
     memmove(q_copy->h0, q_orig->h0, q_copy->h_len*sizeof(T));
     memmove(q_copy->w0, q_orig->w0, q_copy->h_len*sizeof(T));
-    memmove(q_copy->w1, q_orig->w1, q_copy->h_len*sizeof(T));
+
+    // block processing buffer (contents are not retained between calls)
+    q_copy->buf = (T*) malloc((q_copy->h_len + EQLMS_BLOCK_LEN)*sizeof(T));
 
     // copy window and buffer objects
     q_copy->buffer = WINDOW(_copy)(q_orig->buffer);
@@ -209,7 +237,7 @@ int EQLMS(_destroy)(EQLMS() _q)
 {
     free(_q->h0);
     free(_q->w0);
-    free(_q->w1);
+    free(_q->buf);
 
     WINDOW(_destroy)(_q->buffer);
     wdelayf_destroy(_q->x2);
@@ -329,20 +357,11 @@ int EQLMS(_push_block)(EQLMS()      _q,
 int EQLMS(_execute)(EQLMS() _q,
                     T *     _y)
 {
-    T y = 0;    // temporary accumulator
     T * r;      // read buffer
     WINDOW(_read)(_q->buffer, &r);
 
     // compute conjugate vector dot product
-    //DOTPROD(_run)(_q->w0, r, _q->h_len, &y);
-    unsigned int i;
-    for (i=0; i<_q->h_len; i++) {
-        T sum = conj(_q->w0[i])*r[i];
-        y += sum;
-    }
-
-    // set output
-    *_y = y;
+    *_y = EQLMS(_dotprod)(_q, r);
     return LIQUID_OK;
 }
 
@@ -384,26 +403,9 @@ int EQLMS(_execute_block)(EQLMS()      _q,
     if (_k == 0)
         return liquid_error(LIQUID_EICONFIG,"eqlms_%s_execute_block(), down-sampling rate 'k' must be greater than 0", EXTENSION_FULL);
 
-    unsigned int i;
-    T d_hat;
-    for (i=0; i<_n; i++) {
-        // push input sample
-        EQLMS(_push)(_q, _x[i]);
-
-        // compute output sample
-        EQLMS(_execute)(_q, &d_hat);
-
-        // store result in output
-        _y[i] = d_hat;
-
-        // decimate by _k
-        if ( ((_q->count+_k-1) % _k) == 0 ) {
-            // update equalizer independent of the signal: estimate error
-            // assuming constant modulus signal
-            EQLMS(_step_blind)(_q, d_hat);
-        }
-    }
-    return LIQUID_OK;
+    // update equalizer independent of the signal: estimate error assuming
+    // constant modulus signal
+    return EQLMS(_run_block)(_q, _x, NULL, _k, _n, _y);
 }
 
 // step through one cycle of equalizer training
@@ -414,48 +416,19 @@ int EQLMS(_step)(EQLMS() _q,
                  T       _d,
                  T       _d_hat)
 {
-    // check count; only run step when buffer is full
-    if (!_q->buf_full) {
-        if (_q->count < _q->h_len)
-            return LIQUID_OK;
-        else
-            _q->buf_full = 1;
-    }
-
-    unsigned int i;
-
-    // compute error (a priori)
-    T alpha = _d - _d_hat;
+    // compute weight update scale
+    T c = EQLMS(_step_scale)(_q, _d, _d_hat);
+    if (c == 0)
+        return LIQUID_OK;
 
     // read buffer
     T * r;      // read buffer
     WINDOW(_read)(_q->buffer, &r);
 
-    // update weighting vector
-    // w[n+1] = w[n] + mu*conj(d-d_hat)*x[n]/(x[n]' * conj(x[n]))
-    if (_q->x2_sum > 0.0f) {
-        for (i=0; i<_q->h_len; i++)
-            _q->w1[i] = _q->w0[i] + (_q->mu)*conj(alpha)*r[i]/_q->x2_sum;
-    } else {
-        // sum is zero; just copy old coefficients
-        memmove(_q->w1, _q->w0, _q->h_len*sizeof(T));
-    }
-
-#if 0
-    printf("w0: \n");
-    for (i=0; i<_q->h_len; i++) {
-        PRINTVAL(_q->w0[i]);
-        printf("\n");
-    }
-    printf("w1: \n");
-    for (i=0; i<_q->h_len; i++) {
-        PRINTVAL(_q->w1[i]);
-        printf("\n");
-    }
-#endif
-
-    // copy old values
-    memmove(_q->w0, _q->w1, _q->h_len*sizeof(T));
+    // update weighting vector in place
+    unsigned int i;
+    for (i=0; i<_q->h_len; i++)
+        _q->w0[i] += c*r[i];
     return LIQUID_OK;
 }
 
@@ -501,17 +474,8 @@ int EQLMS(_train)(EQLMS()      _q,
     for (i=0; i<p; i++)
         _q->w0[i] = _w[p - i - 1];
 
-    T d_hat;
-    for (i=0; i<_n; i++) {
-        // push sample into internal buffer
-        EQLMS(_push)(_q, _x[i]);
-
-        // execute vector dot product
-        EQLMS(_execute)(_q, &d_hat);
-
-        // step through training cycle
-        EQLMS(_step)(_q, _d[i], d_hat);
-    }
+    // run training sequence through equalizer
+    EQLMS(_run_block)(_q, _x, _d, 1, _n, NULL);
 
     // copy output weight vector
     EQLMS(_copy_coefficients)(_q, _w);
@@ -543,3 +507,144 @@ int EQLMS(_update_sumsq)(EQLMS() _q, T _x)
     return LIQUID_OK;
 }
 
+// compute weight update scale for one training cycle, zero if no update
+//  _q      :   equalizer object
+//  _d      :   desired output
+//  _d_hat  :   filtered output
+T EQLMS(_step_scale)(EQLMS() _q,
+                     T       _d,
+                     T       _d_hat)
+{
+    // check count; only run step when buffer is full
+    if (!_q->buf_full) {
+        if (_q->count < _q->h_len)
+            return 0;
+        else
+            _q->buf_full = 1;
+    }
+
+    // sum is zero; keep old coefficients
+    if (_q->x2_sum <= 0.0f)
+        return 0;
+
+    // compute error (a priori)
+    T alpha = _d - _d_hat;
+
+    // w[n+1] = w[n] + mu*conj(d-d_hat)*x[n]/(x[n]' * conj(x[n]))
+    return (_q->mu)*conj(alpha)/_q->x2_sum;
+}
+
+// run block of samples through equalizer, training on each output with
+// either the desired response or blindly at a decimation rate of _k. The
+// weight update from each training cycle is applied in the same pass over
+// the coefficients as the filter output for the following sample.
+//  _q      :   equalizer object
+//  _x      :   input sample array [size: _n x 1]
+//  _d      :   desired output array [size: _n x 1], blind if NULL
+//  _k      :   down-sampling rate for blind training
+//  _n      :   input sample array length
+//  _y      :   output sample array [size: _n x 1], ignored if NULL
+int EQLMS(_run_block)(EQLMS()      _q,
+                      T *          _x,
+                      T *          _d,
+                      unsigned int _k,
+                      unsigned int _n,
+                      T *          _y)
+{
+    unsigned int p = _q->h_len;
+    unsigned int i, j;
+    for (i=0; i<_n; i+=EQLMS_BLOCK_LEN) {
+        unsigned int n = (_n - i) < EQLMS_BLOCK_LEN ? _n - i : EQLMS_BLOCK_LEN;
+
+        // arrange buffered samples followed by new inputs contiguously so
+        // the window for the j-th new sample starts at buf[j+1]
+        T * r;
+        WINDOW(_read)(_q->buffer, &r);
+        memmove(_q->buf,   r,      p*sizeof(T));
+        memmove(_q->buf+p, _x + i, n*sizeof(T));
+
+        T   c = 0;      // pending weight update scale
+        T * u = NULL;   // pending weight update input vector
+        for (j=0; j<n; j++) {
+            // update sum{|x|^2} with new and dropped samples
+            T x_new = _q->buf[p+j];
+            T x_old = _q->buf[j];
+            _q->x2_sum = _q->x2_sum + crealf(x_new*conjf(x_new)) - crealf(x_old*conjf(x_old));
+            _q->count++;
+
+            // compute output, applying any pending weight update
+            T * v = _q->buf + j + 1;
+            T d_hat = (c == 0) ? EQLMS(_dotprod)(_q, v) :
+                                 EQLMS(_update_dotprod)(_q, c, u, v);
+            c = 0;
+            if (_y != NULL)
+                _y[i+j] = d_hat;
+
+            // compute weight update for training cycle
+            if (_d != NULL) {
+                c = EQLMS(_step_scale)(_q, _d[i+j], d_hat);
+            } else if ( ((_q->count+_k-1) % _k) == 0 ) {
+#if T_COMPLEX
+                T d = d_hat / cabsf(d_hat);
+#else
+                T d = d_hat > 0 ? 1 : -1;
+#endif
+                c = EQLMS(_step_scale)(_q, d, d_hat);
+            }
+            u = v;
+        }
+
+        // apply weight update from last sample in block
+        if (c != 0) {
+            for (j=0; j<p; j++)
+                _q->w0[j] += c*u[j];
+        }
+
+        // update internal buffers with most recent samples
+        unsigned int m = n < p ? n : p;
+        T * x_tail = _q->buf + p + n - m;
+        WINDOW(_write)(_q->buffer, x_tail, m);
+        for (j=0; j<m; j++)
+            wdelayf_push(_q->x2, crealf(x_tail[j]*conjf(x_tail[j])));
+    }
+    return LIQUID_OK;
+}
+
+// compute conjugate dot product of weights with input vector
+//  _q      :   equalizer object
+//  _v      :   input vector [size: h_len x 1]
+static T EQLMS(_dotprod)(EQLMS() _q,
+                         T *     _v)
+{
+    if (_q->h_len >= EQLMS_VECTOR_MIN_LEN)
+        return VECTOR(_dotprod_conj)(_q->w0, _v, _q->h_len);
+
+    T y = 0;
+    unsigned int i;
+    for (i=0; i<_q->h_len; i++)
+        y += conj(_q->w0[i])*_v[i];
+    return y;
+}
+
+// update weights in place with _c*_u, then compute conjugate dot product
+// of updated weights with input vector _v
+//  _q      :   equalizer object
+//  _c      :   weight update scale
+//  _u      :   weight update input vector [size: h_len x 1]
+//  _v      :   input vector [size: h_len x 1]
+static T EQLMS(_update_dotprod)(EQLMS() _q,
+                                T       _c,
+                                T *     _u,
+                                T *     _v)
+{
+    if (_q->h_len >= EQLMS_VECTOR_MIN_LEN)
+        return VECTOR(_axpy_dotprod_conj)(_q->w0, _q->h_len, _c, _u, _v);
+
+    T y = 0;
+    unsigned int i;
+    for (i=0; i<_q->h_len; i++) {
+        _q->w0[i] += _c*_u[i];
+        y += conj(_q->w0[i])*_v[i];
+    }
+    return y;
+}
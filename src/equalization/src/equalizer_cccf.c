@@ -34,6 +34,7 @@
 #define EQRLS(name)     LIQUID_CONCAT(eqrls_cccf,name)
 
 #define DOTPROD(name)   LIQUID_CONCAT(dotprod_cccf,name)
+#define VECTOR(name)    LIQUID_CONCAT(liquid_vectorcf,name)
 #define WINDOW(name)    LIQUID_CONCAT(windowcf,name)
 #define MATRIX(name)    LIQUID_CONCAT(matrixcf,name)
 
@@ -34,6 +34,7 @@
 #define EQRLS(name)     LIQUID_CONCAT(eqrls_rrrf,name)
 
 #define DOTPROD(name)   LIQUID_CONCAT(dotprod_rrrf,name)
+#define VECTOR(name)    LIQUID_CONCAT(liquid_vectorf,name)
 #define WINDOW(name)    LIQUID_CONCAT(windowf,name)
 #define MATRIX(name)    LIQUID_CONCAT(matrixf,name)
 
@@ -229,3 +229,112 @@ LIQUID_AUTOTEST(eqlms_cccf_copy,"test copying eqlms object","",0.1)
     eqlms_cccf_destroy(q0);
     eqlms_cccf_destroy(q1);
 }
+
+// compare block execution against running each sample individually
+void testbench_eqlms_cccf_block(liquid_autotest __q__,
+                                unsigned int    _h_len,
+                                unsigned int    _k,
+                                unsigned int    _n)
+{
+    // create pair of objects
+    eqlms_cccf q0 = eqlms_cccf_create_lowpass(_h_len, 0.4f);
+    eqlms_cccf q1 = eqlms_cccf_create_lowpass(_h_len, 0.4f);
+    eqlms_cccf_set_bw(q0, 0.05f);
+    eqlms_cccf_set_bw(q1, 0.05f);
+
+    // generate QPSK-like input with some noise
+    unsigned int i;
+    float complex x[_n], y0[_n], y1[_n];
+    for (i=0; i<_n; i++) {
+        x[i] = ((rand() & 1) ? 1.0f : -1.0f) + ((rand() & 1) ? _Complex_I : -_Complex_I);
+        x[i] += 0.1f*(randnf() + _Complex_I*randnf());
+    }
+
+    // run samples individually, updating blindly every _k samples
+    for (i=0; i<_n; i++) {
+        eqlms_cccf_push(q0, x[i]);
+        eqlms_cccf_execute(q0, &y0[i]);
+        if ( ((i+1+_k-1) % _k) == 0 )
+            eqlms_cccf_step_blind(q0, y0[i]);
+    }
+
+    // run samples in irregularly-sized blocks
+    unsigned int n = 0, block_len = 1;
+    while (n < _n) {
+        unsigned int num = (_n - n) < block_len ? _n - n : block_len;
+        eqlms_cccf_execute_block(q1, _k, x + n, num, y1 + n);
+        n += num;
+        block_len = 3*block_len + 1;
+    }
+
+    // compare outputs and coefficients
+    float tol = 1e-4f;
+    for (i=0; i<_n; i++)
+        LIQUID_CHECK_DELTA(cabsf(y0[i] - y1[i]), 0, tol);
+    const float complex * w0 = eqlms_cccf_get_coefficients(q0);
+    const float complex * w1 = eqlms_cccf_get_coefficients(q1);
+    for (i=0; i<_h_len; i++)
+        LIQUID_CHECK_DELTA(cabsf(w0[i] - w1[i]), 0, tol);
+
+    eqlms_cccf_destroy(q0);
+    eqlms_cccf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(eqlms_cccf_block_p11_k1, "block execution, 11 taps, k=1","",0.1) { testbench_eqlms_cccf_block(__q__, 11, 1, 900); }
+LIQUID_AUTOTEST(eqlms_cccf_block_p21_k2, "block execution, 21 taps, k=2","",0.1) { testbench_eqlms_cccf_block(__q__, 21, 2, 900); }
+LIQUID_AUTOTEST(eqlms_cccf_block_p64_k4, "block execution, 64 taps, k=4","",0.1) { testbench_eqlms_cccf_block(__q__, 64, 4, 900); }
+LIQUID_AUTOTEST(eqlms_cccf_block_p300_k2,"block execution, 300 taps, k=2","",0.1) { testbench_eqlms_cccf_block(__q__,300, 2, 900); }
+LIQUID_AUTOTEST(eqlms_cccf_block_p4_k1,  "block execution, 4 taps, k=1","",0.1) { testbench_eqlms_cccf_block(__q__,  4, 1, 900); }
+LIQUID_AUTOTEST(eqlms_cccf_block_p7_k3,  "block execution, 7 taps, k=3","",0.1) { testbench_eqlms_cccf_block(__q__,  7, 3, 900); }
+
+// train() is deprecated but still runs through the block path
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+
+// compare training on sequence against push/execute/step on each sample
+void testbench_eqlms_cccf_train(liquid_autotest __q__,
+                                unsigned int    _h_len,
+                                unsigned int    _n)
+{
+    // initial weights and training sequence
+    unsigned int i;
+    float complex w[_h_len], h[_h_len], x[_n], d[_n];
+    for (i=0; i<_h_len; i++) {
+        w[i] = (i==_h_len/2 ? 1.0f : 0.0f) + 0.05f*(randnf() + _Complex_I*randnf());
+        h[i] = conjf(w[i]);
+    }
+    for (i=0; i<_n; i++) {
+        d[i] = ((rand() & 1) ? 1.0f : -1.0f) + ((rand() & 1) ? _Complex_I : -_Complex_I);
+        x[i] = d[i] + 0.1f*(randnf() + _Complex_I*randnf());
+    }
+
+    // run samples individually with equivalent initial coefficients
+    eqlms_cccf q0 = eqlms_cccf_create(h, _h_len);
+    eqlms_cccf q1 = eqlms_cccf_create(NULL, _h_len);
+    float complex d_hat;
+    for (i=0; i<_n; i++) {
+        eqlms_cccf_push(q0, x[i]);
+        eqlms_cccf_execute(q0, &d_hat);
+        eqlms_cccf_step(q0, d[i], d_hat);
+    }
+
+    // train on full sequence
+    LIQUID_CHECK(eqlms_cccf_train(q1, w, x, d, _n) == LIQUID_OK);
+
+    // compare coefficients, returned in reverse conjugated order
+    const float complex * w0 = eqlms_cccf_get_coefficients(q0);
+    for (i=0; i<_h_len; i++)
+        LIQUID_CHECK_DELTA(cabsf(conjf(w0[_h_len-i-1]) - w[i]), 0, 1e-4f);
+
+    eqlms_cccf_destroy(q0);
+    eqlms_cccf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(eqlms_cccf_train_p4, "training sequence, 4 taps", "",0.1) { testbench_eqlms_cccf_train(__q__,  4, 900); }
+LIQUID_AUTOTEST(eqlms_cccf_train_p21,"training sequence, 21 taps","",0.1) { testbench_eqlms_cccf_train(__q__, 21, 900); }
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
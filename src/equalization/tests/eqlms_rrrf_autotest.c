@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "liquid.autotest.h"
+#include "liquid.h"
+
+// compare block execution against running each sample individually
+void testbench_eqlms_rrrf_block(liquid_autotest __q__,
+                                unsigned int    _h_len,
+                                unsigned int    _k,
+                                unsigned int    _n)
+{
+    // create pair of objects
+    eqlms_rrrf q0 = eqlms_rrrf_create_lowpass(_h_len, 0.4f);
+    eqlms_rrrf q1 = eqlms_rrrf_create_lowpass(_h_len, 0.4f);
+    eqlms_rrrf_set_bw(q0, 0.05f);
+    eqlms_rrrf_set_bw(q1, 0.05f);
+
+    // generate BPSK-like input with some noise
+    unsigned int i;
+    float x[_n], y0[_n], y1[_n];
+    for (i=0; i<_n; i++)
+        x[i] = ((rand() & 1) ? 1.0f : -1.0f) + 0.1f*randnf();
+
+    // run samples individually, updating blindly every _k samples
+    for (i=0; i<_n; i++) {
+        eqlms_rrrf_push(q0, x[i]);
+        eqlms_rrrf_execute(q0, &y0[i]);
+        if ( ((i+1+_k-1) % _k) == 0 )
+            eqlms_rrrf_step_blind(q0, y0[i]);
+    }
+
+    // run samples in irregularly-sized blocks
+    unsigned int n = 0, block_len = 1;
+    while (n < _n) {
+        unsigned int num = (_n - n) < block_len ? _n - n : block_len;
+        eqlms_rrrf_execute_block(q1, _k, x + n, num, y1 + n);
+        n += num;
+        block_len = 3*block_len + 1;
+    }
+
+    // compare outputs and coefficients
+    float tol = 1e-4f;
+    for (i=0; i<_n; i++)
+        LIQUID_CHECK_DELTA(y0[i], y1[i], tol);
+    const float * w0 = eqlms_rrrf_get_coefficients(q0);
+    const float * w1 = eqlms_rrrf_get_coefficients(q1);
+    for (i=0; i<_h_len; i++)
+        LIQUID_CHECK_DELTA(w0[i], w1[i], tol);
+
+    eqlms_rrrf_destroy(q0);
+    eqlms_rrrf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(eqlms_rrrf_block_p4_k1,  "block execution, 4 taps, k=1","",0.1) { testbench_eqlms_rrrf_block(__q__,  4, 1, 900); }
+LIQUID_AUTOTEST(eqlms_rrrf_block_p11_k2, "block execution, 11 taps, k=2","",0.1) { testbench_eqlms_rrrf_block(__q__, 11, 2, 900); }
+LIQUID_AUTOTEST(eqlms_rrrf_block_p64_k1, "block execution, 64 taps, k=1","",0.1) { testbench_eqlms_rrrf_block(__q__, 64, 1, 900); }
+
+// train() is deprecated but still runs through the block path
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+
+// compare training on sequence against push/execute/step on each sample
+void testbench_eqlms_rrrf_train(liquid_autotest __q__,
+                                unsigned int    _h_len,
+                                unsigned int    _n)
+{
+    // initial weights and training sequence
+    unsigned int i;
+    float w[_h_len], x[_n], d[_n];
+    for (i=0; i<_h_len; i++)
+        w[i] = (i==_h_len/2 ? 1.0f : 0.0f) + 0.05f*randnf();
+    for (i=0; i<_n; i++) {
+        d[i] = (rand() & 1) ? 1.0f : -1.0f;
+        x[i] = d[i] + 0.1f*randnf();
+    }
+
+    // run samples individually with equivalent initial coefficients
+    eqlms_rrrf q0 = eqlms_rrrf_create(w, _h_len);
+    eqlms_rrrf q1 = eqlms_rrrf_create(NULL, _h_len);
+    float d_hat;
+    for (i=0; i<_n; i++) {
+        eqlms_rrrf_push(q0, x[i]);
+        eqlms_rrrf_execute(q0, &d_hat);
+        eqlms_rrrf_step(q0, d[i], d_hat);
+    }
+
+    // train on full sequence
+    LIQUID_CHECK(eqlms_rrrf_train(q1, w, x, d, _n) == LIQUID_OK);
+
+    // compare coefficients, returned in reverse order
+    const float * w0 = eqlms_rrrf_get_coefficients(q0);
+    for (i=0; i<_h_len; i++)
+        LIQUID_CHECK_DELTA(w0[_h_len-i-1], w[i], 1e-4f);
+
+    eqlms_rrrf_destroy(q0);
+    eqlms_rrrf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(eqlms_rrrf_train_p4, "training sequence, 4 taps", "",0.1) { testbench_eqlms_rrrf_train(__q__,  4, 900); }
+LIQUID_AUTOTEST(eqlms_rrrf_train_p21,"training sequence, 21 taps","",0.1) { testbench_eqlms_rrrf_train(__q__, 21, 900); }
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
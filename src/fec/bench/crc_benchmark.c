@@ -80,3 +80,7 @@ void benchmark_crc_crc16_n256       CRC_BENCH_API(LIQUID_CRC_16,        256)
 void benchmark_crc_crc24_n256       CRC_BENCH_API(LIQUID_CRC_24,        256)
 void benchmark_crc_crc32_n256       CRC_BENCH_API(LIQUID_CRC_32,        256)
 
+void benchmark_crc_crc8_n4096       CRC_BENCH_API(LIQUID_CRC_8,         4096)
+void benchmark_crc_crc16_n4096      CRC_BENCH_API(LIQUID_CRC_16,        4096)
+void benchmark_crc_crc24_n4096      CRC_BENCH_API(LIQUID_CRC_24,        4096)
+void benchmark_crc_crc32_n4096      CRC_BENCH_API(LIQUID_CRC_32,        4096)
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include "liquid.internal.h"
+
+// Helper function to keep code base small; decodes noisy blocks so that
+// the decoder runs several iterations before parity checks
+//  _fs         : LDPC scheme
+//  _soft       : soft-decision (16-bit) or hard-decision (8-bit) decoding
+//  _runtime    : layer update kernel
+void fec_ldpc_bench(struct rusage *     _start,
+                    struct rusage *     _finish,
+                    unsigned long int * _num_iterations,
+                    fec_scheme          _fs,
+                    int                 _soft,
+                    liquid_runtime_t    _runtime)
+{
+    // check if runtime is available on this machine
+    struct liquid_cpuinfo_s impl;
+    memset(&impl, 0x00, sizeof(struct liquid_cpuinfo_s));
+    switch (_runtime) {
+    case LIQUID_RUNTIME_NEON:   impl.neon   = true; break;
+    case LIQUID_RUNTIME_AVX2:   impl.avx2   = true; break;
+    default:;
+    }
+    if (liquid_runtime_detect(&impl) != _runtime) {
+        getrusage(RUSAGE_SELF, _start);
+        memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
+        return;
+    }
+
+    // adjust number of iterations (decoded bits)
+    unsigned int n = 384;
+    *_num_iterations /= 200;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // create arrays
+    unsigned int n_enc = fec_get_enc_msg_length(_fs,n);
+    unsigned char msg[n];               // original message
+    unsigned char msg_enc[n_enc];       // encoded message
+    unsigned char msg_hard[n_enc];      // received message (hard decisions)
+    unsigned char msg_soft[8*n_enc];    // received message (soft bits)
+    unsigned char msg_dec[n];           // decoded message
+
+    // encode random message and add noise; hard decisions have about one
+    // percent bit errors
+    fec q = fec_create(_fs,NULL);
+    fec_ldpc_runtime_select(q, _runtime);
+    unsigned long int i;
+    for (i=0; i<n; i++)
+        msg[i] = rand() & 0xff;
+    fec_encode(q, n, msg, msg_enc);
+    memset(msg_hard, 0x00, n_enc);
+    for (i=0; i<8*n_enc; i++) {
+        unsigned int bit = (msg_enc[i/8] >> (7-(i%8))) & 1;
+        float y = (bit ? 1.0f : -1.0f) + 0.43f*randnf();
+        float v = 127.5f + 127.5f*y/2.0f;
+        msg_soft[i] = v < 0.0f ? 0 : (v > 255.0f ? 255 : (unsigned char)v);
+        msg_hard[i/8] |= (y > 0.0f) << (7-(i%8));
+    }
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        if (_soft)
+            fec_decode_soft(q, n, msg_soft, msg_dec);
+        else
+            fec_decode(q, n, msg_hard, msg_dec);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 8*n;
+
+    fec_destroy(q);
+}
+
+#define FEC_LDPC_BENCHMARK_API(FS,SOFT,RUNTIME)     \
+(   struct rusage *_start,                          \
+    struct rusage *_finish,                         \
+    unsigned long int *_num_iterations)             \
+{ fec_ldpc_bench(_start, _finish, _num_iterations, FS, SOFT, RUNTIME); }
+
+void benchmark_fec_ldpc_r12k1024_soft_port  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R12_K1024, 1, LIQUID_RUNTIME_PORT)
+void benchmark_fec_ldpc_r12k1024_soft_neon  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R12_K1024, 1, LIQUID_RUNTIME_NEON)
+void benchmark_fec_ldpc_r12k1024_soft_avx2  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R12_K1024, 1, LIQUID_RUNTIME_AVX2)
+void benchmark_fec_ldpc_r12k1024_hard_port  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R12_K1024, 0, LIQUID_RUNTIME_PORT)
+void benchmark_fec_ldpc_r12k1024_hard_neon  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R12_K1024, 0, LIQUID_RUNTIME_NEON)
+void benchmark_fec_ldpc_r12k1024_hard_avx2  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R12_K1024, 0, LIQUID_RUNTIME_AVX2)
+
+void benchmark_fec_ldpc_r34k3072_soft_port  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R34_K3072, 1, LIQUID_RUNTIME_PORT)
+void benchmark_fec_ldpc_r34k3072_soft_neon  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R34_K3072, 1, LIQUID_RUNTIME_NEON)
+void benchmark_fec_ldpc_r34k3072_soft_avx2  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R34_K3072, 1, LIQUID_RUNTIME_AVX2)
+void benchmark_fec_ldpc_r34k3072_hard_port  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R34_K3072, 0, LIQUID_RUNTIME_PORT)
+void benchmark_fec_ldpc_r34k3072_hard_neon  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R34_K3072, 0, LIQUID_RUNTIME_NEON)
+void benchmark_fec_ldpc_r34k3072_hard_avx2  FEC_LDPC_BENCHMARK_API(LIQUID_FEC_LDPC_R34_K3072, 0, LIQUID_RUNTIME_AVX2)
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include "liquid.internal.h"
+
+// Helper function to keep code base small
+//  _K          : constraint length
+//  _R          : inverse rate
+//  _poly       : generator polynomials
+//  _runtime    : add-compare-select kernel
+void fec_viterbi_bench(struct rusage *     _start,
+                       struct rusage *     _finish,
+                       unsigned long int * _num_iterations,
+                       unsigned int        _K,
+                       unsigned int        _R,
+                       int *               _poly,
+                       liquid_runtime_t    _runtime)
+{
+    // check if runtime is available on this machine
+    struct liquid_cpuinfo_s impl;
+    memset(&impl, 0x00, sizeof(struct liquid_cpuinfo_s));
+    switch (_runtime) {
+    case LIQUID_RUNTIME_SSE2:   impl.sse2   = true; break;
+    case LIQUID_RUNTIME_AVX2:   impl.avx2   = true; break;
+    case LIQUID_RUNTIME_AVX512: impl.avx512 = true; break;
+    default:;
+    }
+    if (liquid_runtime_detect(&impl) != _runtime) {
+        getrusage(RUSAGE_SELF, _start);
+        memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
+        return;
+    }
+
+    // adjust number of iterations (decoded bits): scale by number of states
+    unsigned int n = 1024;
+    *_num_iterations *= 4;
+    *_num_iterations /= (1 << (_K-1));
+    *_num_iterations /= n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // generate random soft symbols
+    unsigned int m = n + _K - 1;
+    unsigned char * sym = (unsigned char*) malloc(_R*m*sizeof(unsigned char));
+    unsigned char msg[n/8];
+    unsigned long int i;
+    for (i=0; i<_R*m; i++)
+        sym[i] = rand() & 0xff;
+
+    // create decoder
+    fec_viterbi q = fec_viterbi_create(_K, _R, _poly, n);
+    fec_viterbi_runtime_select(q, _runtime);
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        fec_viterbi_reset(q, 0);
+        fec_viterbi_update_blk(q, sym, m);
+        fec_viterbi_chainback(q, msg, n, 0);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    fec_viterbi_destroy(q);
+    free(sym);
+}
+
+#define FEC_VITERBI_BENCHMARK_API(K,R,POLY,RUNTIME) \
+(   struct rusage *_start,                          \
+    struct rusage *_finish,                         \
+    unsigned long int *_num_iterations)             \
+{ fec_viterbi_bench(_start, _finish, _num_iterations, K, R, POLY, RUNTIME); }
+
+void benchmark_fec_viterbi_v27_port     FEC_VITERBI_BENCHMARK_API( 7, 2, fec_conv27_poly,  LIQUID_RUNTIME_PORT  )
+void benchmark_fec_viterbi_v27_sse2     FEC_VITERBI_BENCHMARK_API( 7, 2, fec_conv27_poly,  LIQUID_RUNTIME_SSE2  )
+void benchmark_fec_viterbi_v27_avx2     FEC_VITERBI_BENCHMARK_API( 7, 2, fec_conv27_poly,  LIQUID_RUNTIME_AVX2  )
+void benchmark_fec_viterbi_v27_avx512   FEC_VITERBI_BENCHMARK_API( 7, 2, fec_conv27_poly,  LIQUID_RUNTIME_AVX512)
+
+void benchmark_fec_viterbi_v29_port     FEC_VITERBI_BENCHMARK_API( 9, 2, fec_conv29_poly,  LIQUID_RUNTIME_PORT  )
+void benchmark_fec_viterbi_v29_sse2     FEC_VITERBI_BENCHMARK_API( 9, 2, fec_conv29_poly,  LIQUID_RUNTIME_SSE2  )
+void benchmark_fec_viterbi_v29_avx2     FEC_VITERBI_BENCHMARK_API( 9, 2, fec_conv29_poly,  LIQUID_RUNTIME_AVX2  )
+void benchmark_fec_viterbi_v29_avx512   FEC_VITERBI_BENCHMARK_API( 9, 2, fec_conv29_poly,  LIQUID_RUNTIME_AVX512)
+
+void benchmark_fec_viterbi_v615_port    FEC_VITERBI_BENCHMARK_API(15, 6, fec_conv615_poly, LIQUID_RUNTIME_PORT  )
+void benchmark_fec_viterbi_v615_sse2    FEC_VITERBI_BENCHMARK_API(15, 6, fec_conv615_poly, LIQUID_RUNTIME_SSE2  )
+void benchmark_fec_viterbi_v615_avx2    FEC_VITERBI_BENCHMARK_API(15, 6, fec_conv615_poly, LIQUID_RUNTIME_AVX2  )
+void benchmark_fec_viterbi_v615_avx512  FEC_VITERBI_BENCHMARK_API(15, 6, fec_conv615_poly, LIQUID_RUNTIME_AVX512)
+
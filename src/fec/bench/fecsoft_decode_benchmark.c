@@ -49,25 +49,9 @@ void fecsoft_decode_bench(
     void * _opts)
 {
 #if !LIBFEC_ENABLED
-    if ( _fs == LIQUID_FEC_CONV_V27    ||
-         _fs == LIQUID_FEC_CONV_V29    ||
-         _fs == LIQUID_FEC_CONV_V39    ||
-         _fs == LIQUID_FEC_CONV_V615   ||
-         _fs == LIQUID_FEC_CONV_V27P23 ||
-         _fs == LIQUID_FEC_CONV_V27P34 ||
-         _fs == LIQUID_FEC_CONV_V27P45 ||
-         _fs == LIQUID_FEC_CONV_V27P56 ||
-         _fs == LIQUID_FEC_CONV_V27P67 ||
-         _fs == LIQUID_FEC_CONV_V27P78 ||
-         _fs == LIQUID_FEC_CONV_V29P23 ||
-         _fs == LIQUID_FEC_CONV_V29P34 ||
-         _fs == LIQUID_FEC_CONV_V29P45 ||
-         _fs == LIQUID_FEC_CONV_V29P56 ||
-         _fs == LIQUID_FEC_CONV_V29P67 ||
-         _fs == LIQUID_FEC_CONV_V29P78 ||
-         _fs == LIQUID_FEC_RS_M8)
+    if (_fs == LIQUID_FEC_RS_M8)
     {
-        liquid_error(LIQUID_EUMODE,"convolutional, Reed-Solomon codes unavailable (install libfec)");
+        liquid_error(LIQUID_EUMODE,"Reed-Solomon codes unavailable (install libfec)");
         getrusage(RUSAGE_SELF, _start);
         memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
         return;
@@ -107,6 +91,11 @@ void fecsoft_decode_bench(
     case LIQUID_FEC_RS_M8:
         *_num_iterations *= 1;
         break;
+    case LIQUID_FEC_LDPC_R12_K1024:
+    case LIQUID_FEC_LDPC_R12_K4096:
+    case LIQUID_FEC_LDPC_R34_K3072:
+        *_num_iterations /= 20;
+        break;
     default:;
     }
     if (*_num_iterations < 1) *_num_iterations = 1;
@@ -188,3 +177,7 @@ void benchmark_fecsoft_dec_conv29p78_n64  FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CO
 
 void benchmark_fecsoft_dec_rs8_n64        FECSOFT_DECODE_BENCH_API(LIQUID_FEC_RS_M8,      64, NULL)
 
+void benchmark_fecsoft_dec_ldpc12k1024_n512 FECSOFT_DECODE_BENCH_API(LIQUID_FEC_LDPC_R12_K1024, 512, NULL)
+void benchmark_fecsoft_dec_ldpc12k4096_n512 FECSOFT_DECODE_BENCH_API(LIQUID_FEC_LDPC_R12_K4096, 512, NULL)
+void benchmark_fecsoft_dec_ldpc34k3072_n512 FECSOFT_DECODE_BENCH_API(LIQUID_FEC_LDPC_R34_K3072, 512, NULL)
+
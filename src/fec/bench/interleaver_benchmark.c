@@ -25,17 +25,18 @@
 #include <sys/resource.h>
 #include "liquid.h"
 
-#define INTERLEAVER_BENCH_API(N)        \
+#define INTERLEAVER_BENCH_API(N,SOFT)   \
 (   struct rusage *_start,              \
     struct rusage *_finish,             \
     unsigned long int *_num_iterations) \
-{ interleaver_bench(_start, _finish, _num_iterations, N); }
+{ interleaver_bench(_start, _finish, _num_iterations, N, SOFT); }
 
 // Helper function to keep code base small
 void interleaver_bench(struct rusage *_start,
                        struct rusage *_finish,
                        unsigned long int *_num_iterations,
-                       unsigned int _n)
+                       unsigned int _n,
+                       int _soft)
 {
     // scale number of iterations by block size
     // iterations = 4: cycles/trial ~ exp( -0.883 + 0.708*log(_n) )
@@ -45,20 +46,31 @@ void interleaver_bench(struct rusage *_start,
     interleaver q = interleaver_create(_n);
     interleaver_set_depth(q, 4);
 
-    unsigned char x[_n];
-    unsigned char y[_n];
+    // soft bits are eight times the length
+    unsigned int num_bytes = _soft ? 8*_n : _n;
+    unsigned char x[num_bytes];
+    unsigned char y[num_bytes];
     
     unsigned long int i;
-    for (i=0; i<_n; i++)
+    for (i=0; i<num_bytes; i++)
         x[i] = rand() & 0xff;
 
     // start trials
     getrusage(RUSAGE_SELF, _start);
-    for (i=0; i<(*_num_iterations); i++) {
-        interleaver_encode(q, x, y);
-        interleaver_encode(q, x, y);
-        interleaver_encode(q, x, y);
-        interleaver_encode(q, x, y);
+    if (_soft) {
+        for (i=0; i<(*_num_iterations); i++) {
+            interleaver_encode_soft(q, x, y);
+            interleaver_decode_soft(q, y, x);
+            interleaver_encode_soft(q, x, y);
+            interleaver_decode_soft(q, y, x);
+        }
+    } else {
+        for (i=0; i<(*_num_iterations); i++) {
+            interleaver_encode(q, x, y);
+            interleaver_decode(q, y, x);
+            interleaver_encode(q, x, y);
+            interleaver_decode(q, y, x);
+        }
     }
     getrusage(RUSAGE_SELF, _finish);
     *_num_iterations *= 4;
@@ -67,12 +79,21 @@ void interleaver_bench(struct rusage *_start,
     interleaver_destroy(q);
 }
 
-void benchmark_interleaver_8    INTERLEAVER_BENCH_API(8     )
-void benchmark_interleaver_16   INTERLEAVER_BENCH_API(16    )
-void benchmark_interleaver_32   INTERLEAVER_BENCH_API(32    )
-void benchmark_interleaver_64   INTERLEAVER_BENCH_API(64    )
-void benchmark_interleaver_128  INTERLEAVER_BENCH_API(128   )
-void benchmark_interleaver_256  INTERLEAVER_BENCH_API(256   )
-void benchmark_interleaver_512  INTERLEAVER_BENCH_API(512   )
-void benchmark_interleaver_1024 INTERLEAVER_BENCH_API(1024  )
+void benchmark_interleaver_8         INTERLEAVER_BENCH_API(8     ,0)
+void benchmark_interleaver_16        INTERLEAVER_BENCH_API(16    ,0)
+void benchmark_interleaver_32        INTERLEAVER_BENCH_API(32    ,0)
+void benchmark_interleaver_64        INTERLEAVER_BENCH_API(64    ,0)
+void benchmark_interleaver_128       INTERLEAVER_BENCH_API(128   ,0)
+void benchmark_interleaver_256       INTERLEAVER_BENCH_API(256   ,0)
+void benchmark_interleaver_512       INTERLEAVER_BENCH_API(512   ,0)
+void benchmark_interleaver_1024      INTERLEAVER_BENCH_API(1024  ,0)
+
+void benchmark_interleaver_soft_8    INTERLEAVER_BENCH_API(8     ,1)
+void benchmark_interleaver_soft_16   INTERLEAVER_BENCH_API(16    ,1)
+void benchmark_interleaver_soft_32   INTERLEAVER_BENCH_API(32    ,1)
+void benchmark_interleaver_soft_64   INTERLEAVER_BENCH_API(64    ,1)
+void benchmark_interleaver_soft_128  INTERLEAVER_BENCH_API(128   ,1)
+void benchmark_interleaver_soft_256  INTERLEAVER_BENCH_API(256   ,1)
+void benchmark_interleaver_soft_512  INTERLEAVER_BENCH_API(512   ,1)
+void benchmark_interleaver_soft_1024 INTERLEAVER_BENCH_API(1024  ,1)
 
@@ -27,9 +27,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdatomic.h>
 
 #include "liquid.internal.h"
 
+#if BUILD_PTHREADS
+#include <pthread.h>
+#endif
+
 #define CRC8_POLY 0x07
 #define CRC16_POLY 0x8005
 #define CRC24_POLY 0x5D6DCB
@@ -254,8 +259,8 @@ unsigned int checksum_generate_key(unsigned char *_data,
 //
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
-unsigned int crc8_generate_key(unsigned char *_msg,
-                               unsigned int _n)
+unsigned int crc8_generate_key_bitwise(unsigned char *_msg,
+                                       unsigned int _n)
 {
     unsigned int i, j, b, mask, key8=~0;
     unsigned int poly = liquid_reverse_byte_gentab[CRC8_POLY];
@@ -282,8 +287,8 @@ unsigned int crc8_generate_key(unsigned char *_msg,
 //
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
-unsigned int crc16_generate_key(unsigned char *_msg,
-                                unsigned int _n)
+unsigned int crc16_generate_key_bitwise(unsigned char *_msg,
+                                        unsigned int _n)
 {
     unsigned int i, j, b, mask, key16=~0;
     unsigned int poly = liquid_reverse_uint16(CRC16_POLY);
@@ -310,8 +315,8 @@ unsigned int crc16_generate_key(unsigned char *_msg,
 //
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
-unsigned int crc24_generate_key(unsigned char *_msg,
-                                unsigned int _n)
+unsigned int crc24_generate_key_bitwise(unsigned char *_msg,
+                                        unsigned int _n)
 {
     unsigned int i, j, b, mask, key24=~0;
     unsigned int poly = liquid_reverse_uint24(CRC24_POLY);
@@ -338,8 +343,8 @@ unsigned int crc24_generate_key(unsigned char *_msg,
 //
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
-unsigned int crc32_generate_key(unsigned char *_msg,
-                                unsigned int _n)
+unsigned int crc32_generate_key_bitwise(unsigned char *_msg,
+                                        unsigned int _n)
 {
     unsigned int i, j, b, mask, key32=~0;
     unsigned int poly = liquid_reverse_uint32(CRC32_POLY);
@@ -354,6 +359,275 @@ unsigned int crc32_generate_key(unsigned char *_msg,
     return (~key32) & 0xffffffff;
 }
 
+//
+// Table-driven engines
+//
+
+// engines for each width, indexed by key size in bytes minus one; built
+// exactly once before any kernel is published
+static struct crc_engine_s crc_engines[4];
+#if BUILD_PTHREADS
+static pthread_once_t crc_engines_once = PTHREAD_ONCE_INIT;
+#endif
+
+// CRC state update kernel
+typedef uint32_t crc_update_t(struct crc_engine_s *, uint32_t, unsigned char *, unsigned int);
+
+// kernel shared by all callers, selected automatically on first use and
+// published atomically after the engines are built; CRC-8 and CRC-16
+// always use the slicing tables
+static _Atomic(crc_update_t *) crc_kernel = NULL;
+
+// compute x^_e mod P as reflected 64-bit operand for carry-less multiply,
+// such that bit j holds the coefficient of x^(63-j)
+static uint64_t crc_engine_xpow(unsigned int _width,
+                                uint32_t     _poly,
+                                unsigned int _e)
+{
+    // start with x^0 (reflected) and multiply by x one step at a time
+    uint32_t r = 1u << (_width - 1);
+    unsigned int i;
+    for (i=0; i<_e; i++)
+        r = (r >> 1) ^ (_poly & -(r & 1));
+    return (uint64_t)r << (64 - _width);
+}
+
+// build slicing tables and folding constants
+//  _q      :   CRC engine
+//  _width  :   key width [bits]
+//  _poly   :   reflected generator polynomial
+static void crc_engine_init(struct crc_engine_s * _q,
+                            unsigned int          _width,
+                            uint32_t              _poly)
+{
+    _q->poly  = _poly;
+
+    // base table: eight bit-wise steps of the 32-bit shift register
+    unsigned int i, j;
+    for (i=0; i<256; i++) {
+        uint32_t r = i;
+        for (j=0; j<8; j++)
+            r = (r >> 1) ^ (_poly & -(r & 1));
+        _q->T[0][i] = r;
+    }
+
+    // each successive table advances its entries by another zero byte
+    for (j=1; j<16; j++) {
+        for (i=0; i<256; i++)
+            _q->T[j][i] = (_q->T[j-1][i] >> 8) ^ _q->T[0][_q->T[j-1][i] & 0xff];
+    }
+
+    // constants for folding 128-bit blocks across distances of 512 and
+    // 128 bits; the extra factor of x absorbs the one-bit offset of the
+    // reflected carry-less product
+    _q->k[0] = crc_engine_xpow(_width, _poly, 512+64-1);
+    _q->k[1] = crc_engine_xpow(_width, _poly, 512   -1);
+    _q->k[2] = crc_engine_xpow(_width, _poly, 128+64-1);
+    _q->k[3] = crc_engine_xpow(_width, _poly, 128   -1);
+
+    // set width last, once the engine is complete
+    _q->width = _width;
+}
+
+// build engines for all widths
+static void crc_engines_init(void)
+{
+    crc_engine_init(&crc_engines[0],  8, liquid_reverse_byte_gentab[CRC8_POLY]);
+    crc_engine_init(&crc_engines[1], 16, liquid_reverse_uint16(CRC16_POLY));
+    crc_engine_init(&crc_engines[2], 24, liquid_reverse_uint24(CRC24_POLY));
+    crc_engine_init(&crc_engines[3], 32, liquid_reverse_uint32(CRC32_POLY));
+}
+
+// build engines for all widths exactly once; without thread support the
+// library never computes keys concurrently
+static void crc_engines_build(void)
+{
+#if BUILD_PTHREADS
+    pthread_once(&crc_engines_once, crc_engines_init);
+#else
+    if (crc_engines[3].width == 0)
+        crc_engines_init();
+#endif
+}
+
+// load 32-bit little-endian word
+static inline uint32_t crc_load32(unsigned char * _p)
+{
+    return  (uint32_t)_p[0]        | ((uint32_t)_p[1] <<  8) |
+           ((uint32_t)_p[2] << 16) | ((uint32_t)_p[3] << 24);
+}
+
+// update CRC state, sixteen bytes at a time (portable)
+uint32_t crc_update_slice16(struct crc_engine_s * _q,
+                            uint32_t              _s,
+                            unsigned char *       _msg,
+                            unsigned int          _n)
+{
+    uint32_t (*T)[256] = _q->T;
+    while (_n >= 16) {
+        uint32_t a = crc_load32(_msg   ) ^ _s;
+        uint32_t b = crc_load32(_msg+ 4);
+        uint32_t c = crc_load32(_msg+ 8);
+        uint32_t d = crc_load32(_msg+12);
+        _s = T[15][a & 0xff] ^ T[14][(a >> 8) & 0xff] ^ T[13][(a >> 16) & 0xff] ^ T[12][a >> 24] ^
+             T[11][b & 0xff] ^ T[10][(b >> 8) & 0xff] ^ T[ 9][(b >> 16) & 0xff] ^ T[ 8][b >> 24] ^
+             T[ 7][c & 0xff] ^ T[ 6][(c >> 8) & 0xff] ^ T[ 5][(c >> 16) & 0xff] ^ T[ 4][c >> 24] ^
+             T[ 3][d & 0xff] ^ T[ 2][(d >> 8) & 0xff] ^ T[ 1][(d >> 16) & 0xff] ^ T[ 0][d >> 24];
+        _msg += 16;
+        _n   -= 16;
+    }
+
+    // remaining block of eight bytes
+    if (_n >= 8) {
+        uint32_t a = crc_load32(_msg  ) ^ _s;
+        uint32_t b = crc_load32(_msg+4);
+        _s = T[ 7][a & 0xff] ^ T[ 6][(a >> 8) & 0xff] ^ T[ 5][(a >> 16) & 0xff] ^ T[ 4][a >> 24] ^
+             T[ 3][b & 0xff] ^ T[ 2][(b >> 8) & 0xff] ^ T[ 1][(b >> 16) & 0xff] ^ T[ 0][b >> 24];
+        _msg += 8;
+        _n   -= 8;
+    }
+
+    // remaining bytes
+    while (_n--)
+        _s = (_s >> 8) ^ T[0][(_s ^ *_msg++) & 0xff];
+    return _s;
+}
+
+// check for carry-less multiply instruction (PCLMULQDQ) on x86
+static int crc_runtime_pclmul(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+    uint32_t a,b,c,d;
+    if (liquid_runtime_cpuid_x86(1, 0, &a,&b,&c,&d))
+        return 0;
+    return (c & (1u << 1)) != 0;
+#else
+    return 0;
+#endif
+}
+
+// look up kernel for runtime, returning NULL if unavailable
+static crc_update_t * crc_runtime_kernel(liquid_runtime_t _select)
+{
+    switch (_select) {
+    case LIQUID_RUNTIME_PORT:
+        return &crc_update_slice16;
+#if CRC_BUILD_PMULL
+    case LIQUID_RUNTIME_NEON:
+        return &crc_update_pmull;
+#endif
+#if CRC_BUILD_PCLMUL
+    case LIQUID_RUNTIME_AVX:
+        return crc_runtime_pclmul() ? &crc_update_pclmul : NULL;
+#endif
+    default:;
+    }
+    return NULL;
+}
+
+// find best available runtime execution method
+static liquid_runtime_t crc_runtime_best(void)
+{
+    // implementations; PCLMULQDQ is not tracked by liquid_cpuinfo so the
+    // x86 kernel is keyed to AVX and checked separately
+    struct liquid_cpuinfo_s impl =
+    {
+        .altivec = 0,
+        .neon    = CRC_BUILD_PMULL,
+        .mmx     = 0,
+        .sse     = 0,
+        .sse2    = 0,
+        .sse3    = 0,
+        .ssse3   = 0,
+        .sse41   = 0,
+        .sse42   = 0,
+        .avx     = CRC_BUILD_PCLMUL && crc_runtime_pclmul(),
+        .fma3    = 0,
+        .avx2    = 0,
+        .avx512  = 0,
+        .amx     = 0,
+        .amx101  = 0,
+        .amx102  = 0,
+    };
+
+    // given implementations, find best method
+    return liquid_runtime_detect(&impl);
+}
+
+// select runtime execution method
+int crc_runtime_select(liquid_runtime_t _select)
+{
+    // build tables for all widths before publishing any kernel
+    crc_engines_build();
+
+    crc_update_t * update = crc_runtime_kernel(_select);
+    if (update == NULL) {
+        atomic_store_explicit(&crc_kernel, &crc_update_slice16, memory_order_release);
+        return liquid_error(LIQUID_EINT,
+            "crc_runtime_select(), invalid selection or mode not available (%d), falling back to portable version",
+            _select);
+    }
+    liquid_log_trace("crc_runtime_select(), %s",
+        update == &crc_update_slice16 ? "port" : "carry-less multiply");
+    atomic_store_explicit(&crc_kernel, update, memory_order_release);
+    return LIQUID_OK;
+}
+
+// detect runtime execution method
+int crc_runtime_detect(void)
+{
+    // invoke selection method
+    return crc_runtime_select(crc_runtime_best());
+}
+
+// get update kernel, building the engines and selecting the best available
+// kernel on first use; an explicit selection made concurrently by another
+// thread takes precedence
+static crc_update_t * crc_get_kernel(void)
+{
+    crc_update_t * update = atomic_load_explicit(&crc_kernel, memory_order_acquire);
+    if (update != NULL)
+        return update;
+
+    crc_engines_build();
+    crc_update_t * best = crc_runtime_kernel(crc_runtime_best());
+    if (best == NULL)
+        best = &crc_update_slice16;
+    if (atomic_compare_exchange_strong(&crc_kernel, &update, best))
+        return best;
+    return update;  // set by another thread in the meantime
+}
+
+// generate 8-bit cyclic redundancy check key
+unsigned int crc8_generate_key(unsigned char * _msg,
+                               unsigned int    _n)
+{
+    crc_get_kernel();
+    return (~crc_update_slice16(&crc_engines[0], ~0u, _msg, _n)) & 0xff;
+}
+
+// generate 16-bit cyclic redundancy check key
+unsigned int crc16_generate_key(unsigned char * _msg,
+                                unsigned int    _n)
+{
+    crc_get_kernel();
+    return (~crc_update_slice16(&crc_engines[1], ~0u, _msg, _n)) & 0xffff;
+}
+
+// generate 24-bit cyclic redundancy check key
+unsigned int crc24_generate_key(unsigned char * _msg,
+                                unsigned int    _n)
+{
+    return (~crc_get_kernel()(&crc_engines[2], ~0u, _msg, _n)) & 0xffffff;
+}
+
+// generate 32-bit cyclic redundancy check key
+unsigned int crc32_generate_key(unsigned char * _msg,
+                                unsigned int    _n)
+{
+    return (~crc_get_kernel()(&crc_engines[3], ~0u, _msg, _n)) & 0xffffffff;
+}
+
 #if 0
 int crc32_generate_key(unsigned char *_msg,
                        unsigned int _n,
@@ -368,3 +642,6 @@ int crc32_generate_key(unsigned char *_msg,
 }
 #endif
 
+// runtime-specific kernels
+#include "crc.pclmul.c"
+#include "crc.pmull.c"
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// cyclic redundancy check, carry-less multiply folding (x86 PCLMULQDQ)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if CRC_BUILD_PCLMUL
+
+// include proper SIMD extensions for x86 carry-less multiply
+#include <immintrin.h>
+
+// fold 128-bit block _x onto _b: x_lo*k_lo + x_hi*k_hi + b
+static inline __m128i __attribute__((target("sse2,pclmul")))
+crc_fold_pclmul(__m128i _x, __m128i _k, __m128i _b)
+{
+    __m128i lo = _mm_clmulepi64_si128(_x, _k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(_x, _k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), _b);
+}
+
+// Update CRC state by folding 128-bit blocks with carry-less multiplies;
+// the message is reduced to a single block which is congruent modulo the
+// generator polynomial and finished with the slicing tables along with
+// any remaining bytes.
+uint32_t __attribute__((target("sse2,pclmul")))
+crc_update_pclmul(struct crc_engine_s * _q,
+                  uint32_t              _s,
+                  unsigned char *       _msg,
+                  unsigned int          _n)
+{
+    // shift leading bytes until state fits within key width
+    unsigned int m = (32 - _q->width) / 8;
+    if (_n < m + 32)
+        return crc_update_slice16(_q, _s, _msg, _n);
+    _s = crc_update_slice16(_q, _s, _msg, m);
+    _msg += m;
+    _n   -= m;
+
+    // state is equivalent to adding it to the first bytes of the message
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128((__m128i*)_msg), _mm_cvtsi32_si128((int)_s));
+    _msg += 16;
+    _n   -= 16;
+
+    // fold four blocks at a time while there is sufficient input
+    __m128i k;
+    if (_n >= 112) {
+        __m128i x1 = _mm_loadu_si128((__m128i*)(_msg   ));
+        __m128i x2 = _mm_loadu_si128((__m128i*)(_msg+16));
+        __m128i x3 = _mm_loadu_si128((__m128i*)(_msg+32));
+        _msg += 48;
+        _n   -= 48;
+
+        k = _mm_set_epi64x((long long)_q->k[1], (long long)_q->k[0]);
+        while (_n >= 64) {
+            x0 = crc_fold_pclmul(x0, k, _mm_loadu_si128((__m128i*)(_msg   )));
+            x1 = crc_fold_pclmul(x1, k, _mm_loadu_si128((__m128i*)(_msg+16)));
+            x2 = crc_fold_pclmul(x2, k, _mm_loadu_si128((__m128i*)(_msg+32)));
+            x3 = crc_fold_pclmul(x3, k, _mm_loadu_si128((__m128i*)(_msg+48)));
+            _msg += 64;
+            _n   -= 64;
+        }
+
+        // reduce to a single block
+        k  = _mm_set_epi64x((long long)_q->k[3], (long long)_q->k[2]);
+        x1 = crc_fold_pclmul(x0, k, x1);
+        x2 = crc_fold_pclmul(x1, k, x2);
+        x0 = crc_fold_pclmul(x2, k, x3);
+    }
+
+    // fold one block at a time
+    k = _mm_set_epi64x((long long)_q->k[3], (long long)_q->k[2]);
+    while (_n >= 16) {
+        x0 = crc_fold_pclmul(x0, k, _mm_loadu_si128((__m128i*)_msg));
+        _msg += 16;
+        _n   -= 16;
+    }
+
+    // finish with tables from zero state
+    unsigned char buf[16];
+    _mm_storeu_si128((__m128i*)buf, x0);
+    _s = crc_update_slice16(_q, 0, buf, 16);
+    return crc_update_slice16(_q, _s, _msg, _n);
+}
+
+// build guard
+#else
+
+// invalidated; fall back to portable tables
+uint32_t crc_update_pclmul(struct crc_engine_s * _q,
+                           uint32_t              _s,
+                           unsigned char *       _msg,
+                           unsigned int          _n)
+{
+    return crc_update_slice16(_q, _s, _msg, _n);
+}
+
+// build guard
+#endif
+
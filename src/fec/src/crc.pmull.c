@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// cyclic redundancy check, carry-less multiply folding (ARM PMULL)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if CRC_BUILD_PMULL
+
+// include proper SIMD extensions for ARM polynomial multiply
+#include <arm_neon.h>
+
+// fold 128-bit block _x onto _b: x_lo*k_lo + x_hi*k_hi + b
+static inline uint64x2_t crc_fold_pmull(uint64x2_t _x, uint64x2_t _k, uint64x2_t _b)
+{
+    uint64x2_t lo = vreinterpretq_u64_p128(vmull_p64((poly64_t)vgetq_lane_u64(_x,0),
+                                                     (poly64_t)vgetq_lane_u64(_k,0)));
+    uint64x2_t hi = vreinterpretq_u64_p128(vmull_high_p64(vreinterpretq_p64_u64(_x),
+                                                          vreinterpretq_p64_u64(_k)));
+    return veorq_u64(veorq_u64(lo, hi), _b);
+}
+
+// load 128-bit block
+static inline uint64x2_t crc_load_pmull(unsigned char * _p)
+{
+    return vreinterpretq_u64_u8(vld1q_u8(_p));
+}
+
+// Update CRC state by folding 128-bit blocks with polynomial multiplies;
+// see crc_update_pclmul() for details.
+uint32_t crc_update_pmull(struct crc_engine_s * _q,
+                          uint32_t              _s,
+                          unsigned char *       _msg,
+                          unsigned int          _n)
+{
+    // shift leading bytes until state fits within key width
+    unsigned int m = (32 - _q->width) / 8;
+    if (_n < m + 32)
+        return crc_update_slice16(_q, _s, _msg, _n);
+    _s = crc_update_slice16(_q, _s, _msg, m);
+    _msg += m;
+    _n   -= m;
+
+    // state is equivalent to adding it to the first bytes of the message
+    uint64x2_t x0 = veorq_u64(crc_load_pmull(_msg), vcombine_u64(vcreate_u64(_s), vcreate_u64(0)));
+    _msg += 16;
+    _n   -= 16;
+
+    // fold four blocks at a time while there is sufficient input
+    uint64x2_t k;
+    if (_n >= 112) {
+        uint64x2_t x1 = crc_load_pmull(_msg   );
+        uint64x2_t x2 = crc_load_pmull(_msg+16);
+        uint64x2_t x3 = crc_load_pmull(_msg+32);
+        _msg += 48;
+        _n   -= 48;
+
+        k = vcombine_u64(vcreate_u64(_q->k[0]), vcreate_u64(_q->k[1]));
+        while (_n >= 64) {
+            x0 = crc_fold_pmull(x0, k, crc_load_pmull(_msg   ));
+            x1 = crc_fold_pmull(x1, k, crc_load_pmull(_msg+16));
+            x2 = crc_fold_pmull(x2, k, crc_load_pmull(_msg+32));
+            x3 = crc_fold_pmull(x3, k, crc_load_pmull(_msg+48));
+            _msg += 64;
+            _n   -= 64;
+        }
+
+        // reduce to a single block
+        k  = vcombine_u64(vcreate_u64(_q->k[2]), vcreate_u64(_q->k[3]));
+        x1 = crc_fold_pmull(x0, k, x1);
+        x2 = crc_fold_pmull(x1, k, x2);
+        x0 = crc_fold_pmull(x2, k, x3);
+    }
+
+    // fold one block at a time
+    k = vcombine_u64(vcreate_u64(_q->k[2]), vcreate_u64(_q->k[3]));
+    while (_n >= 16) {
+        x0 = crc_fold_pmull(x0, k, crc_load_pmull(_msg));
+        _msg += 16;
+        _n   -= 16;
+    }
+
+    // finish with tables from zero state
+    unsigned char buf[16];
+    vst1q_u8(buf, vreinterpretq_u8_u64(x0));
+    _s = crc_update_slice16(_q, 0, buf, 16);
+    return crc_update_slice16(_q, _s, _msg, _n);
+}
+
+// build guard
+#else
+
+// invalidated; fall back to portable tables
+uint32_t crc_update_pmull(struct crc_engine_s * _q,
+                          uint32_t              _s,
+                          unsigned char *       _msg,
+                          unsigned int          _n)
+{
+    return crc_update_slice16(_q, _s, _msg, _n);
+}
+
+// build guard
+#endif
+
@@ -61,7 +61,10 @@ const char * fec_scheme_str[LIQUID_FEC_NUM_SCHEMES][2] = {
     {"v29p56",      "convolutional r5/6 K=9 (punctured)"},
     {"v29p67",      "convolutional r6/7 K=9 (punctured)"},
     {"v29p78",      "convolutional r7/8 K=9 (punctured)"},
-    {"rs8",         "Reed-Solomon, 223/255"}
+    {"rs8",         "Reed-Solomon, 223/255"},
+    {"ldpc12k1024", "LDPC r1/2 (2048,1024)"},
+    {"ldpc12k4096", "LDPC r1/2 (8192,4096)"},
+    {"ldpc34k3072", "LDPC r3/4 (4096,3072)"}
 };
 
 // Print compact list of existing and available fec schemes
@@ -74,7 +77,7 @@ int liquid_print_fec_schemes()
     printf("          ");
     for (i=0; i<LIQUID_FEC_NUM_SCHEMES; i++) {
 #if !LIBFEC_ENABLED
-        if ( fec_scheme_is_convolutional(i) || fec_scheme_is_reedsolomon(i) )
+        if ( fec_scheme_is_reedsolomon(i) )
             continue;
 #endif
         printf("%s", fec_scheme_str[i][0]);
@@ -175,6 +178,19 @@ int fec_scheme_is_reedsolomon(fec_scheme _scheme)
     return 0;
 }
 
+// is scheme low-density parity check?
+int fec_scheme_is_ldpc(fec_scheme _scheme)
+{
+    switch (_scheme) {
+    case LIQUID_FEC_LDPC_R12_K1024:
+    case LIQUID_FEC_LDPC_R12_K4096:
+    case LIQUID_FEC_LDPC_R34_K3072:
+        return 1;
+    default:;
+    }
+    return 0;
+}
+
 // is scheme Hamming?
 int fec_scheme_is_hamming(fec_scheme _scheme)
 {
@@ -221,7 +237,6 @@ unsigned int fec_get_enc_msg_length(fec_scheme   _scheme,
     case LIQUID_FEC_SECDED3932:     return _msg_len + _msg_len/4 + ((_msg_len%4) ? 1 : 0);
     case LIQUID_FEC_SECDED7264:     return _msg_len + _msg_len/8 + ((_msg_len%8) ? 1 : 0);
 
-#if LIBFEC_ENABLED
     // convolutional codes
     case LIQUID_FEC_CONV_V27:       return 2*_msg_len + 2;  // (K-1)/r=12, round up to 2 bytes
     case LIQUID_FEC_CONV_V29:       return 2*_msg_len + 2;  // (K-1)/r=16, 2 bytes
@@ -241,33 +256,19 @@ unsigned int fec_get_enc_msg_length(fec_scheme   _scheme,
     case LIQUID_FEC_CONV_V29P67:    return fec_conv_get_enc_msg_len(_msg_len,9,6);
     case LIQUID_FEC_CONV_V29P78:    return fec_conv_get_enc_msg_len(_msg_len,9,7);
 
+#if LIBFEC_ENABLED
     // Reed-Solomon codes
     case LIQUID_FEC_RS_M8:          return fec_rs_get_enc_msg_len(_msg_len,32,255,223);
 #else
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
-        liquid_error(LIQUID_EUMODE,"fec_get_enc_msg_length(), convolutional codes unavailable (install libfec)");
-        break;
     case LIQUID_FEC_RS_M8:
         liquid_error(LIQUID_EUMODE,"fec_get_enc_msg_length(), Reed-Solomon codes unavailable (install libfec)");
         break;
 #endif
+
+    // low-density parity check codes
+    case LIQUID_FEC_LDPC_R12_K1024: return fec_ldpc_get_enc_msg_len(_msg_len,1024,2048);
+    case LIQUID_FEC_LDPC_R12_K4096: return fec_ldpc_get_enc_msg_len(_msg_len,4096,8192);
+    case LIQUID_FEC_LDPC_R34_K3072: return fec_ldpc_get_enc_msg_len(_msg_len,3072,4096);
     default:
         liquid_error(LIQUID_EIMODE,"fec_get_enc_msg_length(), unknown/unsupported scheme: %d\n", _scheme);
     }
@@ -413,7 +414,6 @@ float fec_get_rate(fec_scheme _scheme)
     case LIQUID_FEC_SECDED7264:     return 8./9.;
 
     // convolutional codes
-#if LIBFEC_ENABLED
     case LIQUID_FEC_CONV_V27:       return 1./2.;
     case LIQUID_FEC_CONV_V29:       return 1./2.;
     case LIQUID_FEC_CONV_V39:       return 1./3.;
@@ -431,34 +431,20 @@ float fec_get_rate(fec_scheme _scheme)
     case LIQUID_FEC_CONV_V29P67:    return 6./7.;
     case LIQUID_FEC_CONV_V29P78:    return 7./8.;
 
+#if LIBFEC_ENABLED
     // Reed-Solomon codes
     case LIQUID_FEC_RS_M8:          return 223./255.;
 #else
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
-        liquid_error(LIQUID_EUMODE,"fec_get_rate(), convolutional codes unavailable (install libfec)");
-        return 0.0f;
     case LIQUID_FEC_RS_M8:
         liquid_error(LIQUID_EUMODE,"fec_get_rate(), Reed-Solomon codes unavailable (install libfec)");
         return 0.0f;
 #endif
 
+    // low-density parity check codes
+    case LIQUID_FEC_LDPC_R12_K1024: return 1./2.;
+    case LIQUID_FEC_LDPC_R12_K4096: return 1./2.;
+    case LIQUID_FEC_LDPC_R34_K3072: return 3./4.;
+
     default:
         liquid_error(LIQUID_EIMODE,"fec_get_rate(), unknown/unsupported scheme: %d", _scheme);
         return 0.0f;
@@ -489,7 +475,6 @@ fec fec_create(fec_scheme _scheme, void *_opts)
     case LIQUID_FEC_SECDED7264: return fec_secded7264_create(_opts);
 
     // convolutional codes
-#if LIBFEC_ENABLED
     case LIQUID_FEC_CONV_V27:
     case LIQUID_FEC_CONV_V29:
     case LIQUID_FEC_CONV_V39:
@@ -512,34 +497,21 @@ fec fec_create(fec_scheme _scheme, void *_opts)
     case LIQUID_FEC_CONV_V29P78:
         return fec_conv_punctured_create(_scheme);
 
+#if LIBFEC_ENABLED
     // Reed-Solomon codes
     case LIQUID_FEC_RS_M8:
         return fec_rs_create(_scheme);
 #else
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
-        liquid_error(LIQUID_EUMODE,"fec_create(), convolutional codes unavailable (install libfec)");
-        return NULL;
     case LIQUID_FEC_RS_M8:
         liquid_error(LIQUID_EUMODE,"fec_create(), Reed-Solomon codes unavailable (install libfec)");
         return NULL;
 #endif
+
+    // low-density parity check codes
+    case LIQUID_FEC_LDPC_R12_K1024:
+    case LIQUID_FEC_LDPC_R12_K4096:
+    case LIQUID_FEC_LDPC_R34_K3072:
+        return fec_ldpc_create(_scheme);
     default:
         liquid_error(LIQUID_EIMODE,"fec_create(), unknown/unsupported scheme: %d", _scheme);
         return NULL;
@@ -599,7 +571,6 @@ int fec_destroy(fec _q)
     case LIQUID_FEC_SECDED7264: return fec_secded7264_destroy(_q);
 
     // convolutional codes
-#if LIBFEC_ENABLED
     case LIQUID_FEC_CONV_V27:
     case LIQUID_FEC_CONV_V29:
     case LIQUID_FEC_CONV_V39:
@@ -621,30 +592,20 @@ int fec_destroy(fec _q)
     case LIQUID_FEC_CONV_V29P78:
         return fec_conv_punctured_destroy(_q);
 
+#if LIBFEC_ENABLED
     // Reed-Solomon codes
     case LIQUID_FEC_RS_M8:
         return fec_rs_destroy(_q);
 #else
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
-        return liquid_error(LIQUID_EUMODE,"fec_destroy(), convolutional codes unavailable (install libfec)");
     case LIQUID_FEC_RS_M8:
         return liquid_error(LIQUID_EUMODE,"fec_destroy(), Reed-Solomon codes unavailable (install libfec)");
 #endif
+
+    // low-density parity check codes
+    case LIQUID_FEC_LDPC_R12_K1024:
+    case LIQUID_FEC_LDPC_R12_K4096:
+    case LIQUID_FEC_LDPC_R34_K3072:
+        return fec_ldpc_destroy(_q);
     default:
         return liquid_error(LIQUID_EUMODE,"fec_destroy(), unknown/unsupported scheme: %d\n", _q->scheme);
     }
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// low-density parity check layer update (AVX2)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_AVX2
+
+// include proper SIMD extensions for x86 AVX2
+#include <immintrin.h>
+
+// update layer, sixteen rows at a time
+int __attribute__((target("avx2")))
+fec_ldpc_update16_avx2(int16_t *    _v,
+                       int16_t *    _msg,
+                       unsigned int _d,
+                       unsigned int _z)
+{
+    __m256i vmax = _mm256_set1_epi16( FEC_LDPC_LLR_MAX);
+    __m256i vmin = _mm256_set1_epi16(-FEC_LDPC_LLR_MAX);
+    unsigned int i, b;
+    for (i=0; i+16<=_z; i+=16) {
+        // variable-to-check messages, two smallest magnitudes, and sign
+        __m256i min1 = vmax;
+        __m256i min2 = vmax;
+        __m256i imin = _mm256_setzero_si256();
+        __m256i sign = _mm256_setzero_si256();
+        for (b=0; b<_d; b++) {
+            __m256i x = _mm256_sub_epi16(_mm256_loadu_si256((__m256i*)&_v  [b*_z+i]),
+                                         _mm256_loadu_si256((__m256i*)&_msg[b*_z+i]));
+            x = _mm256_max_epi16(_mm256_min_epi16(x, vmax), vmin);
+            _mm256_storeu_si256((__m256i*)&_v[b*_z+i], x);
+
+            __m256i a  = _mm256_abs_epi16(x);
+            __m256i lt = _mm256_cmpgt_epi16(min1, a);
+            min2 = _mm256_blendv_epi8(_mm256_min_epi16(min2, a), min1, lt);
+            min1 = _mm256_min_epi16(min1, a);
+            imin = _mm256_blendv_epi8(imin, _mm256_set1_epi16(b), lt);
+            sign = _mm256_xor_si256(sign, x);
+        }
+        min1 = _mm256_srai_epi16(_mm256_add_epi16(min1, _mm256_add_epi16(min1, min1)), 2);
+        min2 = _mm256_srai_epi16(_mm256_add_epi16(min2, _mm256_add_epi16(min2, min2)), 2);
+
+        // check-to-variable messages and posteriors
+        for (b=0; b<_d; b++) {
+            __m256i x = _mm256_loadu_si256((__m256i*)&_v[b*_z+i]);
+            __m256i a = _mm256_blendv_epi8(min1, min2, _mm256_cmpeq_epi16(imin, _mm256_set1_epi16(b)));
+            __m256i s = _mm256_srai_epi16(_mm256_xor_si256(sign, x), 15);
+            __m256i r = _mm256_sub_epi16(_mm256_xor_si256(a, s), s);
+            _mm256_storeu_si256((__m256i*)&_msg[b*_z+i], r);
+            x = _mm256_max_epi16(_mm256_min_epi16(_mm256_add_epi16(x, r), vmax), vmin);
+            _mm256_storeu_si256((__m256i*)&_v[b*_z+i], x);
+        }
+    }
+
+    // remaining rows
+    fec_ldpc_update16_rows(_v, _msg, _d, _z, i);
+    return LIQUID_OK;
+}
+
+// update layer with 8-bit ratios, thirty-two rows at a time
+int __attribute__((target("avx2")))
+fec_ldpc_update8_avx2(int8_t *     _v,
+                      int8_t *     _msg,
+                      unsigned int _d,
+                      unsigned int _z)
+{
+    __m256i vmax = _mm256_set1_epi8( FEC_LDPC_LLR8_MAX);
+    __m256i vmin = _mm256_set1_epi8(-FEC_LDPC_LLR8_MAX);
+    __m256i v3   = _mm256_set1_epi8(3);
+    __m256i vlo  = _mm256_set1_epi8(0x3f);
+    unsigned int i, b;
+    for (i=0; i+32<=_z; i+=32) {
+        // variable-to-check messages, two smallest magnitudes, and sign
+        __m256i min1 = vmax;
+        __m256i min2 = vmax;
+        __m256i imin = _mm256_setzero_si256();
+        __m256i sign = _mm256_setzero_si256();
+        for (b=0; b<_d; b++) {
+            __m256i x = _mm256_subs_epi8(_mm256_loadu_si256((__m256i*)&_v  [b*_z+i]),
+                                         _mm256_loadu_si256((__m256i*)&_msg[b*_z+i]));
+            x = _mm256_max_epi8(x, vmin);
+            _mm256_storeu_si256((__m256i*)&_v[b*_z+i], x);
+
+            __m256i a  = _mm256_abs_epi8(x);
+            __m256i lt = _mm256_cmpgt_epi8(min1, a);
+            min2 = _mm256_blendv_epi8(_mm256_min_epi8(min2, a), min1, lt);
+            min1 = _mm256_min_epi8(min1, a);
+            imin = _mm256_blendv_epi8(imin, _mm256_set1_epi8(b), lt);
+            sign = _mm256_xor_si256(sign, x);
+        }
+
+        // normalize magnitudes by 3/4 without overflow: a - ceil(a/4)
+        min1 = _mm256_sub_epi8(min1, _mm256_and_si256(_mm256_srli_epi16(_mm256_add_epi8(min1, v3), 2), vlo));
+        min2 = _mm256_sub_epi8(min2, _mm256_and_si256(_mm256_srli_epi16(_mm256_add_epi8(min2, v3), 2), vlo));
+
+        // check-to-variable messages and posteriors
+        for (b=0; b<_d; b++) {
+            __m256i x = _mm256_loadu_si256((__m256i*)&_v[b*_z+i]);
+            __m256i a = _mm256_blendv_epi8(min1, min2, _mm256_cmpeq_epi8(imin, _mm256_set1_epi8(b)));
+            __m256i r = _mm256_blendv_epi8(a, _mm256_sub_epi8(_mm256_setzero_si256(), a),
+                                           _mm256_xor_si256(sign, x));
+            _mm256_storeu_si256((__m256i*)&_msg[b*_z+i], r);
+            x = _mm256_max_epi8(_mm256_adds_epi8(x, r), vmin);
+            _mm256_storeu_si256((__m256i*)&_v[b*_z+i], x);
+        }
+    }
+
+    // remaining rows
+    fec_ldpc_update8_rows(_v, _msg, _d, _z, i);
+    return LIQUID_OK;
+}
+
+// build guard
+#else
+
+// invalidated
+int fec_ldpc_update16_avx2(int16_t *    _v,
+                           int16_t *    _msg,
+                           unsigned int _d,
+                           unsigned int _z)
+{
+    return liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+}
+
+int fec_ldpc_update8_avx2(int8_t *     _v,
+                          int8_t *     _msg,
+                          unsigned int _d,
+                          unsigned int _z)
+{
+    return liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+}
+
+// build guard
+#endif
+
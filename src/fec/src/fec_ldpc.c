@@ -0,0 +1,966 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// quasi-cyclic low-density parity check (LDPC) codes
+//
+// The parity-check matrix H = [Hs Hp] pairs an array of circulant
+// permutations over the information bits with a block dual-diagonal parity
+// part whose first block column has weight three, as in IEEE 802.11n, so
+// parity is computed in linear time without a generator matrix. Messages longer than one block are
+// split evenly across blocks as with the Reed-Solomon codec; unused
+// information bits are shortened (fixed to zero and not transmitted).
+// Decoding runs a layered, normalized min-sum algorithm, stopping as soon
+// as all parity checks are satisfied. The rows of each block row (layer)
+// share no variables, so a layer is updated at once with one vector of
+// circulant size per block column; soft-decision input is decoded with
+// 16-bit fixed-point log-likelihood ratios and hard-decision input with
+// 8-bit ratios, doubling the number of rows per SIMD instruction.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+#define DEBUG_FEC_LDPC 0
+
+// maximum number of decoder iterations
+#define FEC_LDPC_MAX_STEPS      (20)
+
+// saturation of fixed-point log-likelihood ratios; shortened bits are
+// known with full confidence
+#define FEC_LDPC_LLR_MAX        (8191)
+
+// saturation and hard-decision confidence of 8-bit log-likelihood ratios
+#define FEC_LDPC_LLR8_MAX       (127)
+#define FEC_LDPC_LLR8_HARD      (16)
+
+// maximum attempts when choosing each circulant shift
+#define FEC_LDPC_GEN_MAX_TRIALS (1024)
+
+// select runtime execution method
+static int fec_ldpc_runtime_detect(fec _q);
+
+// run layered decoder from posteriors set to the channel input
+static int fec_ldpc_decode16(fec _q);
+static int fec_ldpc_decode8 (fec _q);
+
+// compute encoded message length; blocks are partitioned identically to
+// Reed-Solomon codes with _k/8 information and (_n-_k)/8 parity bytes
+//  _dec_msg_len    :   decoded message length (bytes)
+//  _k              :   information bits per block
+//  _n              :   code bits per block
+unsigned int fec_ldpc_get_enc_msg_len(unsigned int _dec_msg_len,
+                                      unsigned int _k,
+                                      unsigned int _n)
+{
+    return fec_rs_get_enc_msg_len(_dec_msg_len, (_n-_k)/8, _n/8, _k/8);
+}
+
+fec fec_ldpc_create(fec_scheme _fs)
+{
+    // circulant size, information block columns, parity block rows
+    unsigned int Z, kb, mb;
+    switch (_fs) {
+    case LIQUID_FEC_LDPC_R12_K1024: Z =  64; kb = 16; mb = 16; break;
+    case LIQUID_FEC_LDPC_R12_K4096: Z = 256; kb = 16; mb = 16; break;
+    case LIQUID_FEC_LDPC_R34_K3072: Z = 128; kb = 24; mb =  8; break;
+    default: return liquid_error_config("fec_ldpc_create(), invalid type");
+    }
+
+    // generate parity-check matrix
+    smatrixb H = fec_ldpc_gen_qc(Z, kb, mb, 3);
+    if (H == NULL)
+        return liquid_error_config("fec_ldpc_create(), could not generate parity-check matrix");
+
+    fec q = (fec) malloc(sizeof(struct fec_s));
+
+    q->scheme = _fs;
+    q->rate = fec_get_rate(q->scheme);
+
+    q->encode_func      = &fec_ldpc_encode;
+    q->decode_func      = &fec_ldpc_decode;
+    q->decode_soft_func = &fec_ldpc_decode_soft;
+
+    // compress matrix into graph
+    q->ldpc = fec_ldpc_graph_create(H);
+    smatrixb_destroy(H);
+
+    // block lengths (bytes)
+    q->ldpc_k = kb*Z;
+    q->ldpc_z = Z;
+    q->kk     = kb*Z/8;
+    q->nroots = mb*Z/8;
+    q->num_dec_bytes = 0;
+
+    // layers: the circulants of each block row follow from the variables
+    // of its first row, as row i of a circulant has column (i + shift) % Z
+    // within its block column
+    unsigned int r, e;
+    unsigned int num_circulants = q->ldpc->num_edges / Z;
+    q->ldpc_mb    = mb;
+    q->ldpc_layer = (unsigned int*) malloc((mb+1)*sizeof(unsigned int));
+    q->ldpc_base  = (unsigned int*) malloc(num_circulants*sizeof(unsigned int));
+    q->ldpc_shift = (unsigned int*) malloc(num_circulants*sizeof(unsigned int));
+    for (r=0; r<mb; r++) {
+        unsigned int e0 = q->ldpc->row[r*Z];
+        q->ldpc_layer[r] = e0 / Z;
+        for (e=e0; e<q->ldpc->row[r*Z+1]; e++) {
+            q->ldpc_base [e0/Z + e-e0] = q->ldpc->var[e] - q->ldpc->var[e] % Z;
+            q->ldpc_shift[e0/Z + e-e0] = q->ldpc->var[e] % Z;
+        }
+    }
+    q->ldpc_layer[mb] = num_circulants;
+
+    // allocate memory for arrays
+    unsigned int n = q->ldpc->n;
+    unsigned int num_edges = q->ldpc->num_edges;
+    q->ldpc_bits = (unsigned char*) malloc(n*sizeof(unsigned char));
+    q->ldpc_llr  = (int16_t*)       malloc(n*sizeof(int16_t));
+    q->ldpc_msg  = (int16_t*)       malloc(num_edges*sizeof(int16_t));
+    q->ldpc_v    = (int16_t*)       malloc(q->ldpc->max_degree*Z*sizeof(int16_t));
+    q->ldpc_llr8 = (int8_t*)        malloc(n*sizeof(int8_t));
+    q->ldpc_msg8 = (int8_t*)        malloc(num_edges*sizeof(int8_t));
+    q->ldpc_v8   = (int8_t*)        malloc(q->ldpc->max_degree*Z*sizeof(int8_t));
+
+    // detect runtime method for layer updates
+    fec_ldpc_runtime_detect(q);
+    return q;
+}
+
+int fec_ldpc_destroy(fec _q)
+{
+    // delete internal graph and memory arrays
+    fec_ldpc_graph_destroy(_q->ldpc);
+    free(_q->ldpc_layer);
+    free(_q->ldpc_base);
+    free(_q->ldpc_shift);
+    free(_q->ldpc_bits);
+    free(_q->ldpc_llr);
+    free(_q->ldpc_msg);
+    free(_q->ldpc_v);
+    free(_q->ldpc_llr8);
+    free(_q->ldpc_msg8);
+    free(_q->ldpc_v8);
+
+    // delete fec object
+    free(_q);
+    return LIQUID_OK;
+}
+
+// Set dec_msg_len, dividing the input message evenly into blocks; see
+// fec_rs_setlength() for details
+int fec_ldpc_setlength(fec _q, unsigned int _dec_msg_len)
+{
+    // return if length has not changed
+    if (_dec_msg_len == _q->num_dec_bytes)
+        return LIQUID_OK;
+
+    // reset lengths
+    _q->num_dec_bytes = _dec_msg_len;
+
+    div_t d;
+
+    // compute the total number of blocks necessary: ceil(num_dec_bytes / kk)
+    d = div(_q->num_dec_bytes, _q->kk);
+    _q->num_blocks = d.quot + (d.rem==0 ? 0 : 1);
+
+    // compute the decoded block length: ceil(num_dec_bytes / num_blocks)
+    d = div(_dec_msg_len, _q->num_blocks);
+    _q->dec_block_len = d.quot + (d.rem == 0 ? 0 : 1);
+
+    // compute the encoded block length: dec_block_len + nroots
+    _q->enc_block_len = _q->dec_block_len + _q->nroots;
+
+    // compute the residual padding bytes in the last block
+    _q->res_block_len = (_q->num_blocks*_q->dec_block_len) % _q->num_dec_bytes;
+
+    // compute the final encoded block length: enc_block_len * num_blocks
+    _q->num_enc_bytes = _q->enc_block_len * _q->num_blocks;
+
+#if DEBUG_FEC_LDPC
+    printf("dec_msg_len     :   %u\n", _q->num_dec_bytes);
+    printf("num_blocks      :   %u\n", _q->num_blocks);
+    printf("dec_block_len   :   %u\n", _q->dec_block_len);
+    printf("enc_block_len   :   %u\n", _q->enc_block_len);
+    printf("res_block_len   :   %u\n", _q->res_block_len);
+    printf("enc_msg_len     :   %u\n", _q->num_enc_bytes);
+#endif
+    return LIQUID_OK;
+}
+
+// compute parity bytes for a single block: with the contribution of the
+// information bits to block row r denoted l[r], the first parity block is
+// p[0] = sum of all l[r], and the remaining blocks follow from the dual
+// diagonal, p[r+1] = p[r] + l[r] (+ p[0] at the middle row)
+//  _q      :   fec object
+//  _info   :   information bytes, [size: dec_block_len x 1]
+//  _parity :   parity bytes, [size: nroots x 1]
+static int fec_ldpc_encode_block(fec             _q,
+                                 unsigned char * _info,
+                                 unsigned char * _parity)
+{
+    fec_ldpc_graph G = _q->ldpc;
+    unsigned int   k  = _q->ldpc_k;
+    unsigned int   Z  = _q->ldpc_z;
+    unsigned int   mb = G->m / Z;
+    unsigned char * u = _q->ldpc_bits;      // information bits
+    unsigned char * l = _q->ldpc_bits + k;  // row sums, then parity blocks
+
+    // unpack information bits; shortened bits are zero
+    unsigned int t;
+    unsigned int nbits = 8*_q->dec_block_len;
+    for (t=0; t<k; t++)
+        u[t] = t < nbits ? (_info[t/8] >> (7-(t%8))) & 1 : 0;
+
+    // sum information bits in each row
+    unsigned int i, j, e, r;
+    for (j=0; j<G->m; j++) {
+        unsigned char v = 0;
+        for (e=G->row[j]; e<G->row[j+1]; e++) {
+            if (G->var[e] < k)
+                v ^= u[G->var[e]];
+        }
+        l[j] = v;
+    }
+
+    // first parity block replaces the last row sum, which is not needed
+    // for the recursion; each remaining block replaces the row sum
+    // preceding it
+    unsigned char * p0 = l + (mb-1)*Z;
+    for (i=0; i<Z; i++) {
+        for (r=0; r<mb-1; r++)
+            p0[i] ^= l[r*Z + i];
+    }
+    for (i=0; i<Z; i++)
+        l[i] ^= p0[(i+1)%Z];
+    for (r=1; r<mb-1; r++) {
+        for (i=0; i<Z; i++)
+            l[r*Z + i] ^= l[(r-1)*Z + i] ^ (r == mb/2 ? p0[i] : 0);
+    }
+
+    // pack parity bits in block order p[0], p[1], ..., p[mb-1]
+    memset(_parity, 0x00, G->m/8);
+    for (j=0; j<G->m; j++) {
+        unsigned char p = j < Z ? p0[j] : l[j-Z];
+        _parity[j/8] |= p << (7-(j%8));
+    }
+    return LIQUID_OK;
+}
+
+int fec_ldpc_encode(fec             _q,
+                    unsigned int    _dec_msg_len,
+                    unsigned char * _msg_dec,
+                    unsigned char * _msg_enc)
+{
+    // validate input
+    if (_dec_msg_len == 0)
+        return liquid_error(LIQUID_EICONFIG,"fec_ldpc_encode(), input length must be > 0");
+
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    unsigned int i;
+    unsigned int n0=0;  // input index
+    unsigned int n1=0;  // output index
+    unsigned int block_size = _q->dec_block_len;
+    for (i=0; i<_q->num_blocks; i++) {
+
+        // the last block is smaller by the residual block length
+        if (i == _q->num_blocks-1)
+            block_size -= _q->res_block_len;
+
+        // systematic: copy sequence, padding the last block with zeros
+        memmove(&_msg_enc[n1], &_msg_dec[n0], block_size*sizeof(unsigned char));
+        memset(&_msg_enc[n1+block_size], 0x00, (_q->dec_block_len-block_size)*sizeof(unsigned char));
+
+        // append parity bytes
+        fec_ldpc_encode_block(_q, &_msg_enc[n1], &_msg_enc[n1+_q->dec_block_len]);
+
+        // increment counters
+        n0 += block_size;
+        n1 += _q->enc_block_len;
+    }
+
+    // sanity check
+    if (n0 != _q->num_dec_bytes)
+        return liquid_error(LIQUID_EINT,"fec_ldpc_encode(), unexpected decoded byte count");
+    if (n1 != _q->num_enc_bytes)
+        return liquid_error(LIQUID_EINT,"fec_ldpc_encode(), unexpected encoded byte count");
+    return LIQUID_OK;
+}
+
+// channel log-likelihood ratio of code bit _i (positive values favor zero)
+//  _enc    :   encoded block, soft bits or packed bytes
+//  _i      :   bit index within block
+static inline int16_t fec_ldpc_llr_soft(unsigned char * _enc,
+                                        unsigned int    _i)
+{
+    return (int16_t)(255 - 2*(int)_enc[_i]);
+}
+static inline int8_t fec_ldpc_llr_hard(unsigned char * _enc,
+                                       unsigned int    _i)
+{
+    return ((_enc[_i/8] >> (7-(_i%8))) & 1) ? -FEC_LDPC_LLR8_HARD : FEC_LDPC_LLR8_HARD;
+}
+
+// decode a single block
+//  _q          :   fec object
+//  _enc        :   encoded block, packed bytes or soft bits
+//  _block_size :   number of valid information bytes in block
+//  _soft       :   soft-bit input flag
+//  _dec        :   decoded bytes, [size: _block_size x 1]
+static int fec_ldpc_decode_block(fec             _q,
+                                 unsigned char * _enc,
+                                 unsigned int    _block_size,
+                                 int             _soft,
+                                 unsigned char * _dec)
+{
+    fec_ldpc_graph G = _q->ldpc;
+    unsigned int   k = _q->ldpc_k;
+    unsigned int   num_tx    = 8*_q->dec_block_len;    // transmitted information bits
+    unsigned int   num_valid = 8*_block_size;          // valid information bits
+
+    // information bits beyond the valid portion are known to be zero
+    unsigned int i;
+    if (_soft) {
+        for (i=0; i<k; i++)
+            _q->ldpc_llr[i] = i < num_valid ? fec_ldpc_llr_soft(_enc, i) : FEC_LDPC_LLR_MAX;
+        for (i=0; i<G->m; i++)
+            _q->ldpc_llr[k+i] = fec_ldpc_llr_soft(_enc, num_tx+i);
+        fec_ldpc_decode16(_q);
+    } else {
+        for (i=0; i<k; i++)
+            _q->ldpc_llr8[i] = i < num_valid ? fec_ldpc_llr_hard(_enc, i) : FEC_LDPC_LLR8_MAX;
+        for (i=0; i<G->m; i++)
+            _q->ldpc_llr8[k+i] = fec_ldpc_llr_hard(_enc, num_tx+i);
+        fec_ldpc_decode8(_q);
+    }
+
+    // pack information bits
+    memset(_dec, 0x00, _block_size*sizeof(unsigned char));
+    for (i=0; i<num_valid; i++)
+        _dec[i/8] |= _q->ldpc_bits[i] << (7-(i%8));
+    return LIQUID_OK;
+}
+
+// decode message from packed bytes or soft bits
+static int fec_ldpc_decode_message(fec             _q,
+                                   unsigned int    _dec_msg_len,
+                                   unsigned char * _msg_enc,
+                                   unsigned char * _msg_dec,
+                                   int             _soft)
+{
+    // validate input
+    if (_dec_msg_len == 0)
+        return liquid_error(LIQUID_EICONFIG,"fec_ldpc_decode(), input length must be > 0");
+
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    unsigned int i;
+    unsigned int n0=0;  // input index (bytes)
+    unsigned int n1=0;  // output index
+    unsigned int block_size = _q->dec_block_len;
+    for (i=0; i<_q->num_blocks; i++) {
+
+        // the last block is smaller by the residual block length
+        if (i == _q->num_blocks-1)
+            block_size -= _q->res_block_len;
+
+        // decode block
+        fec_ldpc_decode_block(_q, &_msg_enc[_soft ? 8*n0 : n0], block_size, _soft, &_msg_dec[n1]);
+
+        // increment counters
+        n0 += _q->enc_block_len;
+        n1 += block_size;
+    }
+
+    // sanity check
+    if (n0 != _q->num_enc_bytes)
+        return liquid_error(LIQUID_EINT,"fec_ldpc_decode(), unexpected encoded byte count");
+    if (n1 != _q->num_dec_bytes)
+        return liquid_error(LIQUID_EINT,"fec_ldpc_decode(), unexpected decoded byte count");
+    return LIQUID_OK;
+}
+
+int fec_ldpc_decode(fec             _q,
+                    unsigned int    _dec_msg_len,
+                    unsigned char * _msg_enc,
+                    unsigned char * _msg_dec)
+{
+    return fec_ldpc_decode_message(_q, _dec_msg_len, _msg_enc, _msg_dec, 0);
+}
+
+int fec_ldpc_decode_soft(fec             _q,
+                         unsigned int    _dec_msg_len,
+                         unsigned char * _msg_enc,
+                         unsigned char * _msg_dec)
+{
+    return fec_ldpc_decode_message(_q, _dec_msg_len, _msg_enc, _msg_dec, 1);
+}
+
+//
+// parity-check matrix and graph
+//
+
+// determine if circulant shift _s at block (_r,_c) avoids cycles of length
+// four: two block columns sharing two block rows form a cycle when the
+// differences in their shifts are equal
+//  _shift  :   block shifts (-1 if empty), [size: _mb x _nb]
+static int fec_ldpc_gen_qc_valid(int *        _shift,
+                                 unsigned int _Z,
+                                 unsigned int _mb,
+                                 unsigned int _nb,
+                                 unsigned int _r,
+                                 unsigned int _c,
+                                 int          _s)
+{
+    unsigned int r, c;
+    int Z = (int)_Z;
+    for (r=0; r<_mb; r++) {
+        int s = _shift[r*_nb + _c];
+        if (r == _r || s < 0)
+            continue;
+
+        int d = (_s - s + Z) % Z;
+        for (c=0; c<_nb; c++) {
+            int s0 = _shift[_r*_nb + c];
+            int s1 = _shift[ r*_nb + c];
+            if (c != _c && s0 >= 0 && s1 >= 0 && (s0 - s1 + Z) % Z == d)
+                return 0;
+        }
+    }
+    return 1;
+}
+
+// generate quasi-cyclic parity-check matrix
+smatrixb fec_ldpc_gen_qc(unsigned int _Z,
+                         unsigned int _kb,
+                         unsigned int _mb,
+                         unsigned int _dv)
+{
+    // validate input
+    if (_Z == 0 || _Z > 65536 || _kb == 0 || _mb < 3)
+        return liquid_error_config("fec_ldpc_gen_qc(), invalid dimensions");
+    if (_dv == 0 || _dv > _mb)
+        return liquid_error_config("fec_ldpc_gen_qc(), column weight must be in [1,%u]", _mb);
+
+    // block shifts for information columns followed by parity columns
+    unsigned int nb = _kb + _mb;
+    int * shift = (int*) malloc(_mb*nb*sizeof(int));
+    unsigned int r, c, i, t;
+    for (i=0; i<_mb*nb; i++)
+        shift[i] = -1;
+
+    // parity: first block column has weight three, the rest are
+    // dual-diagonal identities
+    shift[           0*nb + _kb] = 1;
+    shift[     (_mb/2)*nb + _kb] = 0;
+    shift[     (_mb-1)*nb + _kb] = 1;
+    for (c=1; c<_mb; c++) {
+        shift[(c-1)*nb + _kb + c] = 0;
+        shift[    c*nb + _kb + c] = 0;
+    }
+
+    // information: spread each block column over consecutive block rows
+    // so that every row has the same weight
+    msequence ms = msequence_create_default(16);
+    for (c=0; c<_kb; c++) {
+        for (i=0; i<_dv; i++) {
+            r = (c*_dv + i) % _mb;
+            int s = 0;
+            for (t=0; t<FEC_LDPC_GEN_MAX_TRIALS; t++) {
+                s = msequence_generate_symbol(ms,16) % _Z;
+                if (fec_ldpc_gen_qc_valid(shift, _Z, _mb, nb, r, c, s))
+                    break;
+            }
+            if (t == FEC_LDPC_GEN_MAX_TRIALS) {
+                msequence_destroy(ms);
+                free(shift);
+                return liquid_error_config("fec_ldpc_gen_qc(), could not place circulant (%u,%u) without cycles of length four", r, c);
+            }
+            shift[r*nb + c] = s;
+        }
+    }
+    msequence_destroy(ms);
+
+    // expand circulants: row i of block (r,c) has column (i + shift) % Z
+    smatrixb H = smatrixb_create(_mb*_Z, nb*_Z);
+    for (r=0; r<_mb; r++) {
+        for (c=0; c<nb; c++) {
+            if (shift[r*nb + c] < 0)
+                continue;
+            for (i=0; i<_Z; i++)
+                smatrixb_set(H, r*_Z + i, c*_Z + (i + shift[r*nb + c]) % _Z, 1);
+        }
+    }
+    free(shift);
+    return H;
+}
+
+// create graph from sparse binary parity-check matrix
+fec_ldpc_graph fec_ldpc_graph_create(smatrixb _H)
+{
+    unsigned int m, n;
+    smatrixb_size(_H, &m, &n);
+
+    fec_ldpc_graph q = (fec_ldpc_graph) malloc(sizeof(struct fec_ldpc_graph_s));
+    q->m = m;
+    q->n = n;
+
+    // count edges in each row
+    unsigned int j, d, e;
+    q->row = (unsigned int*) malloc((m+1)*sizeof(unsigned int));
+    q->num_edges  = 0;
+    q->max_degree = 0;
+    for (j=0; j<m; j++) {
+        smatrixb_get_row(_H, j, NULL, &d);
+        q->row[j] = q->num_edges;
+        q->num_edges += d;
+        q->max_degree = d > q->max_degree ? d : q->max_degree;
+    }
+    q->row[m] = q->num_edges;
+
+    // variable of each edge
+    q->var = (unsigned int*) malloc(q->num_edges*sizeof(unsigned int));
+    for (j=0; j<m; j++)
+        smatrixb_get_row(_H, j, q->var + q->row[j], &d);
+
+    // group edges by column (counting sort, preserving row order)
+    q->col      = (unsigned int*) calloc(n+1, sizeof(unsigned int));
+    q->col_edge = (unsigned int*) malloc(q->num_edges*sizeof(unsigned int));
+    for (e=0; e<q->num_edges; e++)
+        q->col[q->var[e]+1]++;
+    for (j=0; j<n; j++)
+        q->col[j+1] += q->col[j];
+    unsigned int * pos = (unsigned int*) malloc(n*sizeof(unsigned int));
+    memmove(pos, q->col, n*sizeof(unsigned int));
+    for (e=0; e<q->num_edges; e++)
+        q->col_edge[ pos[q->var[e]]++ ] = e;
+    free(pos);
+    return q;
+}
+
+// destroy graph, freeing all internal memory
+int fec_ldpc_graph_destroy(fec_ldpc_graph _q)
+{
+    free(_q->row);
+    free(_q->var);
+    free(_q->col);
+    free(_q->col_edge);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// check parity of hard decisions; returns 1 if all checks pass
+int fec_ldpc_graph_check(fec_ldpc_graph  _q,
+                         unsigned char * _c)
+{
+    unsigned int j, e;
+    for (j=0; j<_q->m; j++) {
+        unsigned char p = 0;
+        for (e=_q->row[j]; e<_q->row[j+1]; e++)
+            p ^= _c[_q->var[e]];
+        if (p)
+            return 0;
+    }
+    return 1;
+}
+
+//
+// min-sum decoder
+//
+
+// saturate log-likelihood ratio
+static inline int fec_ldpc_clamp(int _x)
+{
+    if (_x >  FEC_LDPC_LLR_MAX) return  FEC_LDPC_LLR_MAX;
+    if (_x < -FEC_LDPC_LLR_MAX) return -FEC_LDPC_LLR_MAX;
+    return _x;
+}
+
+// update a single check node and its variables: the outgoing magnitude on
+// each edge is the smallest incoming magnitude among the other edges,
+// scaled by 3/4, with the sign set to satisfy parity
+//  _llr    :   posterior log-likelihood ratios, [size: n x 1]
+//  _msg    :   check-to-variable messages of row, [size: _d x 1]
+//  _var    :   variables of row, [size: _d x 1]
+//  _d      :   check degree
+//  _buf    :   buffer for incoming messages, [size: _d x 1]
+static void fec_ldpc_minsum_check(int16_t *      _llr,
+                                  int16_t *      _msg,
+                                  unsigned int * _var,
+                                  unsigned int   _d,
+                                  int16_t *      _buf)
+{
+    // gather variable-to-check messages
+    unsigned int i;
+    for (i=0; i<_d; i++)
+        _buf[i] = fec_ldpc_clamp(_llr[_var[i]] - _msg[i]);
+
+    // find two smallest magnitudes and overall sign
+    int min1 = FEC_LDPC_LLR_MAX;
+    int min2 = FEC_LDPC_LLR_MAX;
+    unsigned int imin = 0;
+    int sign = 0;
+    for (i=0; i<_d; i++) {
+        int a = _buf[i] < 0 ? -_buf[i] : _buf[i];
+        sign ^= _buf[i] < 0;
+        if (a < min1) {
+            min2 = min1;
+            min1 = a;
+            imin = i;
+        } else if (a < min2) {
+            min2 = a;
+        }
+    }
+    min1 = (3*min1) >> 2;
+    min2 = (3*min2) >> 2;
+
+    // scatter check-to-variable messages and update posterior
+    for (i=0; i<_d; i++) {
+        int a = i == imin ? min2 : min1;
+        int r = (sign ^ (_buf[i] < 0)) ? -a : a;
+        _msg[i] = r;
+        _llr[_var[i]] = fec_ldpc_clamp(_buf[i] + r);
+    }
+}
+
+// run layered, normalized min-sum decoder
+int fec_ldpc_minsum(fec_ldpc_graph  _q,
+                    int16_t *       _llr,
+                    int16_t *       _msg,
+                    unsigned char * _c_hat,
+                    unsigned int    _max_steps)
+{
+    int16_t buf[_q->max_degree > 0 ? _q->max_degree : 1];
+    unsigned int i, j, t;
+
+    // hard decisions from channel; stop early if parity already checks
+    for (i=0; i<_q->n; i++)
+        _c_hat[i] = _llr[i] < 0;
+    int parity_pass = fec_ldpc_graph_check(_q, _c_hat);
+
+    for (t=0; t<_max_steps && !parity_pass; t++) {
+        // update each check in turn
+        for (j=0; j<_q->m; j++) {
+            fec_ldpc_minsum_check(_llr,
+                                  _msg    + _q->row[j],
+                                  _q->var + _q->row[j],
+                                  _q->row[j+1] - _q->row[j],
+                                  buf);
+        }
+
+        // compute hard decisions and check parity
+        for (i=0; i<_q->n; i++)
+            _c_hat[i] = _llr[i] < 0;
+        parity_pass = fec_ldpc_graph_check(_q, _c_hat);
+#if DEBUG_FEC_LDPC
+        printf("  fec_ldpc_minsum(), iteration %2u : %s\n", t, parity_pass ? "pass" : "FAIL");
+#endif
+    }
+    return parity_pass;
+}
+
+
+//
+// layered decoder for quasi-cyclic codes
+//
+
+// saturate 8-bit log-likelihood ratio
+static inline int fec_ldpc_clamp8(int _x)
+{
+    if (_x >  FEC_LDPC_LLR8_MAX) return  FEC_LDPC_LLR8_MAX;
+    if (_x < -FEC_LDPC_LLR8_MAX) return -FEC_LDPC_LLR8_MAX;
+    return _x;
+}
+
+// copy posteriors of the variables in layer _r into row order: element i
+// of circulant b is variable base[b] + (i + shift[b]) % Z
+//  _llr    :   posteriors in variable order, [size: n x _size bytes]
+//  _v      :   posteriors in row order, [size: d*Z x _size bytes]
+static void fec_ldpc_gather(fec             _q,
+                            unsigned int    _r,
+                            unsigned char * _llr,
+                            unsigned char * _v,
+                            size_t          _size)
+{
+    unsigned int Z = _q->ldpc_z;
+    unsigned int b;
+    for (b=_q->ldpc_layer[_r]; b<_q->ldpc_layer[_r+1]; b++) {
+        unsigned int s = _q->ldpc_shift[b];
+        unsigned char * src = _llr + _q->ldpc_base[b]*_size;
+        memmove(_v,               src + s*_size, (Z-s)*_size);
+        memmove(_v + (Z-s)*_size, src,               s*_size);
+        _v += Z*_size;
+    }
+}
+
+// copy posteriors of layer _r from row order back into variable order
+static void fec_ldpc_scatter(fec             _q,
+                             unsigned int    _r,
+                             unsigned char * _llr,
+                             unsigned char * _v,
+                             size_t          _size)
+{
+    unsigned int Z = _q->ldpc_z;
+    unsigned int b;
+    for (b=_q->ldpc_layer[_r]; b<_q->ldpc_layer[_r+1]; b++) {
+        unsigned int s = _q->ldpc_shift[b];
+        unsigned char * dst = _llr + _q->ldpc_base[b]*_size;
+        memmove(dst + s*_size, _v,               (Z-s)*_size);
+        memmove(dst,           _v + (Z-s)*_size,     s*_size);
+        _v += Z*_size;
+    }
+}
+
+// run layered, normalized min-sum decoder on 16-bit posteriors, starting
+// from empty messages; returns 1 if parity checks
+static int fec_ldpc_decode16(fec _q)
+{
+    fec_ldpc_graph G = _q->ldpc;
+    unsigned int   Z = _q->ldpc_z;
+    unsigned int i, r, t;
+
+    // hard decisions from channel; stop early if parity already checks
+    memset(_q->ldpc_msg, 0x00, G->num_edges*sizeof(int16_t));
+    for (i=0; i<G->n; i++)
+        _q->ldpc_bits[i] = _q->ldpc_llr[i] < 0;
+    int parity_pass = fec_ldpc_graph_check(G, _q->ldpc_bits);
+
+    for (t=0; t<FEC_LDPC_MAX_STEPS && !parity_pass; t++) {
+        // update each layer in turn
+        for (r=0; r<_q->ldpc_mb; r++) {
+            unsigned int b0 = _q->ldpc_layer[r];
+            fec_ldpc_gather(_q, r, (unsigned char*)_q->ldpc_llr, (unsigned char*)_q->ldpc_v, sizeof(int16_t));
+            _q->ldpc_update16(_q->ldpc_v, _q->ldpc_msg + b0*Z, _q->ldpc_layer[r+1]-b0, Z);
+            fec_ldpc_scatter(_q, r, (unsigned char*)_q->ldpc_llr, (unsigned char*)_q->ldpc_v, sizeof(int16_t));
+        }
+
+        // compute hard decisions and check parity
+        for (i=0; i<G->n; i++)
+            _q->ldpc_bits[i] = _q->ldpc_llr[i] < 0;
+        parity_pass = fec_ldpc_graph_check(G, _q->ldpc_bits);
+    }
+    return parity_pass;
+}
+
+// run layered, normalized min-sum decoder on 8-bit posteriors, starting
+// from empty messages; returns 1 if parity checks
+static int fec_ldpc_decode8(fec _q)
+{
+    fec_ldpc_graph G = _q->ldpc;
+    unsigned int   Z = _q->ldpc_z;
+    unsigned int i, r, t;
+
+    // hard decisions from channel; stop early if parity already checks
+    memset(_q->ldpc_msg8, 0x00, G->num_edges*sizeof(int8_t));
+    for (i=0; i<G->n; i++)
+        _q->ldpc_bits[i] = _q->ldpc_llr8[i] < 0;
+    int parity_pass = fec_ldpc_graph_check(G, _q->ldpc_bits);
+
+    for (t=0; t<FEC_LDPC_MAX_STEPS && !parity_pass; t++) {
+        // update each layer in turn
+        for (r=0; r<_q->ldpc_mb; r++) {
+            unsigned int b0 = _q->ldpc_layer[r];
+            fec_ldpc_gather(_q, r, (unsigned char*)_q->ldpc_llr8, (unsigned char*)_q->ldpc_v8, sizeof(int8_t));
+            _q->ldpc_update8(_q->ldpc_v8, _q->ldpc_msg8 + b0*Z, _q->ldpc_layer[r+1]-b0, Z);
+            fec_ldpc_scatter(_q, r, (unsigned char*)_q->ldpc_llr8, (unsigned char*)_q->ldpc_v8, sizeof(int8_t));
+        }
+
+        // compute hard decisions and check parity
+        for (i=0; i<G->n; i++)
+            _q->ldpc_bits[i] = _q->ldpc_llr8[i] < 0;
+        parity_pass = fec_ldpc_graph_check(G, _q->ldpc_bits);
+    }
+    return parity_pass;
+}
+
+// update rows _i0 through _z-1 of a layer, one at a time; the SIMD kernels
+// finish any rows beyond a multiple of their vector length here
+static void fec_ldpc_update16_rows(int16_t *    _v,
+                                   int16_t *    _msg,
+                                   unsigned int _d,
+                                   unsigned int _z,
+                                   unsigned int _i0)
+{
+    unsigned int i, b;
+    for (i=_i0; i<_z; i++) {
+        // variable-to-check messages, two smallest magnitudes, and sign
+        int min1 = FEC_LDPC_LLR_MAX;
+        int min2 = FEC_LDPC_LLR_MAX;
+        unsigned int imin = 0;
+        int sign = 0;
+        for (b=0; b<_d; b++) {
+            int x = fec_ldpc_clamp(_v[b*_z+i] - _msg[b*_z+i]);
+            int a = x < 0 ? -x : x;
+            _v[b*_z+i] = x;
+            sign ^= x < 0;
+            if (a < min1) {
+                min2 = min1;
+                min1 = a;
+                imin = b;
+            } else if (a < min2) {
+                min2 = a;
+            }
+        }
+        min1 = (3*min1) >> 2;
+        min2 = (3*min2) >> 2;
+
+        // check-to-variable messages and posteriors
+        for (b=0; b<_d; b++) {
+            int x = _v[b*_z+i];
+            int a = b == imin ? min2 : min1;
+            int r = (sign ^ (x < 0)) ? -a : a;
+            _msg[b*_z+i] = r;
+            _v[b*_z+i]   = fec_ldpc_clamp(x + r);
+        }
+    }
+}
+
+// update rows _i0 through _z-1 of a layer with 8-bit ratios
+static void fec_ldpc_update8_rows(int8_t *     _v,
+                                  int8_t *     _msg,
+                                  unsigned int _d,
+                                  unsigned int _z,
+                                  unsigned int _i0)
+{
+    unsigned int i, b;
+    for (i=_i0; i<_z; i++) {
+        // variable-to-check messages, two smallest magnitudes, and sign
+        int min1 = FEC_LDPC_LLR8_MAX;
+        int min2 = FEC_LDPC_LLR8_MAX;
+        unsigned int imin = 0;
+        int sign = 0;
+        for (b=0; b<_d; b++) {
+            int x = fec_ldpc_clamp8(_v[b*_z+i] - _msg[b*_z+i]);
+            int a = x < 0 ? -x : x;
+            _v[b*_z+i] = x;
+            sign ^= x < 0;
+            if (a < min1) {
+                min2 = min1;
+                min1 = a;
+                imin = b;
+            } else if (a < min2) {
+                min2 = a;
+            }
+        }
+        min1 = (3*min1) >> 2;
+        min2 = (3*min2) >> 2;
+
+        // check-to-variable messages and posteriors
+        for (b=0; b<_d; b++) {
+            int x = _v[b*_z+i];
+            int a = b == imin ? min2 : min1;
+            int r = (sign ^ (x < 0)) ? -a : a;
+            _msg[b*_z+i] = r;
+            _v[b*_z+i]   = fec_ldpc_clamp8(x + r);
+        }
+    }
+}
+
+// portable layer updates
+int fec_ldpc_update16_port(int16_t *    _v,
+                           int16_t *    _msg,
+                           unsigned int _d,
+                           unsigned int _z)
+{
+    fec_ldpc_update16_rows(_v, _msg, _d, _z, 0);
+    return LIQUID_OK;
+}
+
+int fec_ldpc_update8_port(int8_t *     _v,
+                          int8_t *     _msg,
+                          unsigned int _d,
+                          unsigned int _z)
+{
+    fec_ldpc_update8_rows(_v, _msg, _d, _z, 0);
+    return LIQUID_OK;
+}
+
+// select runtime execution method
+int fec_ldpc_runtime_select(fec              _q,
+                            liquid_runtime_t _select)
+{
+    switch (_select) {
+    case LIQUID_RUNTIME_PORT:
+        liquid_log_trace("fec_ldpc_runtime_select(), port");
+        _q->ldpc_update16 = &fec_ldpc_update16_port;
+        _q->ldpc_update8  = &fec_ldpc_update8_port;
+        return LIQUID_OK;
+    case LIQUID_RUNTIME_NEON:
+        liquid_log_trace("fec_ldpc_runtime_select(), neon");
+        _q->ldpc_update16 = &fec_ldpc_update16_neon;
+        _q->ldpc_update8  = &fec_ldpc_update8_neon;
+        return LIQUID_OK;
+    case LIQUID_RUNTIME_AVX2:
+        liquid_log_trace("fec_ldpc_runtime_select(), avx2");
+        _q->ldpc_update16 = &fec_ldpc_update16_avx2;
+        _q->ldpc_update8  = &fec_ldpc_update8_avx2;
+        return LIQUID_OK;
+    default:;
+    }
+
+    _q->ldpc_update16 = &fec_ldpc_update16_port;
+    _q->ldpc_update8  = &fec_ldpc_update8_port;
+    return liquid_error(LIQUID_EINT,
+        "fec_ldpc_runtime_select(), invalid selection or mode not available (%d), falling back to portable version",
+        _select);
+}
+
+// detect runtime execution method
+static int fec_ldpc_runtime_detect(fec _q)
+{
+    // implementations
+    struct liquid_cpuinfo_s impl =
+    {
+        .altivec = 0,
+        .neon    = true,
+        .mmx     = 0,
+        .sse     = 0,
+        .sse2    = 0,
+        .sse3    = 0,
+        .ssse3   = 0,
+        .sse41   = 0,
+        .sse42   = 0,
+        .avx     = 0,
+        .fma3    = 0,
+        .avx2    = true,
+        .avx512  = 0,
+        .amx     = 0,
+        .amx101  = 0,
+        .amx102  = 0,
+    };
+
+    // given implementations, find best method
+    liquid_runtime_t selection = liquid_runtime_detect(&impl);
+
+    // invoke selection method
+    return fec_ldpc_runtime_select(_q, selection);
+}
+
+// runtime-specific kernels
+#include "fec_ldpc.neon.c"
+#include "fec_ldpc.avx2.c"
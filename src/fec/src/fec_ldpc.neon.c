@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// low-density parity check layer update (ARM Neon)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_NEON
+
+// include proper SIMD extensions for ARM Neon
+#include <arm_neon.h>
+
+// update layer, eight rows at a time
+int fec_ldpc_update16_neon(int16_t *    _v,
+                           int16_t *    _msg,
+                           unsigned int _d,
+                           unsigned int _z)
+{
+    int16x8_t vmax = vdupq_n_s16( FEC_LDPC_LLR_MAX);
+    int16x8_t vmin = vdupq_n_s16(-FEC_LDPC_LLR_MAX);
+    unsigned int i, b;
+    for (i=0; i+8<=_z; i+=8) {
+        // variable-to-check messages, two smallest magnitudes, and sign
+        int16x8_t min1 = vmax;
+        int16x8_t min2 = vmax;
+        int16x8_t imin = vdupq_n_s16(0);
+        int16x8_t sign = vdupq_n_s16(0);
+        for (b=0; b<_d; b++) {
+            int16x8_t x = vsubq_s16(vld1q_s16(&_v[b*_z+i]), vld1q_s16(&_msg[b*_z+i]));
+            x = vmaxq_s16(vminq_s16(x, vmax), vmin);
+            vst1q_s16(&_v[b*_z+i], x);
+
+            int16x8_t  a  = vabsq_s16(x);
+            uint16x8_t lt = vcltq_s16(a, min1);
+            min2 = vbslq_s16(lt, min1, vminq_s16(min2, a));
+            min1 = vminq_s16(min1, a);
+            imin = vbslq_s16(lt, vdupq_n_s16(b), imin);
+            sign = veorq_s16(sign, x);
+        }
+        min1 = vshrq_n_s16(vaddq_s16(min1, vaddq_s16(min1, min1)), 2);
+        min2 = vshrq_n_s16(vaddq_s16(min2, vaddq_s16(min2, min2)), 2);
+
+        // check-to-variable messages and posteriors
+        for (b=0; b<_d; b++) {
+            int16x8_t x = vld1q_s16(&_v[b*_z+i]);
+            int16x8_t a = vbslq_s16(vceqq_s16(imin, vdupq_n_s16(b)), min2, min1);
+            int16x8_t s = vshrq_n_s16(veorq_s16(sign, x), 15);
+            int16x8_t r = vsubq_s16(veorq_s16(a, s), s);
+            vst1q_s16(&_msg[b*_z+i], r);
+            x = vmaxq_s16(vminq_s16(vaddq_s16(x, r), vmax), vmin);
+            vst1q_s16(&_v[b*_z+i], x);
+        }
+    }
+
+    // remaining rows
+    fec_ldpc_update16_rows(_v, _msg, _d, _z, i);
+    return LIQUID_OK;
+}
+
+// update layer with 8-bit ratios, sixteen rows at a time
+int fec_ldpc_update8_neon(int8_t *     _v,
+                          int8_t *     _msg,
+                          unsigned int _d,
+                          unsigned int _z)
+{
+    int8x16_t vmax = vdupq_n_s8( FEC_LDPC_LLR8_MAX);
+    int8x16_t vmin = vdupq_n_s8(-FEC_LDPC_LLR8_MAX);
+    uint8x16_t v3  = vdupq_n_u8(3);
+    unsigned int i, b;
+    for (i=0; i+16<=_z; i+=16) {
+        // variable-to-check messages, two smallest magnitudes, and sign
+        int8x16_t min1 = vmax;
+        int8x16_t min2 = vmax;
+        int8x16_t imin = vdupq_n_s8(0);
+        int8x16_t sign = vdupq_n_s8(0);
+        for (b=0; b<_d; b++) {
+            int8x16_t x = vqsubq_s8(vld1q_s8(&_v[b*_z+i]), vld1q_s8(&_msg[b*_z+i]));
+            x = vmaxq_s8(x, vmin);
+            vst1q_s8(&_v[b*_z+i], x);
+
+            int8x16_t  a  = vabsq_s8(x);
+            uint8x16_t lt = vcltq_s8(a, min1);
+            min2 = vbslq_s8(lt, min1, vminq_s8(min2, a));
+            min1 = vminq_s8(min1, a);
+            imin = vbslq_s8(lt, vdupq_n_s8(b), imin);
+            sign = veorq_s8(sign, x);
+        }
+
+        // normalize magnitudes by 3/4 without overflow: a - ceil(a/4)
+        min1 = vsubq_s8(min1, vreinterpretq_s8_u8(vshrq_n_u8(vaddq_u8(vreinterpretq_u8_s8(min1), v3), 2)));
+        min2 = vsubq_s8(min2, vreinterpretq_s8_u8(vshrq_n_u8(vaddq_u8(vreinterpretq_u8_s8(min2), v3), 2)));
+
+        // check-to-variable messages and posteriors
+        for (b=0; b<_d; b++) {
+            int8x16_t x = vld1q_s8(&_v[b*_z+i]);
+            int8x16_t a = vbslq_s8(vceqq_s8(imin, vdupq_n_s8(b)), min2, min1);
+            int8x16_t s = vshrq_n_s8(veorq_s8(sign, x), 7);
+            int8x16_t r = vsubq_s8(veorq_s8(a, s), s);
+            vst1q_s8(&_msg[b*_z+i], r);
+            x = vmaxq_s8(vqaddq_s8(x, r), vmin);
+            vst1q_s8(&_v[b*_z+i], x);
+        }
+    }
+
+    // remaining rows
+    fec_ldpc_update8_rows(_v, _msg, _d, _z, i);
+    return LIQUID_OK;
+}
+
+// build guard
+#else
+
+// invalidated
+int fec_ldpc_update16_neon(int16_t *    _v,
+                           int16_t *    _msg,
+                           unsigned int _d,
+                           unsigned int _z)
+{
+    return liquid_error(LIQUID_EICONFIG,"neon extensions not available");
+}
+
+int fec_ldpc_update8_neon(int8_t *     _v,
+                          int8_t *     _msg,
+                          unsigned int _d,
+                          unsigned int _z)
+{
+    return liquid_error(LIQUID_EICONFIG,"neon extensions not available");
+}
+
+// build guard
+#endif
+
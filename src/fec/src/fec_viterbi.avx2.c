@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+//
+// Viterbi decoder add-compare-select (AVX2)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_AVX2
+
+// include proper SIMD extensions for x86 AVX2
+#include <immintrin.h>
+
+// run add-compare-select, sixteen butterflies at a time
+int __attribute__((target("avx2")))
+fec_viterbi_update_blk_avx2(fec_viterbi     _q,
+                            unsigned char * _sym,
+                            unsigned int    _n)
+{
+    unsigned int h = _q->S / 2;
+    unsigned int k, i, r;
+    __m256i vsym[8];
+    __m256i vM = _mm256_set1_epi16(_q->M);
+    for (k=0; k<_n; k++) {
+        unsigned char * sym = _sym + k*_q->R;
+        unsigned char * d0  = _q->decisions + _q->t*(_q->S/8);
+        unsigned char * d1  = d0 + h/8;
+
+        // broadcast received symbols
+        for (r=0; r<_q->R; r++)
+            vsym[r] = _mm256_set1_epi16(sym[r]);
+
+        __m256i vnorm = _mm256_set1_epi16(_q->norm);
+        __m256i vmin  = _mm256_set1_epi16(0x7fff);
+        for (i=0; i<h; i+=16) {
+            // branch metric
+            __m256i m = _mm256_xor_si256(_mm256_load_si256((__m256i*)&_q->tab[i]), vsym[0]);
+            for (r=1; r<_q->R; r++)
+                m = _mm256_add_epi16(m, _mm256_xor_si256(_mm256_load_si256((__m256i*)&_q->tab[r*h+i]), vsym[r]));
+            __m256i mc = _mm256_sub_epi16(vM, m);
+
+            // add
+            __m256i a  = _mm256_sub_epi16(_mm256_load_si256((__m256i*)&_q->metric[i  ]), vnorm);
+            __m256i b  = _mm256_sub_epi16(_mm256_load_si256((__m256i*)&_q->metric[i+h]), vnorm);
+            __m256i e0 = _mm256_add_epi16(a, m);
+            __m256i e1 = _mm256_add_epi16(b, mc);
+            __m256i o0 = _mm256_add_epi16(a, mc);
+            __m256i o1 = _mm256_add_epi16(b, m);
+
+            // compare, select
+            __m256i c0 = _mm256_cmpgt_epi16(e0, e1);
+            __m256i c1 = _mm256_cmpgt_epi16(o0, o1);
+            __m256i s0 = _mm256_min_epi16(e0, e1);
+            __m256i s1 = _mm256_min_epi16(o0, o1);
+
+            // interleave survivors into new states 2i, 2i+1 (unpack works
+            // within 128-bit lanes, so recombine the lanes in order)
+            __m256i ul = _mm256_unpacklo_epi16(s0, s1);
+            __m256i uh = _mm256_unpackhi_epi16(s0, s1);
+            _mm256_store_si256((__m256i*)&_q->buf[2*i   ], _mm256_permute2x128_si256(ul, uh, 0x20));
+            _mm256_store_si256((__m256i*)&_q->buf[2*i+16], _mm256_permute2x128_si256(ul, uh, 0x31));
+
+            // pack decisions: low 16 bits for even states, high for odd
+            __m256i p = _mm256_permute4x64_epi64(_mm256_packs_epi16(c0, c1), _MM_SHUFFLE(3,1,2,0));
+            uint32_t mask = (uint32_t)_mm256_movemask_epi8(p);
+            uint16_t m0 = (uint16_t)(mask      );
+            uint16_t m1 = (uint16_t)(mask >> 16);
+            memmove(&d0[i>>3], &m0, sizeof(uint16_t));
+            memmove(&d1[i>>3], &m1, sizeof(uint16_t));
+
+            vmin = _mm256_min_epi16(vmin, _mm256_min_epi16(s0, s1));
+        }
+
+        // horizontal minimum for renormalization
+        __m128i v = _mm_min_epi16(_mm256_castsi256_si128(vmin), _mm256_extracti128_si256(vmin, 1));
+        v = _mm_minpos_epu16(v);
+
+        // swap metric buffers
+        uint16_t * tmp = _q->metric;
+        _q->metric = _q->buf;
+        _q->buf    = tmp;
+        _q->norm   = (uint16_t)_mm_extract_epi16(v, 0);
+        _q->t++;
+    }
+    return LIQUID_OK;
+}
+
+// build guard
+#else
+
+// invalidated
+int fec_viterbi_update_blk_avx2(fec_viterbi     _q,
+                                unsigned char * _sym,
+                                unsigned int    _n)
+{
+    return liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+}
+
+// build guard
+#endif
+
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+//
+// Viterbi decoder add-compare-select (AVX-512)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_AVX512
+
+// include proper SIMD extensions for x86 AVX-512
+#include <immintrin.h>
+
+// run add-compare-select, thirty-two butterflies at a time
+int __attribute__((target("avx512f,avx512bw")))
+fec_viterbi_update_blk_avx512(fec_viterbi     _q,
+                              unsigned char * _sym,
+                              unsigned int    _n)
+{
+    unsigned int h = _q->S / 2;
+    unsigned int k, i, r;
+    __m512i vsym[8];
+    __m512i vM = _mm512_set1_epi16(_q->M);
+
+    // permutations interleaving survivors into new states 2i, 2i+1
+    uint16_t idx[64];
+    for (i=0; i<16; i++) {
+        idx[     2*i  ] =      i;
+        idx[     2*i+1] = 32 + i;
+        idx[32 + 2*i  ] = 16 + i;
+        idx[32 + 2*i+1] = 48 + i;
+    }
+    __m512i vlo = _mm512_loadu_si512((void*)&idx[ 0]);
+    __m512i vhi = _mm512_loadu_si512((void*)&idx[32]);
+
+    for (k=0; k<_n; k++) {
+        unsigned char * sym = _sym + k*_q->R;
+        unsigned char * d0  = _q->decisions + _q->t*(_q->S/8);
+        unsigned char * d1  = d0 + h/8;
+
+        // broadcast received symbols
+        for (r=0; r<_q->R; r++)
+            vsym[r] = _mm512_set1_epi16(sym[r]);
+
+        __m512i vnorm = _mm512_set1_epi16(_q->norm);
+        __m512i vmin  = _mm512_set1_epi16(0x7fff);
+        for (i=0; i<h; i+=32) {
+            // branch metric
+            __m512i m = _mm512_xor_si512(_mm512_load_si512((void*)&_q->tab[i]), vsym[0]);
+            for (r=1; r<_q->R; r++)
+                m = _mm512_add_epi16(m, _mm512_xor_si512(_mm512_load_si512((void*)&_q->tab[r*h+i]), vsym[r]));
+            __m512i mc = _mm512_sub_epi16(vM, m);
+
+            // add
+            __m512i a  = _mm512_sub_epi16(_mm512_load_si512((void*)&_q->metric[i  ]), vnorm);
+            __m512i b  = _mm512_sub_epi16(_mm512_load_si512((void*)&_q->metric[i+h]), vnorm);
+            __m512i e0 = _mm512_add_epi16(a, m);
+            __m512i e1 = _mm512_add_epi16(b, mc);
+            __m512i o0 = _mm512_add_epi16(a, mc);
+            __m512i o1 = _mm512_add_epi16(b, m);
+
+            // compare, select
+            __mmask32 c0 = _mm512_cmplt_epi16_mask(e1, e0);
+            __mmask32 c1 = _mm512_cmplt_epi16_mask(o1, o0);
+            __m512i   s0 = _mm512_min_epi16(e0, e1);
+            __m512i   s1 = _mm512_min_epi16(o0, o1);
+
+            // interleave survivors into new states 2i, 2i+1
+            _mm512_store_si512((void*)&_q->buf[2*i   ], _mm512_permutex2var_epi16(s0, vlo, s1));
+            _mm512_store_si512((void*)&_q->buf[2*i+32], _mm512_permutex2var_epi16(s0, vhi, s1));
+
+            // decisions map directly from comparison masks
+            uint32_t m0 = (uint32_t)c0;
+            uint32_t m1 = (uint32_t)c1;
+            memmove(&d0[i>>3], &m0, sizeof(uint32_t));
+            memmove(&d1[i>>3], &m1, sizeof(uint32_t));
+
+            vmin = _mm512_min_epi16(vmin, _mm512_min_epi16(s0, s1));
+        }
+
+        // horizontal minimum for renormalization
+        __m256i v256 = _mm256_min_epi16(_mm512_castsi512_si256(vmin), _mm512_extracti64x4_epi64(vmin, 1));
+        __m128i v    = _mm_min_epi16(_mm256_castsi256_si128(v256), _mm256_extracti128_si256(v256, 1));
+        v = _mm_minpos_epu16(v);
+
+        // swap metric buffers
+        uint16_t * tmp = _q->metric;
+        _q->metric = _q->buf;
+        _q->buf    = tmp;
+        _q->norm   = (uint16_t)_mm_extract_epi16(v, 0);
+        _q->t++;
+    }
+    return LIQUID_OK;
+}
+
+// build guard
+#else
+
+// invalidated
+int fec_viterbi_update_blk_avx512(fec_viterbi     _q,
+                                  unsigned char * _sym,
+                                  unsigned int    _n)
+{
+    return liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+}
+
+// build guard
+#endif
+
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Viterbi decoder for convolutional codes
+//
+// The trellis is evaluated as a set of butterflies: old states i and
+// i+S/2 feed new states 2i and 2i+1 where S=2^(K-1). Because every
+// generator polynomial has its first and last taps set, each butterfly
+// needs only a single branch metric m and its complement M-m. Path
+// metrics are 16-bit and renormalized every step, which bounds them by
+// (K+1)*M (plus the initial offset) and keeps them within signed range
+// for the lane-parallel kernels.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// initial metric for states which are not the starting state
+#define FEC_VITERBI_METRIC_INIT (4096)
+
+// add-compare-select kernels
+int fec_viterbi_update_blk_port  (fec_viterbi _q, unsigned char * _sym, unsigned int _n);
+int fec_viterbi_update_blk_neon  (fec_viterbi _q, unsigned char * _sym, unsigned int _n);
+int fec_viterbi_update_blk_sse2  (fec_viterbi _q, unsigned char * _sym, unsigned int _n);
+int fec_viterbi_update_blk_avx2  (fec_viterbi _q, unsigned char * _sym, unsigned int _n);
+int fec_viterbi_update_blk_avx512(fec_viterbi _q, unsigned char * _sym, unsigned int _n);
+
+// select runtime execution method
+int fec_viterbi_runtime_detect(fec_viterbi _q);
+
+struct fec_viterbi_s {
+    unsigned int K;             // constraint length
+    unsigned int R;             // inverse rate (number of polynomials)
+    unsigned int S;             // number of states, 2^(K-1)
+    unsigned int n;             // maximum number of trellis steps
+    unsigned int t;             // current trellis step
+    uint16_t     M;             // maximum branch metric, 255*R
+
+    uint16_t *   tab;           // branch table [R x S/2], values {0,255}
+    uint16_t *   metric;        // path metrics, old [S x 1]
+    uint16_t *   buf;           // path metrics, new [S x 1]
+    uint16_t     norm;          // minimum of old path metrics
+
+    // decisions [n x S/8], each row holds S/2 bits for even states
+    // followed by S/2 bits for odd states
+    unsigned char * decisions;
+
+    // runtime execution method
+    int (*update_blk)(fec_viterbi, unsigned char *, unsigned int);
+};
+
+// create Viterbi decoder
+fec_viterbi fec_viterbi_create(unsigned int _K,
+                               unsigned int _R,
+                               int *        _poly,
+                               unsigned int _n)
+{
+    // validate input
+    if (_K < 7 || _K > 16)
+        return liquid_error_config("fec_viterbi_create(), constraint length must be in [7,16]");
+    if (_R < 1 || _R > 8)
+        return liquid_error_config("fec_viterbi_create(), inverse rate must be in [1,8]");
+    if ((_K+1)*255*_R + FEC_VITERBI_METRIC_INIT > 32767)
+        return liquid_error_config("fec_viterbi_create(), path metrics would overflow for K=%u, R=%u", _K, _R);
+
+    unsigned int r;
+    for (r=0; r<_R; r++) {
+        if ( (_poly[r] & 1) == 0 || ((_poly[r] >> (_K-1)) & 1) == 0 )
+            return liquid_error_config("fec_viterbi_create(), polynomial 0x%x must have first and last taps set", _poly[r]);
+    }
+
+    // create object and initialize values
+    fec_viterbi q = (fec_viterbi) malloc(sizeof(struct fec_viterbi_s));
+    q->K = _K;
+    q->R = _R;
+    q->S = 1 << (_K-1);
+    q->n = _n + _K - 1;
+    q->M = 255*_R;
+
+    // generate branch table: expected output for register value 2i
+    unsigned int h = q->S / 2;
+    unsigned int i;
+    q->tab = (uint16_t*) liquid_aligned_alloc(64, _R*h*sizeof(uint16_t));
+    for (r=0; r<_R; r++) {
+        for (i=0; i<h; i++)
+            q->tab[r*h + i] = liquid_count_ones_mod2((2*i) & _poly[r]) ? 255 : 0;
+    }
+
+    // allocate memory for path metrics and decisions
+    q->metric    = (uint16_t*) liquid_aligned_alloc(64, q->S*sizeof(uint16_t));
+    q->buf       = (uint16_t*) liquid_aligned_alloc(64, q->S*sizeof(uint16_t));
+    q->decisions = (unsigned char*) malloc(q->n*(q->S/8)*sizeof(unsigned char));
+
+    // detect runtime method and reset
+    fec_viterbi_runtime_detect(q);
+    fec_viterbi_reset(q, 0);
+    return q;
+}
+
+// destroy Viterbi decoder
+int fec_viterbi_destroy(fec_viterbi _q)
+{
+    liquid_aligned_free(_q->tab);
+    liquid_aligned_free(_q->metric);
+    liquid_aligned_free(_q->buf);
+    free(_q->decisions);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// reset decoder state
+int fec_viterbi_reset(fec_viterbi _q, unsigned int _state)
+{
+    unsigned int i;
+    for (i=0; i<_q->S; i++)
+        _q->metric[i] = FEC_VITERBI_METRIC_INIT;
+    _q->metric[_state & (_q->S-1)] = 0;
+    _q->norm = 0;
+    _q->t    = 0;
+    return LIQUID_OK;
+}
+
+// run add-compare-select over a block of soft symbols
+int fec_viterbi_update_blk(fec_viterbi     _q,
+                           unsigned char * _sym,
+                           unsigned int    _n)
+{
+    if (_q->t + _n > _q->n) {
+        return liquid_error(LIQUID_EIRANGE,"fec_viterbi_update_blk(), %u steps exceeds capacity (%u)",
+                _q->t + _n, _q->n);
+    }
+
+    // invoke runtime-specific method
+    return _q->update_blk(_q, _sym, _n);
+}
+
+// trace back decisions and write decoded bits (msb first)
+int fec_viterbi_chainback(fec_viterbi     _q,
+                          unsigned char * _data,
+                          unsigned int    _nbits,
+                          unsigned int    _endstate)
+{
+    if (_nbits + _q->K - 1 > _q->t) {
+        return liquid_error(LIQUID_EIRANGE,"fec_viterbi_chainback(), %u bits requested but only %u steps decoded",
+                _nbits, _q->t);
+    }
+
+    memset(_data, 0x00, (_nbits+7)/8);
+
+    unsigned int h     = _q->S / 2;     // number of butterflies
+    unsigned int row   = _q->S / 8;     // bytes per decision row
+    unsigned int state = _endstate & (_q->S-1);
+    unsigned int t     = _nbits + _q->K - 1;
+    while (t > 0) {
+        t--;
+        // decision bit for this state: even states in first half of row
+        unsigned int i = state >> 1;
+        unsigned char * d = _q->decisions + t*row + (state & 1)*(h/8);
+        unsigned int bit = (d[i>>3] >> (i&7)) & 1;
+
+        // input bit is the least significant bit of the state
+        if (t < _nbits)
+            _data[t>>3] |= (state & 1) << (7 - (t&7));
+
+        // step back to previous state
+        state = i | (bit << (_q->K-2));
+    }
+    return LIQUID_OK;
+}
+
+// select runtime execution method
+int fec_viterbi_runtime_select(fec_viterbi      _q,
+                               liquid_runtime_t _select)
+{
+    switch (_select) {
+    case LIQUID_RUNTIME_PORT:
+        liquid_log_trace("fec_viterbi_runtime_select(), port");
+        _q->update_blk = &fec_viterbi_update_blk_port;
+        return LIQUID_OK;
+    case LIQUID_RUNTIME_NEON:
+        liquid_log_trace("fec_viterbi_runtime_select(), neon");
+        _q->update_blk = &fec_viterbi_update_blk_neon;
+        return LIQUID_OK;
+    case LIQUID_RUNTIME_SSE2:
+        liquid_log_trace("fec_viterbi_runtime_select(), sse2");
+        _q->update_blk = &fec_viterbi_update_blk_sse2;
+        return LIQUID_OK;
+    case LIQUID_RUNTIME_AVX2:
+        liquid_log_trace("fec_viterbi_runtime_select(), avx2");
+        _q->update_blk = &fec_viterbi_update_blk_avx2;
+        return LIQUID_OK;
+    case LIQUID_RUNTIME_AVX512:
+        liquid_log_trace("fec_viterbi_runtime_select(), avx512");
+        _q->update_blk = &fec_viterbi_update_blk_avx512;
+        return LIQUID_OK;
+    default:;
+    }
+
+    _q->update_blk = &fec_viterbi_update_blk_port;
+    return liquid_error(LIQUID_EINT,
+        "fec_viterbi_runtime_select(), invalid selection or mode not available (%d), falling back to portable version",
+        _select);
+}
+
+// portable add-compare-select
+int fec_viterbi_update_blk_port(fec_viterbi     _q,
+                                unsigned char * _sym,
+                                unsigned int    _n)
+{
+    unsigned int h = _q->S / 2;
+    unsigned int k, i, r;
+    for (k=0; k<_n; k++) {
+        unsigned char * sym = _sym + k*_q->R;
+        unsigned char * d0  = _q->decisions + _q->t*(_q->S/8);
+        unsigned char * d1  = d0 + h/8;
+        memset(d0, 0x00, _q->S/8);
+
+        uint16_t vmin = 0xffff;
+        for (i=0; i<h; i++) {
+            // branch metric
+            uint16_t m = 0;
+            for (r=0; r<_q->R; r++)
+                m += _q->tab[r*h+i] ^ sym[r];
+            uint16_t mc = _q->M - m;
+
+            // add
+            int16_t a  = (int16_t)(_q->metric[i  ] - _q->norm);
+            int16_t b  = (int16_t)(_q->metric[i+h] - _q->norm);
+            int16_t e0 = a + m;
+            int16_t e1 = b + mc;
+            int16_t o0 = a + mc;
+            int16_t o1 = b + m;
+
+            // compare, select
+            unsigned int c0 = e1 < e0;
+            unsigned int c1 = o1 < o0;
+            _q->buf[2*i  ] = c0 ? e1 : e0;
+            _q->buf[2*i+1] = c1 ? o1 : o0;
+            d0[i>>3] |= c0 << (i&7);
+            d1[i>>3] |= c1 << (i&7);
+
+            vmin = _q->buf[2*i  ] < vmin ? _q->buf[2*i  ] : vmin;
+            vmin = _q->buf[2*i+1] < vmin ? _q->buf[2*i+1] : vmin;
+        }
+
+        // swap metric buffers
+        uint16_t * tmp = _q->metric;
+        _q->metric = _q->buf;
+        _q->buf    = tmp;
+        _q->norm   = vmin;
+        _q->t++;
+    }
+    return LIQUID_OK;
+}
+
+// detect runtime execution method
+int fec_viterbi_runtime_detect(fec_viterbi _q)
+{
+    // implementations
+    struct liquid_cpuinfo_s impl =
+    {
+        .altivec = 0,
+        .neon    = true,
+        .mmx     = 0,
+        .sse     = 0,
+        .sse2    = true,
+        .sse3    = 0,
+        .ssse3   = 0,
+        .sse41   = 0,
+        .sse42   = 0,
+        .avx     = 0,
+        .fma3    = 0,
+        .avx2    = true,
+        .avx512  = true,
+        .amx     = 0,
+        .amx101  = 0,
+        .amx102  = 0,
+    };
+
+    // given implementations, find best method
+    liquid_runtime_t selection = liquid_runtime_detect(&impl);
+
+    // invoke selection method
+    return fec_viterbi_runtime_select(_q, selection);
+}
+
+//
+// libfec-compatible interface
+//
+
+void * fec_viterbi27_create(int _n)
+{
+    return fec_viterbi_create(7, 2, fec_conv27_poly, _n);
+}
+
+void * fec_viterbi29_create(int _n)
+{
+    return fec_viterbi_create(9, 2, fec_conv29_poly, _n);
+}
+
+void * fec_viterbi39_create(int _n)
+{
+    return fec_viterbi_create(9, 3, fec_conv39_poly, _n);
+}
+
+void * fec_viterbi615_create(int _n)
+{
+    return fec_viterbi_create(15, 6, fec_conv615_poly, _n);
+}
+
+int fec_viterbi_init(void * _vp, int _state)
+{
+    return fec_viterbi_reset((fec_viterbi)_vp, _state);
+}
+
+int fec_viterbi_update(void * _vp, unsigned char * _sym, int _n)
+{
+    return fec_viterbi_update_blk((fec_viterbi)_vp, _sym, _n);
+}
+
+int fec_viterbi_traceback(void * _vp, unsigned char * _data, unsigned int _nbits, unsigned int _endstate)
+{
+    return fec_viterbi_chainback((fec_viterbi)_vp, _data, _nbits, _endstate);
+}
+
+void fec_viterbi_delete(void * _vp)
+{
+    fec_viterbi_destroy((fec_viterbi)_vp);
+}
+
+// runtime-specific kernels
+#include "fec_viterbi.neon.c"
+#include "fec_viterbi.sse2.c"
+#include "fec_viterbi.avx2.c"
+#include "fec_viterbi.avx512.c"
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+//
+// Viterbi decoder add-compare-select (ARM Neon)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_NEON
+
+// include proper SIMD extensions for ARM Neon
+#include <arm_neon.h>
+
+// run add-compare-select, eight butterflies at a time
+int fec_viterbi_update_blk_neon(fec_viterbi     _q,
+                                unsigned char * _sym,
+                                unsigned int    _n)
+{
+    unsigned int h = _q->S / 2;
+    unsigned int k, i, r;
+    uint16x8_t vsym[8];
+    uint16x8_t vM = vdupq_n_u16(_q->M);
+
+    // bit weights for packing decisions
+    const uint8_t w[8] = {1,2,4,8,16,32,64,128};
+    uint8x8_t vw = vld1_u8(w);
+
+    for (k=0; k<_n; k++) {
+        unsigned char * sym = _sym + k*_q->R;
+        unsigned char * d0  = _q->decisions + _q->t*(_q->S/8);
+        unsigned char * d1  = d0 + h/8;
+
+        // broadcast received symbols
+        for (r=0; r<_q->R; r++)
+            vsym[r] = vdupq_n_u16(sym[r]);
+
+        uint16x8_t vnorm = vdupq_n_u16(_q->norm);
+        int16x8_t  vmin  = vdupq_n_s16(0x7fff);
+        for (i=0; i<h; i+=8) {
+            // branch metric
+            uint16x8_t m = veorq_u16(vld1q_u16(&_q->tab[i]), vsym[0]);
+            for (r=1; r<_q->R; r++)
+                m = vaddq_u16(m, veorq_u16(vld1q_u16(&_q->tab[r*h+i]), vsym[r]));
+            uint16x8_t mc = vsubq_u16(vM, m);
+
+            // add
+            uint16x8_t a  = vsubq_u16(vld1q_u16(&_q->metric[i  ]), vnorm);
+            uint16x8_t b  = vsubq_u16(vld1q_u16(&_q->metric[i+h]), vnorm);
+            int16x8_t  e0 = vreinterpretq_s16_u16(vaddq_u16(a, m));
+            int16x8_t  e1 = vreinterpretq_s16_u16(vaddq_u16(b, mc));
+            int16x8_t  o0 = vreinterpretq_s16_u16(vaddq_u16(a, mc));
+            int16x8_t  o1 = vreinterpretq_s16_u16(vaddq_u16(b, m));
+
+            // compare, select
+            uint16x8_t c0 = vcltq_s16(e1, e0);
+            uint16x8_t c1 = vcltq_s16(o1, o0);
+            int16x8x2_t s;
+            s.val[0] = vminq_s16(e0, e1);
+            s.val[1] = vminq_s16(o0, o1);
+
+            // interleave survivors into new states 2i, 2i+1
+            vst2q_s16((int16_t*)&_q->buf[2*i], s);
+
+            // pack decisions into bytes using pairwise additions
+            uint8x8_t p = vpadd_u8(vand_u8(vmovn_u16(c0), vw),
+                                   vand_u8(vmovn_u16(c1), vw));
+            p = vpadd_u8(p, p);
+            p = vpadd_u8(p, p);
+            d0[i>>3] = vget_lane_u8(p, 0);
+            d1[i>>3] = vget_lane_u8(p, 1);
+
+            vmin = vminq_s16(vmin, vminq_s16(s.val[0], s.val[1]));
+        }
+
+        // horizontal minimum for renormalization
+        int16x4_t v = vmin_s16(vget_low_s16(vmin), vget_high_s16(vmin));
+        v = vpmin_s16(v, v);
+        v = vpmin_s16(v, v);
+
+        // swap metric buffers
+        uint16_t * tmp = _q->metric;
+        _q->metric = _q->buf;
+        _q->buf    = tmp;
+        _q->norm   = (uint16_t)vget_lane_s16(v, 0);
+        _q->t++;
+    }
+    return LIQUID_OK;
+}
+
+// build guard
+#else
+
+// invalidated
+int fec_viterbi_update_blk_neon(fec_viterbi     _q,
+                                unsigned char * _sym,
+                                unsigned int    _n)
+{
+    return liquid_error(LIQUID_EICONFIG,"neon extensions not available");
+}
+
+// build guard
+#endif
+
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+//
+// Viterbi decoder add-compare-select (SSE2)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_SSE2
+
+// include proper SIMD extensions for x86 SSE2
+#include <immintrin.h>
+
+// run add-compare-select, eight butterflies at a time
+int __attribute__((target("sse2")))
+fec_viterbi_update_blk_sse2(fec_viterbi     _q,
+                            unsigned char * _sym,
+                            unsigned int    _n)
+{
+    unsigned int h = _q->S / 2;
+    unsigned int k, i, r;
+    __m128i vsym[8];
+    __m128i vM = _mm_set1_epi16(_q->M);
+    for (k=0; k<_n; k++) {
+        unsigned char * sym = _sym + k*_q->R;
+        unsigned char * d0  = _q->decisions + _q->t*(_q->S/8);
+        unsigned char * d1  = d0 + h/8;
+
+        // broadcast received symbols
+        for (r=0; r<_q->R; r++)
+            vsym[r] = _mm_set1_epi16(sym[r]);
+
+        __m128i vnorm = _mm_set1_epi16(_q->norm);
+        __m128i vmin  = _mm_set1_epi16(0x7fff);
+        for (i=0; i<h; i+=8) {
+            // branch metric
+            __m128i m = _mm_xor_si128(_mm_load_si128((__m128i*)&_q->tab[i]), vsym[0]);
+            for (r=1; r<_q->R; r++)
+                m = _mm_add_epi16(m, _mm_xor_si128(_mm_load_si128((__m128i*)&_q->tab[r*h+i]), vsym[r]));
+            __m128i mc = _mm_sub_epi16(vM, m);
+
+            // add
+            __m128i a  = _mm_sub_epi16(_mm_load_si128((__m128i*)&_q->metric[i  ]), vnorm);
+            __m128i b  = _mm_sub_epi16(_mm_load_si128((__m128i*)&_q->metric[i+h]), vnorm);
+            __m128i e0 = _mm_add_epi16(a, m);
+            __m128i e1 = _mm_add_epi16(b, mc);
+            __m128i o0 = _mm_add_epi16(a, mc);
+            __m128i o1 = _mm_add_epi16(b, m);
+
+            // compare, select
+            __m128i c0 = _mm_cmplt_epi16(e1, e0);
+            __m128i c1 = _mm_cmplt_epi16(o1, o0);
+            __m128i s0 = _mm_min_epi16(e0, e1);
+            __m128i s1 = _mm_min_epi16(o0, o1);
+
+            // interleave survivors into new states 2i, 2i+1
+            _mm_store_si128((__m128i*)&_q->buf[2*i  ], _mm_unpacklo_epi16(s0, s1));
+            _mm_store_si128((__m128i*)&_q->buf[2*i+8], _mm_unpackhi_epi16(s0, s1));
+
+            // pack decisions: low byte for even states, high byte for odd
+            int mask = _mm_movemask_epi8(_mm_packs_epi16(c0, c1));
+            d0[i>>3] = (unsigned char)( mask       & 0xff);
+            d1[i>>3] = (unsigned char)((mask >> 8) & 0xff);
+
+            vmin = _mm_min_epi16(vmin, _mm_min_epi16(s0, s1));
+        }
+
+        // horizontal minimum for renormalization
+        vmin = _mm_min_epi16(vmin, _mm_shuffle_epi32(vmin, 0x4e));
+        vmin = _mm_min_epi16(vmin, _mm_shuffle_epi32(vmin, 0xb1));
+        vmin = _mm_min_epi16(vmin, _mm_shufflelo_epi16(vmin, 0xb1));
+
+        // swap metric buffers
+        uint16_t * tmp = _q->metric;
+        _q->metric = _q->buf;
+        _q->buf    = tmp;
+        _q->norm   = (uint16_t)_mm_extract_epi16(vmin, 0);
+        _q->t++;
+    }
+    return LIQUID_OK;
+}
+
+// build guard
+#else
+
+// invalidated
+int fec_viterbi_update_blk_sse2(fec_viterbi     _q,
+                                unsigned char * _sym,
+                                unsigned int    _n)
+{
+    return liquid_error(LIQUID_EICONFIG,"sse2 extensions not available");
+}
+
+// build guard
+#endif
+
@@ -37,31 +37,30 @@
 // internal methods
 //
 
-// permute one iteration
-int interleaver_permute(unsigned char * _x,
-                        unsigned int    _n,
-                        unsigned int    _M,
-                        unsigned int    _N);
-
-// permute one iteration (soft bit input)
-int interleaver_permute_soft(unsigned char * _x,
-                             unsigned int    _n,
-                             unsigned int    _M,
-                             unsigned int    _N);
-
-// permute one iteration with mask
-int interleaver_permute_mask(unsigned char * _x,
-                             unsigned int    _n,
-                             unsigned int    _M,
-                             unsigned int    _N,
-                             unsigned char   _mask);
-
-// permute one iteration (soft bit input) with mask
-int interleaver_permute_mask_soft(unsigned char * _x,
-                                  unsigned int    _n,
-                                  unsigned int    _M,
-                                  unsigned int    _N,
-                                  unsigned char   _mask);
+// compute permutation plans for the current depth
+int interleaver_plan(interleaver _q);
+
+// permute one iteration of index plan, swapping the bits selected by the
+// mask between pairs of bytes
+int interleaver_plan_permute(unsigned int * _p,
+                             unsigned int   _n,
+                             unsigned int   _M,
+                             unsigned int   _N,
+                             unsigned char  _mask);
+
+// apply permutation plan to packed bytes: bit k of output byte b is taken
+// from bit k of input byte _p[8*b+k]/8
+int interleaver_gather(unsigned int *  _p,
+                       unsigned int    _n,
+                       unsigned char * _x,
+                       unsigned char * _y);
+
+// apply permutation plan to soft bits: soft bit t of the output is taken
+// from soft bit _p[t] of the input
+int interleaver_gather_soft(unsigned int *  _p,
+                            unsigned int    _n,
+                            unsigned char * _x,
+                            unsigned char * _y);
 
 // structured interleaver object
 struct interleaver_s {
@@ -72,6 +71,13 @@ struct interleaver_s {
 
     // interleaving depth (number of permutations)
     unsigned int depth;
+
+    // permutation plans over all 8*n bits; the masked iterations only
+    // swap bits in the same position within a byte, so the same plan
+    // applies to both packed bytes and soft bits
+    unsigned int *  p_enc;  // encoder plan, [size: 8*n x 1]
+    unsigned int *  p_dec;  // decoder plan (inverse), [size: 8*n x 1]
+    unsigned char * buf;    // copy of input for in-place operation, [size: 8*n x 1]
 };
 
 // create interleaver of length _n input/output bytes
@@ -89,6 +95,11 @@ interleaver interleaver_create(unsigned int _n)
     q->N = q->n / q->M;
     while (q->n >= (q->M*q->N)) q->N++;  // ensures M*N >= n
 
+    // allocate memory for plans and compute
+    q->p_enc = (unsigned int*)  malloc(8*q->n*sizeof(unsigned int));
+    q->p_dec = (unsigned int*)  malloc(8*q->n*sizeof(unsigned int));
+    q->buf   = (unsigned char*) malloc(8*q->n*sizeof(unsigned char));
+    interleaver_plan(q);
     return q;
 }
 
@@ -99,12 +110,19 @@ interleaver interleaver_copy(interleaver q_orig)
     if (q_orig == NULL)
         return liquid_error_config("interleaver_copy(), object cannot be NULL");
 
-    return interleaver_create(q_orig->n);
+    interleaver q_copy = interleaver_create(q_orig->n);
+    interleaver_set_depth(q_copy, q_orig->depth);
+    return q_copy;
 }
 
 // destroy interleaver object
 int interleaver_destroy(interleaver _q)
 {
+    // free internal plans
+    free(_q->p_enc);
+    free(_q->p_dec);
+    free(_q->buf);
+
     // free main object memory
     free(_q);
     return LIQUID_OK;
@@ -125,7 +143,7 @@ int interleaver_set_depth(interleaver  _q,
                           unsigned int _depth)
 {
     _q->depth = _depth;
-    return LIQUID_OK;
+    return interleaver_plan(_q);
 }
 
 // execute forward interleaver (encoder)
@@ -136,15 +154,12 @@ int interleaver_encode(interleaver     _q,
                        unsigned char * _msg_dec,
                        unsigned char * _msg_enc)
 {
-    // copy data to output
-    memmove(_msg_enc, _msg_dec, _q->n);
-
-    if (_q->depth > 0) interleaver_permute(_msg_enc, _q->n, _q->M, _q->N);
-    if (_q->depth > 1) interleaver_permute_mask(_msg_enc, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 2) interleaver_permute_mask(_msg_enc, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 3) interleaver_permute_mask(_msg_enc, _q->n, _q->M, _q->N+8, 0x33);
-
-    return LIQUID_OK;
+    // copy input if operating in place
+    if (_msg_dec == _msg_enc) {
+        memmove(_q->buf, _msg_dec, _q->n);
+        _msg_dec = _q->buf;
+    }
+    return interleaver_gather(_q->p_enc, _q->n, _msg_dec, _msg_enc);
 }
 
 // execute forward interleaver (encoder) on soft bits
@@ -155,15 +170,12 @@ int interleaver_encode_soft(interleaver     _q,
                             unsigned char * _msg_dec,
                             unsigned char * _msg_enc)
 {
-    // copy data to output
-    memmove(_msg_enc, _msg_dec, 8*_q->n);
-
-    if (_q->depth > 0) interleaver_permute_soft(_msg_enc, _q->n, _q->M, _q->N);
-    if (_q->depth > 1) interleaver_permute_mask_soft(_msg_enc, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 2) interleaver_permute_mask_soft(_msg_enc, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 3) interleaver_permute_mask_soft(_msg_enc, _q->n, _q->M, _q->N+8, 0x33);
-
-    return LIQUID_OK;
+    // copy input if operating in place
+    if (_msg_dec == _msg_enc) {
+        memmove(_q->buf, _msg_dec, 8*_q->n);
+        _msg_dec = _q->buf;
+    }
+    return interleaver_gather_soft(_q->p_enc, _q->n, _msg_dec, _msg_enc);
 }
 
 // execute reverse interleaver (decoder)
@@ -174,15 +186,12 @@ int interleaver_decode(interleaver     _q,
                        unsigned char * _msg_enc,
                        unsigned char * _msg_dec)
 {
-    // copy data to output
-    memmove(_msg_dec, _msg_enc, _q->n);
-
-    if (_q->depth > 3) interleaver_permute_mask(_msg_dec, _q->n, _q->M, _q->N+8, 0x33);
-    if (_q->depth > 2) interleaver_permute_mask(_msg_dec, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 1) interleaver_permute_mask(_msg_dec, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 0) interleaver_permute(_msg_dec, _q->n, _q->M, _q->N);
-
-    return LIQUID_OK;
+    // copy input if operating in place
+    if (_msg_enc == _msg_dec) {
+        memmove(_q->buf, _msg_enc, _q->n);
+        _msg_enc = _q->buf;
+    }
+    return interleaver_gather(_q->p_dec, _q->n, _msg_enc, _msg_dec);
 }
 
 // execute reverse interleaver (decoder) on soft bits
@@ -193,65 +202,52 @@ int interleaver_decode_soft(interleaver     _q,
                             unsigned char * _msg_enc,
                             unsigned char * _msg_dec)
 {
-    // copy data to output
-    memmove(_msg_dec, _msg_enc, 8*_q->n);
-
-    if (_q->depth > 3) interleaver_permute_mask_soft(_msg_dec, _q->n, _q->M, _q->N+8, 0x33);
-    if (_q->depth > 2) interleaver_permute_mask_soft(_msg_dec, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 1) interleaver_permute_mask_soft(_msg_dec, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 0) interleaver_permute_soft(_msg_dec, _q->n, _q->M, _q->N);
-
-    return LIQUID_OK;
+    // copy input if operating in place
+    if (_msg_enc == _msg_dec) {
+        memmove(_q->buf, _msg_enc, 8*_q->n);
+        _msg_enc = _q->buf;
+    }
+    return interleaver_gather_soft(_q->p_dec, _q->n, _msg_enc, _msg_dec);
 }
 
 // 
 // internal permutation methods
 //
 
-// permute one iteration
-int interleaver_permute(unsigned char * _x,
-                        unsigned int    _n,
-                        unsigned int    _M,
-                        unsigned int    _N)
+// compute permutation plans for the current depth by running each
+// iteration over an array of bit indices
+int interleaver_plan(interleaver _q)
 {
     unsigned int i;
-    unsigned int j;
-    unsigned int m=0;
-    unsigned int n=_n/3;
-    unsigned int n2=_n/2;
-    unsigned char tmp;
-    for (i=0; i<n2; i++) {
-        //j = m*N + n; // input
-        do {
-            j = m*_N + n; // output
-            m++;
-            if (m == _M) {
-                n = (n+1) % (_N);
-                m=0;
-            }
-        } while (j>=n2);
-
-        // swap indices
-        tmp = _x[2*j+1];
-        _x[2*j+1] = _x[2*i+0];
-        _x[2*i+0] = tmp;
-    }
-
+    unsigned int * p = _q->p_enc;
+    for (i=0; i<8*_q->n; i++)
+        p[i] = i;
+
+    if (_q->depth > 0) interleaver_plan_permute(p, _q->n, _q->M, _q->N,   0xff);
+    if (_q->depth > 1) interleaver_plan_permute(p, _q->n, _q->M, _q->N+2, 0x0f);
+    if (_q->depth > 2) interleaver_plan_permute(p, _q->n, _q->M, _q->N+4, 0x55);
+    if (_q->depth > 3) interleaver_plan_permute(p, _q->n, _q->M, _q->N+8, 0x33);
+
+    // decoder is the inverse permutation
+    for (i=0; i<8*_q->n; i++)
+        _q->p_dec[p[i]] = i;
     return LIQUID_OK;
 }
 
-// permute one iteration (soft bit input)
-int interleaver_permute_soft(unsigned char * _x,
-                             unsigned int    _n,
-                             unsigned int    _M,
-                             unsigned int    _N)
+// permute one iteration of index plan
+int interleaver_plan_permute(unsigned int * _p,
+                             unsigned int   _n,
+                             unsigned int   _M,
+                             unsigned int   _N,
+                             unsigned char  _mask)
 {
     unsigned int i;
     unsigned int j;
+    unsigned int k;
     unsigned int m=0;
     unsigned int n=_n/3;
     unsigned int n2=_n/2;
-    unsigned char tmp[8];
+    unsigned int tmp;
     for (i=0; i<n2; i++) {
         //j = m*N + n; // input
         do {
@@ -262,89 +258,49 @@ int interleaver_permute_soft(unsigned char * _x,
                 m=0;
             }
         } while (j>=n2);
-    
-        // swap soft bits at indices
-        memmove( tmp,            &_x[8*(2*j+1)], 8);
-        memmove( &_x[8*(2*j+1)], &_x[8*(2*i+0)], 8);
-        memmove( &_x[8*(2*i+0)], tmp,            8);
-    }
-    //printf("\n");
 
+        // swap bits matching the mask
+        for (k=0; k<8; k++) {
+            if ( (_mask >> (8-k-1)) & 0x01 ) {
+                tmp = _p[8*(2*j+1)+k];
+                _p[8*(2*j+1)+k] = _p[8*(2*i+0)+k];
+                _p[8*(2*i+0)+k] = tmp;
+            }
+        }
+    }
     return LIQUID_OK;
 }
 
-
-// permute one iteration with mask
-int interleaver_permute_mask(unsigned char * _x,
-                             unsigned int    _n,
-                             unsigned int    _M,
-                             unsigned int    _N,
-                             unsigned char   _mask)
+// apply permutation plan to packed bytes
+int interleaver_gather(unsigned int *  _p,
+                       unsigned int    _n,
+                       unsigned char * _x,
+                       unsigned char * _y)
 {
     unsigned int i;
-    unsigned int j;
-    unsigned int m=0;
-    unsigned int n=_n/3;
-    unsigned int n2=_n/2;
-    unsigned char tmp0;
-    unsigned char tmp1;
-    for (i=0; i<n2; i++) {
-        //j = m*N + n; // input
-        do {
-            j = m*_N + n; // output
-            m++;
-            if (m == _M) {
-                n = (n+1) % (_N);
-                m=0;
-            }
-        } while (j>=n2);
-
-        // swap indices, applying mask
-        tmp0 = (_x[2*i+0] & (~_mask)) | (_x[2*j+1] & ( _mask));
-        tmp1 = (_x[2*i+0] & ( _mask)) | (_x[2*j+1] & (~_mask));
-        _x[2*i+0] = tmp0;
-        _x[2*j+1] = tmp1;
+    for (i=0; i<_n; i++) {
+        unsigned int * p = &_p[8*i];
+        _y[i] = (_x[p[0] >> 3] & 0x80) |
+                (_x[p[1] >> 3] & 0x40) |
+                (_x[p[2] >> 3] & 0x20) |
+                (_x[p[3] >> 3] & 0x10) |
+                (_x[p[4] >> 3] & 0x08) |
+                (_x[p[5] >> 3] & 0x04) |
+                (_x[p[6] >> 3] & 0x02) |
+                (_x[p[7] >> 3] & 0x01);
     }
-
     return LIQUID_OK;
 }
 
-// permute one iteration (soft bit input)
-int interleaver_permute_mask_soft(unsigned char * _x,
-                                  unsigned int    _n,
-                                  unsigned int    _M,
-                                  unsigned int    _N,
-                                  unsigned char   _mask)
+// apply permutation plan to soft bits
+int interleaver_gather_soft(unsigned int *  _p,
+                            unsigned int    _n,
+                            unsigned char * _x,
+                            unsigned char * _y)
 {
     unsigned int i;
-    unsigned int j;
-    unsigned int k;
-    unsigned int m=0;
-    unsigned int n=_n/3;
-    unsigned int n2=_n/2;
-    unsigned char tmp;
-    for (i=0; i<n2; i++) {
-        //j = m*N + n; // input
-        do {
-            j = m*_N + n; // output
-            m++;
-            if (m == _M) {
-                n = (n+1) % (_N);
-                m=0;
-            }
-        } while (j>=n2);
-
-        // swap bits matching the mask
-        for (k=0; k<8; k++) {
-            if ( (_mask >> (8-k-1)) & 0x01 ) {
-                tmp = _x[8*(2*j+1)+k];
-                _x[8*(2*j+1)+k] = _x[8*(2*i+0)+k];
-                _x[8*(2*i+0)+k] = tmp;
-            }
-        }
-    }
-    //printf("\n");
-
+    for (i=0; i<8*_n; i++)
+        _y[i] = _x[_p[i]];
     return LIQUID_OK;
 }
 
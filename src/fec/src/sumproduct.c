@@ -58,16 +58,23 @@ int fec_sumproduct(unsigned int    _m,
     if (_n == 0 || _m == 0)
         return liquid_error(LIQUID_EICONFIG,"fec_sumproduct(), matrix dimensions cannot be zero");
 
-    // internal variables
+    // build graph of non-zero entries
+    fec_ldpc_graph G = fec_ldpc_graph_create(_H);
+    if (G == NULL)
+        return liquid_error(LIQUID_EICONFIG,"fec_sumproduct(), could not create parity-check graph");
+    if (G->m != _m || G->n != _n) {
+        fec_ldpc_graph_destroy(G);
+        return liquid_error(LIQUID_EICONFIG,"fec_sumproduct(), matrix dimensions do not match");
+    }
+
+    // internal variables: messages are only kept for each edge
     unsigned int num_iterations = 0;
-    float Lq[_m*_n];
-    float Lr[_m*_n];
-    float Lc[_n];
-    float LQ[_n];
-    unsigned char parity[_m];
+    float * Lq = (float*) malloc(G->num_edges*sizeof(float));
+    float * Lr = (float*) malloc(G->num_edges*sizeof(float));
+    float * Lc = (float*) malloc(_n*sizeof(float));
+    float * LQ = (float*) malloc(_n*sizeof(float));
     unsigned int i;
-    unsigned int j;
-    int parity_pass;
+    int parity_pass = 0;
     int continue_running = 1;
 
     // initialize Lq with log-likelihood values
@@ -75,18 +82,14 @@ int fec_sumproduct(unsigned int    _m,
         Lc[i] = _LLR[i];
         //Lc[i] = 2.0f * _y[i] / (sigma*sigma);
 
-    for (j=0; j<_m; j++) {
-        for (i=0; i<_n; i++) {
-            Lq[j*_n+i] = smatrixb_get(_H,j,i) ? Lc[i] : 0.0f;
-        }
-    }
+    for (i=0; i<G->num_edges; i++)
+        Lq[i] = Lc[G->var[i]];
 
 #if DEBUG_SUMPRODUCT
     // print Lc
     matrixf_print(Lc,1,_n);
 #endif
 
-    // TODO : run multiple iterations
     while (continue_running) {
 #if DEBUG_SUMPRODUCT
         //
@@ -95,8 +98,7 @@ int fec_sumproduct(unsigned int    _m,
 #endif
 
         // step sum-product algorithm
-        //parity_pass = fec_sumproduct_step(_H,_m,_n,_c_hat,Lq,Lr,Lc,LQ,parity);
-        parity_pass = fec_sumproduct_step(_m,_n,_H,_c_hat,Lq,Lr,Lc,LQ,parity);
+        parity_pass = fec_sumproduct_step(G,_c_hat,Lq,Lr,Lc,LQ);
 
         // update...
         num_iterations++;
@@ -104,126 +106,93 @@ int fec_sumproduct(unsigned int    _m,
             continue_running = 0;
     }
 
+    // clean up allocated memory
+    free(Lq);
+    free(Lr);
+    free(Lc);
+    free(LQ);
+    fec_ldpc_graph_destroy(G);
     return parity_pass;
 }
 
 // sum-product algorithm, returns 1 if parity checks, 0 otherwise
-//  _m      :   rows
-//  _n      :   cols
-//  _H      :   sparse binary parity check matrix [size: _m x _n]
+//  _G      :   parity-check graph
 //  _c_hat  :   estimated transmitted signal [size: _n x 1]
 //
 // internal state arrays
-//  _Lq     :   [size: _m x _n]
-//  _Lr     :   [size: _m x _n]
+//  _Lq     :   variable-to-check messages [size: num_edges x 1]
+//  _Lr     :   check-to-variable messages [size: num_edges x 1]
 //  _Lc     :   [size: _n x 1]
 //  _LQ     :   [size: _n x 1]
-//  _parity :   _H * _c_hat [size: _m x 1]
-int fec_sumproduct_step(unsigned int    _m,
-                        unsigned int    _n,
-                        smatrixb        _H,
+int fec_sumproduct_step(fec_ldpc_graph  _G,
                         unsigned char * _c_hat,
                         float *         _Lq,
                         float *         _Lr,
                         float *         _Lc,
-                        float *         _LQ,
-                        unsigned char * _parity)
+                        float *         _LQ)
 {
     unsigned int i;
     unsigned int j;
-    unsigned int ip;
-    unsigned int jp;
+    unsigned int e;
+    unsigned int ep;
     float alpha_prod;
     float phi_sum;
-    int parity_pass;
 
-    // compute Lr
-    for (i=0; i<_n; i++) {
-        for (j=0; j<_m; j++) {
+    // compute Lr from all other edges in the same row
+    for (j=0; j<_G->m; j++) {
+        for (e=_G->row[j]; e<_G->row[j+1]; e++) {
             alpha_prod = 1.0f;
             phi_sum    = 0.0f;
-            for (ip=0; ip<_n; ip++) {
-                //if (_H[j*_n+ip]==1 && i != ip) {
-                if (smatrixb_get(_H,j,ip)==1 && i != ip) {
-                    float alpha = _Lq[j*_n+ip] > 0.0f ? 1.0f : -1.0f;
-                    float beta  = fabsf(_Lq[j*_n+ip]);
+            for (ep=_G->row[j]; ep<_G->row[j+1]; ep++) {
+                if (ep != e) {
+                    float alpha = _Lq[ep] > 0.0f ? 1.0f : -1.0f;
+                    float beta  = fabsf(_Lq[ep]);
                     phi_sum += sumproduct_phi(beta);
                     alpha_prod *= alpha;
                 }
             }
-            _Lr[j*_n+i] = alpha_prod * sumproduct_phi(phi_sum);
+            _Lr[e] = alpha_prod * sumproduct_phi(phi_sum);
         }
     }
 
-#if DEBUG_SUMPRODUCT
-    // print Lq
-    matrixf_print(_Lq,_m,_n);
-
-    // print Lr
-    matrixf_print(_Lr,_m,_n);
-#endif
+    // compute LQ and next iteration of Lq from all other edges in the
+    // same column
+    for (i=0; i<_G->n; i++) {
+        _LQ[i] = _Lc[i];  // initialize with LLR value
+        for (e=_G->col[i]; e<_G->col[i+1]; e++)
+            _LQ[i] += _Lr[_G->col_edge[e]];
 
-    // compute next iteration of Lq
-    for (i=0; i<_n; i++) {
-        for (j=0; j<_m; j++) {
+        for (e=_G->col[i]; e<_G->col[i+1]; e++) {
             // initialize with LLR
-            _Lq[j*_n+i] = _Lc[i];
+            unsigned int k = _G->col_edge[e];
+            _Lq[k] = _Lc[i];
 
-            for (jp=0; jp<_m; jp++) {
-                //if (_H[jp*_n+i]==1 && j != jp)
-                if (smatrixb_get(_H,jp,i)==1 && j != jp)
-                    _Lq[j*_n+i] += _Lr[jp*_n+i];
+            for (ep=_G->col[i]; ep<_G->col[i+1]; ep++) {
+                if (ep != e)
+                    _Lq[k] += _Lr[_G->col_edge[ep]];
             }
         }
     }
 
-#if DEBUG_SUMPRODUCT
-    // print Lq
-    matrixf_print(_Lq,_m,_n);
-#endif
-
-    // compute LQ
-    for (i=0; i<_n; i++) {
-        _LQ[i] = _Lc[i];  // initialize with LLR value
-
-        for (j=0; j<_m; j++) {
-            //if (_H[j*_n+i]==1)
-            if (smatrixb_get(_H,j,i)==1)
-                _LQ[i] += _Lr[j*_n+i];
-        }
-    }
-
 #if DEBUG_SUMPRODUCT
     // print LQ
-    matrixf_print(_LQ,1,_n);
+    matrixf_print(_LQ,1,_G->n);
 #endif
 
     // compute hard-decoded value
-    for (i=0; i<_n; i++)
+    for (i=0; i<_G->n; i++)
         _c_hat[i] = _LQ[i] < 0.0f ? 1 : 0;
 
     // compute parity check: p = H*c_hat
-    smatrixb_vmul(_H, _c_hat, _parity);
-
-    // check parity
-    parity_pass = 1;
-    for (j=0; j<_m; j++) {
-        if (_parity[j]) parity_pass = 0;
-    }
+    int parity_pass = fec_ldpc_graph_check(_G, _c_hat);
 
 #if DEBUG_SUMPRODUCT
     // print hard-decision output
     printf("    : c hat = [");
-    for (i=0; i<_n; i++)
+    for (i=0; i<_G->n; i++)
         printf(" %1u", _c_hat[i]);
     printf(" ],  ");
 
-    // print parity
-    printf("parity = [");
-    for (j=0; j<_m; j++)
-        printf(" %1u", _parity[j]);
-    printf(" ],  ");
-
     printf(" (%s)\n", parity_pass ? "pass" : "FAIL");
 #endif
 
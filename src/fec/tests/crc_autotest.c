@@ -157,6 +157,38 @@ LIQUID_AUTOTEST(crc32_testvector,"compare explicit 32-bit CRC with expected","",
     LIQUID_CHECK(crc_validate_message(LIQUID_CRC_32, data, 256, 0x29058c73));
 }
 
+// compare key generation against bit-wise reference for many lengths and
+// alignments using the selected runtime
+void testbench_crc_runtime(liquid_autotest __q__,
+                           int             _detect)
+{
+    int rc = _detect ? crc_runtime_detect() : crc_runtime_select(LIQUID_RUNTIME_PORT);
+    LIQUID_CHECK(rc == LIQUID_OK);
+
+    // generate pseudo-random data
+    unsigned int i, n, offset;
+    unsigned char data[1040];
+    msequence ms = msequence_create_default(11);
+    for (i=0; i<1040; i++)
+        data[i] = msequence_generate_symbol(ms,8);
+    msequence_destroy(ms);
+
+    for (n=0; n<=1024; n += (n < 160 ? 1 : 37)) {
+        for (offset=0; offset<16; offset += 5) {
+            unsigned char * msg = data + offset;
+            LIQUID_CHECK(crc_generate_key(LIQUID_CRC_8,  msg, n) == crc8_generate_key_bitwise (msg, n));
+            LIQUID_CHECK(crc_generate_key(LIQUID_CRC_16, msg, n) == crc16_generate_key_bitwise(msg, n));
+            LIQUID_CHECK(crc_generate_key(LIQUID_CRC_24, msg, n) == crc24_generate_key_bitwise(msg, n));
+            LIQUID_CHECK(crc_generate_key(LIQUID_CRC_32, msg, n) == crc32_generate_key_bitwise(msg, n));
+        }
+    }
+
+    // restore automatic selection
+    crc_runtime_detect();
+}
+LIQUID_AUTOTEST(crc_runtime_port,  "compare portable CRC tables with bit-wise reference","",0.1) { testbench_crc_runtime(__q__, 0); }
+LIQUID_AUTOTEST(crc_runtime_detect,"compare selected CRC kernel with bit-wise reference","",0.1) { testbench_crc_runtime(__q__, 1); }
+
 LIQUID_AUTOTEST(crc_config,"test CRC config","",0.1)
 {
     _liquid_error_downgrade_enable();
@@ -30,24 +30,8 @@ void testbench_fec_codec(liquid_autotest __q__, fec_scheme _fs, unsigned int _n,
 {
 #if !LIBFEC_ENABLED
     switch (_fs) {
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
     case LIQUID_FEC_RS_M8:
-        LIQUID_WARN("convolutional, Reed-Solomon codes unavailable (install libfec)");
+        LIQUID_WARN("Reed-Solomon codes unavailable (install libfec)");
         return;
     default:;
     }
@@ -131,3 +115,8 @@ LIQUID_AUTOTEST(fec_v29p78,"","",0.1)  { testbench_fec_codec(__q__, LIQUID_FEC_C
 LIQUID_AUTOTEST(fec_rs8,"","",0.1)     { testbench_fec_codec(__q__, LIQUID_FEC_RS_M8,         64, NULL); }
 
 
+
+// low-density parity check codes
+LIQUID_AUTOTEST(fec_ldpc12k1024,"","",0.1) { testbench_fec_codec(__q__, LIQUID_FEC_LDPC_R12_K1024, 64, NULL); }
+LIQUID_AUTOTEST(fec_ldpc12k4096,"","",0.1) { testbench_fec_codec(__q__, LIQUID_FEC_LDPC_R12_K4096, 64, NULL); }
+LIQUID_AUTOTEST(fec_ldpc34k3072,"","",0.1) { testbench_fec_codec(__q__, LIQUID_FEC_LDPC_R34_K3072, 64, NULL); }
@@ -82,6 +82,9 @@ LIQUID_AUTOTEST(fec_str2fec,"test converting string to FEC scheme","",0.1)
     LIQUID_CHECK( liquid_getopt_str2fec("v29p67") ==      LIQUID_FEC_CONV_V29P67);
     LIQUID_CHECK( liquid_getopt_str2fec("v29p78") ==      LIQUID_FEC_CONV_V29P78);
     LIQUID_CHECK( liquid_getopt_str2fec("rs8") ==         LIQUID_FEC_RS_M8);
+    LIQUID_CHECK( liquid_getopt_str2fec("ldpc12k1024") == LIQUID_FEC_LDPC_R12_K1024);
+    LIQUID_CHECK( liquid_getopt_str2fec("ldpc12k4096") == LIQUID_FEC_LDPC_R12_K4096);
+    LIQUID_CHECK( liquid_getopt_str2fec("ldpc34k3072") == LIQUID_FEC_LDPC_R34_K3072);
 }
 
 LIQUID_AUTOTEST(fec_is_convolutional,"check that FEC scheme is convolutional","",0.1)
@@ -170,3 +173,13 @@ LIQUID_AUTOTEST(fec_is_hamming,"check that FEC scheme is Hamming code","",0.1)
     LIQUID_CHECK( fec_scheme_is_hamming(LIQUID_FEC_RS_M8) ==        0 );
 }
 
+LIQUID_AUTOTEST(fec_is_ldpc,"check that FEC scheme is low-density parity check","",0.1)
+{
+    LIQUID_CHECK( fec_scheme_is_ldpc(LIQUID_FEC_NONE) ==            0 );
+    LIQUID_CHECK( fec_scheme_is_ldpc(LIQUID_FEC_HAMMING74) ==       0 );
+    LIQUID_CHECK( fec_scheme_is_ldpc(LIQUID_FEC_CONV_V27) ==        0 );
+    LIQUID_CHECK( fec_scheme_is_ldpc(LIQUID_FEC_RS_M8) ==           0 );
+    LIQUID_CHECK( fec_scheme_is_ldpc(LIQUID_FEC_LDPC_R12_K1024) ==  1 );
+    LIQUID_CHECK( fec_scheme_is_ldpc(LIQUID_FEC_LDPC_R12_K4096) ==  1 );
+    LIQUID_CHECK( fec_scheme_is_ldpc(LIQUID_FEC_LDPC_R34_K3072) ==  1 );
+}
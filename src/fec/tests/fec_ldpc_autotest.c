@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+#include "liquid.autotest.h"
+#include "liquid.internal.h"
+
+// Test soft-decoding LDPC codes over an additive white Gaussian noise
+// channel with BPSK modulation; the noise level is chosen such that the
+// raw channel has plenty of bit errors which the decoder must correct
+void testbench_fec_ldpc_awgn(liquid_autotest __q__,
+                             fec_scheme      _fs,
+                             unsigned int    _n,
+                             float           _sigma)
+{
+    // create object
+    fec q = fec_create(_fs,NULL);
+
+    // create arrays
+    unsigned int n_enc = fec_get_enc_msg_length(_fs,_n);
+    unsigned char msg[_n];              // original message
+    unsigned char msg_enc[n_enc];       // encoded message
+    unsigned char msg_soft[8*n_enc];    // received message (soft bits)
+    unsigned char msg_dec[_n];          // decoded message
+
+    // initialize message
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg[i] = rand() & 0xff;
+
+    // encode message
+    fec_encode(q, _n, msg, msg_enc);
+
+    // channel: BPSK with noise, mapped to soft bits (0: strong zero, 255: strong one)
+    unsigned int num_bit_errors = 0;
+    for (i=0; i<8*n_enc; i++) {
+        unsigned int bit = (msg_enc[i/8] >> (7-(i%8))) & 1;
+        float y = (bit ? 1.0f : -1.0f) + _sigma*randnf();
+        float v = 127.5f + 127.5f*y/2.0f;
+        msg_soft[i] = v < 0.0f ? 0 : (v > 255.0f ? 255 : (unsigned char)v);
+        num_bit_errors += (msg_soft[i] > 127) != bit;
+    }
+    LIQUID_CHECK( num_bit_errors > 0 );
+
+    // decode message
+    fec_decode_soft(q, _n, msg_soft, msg_dec);
+
+    // validate output
+    LIQUID_CHECK_ARRAY(msg,msg_dec,_n);
+
+    // clean up objects
+    fec_destroy(q);
+}
+
+LIQUID_AUTOTEST(fec_ldpc_awgn_r12k1024,"","",0.1) { testbench_fec_ldpc_awgn(__q__, LIQUID_FEC_LDPC_R12_K1024, 128, 0.5f); }
+LIQUID_AUTOTEST(fec_ldpc_awgn_r12k4096,"","",0.1) { testbench_fec_ldpc_awgn(__q__, LIQUID_FEC_LDPC_R12_K4096, 512, 0.5f); }
+LIQUID_AUTOTEST(fec_ldpc_awgn_r34k3072,"","",0.1) { testbench_fec_ldpc_awgn(__q__, LIQUID_FEC_LDPC_R34_K3072, 384, 0.4f); }
+
+// encoded blocks must satisfy every parity check, including when the
+// message spans several shortened blocks
+LIQUID_AUTOTEST(fec_ldpc_encode_parity,"","",0.1)
+{
+    unsigned int n = 300;   // spans three blocks of 1024 information bits
+    fec q = fec_create(LIQUID_FEC_LDPC_R12_K1024,NULL);
+    unsigned int n_enc = fec_get_enc_msg_length(LIQUID_FEC_LDPC_R12_K1024,n);
+    LIQUID_CHECK( n_enc == 3*(100+128) );
+
+    unsigned char msg[n];
+    unsigned char msg_enc[n_enc];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        msg[i] = rand() & 0xff;
+    fec_encode(q, n, msg, msg_enc);
+
+    // reassemble each full-length codeword, with shortened bits set to zero
+    fec_ldpc_graph G = q->ldpc;
+    unsigned char c[G->n];
+    unsigned int b;
+    for (b=0; b<q->num_blocks; b++) {
+        unsigned char * block = &msg_enc[b*q->enc_block_len];
+        memset(c, 0x00, G->n);
+        for (i=0; i<8*q->dec_block_len; i++)
+            c[i] = (block[i/8] >> (7-(i%8))) & 1;
+        for (i=0; i<G->m; i++)
+            c[q->ldpc_k+i] = (block[q->dec_block_len+i/8] >> (7-(i%8))) & 1;
+        LIQUID_CHECK( fec_ldpc_graph_check(G, c) == 1 );
+
+        // flipping any single bit must violate at least one check
+        c[b] ^= 1;
+        LIQUID_CHECK( fec_ldpc_graph_check(G, c) == 0 );
+    }
+    fec_destroy(q);
+}
+
+// generated parity-check matrix must have no cycles of length four, i.e.
+// no two rows may share more than one column
+LIQUID_AUTOTEST(fec_ldpc_gen_qc_girth,"","",0.1)
+{
+    unsigned int Z=16, kb=8, mb=8;
+    smatrixb H = fec_ldpc_gen_qc(Z, kb, mb, 3);
+    fec_ldpc_graph G = fec_ldpc_graph_create(H);
+    LIQUID_CHECK( G->m == mb*Z );
+    LIQUID_CHECK( G->n == (kb+mb)*Z );
+
+    // dense copy of matrix
+    unsigned char A[G->m*G->n];
+    memset(A, 0x00, sizeof(A));
+    unsigned int i, j, e;
+    for (i=0; i<G->m; i++) {
+        for (e=G->row[i]; e<G->row[i+1]; e++)
+            A[i*G->n + G->var[e]] = 1;
+    }
+
+    unsigned int max_overlap = 0;
+    for (i=0; i<G->m; i++) {
+        for (j=i+1; j<G->m; j++) {
+            unsigned int k, overlap = 0;
+            for (k=0; k<G->n; k++)
+                overlap += A[i*G->n+k] & A[j*G->n+k];
+            max_overlap = overlap > max_overlap ? overlap : max_overlap;
+        }
+    }
+    LIQUID_CHECK( max_overlap <= 1 );
+
+    fec_ldpc_graph_destroy(G);
+    smatrixb_destroy(H);
+}
+
+// sum-product decoding of a (7,4) Hamming code with one unreliable bit
+LIQUID_AUTOTEST(fec_sumproduct_h74,"","",0.1)
+{
+    unsigned char Hs[21] = {
+        1, 1, 1, 0, 1, 0, 0,
+        0, 1, 1, 1, 0, 1, 0,
+        1, 1, 0, 1, 0, 0, 1};
+    smatrixb H = smatrixb_create_array(Hs, 3, 7);
+
+    // codeword 1000101 with bit 2 received with the wrong sign
+    unsigned char c[7] = {1, 0, 0, 0, 1, 0, 1};
+    float LLR[7];
+    unsigned int i;
+    for (i=0; i<7; i++)
+        LLR[i] = c[i] ? -4.0f : 4.0f;
+    LLR[2] = -0.5f;
+
+    unsigned char c_hat[7];
+    int parity_pass = fec_sumproduct(3, 7, H, LLR, c_hat, 10);
+    LIQUID_CHECK( parity_pass == 1 );
+    LIQUID_CHECK_ARRAY(c, c_hat, 7);
+
+    smatrixb_destroy(H);
+}
+
+// decode soft bits over an additive white Gaussian noise channel and hard
+// decisions with bit errors (8-bit decoder) for a particular runtime,
+// comparing against both the original message and the portable version
+void testbench_fec_ldpc_runtime(liquid_autotest  __q__,
+                                fec_scheme       _fs,
+                                unsigned int     _n,
+                                float            _sigma,
+                                liquid_runtime_t _runtime)
+{
+    // check if runtime is available on this machine
+    struct liquid_cpuinfo_s impl;
+    memset(&impl, 0x00, sizeof(struct liquid_cpuinfo_s));
+    switch (_runtime) {
+    case LIQUID_RUNTIME_PORT:                       break;
+    case LIQUID_RUNTIME_NEON:   impl.neon   = true; break;
+    case LIQUID_RUNTIME_AVX2:   impl.avx2   = true; break;
+    default:;
+    }
+    if (liquid_runtime_detect(&impl) != _runtime) {
+        LIQUID_WARN("runtime unavailable on this machine");
+        return;
+    }
+
+    // create object
+    fec q = fec_create(_fs,NULL);
+
+    // create arrays
+    unsigned int n_enc = fec_get_enc_msg_length(_fs,_n);
+    unsigned char msg[_n];              // original message
+    unsigned char msg_enc[n_enc];       // encoded message
+    unsigned char msg_hard[n_enc];      // received message (hard decisions)
+    unsigned char msg_soft[8*n_enc];    // received message (soft bits)
+    unsigned char msg_ref[_n];          // decoded message (portable)
+    unsigned char msg_dec[_n];          // decoded message (runtime)
+
+    // initialize message and encode
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg[i] = rand() & 0xff;
+    fec_encode(q, _n, msg, msg_enc);
+
+    // channel: BPSK with noise, mapped to soft bits and hard decisions
+    unsigned int num_bit_errors = 0;
+    memset(msg_hard, 0x00, n_enc);
+    for (i=0; i<8*n_enc; i++) {
+        unsigned int bit = (msg_enc[i/8] >> (7-(i%8))) & 1;
+        float y = (bit ? 1.0f : -1.0f) + _sigma*randnf();
+        float v = 127.5f + 127.5f*y/2.0f;
+        msg_soft[i] = v < 0.0f ? 0 : (v > 255.0f ? 255 : (unsigned char)v);
+        msg_hard[i/8] |= (y > 0.0f) << (7-(i%8));
+        num_bit_errors += (y > 0.0f) != bit;
+    }
+    LIQUID_CHECK( num_bit_errors > 0 );
+
+    // soft decoding (16-bit) must be bit-exact with portable version
+    fec_ldpc_runtime_select(q, LIQUID_RUNTIME_PORT);
+    fec_decode_soft(q, _n, msg_soft, msg_ref);
+    fec_ldpc_runtime_select(q, _runtime);
+    fec_decode_soft(q, _n, msg_soft, msg_dec);
+    LIQUID_CHECK_ARRAY(msg_dec, msg_ref, _n);
+    LIQUID_CHECK_ARRAY(msg_dec, msg,     _n);
+
+    // hard decoding (8-bit) must be bit-exact with portable version
+    fec_ldpc_runtime_select(q, LIQUID_RUNTIME_PORT);
+    fec_decode(q, _n, msg_hard, msg_ref);
+    fec_ldpc_runtime_select(q, _runtime);
+    fec_decode(q, _n, msg_hard, msg_dec);
+    LIQUID_CHECK_ARRAY(msg_dec, msg_ref, _n);
+    LIQUID_CHECK_ARRAY(msg_dec, msg,     _n);
+
+    // clean up objects
+    fec_destroy(q);
+}
+
+// portable
+LIQUID_AUTOTEST(fec_ldpc_r12k1024_port,"","",0.1) { testbench_fec_ldpc_runtime(__q__, LIQUID_FEC_LDPC_R12_K1024, 128, 0.45f, LIQUID_RUNTIME_PORT); }
+LIQUID_AUTOTEST(fec_ldpc_r12k4096_port,"","",0.1) { testbench_fec_ldpc_runtime(__q__, LIQUID_FEC_LDPC_R12_K4096, 500, 0.45f, LIQUID_RUNTIME_PORT); }
+LIQUID_AUTOTEST(fec_ldpc_r34k3072_port,"","",0.1) { testbench_fec_ldpc_runtime(__q__, LIQUID_FEC_LDPC_R34_K3072, 384, 0.40f, LIQUID_RUNTIME_PORT); }
+
+// ARM Neon
+LIQUID_AUTOTEST(fec_ldpc_r12k1024_neon,"","",0.1) { testbench_fec_ldpc_runtime(__q__, LIQUID_FEC_LDPC_R12_K1024, 128, 0.45f, LIQUID_RUNTIME_NEON); }
+LIQUID_AUTOTEST(fec_ldpc_r12k4096_neon,"","",0.1) { testbench_fec_ldpc_runtime(__q__, LIQUID_FEC_LDPC_R12_K4096, 500, 0.45f, LIQUID_RUNTIME_NEON); }
+LIQUID_AUTOTEST(fec_ldpc_r34k3072_neon,"","",0.1) { testbench_fec_ldpc_runtime(__q__, LIQUID_FEC_LDPC_R34_K3072, 384, 0.40f, LIQUID_RUNTIME_NEON); }
+
+// AVX2
+LIQUID_AUTOTEST(fec_ldpc_r12k1024_avx2,"","",0.1) { testbench_fec_ldpc_runtime(__q__, LIQUID_FEC_LDPC_R12_K1024, 128, 0.45f, LIQUID_RUNTIME_AVX2); }
+LIQUID_AUTOTEST(fec_ldpc_r12k4096_avx2,"","",0.1) { testbench_fec_ldpc_runtime(__q__, LIQUID_FEC_LDPC_R12_K4096, 500, 0.45f, LIQUID_RUNTIME_AVX2); }
+LIQUID_AUTOTEST(fec_ldpc_r34k3072_avx2,"","",0.1) { testbench_fec_ldpc_runtime(__q__, LIQUID_FEC_LDPC_R34_K3072, 384, 0.40f, LIQUID_RUNTIME_AVX2); }
+
+// updating the rows of each layer at once is equivalent to updating them
+// one at a time over the graph, as the rows of a layer share no variables
+LIQUID_AUTOTEST(fec_ldpc_layered,"","",0.1)
+{
+    unsigned int n = 128;   // single full block of 1024 information bits
+    fec q = fec_create(LIQUID_FEC_LDPC_R12_K1024,NULL);
+    fec_ldpc_runtime_select(q, LIQUID_RUNTIME_PORT);
+    unsigned int n_enc = fec_get_enc_msg_length(LIQUID_FEC_LDPC_R12_K1024,n);
+    fec_ldpc_graph G = q->ldpc;
+    LIQUID_CHECK( 8*n_enc == G->n );
+
+    // encode random message and add noise to soft bits
+    unsigned char msg[n], msg_enc[n_enc], msg_soft[8*n_enc], msg_dec[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        msg[i] = rand() & 0xff;
+    fec_encode(q, n, msg, msg_enc);
+    int16_t llr[G->n];
+    for (i=0; i<G->n; i++) {
+        float v = ((msg_enc[i/8] >> (7-(i%8))) & 1 ? 191.0f : 64.0f) + 40.0f*randnf();
+        msg_soft[i] = v < 0.0f ? 0 : (v > 255.0f ? 255 : (unsigned char)v);
+        llr[i] = 255 - 2*(int)msg_soft[i];
+    }
+
+    // decode with layers, and with rows over graph
+    fec_decode_soft(q, n, msg_soft, msg_dec);
+    int16_t msg_graph[G->num_edges];
+    unsigned char c_hat[G->n];
+    memset(msg_graph, 0x00, sizeof(msg_graph));
+    LIQUID_CHECK( fec_ldpc_minsum(G, llr, msg_graph, c_hat, 20) == 1 );
+
+    // posteriors must be identical
+    LIQUID_CHECK_ARRAY(q->ldpc_llr, llr, G->n*sizeof(int16_t));
+    LIQUID_CHECK_ARRAY(msg_dec, msg, n);
+    fec_destroy(q);
+}
+
+// parity-check matrices of all schemes must be generated without falling
+// back to a circulant shift which forms cycles of length four: for any two
+// layers sharing two block columns, the differences in shifts must differ
+LIQUID_AUTOTEST(fec_ldpc_gen_schemes,"","",0.1)
+{
+    fec_scheme schemes[3] = {LIQUID_FEC_LDPC_R12_K1024,
+                             LIQUID_FEC_LDPC_R12_K4096,
+                             LIQUID_FEC_LDPC_R34_K3072};
+    unsigned int i;
+    for (i=0; i<3; i++) {
+        fec q = fec_create(schemes[i],NULL);
+        LIQUID_CHECK( q != NULL );
+        if (q == NULL)
+            continue;
+
+        int Z = (int)q->ldpc_z;
+        unsigned int r0, r1, b0, b1, c0, c1, num_cycles = 0;
+        for (r0=0; r0<q->ldpc_mb; r0++) {
+            for (r1=r0+1; r1<q->ldpc_mb; r1++) {
+                for (b0=q->ldpc_layer[r0]; b0<q->ldpc_layer[r0+1]; b0++) {
+                    for (b1=b0+1; b1<q->ldpc_layer[r0+1]; b1++) {
+                        // find same block columns in second layer
+                        for (c0=q->ldpc_layer[r1]; c0<q->ldpc_layer[r1+1]; c0++) {
+                            if (q->ldpc_base[c0] != q->ldpc_base[b0])
+                                continue;
+                            for (c1=q->ldpc_layer[r1]; c1<q->ldpc_layer[r1+1]; c1++) {
+                                if (q->ldpc_base[c1] != q->ldpc_base[b1])
+                                    continue;
+                                int d0 = ((int)q->ldpc_shift[b0] - (int)q->ldpc_shift[c0] + Z) % Z;
+                                int d1 = ((int)q->ldpc_shift[b1] - (int)q->ldpc_shift[c1] + Z) % Z;
+                                num_cycles += d0 == d1;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        LIQUID_CHECK( num_cycles == 0 );
+        fec_destroy(q);
+    }
+}
+
+// generation must fail rather than keep a shift which forms cycles of
+// length four when the circulants are too small to avoid them
+LIQUID_AUTOTEST(fec_ldpc_gen_qc_config,"","",0.1)
+{
+    _liquid_error_downgrade_enable();
+    LIQUID_CHECK(NULL == fec_ldpc_gen_qc( 2, 8, 3, 3));
+    LIQUID_CHECK(NULL == fec_ldpc_gen_qc( 0, 8, 8, 3));
+    LIQUID_CHECK(NULL == fec_ldpc_gen_qc(16, 8, 8, 9));
+    _liquid_error_downgrade_disable();
+}
@@ -34,24 +34,8 @@ void testbench_fec_codec_soft(liquid_autotest __q__,
 {
 #if !LIBFEC_ENABLED
     switch (_fs) {
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
     case LIQUID_FEC_RS_M8:
-        LIQUID_WARN("convolutional, Reed-Solomon codes unavailable (install libfec)");
+        LIQUID_WARN("Reed-Solomon codes unavailable (install libfec)");
         return;
     default:;
     }
@@ -140,3 +124,8 @@ LIQUID_AUTOTEST(fecsoft_v29p78,"","",0.1) { testbench_fec_codec_soft(__q__, LIQU
 LIQUID_AUTOTEST(fecsoft_rs8,"","",0.1)    { testbench_fec_codec_soft(__q__, LIQUID_FEC_RS_M8,       64, NULL); }
 
 
+
+// low-density parity check codes
+LIQUID_AUTOTEST(fecsoft_ldpc12k1024,"","",0.1) { testbench_fec_codec_soft(__q__, LIQUID_FEC_LDPC_R12_K1024, 64, NULL); }
+LIQUID_AUTOTEST(fecsoft_ldpc12k4096,"","",0.1) { testbench_fec_codec_soft(__q__, LIQUID_FEC_LDPC_R12_K4096, 64, NULL); }
+LIQUID_AUTOTEST(fecsoft_ldpc34k3072,"","",0.1) { testbench_fec_codec_soft(__q__, LIQUID_FEC_LDPC_R34_K3072, 64, NULL); }
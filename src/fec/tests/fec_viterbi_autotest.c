@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "liquid.autotest.h"
+#include "liquid.internal.h"
+
+// decode noisy soft symbols for a particular code and runtime, comparing
+// against both the original message and the portable implementation
+void testbench_fec_viterbi(liquid_autotest  __q__,
+                           unsigned int     _K,
+                           unsigned int     _R,
+                           int *            _poly,
+                           liquid_runtime_t _runtime)
+{
+    // check if runtime is available on this machine
+    struct liquid_cpuinfo_s impl;
+    memset(&impl, 0x00, sizeof(struct liquid_cpuinfo_s));
+    switch (_runtime) {
+    case LIQUID_RUNTIME_PORT:                       break;
+    case LIQUID_RUNTIME_NEON:   impl.neon   = true; break;
+    case LIQUID_RUNTIME_SSE2:   impl.sse2   = true; break;
+    case LIQUID_RUNTIME_AVX2:   impl.avx2   = true; break;
+    case LIQUID_RUNTIME_AVX512: impl.avx512 = true; break;
+    default:;
+    }
+    if (liquid_runtime_detect(&impl) != _runtime) {
+        LIQUID_WARN("runtime unavailable on this machine");
+        return;
+    }
+
+    unsigned int n = 256;               // number of decoded bits
+    unsigned int m = n + _K - 1;        // number of trellis steps
+    unsigned char msg    [n/8];         // original message
+    unsigned char sym    [_R*m];        // received soft symbols
+    unsigned char msg_ref[n/8];         // decoded message (portable)
+    unsigned char msg_dec[n/8];         // decoded message (runtime)
+
+    // generate message and encode with soft symbols in noise
+    unsigned int i, r;
+    unsigned int sr = 0;
+    for (i=0; i<n/8; i++)
+        msg[i] = rand() & 0xff;
+    for (i=0; i<m; i++) {
+        unsigned int bit = i < n ? (msg[i/8] >> (7-(i%8))) & 1 : 0;
+        sr = (sr << 1) | bit;
+        for (r=0; r<_R; r++) {
+            float v = (liquid_count_ones_mod2(sr & _poly[r]) ? 191.0f : 64.0f) + 24.0f*randnf();
+            sym[i*_R+r] = (unsigned char) (v < 0 ? 0 : (v > 255 ? 255 : v));
+        }
+    }
+
+    // decode with portable method
+    fec_viterbi q = fec_viterbi_create(_K, _R, _poly, n);
+    fec_viterbi_runtime_select(q, LIQUID_RUNTIME_PORT);
+    fec_viterbi_reset(q, 0);
+    fec_viterbi_update_blk(q, sym, m);
+    fec_viterbi_chainback(q, msg_ref, n, 0);
+
+    // decode with runtime method, splitting block to ensure state is retained
+    fec_viterbi_runtime_select(q, _runtime);
+    fec_viterbi_reset(q, 0);
+    fec_viterbi_update_blk(q, sym,          m/3);
+    fec_viterbi_update_blk(q, sym+_R*(m/3), m - m/3);
+    fec_viterbi_chainback(q, msg_dec, n, 0);
+    fec_viterbi_destroy(q);
+
+    // runtime method must be bit-exact with portable version
+    LIQUID_CHECK_ARRAY(msg_dec, msg_ref, n/8);
+    LIQUID_CHECK_ARRAY(msg_dec, msg,     n/8);
+}
+
+// portable
+LIQUID_AUTOTEST(fec_viterbi_v27_port,"","",0.1)    { testbench_fec_viterbi(__q__,  7, 2, fec_conv27_poly,  LIQUID_RUNTIME_PORT  ); }
+LIQUID_AUTOTEST(fec_viterbi_v29_port,"","",0.1)    { testbench_fec_viterbi(__q__,  9, 2, fec_conv29_poly,  LIQUID_RUNTIME_PORT  ); }
+LIQUID_AUTOTEST(fec_viterbi_v39_port,"","",0.1)    { testbench_fec_viterbi(__q__,  9, 3, fec_conv39_poly,  LIQUID_RUNTIME_PORT  ); }
+LIQUID_AUTOTEST(fec_viterbi_v615_port,"","",0.1)   { testbench_fec_viterbi(__q__, 15, 6, fec_conv615_poly, LIQUID_RUNTIME_PORT  ); }
+
+// ARM Neon
+LIQUID_AUTOTEST(fec_viterbi_v27_neon,"","",0.1)    { testbench_fec_viterbi(__q__,  7, 2, fec_conv27_poly,  LIQUID_RUNTIME_NEON  ); }
+LIQUID_AUTOTEST(fec_viterbi_v29_neon,"","",0.1)    { testbench_fec_viterbi(__q__,  9, 2, fec_conv29_poly,  LIQUID_RUNTIME_NEON  ); }
+LIQUID_AUTOTEST(fec_viterbi_v39_neon,"","",0.1)    { testbench_fec_viterbi(__q__,  9, 3, fec_conv39_poly,  LIQUID_RUNTIME_NEON  ); }
+LIQUID_AUTOTEST(fec_viterbi_v615_neon,"","",0.1)   { testbench_fec_viterbi(__q__, 15, 6, fec_conv615_poly, LIQUID_RUNTIME_NEON  ); }
+
+// SSE2
+LIQUID_AUTOTEST(fec_viterbi_v27_sse2,"","",0.1)    { testbench_fec_viterbi(__q__,  7, 2, fec_conv27_poly,  LIQUID_RUNTIME_SSE2  ); }
+LIQUID_AUTOTEST(fec_viterbi_v29_sse2,"","",0.1)    { testbench_fec_viterbi(__q__,  9, 2, fec_conv29_poly,  LIQUID_RUNTIME_SSE2  ); }
+LIQUID_AUTOTEST(fec_viterbi_v39_sse2,"","",0.1)    { testbench_fec_viterbi(__q__,  9, 3, fec_conv39_poly,  LIQUID_RUNTIME_SSE2  ); }
+LIQUID_AUTOTEST(fec_viterbi_v615_sse2,"","",0.1)   { testbench_fec_viterbi(__q__, 15, 6, fec_conv615_poly, LIQUID_RUNTIME_SSE2  ); }
+
+// AVX2
+LIQUID_AUTOTEST(fec_viterbi_v27_avx2,"","",0.1)    { testbench_fec_viterbi(__q__,  7, 2, fec_conv27_poly,  LIQUID_RUNTIME_AVX2  ); }
+LIQUID_AUTOTEST(fec_viterbi_v29_avx2,"","",0.1)    { testbench_fec_viterbi(__q__,  9, 2, fec_conv29_poly,  LIQUID_RUNTIME_AVX2  ); }
+LIQUID_AUTOTEST(fec_viterbi_v39_avx2,"","",0.1)    { testbench_fec_viterbi(__q__,  9, 3, fec_conv39_poly,  LIQUID_RUNTIME_AVX2  ); }
+LIQUID_AUTOTEST(fec_viterbi_v615_avx2,"","",0.1)   { testbench_fec_viterbi(__q__, 15, 6, fec_conv615_poly, LIQUID_RUNTIME_AVX2  ); }
+
+// AVX-512
+LIQUID_AUTOTEST(fec_viterbi_v27_avx512,"","",0.1)  { testbench_fec_viterbi(__q__,  7, 2, fec_conv27_poly,  LIQUID_RUNTIME_AVX512); }
+LIQUID_AUTOTEST(fec_viterbi_v29_avx512,"","",0.1)  { testbench_fec_viterbi(__q__,  9, 2, fec_conv29_poly,  LIQUID_RUNTIME_AVX512); }
+LIQUID_AUTOTEST(fec_viterbi_v39_avx512,"","",0.1)  { testbench_fec_viterbi(__q__,  9, 3, fec_conv39_poly,  LIQUID_RUNTIME_AVX512); }
+LIQUID_AUTOTEST(fec_viterbi_v615_avx512,"","",0.1) { testbench_fec_viterbi(__q__, 15, 6, fec_conv615_poly, LIQUID_RUNTIME_AVX512); }
+
+// invalid configurations
+LIQUID_AUTOTEST(fec_viterbi_config,"","",0.1)
+{
+    _liquid_error_downgrade_enable();
+    int poly_even[2] = {0x4e, 0x6d};    // first tap not set
+    int poly_short[2] = {0x0f, 0x6d};   // last tap not set
+    LIQUID_CHECK(NULL == fec_viterbi_create( 6, 2, fec_conv27_poly, 64));
+    LIQUID_CHECK(NULL == fec_viterbi_create( 7, 0, fec_conv27_poly, 64));
+    LIQUID_CHECK(NULL == fec_viterbi_create( 7, 2, poly_even,       64));
+    LIQUID_CHECK(NULL == fec_viterbi_create( 7, 2, poly_short,      64));
+    LIQUID_CHECK(NULL == fec_viterbi_create(16, 8, fec_conv615_poly,64));
+
+    // decoding beyond capacity
+    unsigned char sym[2*80];
+    unsigned char msg[8];
+    memset(sym, 0x00, sizeof(sym));
+    fec_viterbi q = fec_viterbi_create(7, 2, fec_conv27_poly, 64);
+    LIQUID_CHECK(LIQUID_OK != fec_viterbi_update_blk(q, sym, 80));
+    LIQUID_CHECK(LIQUID_OK != fec_viterbi_chainback (q, msg, 64, 0));
+    LIQUID_CHECK(LIQUID_OK == fec_viterbi_update_blk(q, sym, 70));
+    LIQUID_CHECK(LIQUID_OK == fec_viterbi_chainback (q, msg, 64, 0));
+    fec_viterbi_destroy(q);
+    _liquid_error_downgrade_disable();
+}
@@ -21,6 +21,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "liquid.autotest.h"
 #include "liquid.h"
@@ -81,3 +82,72 @@ LIQUID_AUTOTEST(interleaver_soft_16,"","",0.1)     { testbench_interleaver_soft(
 LIQUID_AUTOTEST(interleaver_soft_64,"","",0.1)     { testbench_interleaver_soft(__q__, 64  ); }
 LIQUID_AUTOTEST(interleaver_soft_256,"","",0.1)    { testbench_interleaver_soft(__q__, 256 ); }
 
+
+// output must match the original iterative permutation, byte for byte
+LIQUID_AUTOTEST(interleaver_reference,"","",0.1)
+{
+    unsigned int n = 37;
+    unsigned char y_test[37] = {
+        0x83, 0x24, 0xf1, 0x2a, 0x7d, 0xa0, 0x0f, 0x2c, 0x7f, 0xd4, 0xb3, 0x5a,
+        0x8d, 0xb4, 0xc1, 0x86, 0x15, 0x5c, 0x7b, 0x98, 0x6b, 0x52, 0xd1, 0x52,
+        0x85, 0x4e, 0xef, 0x68, 0x1d, 0x88, 0x63, 0x26, 0x59, 0xfe, 0x63, 0xb6,
+        0x53};
+
+    unsigned int i;
+    unsigned char x[n];
+    unsigned char y[n];
+    for (i=0; i<n; i++)
+        x[i] = (unsigned char)(i*0x3b + 7);
+
+    interleaver q = interleaver_create(n);
+    interleaver_encode(q,x,y);
+    LIQUID_CHECK_ARRAY(y, y_test, n);
+    interleaver_destroy(q);
+}
+
+// soft-bit interleaving must match hard-bit interleaving for every depth
+LIQUID_AUTOTEST(interleaver_soft_hard,"","",0.1)
+{
+    unsigned int n = 64;
+    unsigned int i, depth;
+    unsigned char x[n],   y[n];
+    unsigned char xs[8*n], ys[8*n], ys_test[8*n];
+    for (i=0; i<n; i++)
+        x[i] = rand() & 0xFF;
+    liquid_unpack_bytes(x, n, xs, 8*n, &i);
+
+    interleaver q = interleaver_create(n);
+    for (depth=0; depth<=4; depth++) {
+        interleaver_set_depth(q, depth);
+        interleaver_encode(q,x,y);
+        interleaver_encode_soft(q,xs,ys);
+        liquid_unpack_bytes(y, n, ys_test, 8*n, &i);
+        LIQUID_CHECK_ARRAY(ys, ys_test, 8*n);
+    }
+    interleaver_destroy(q);
+}
+
+// operating in place and on copied objects gives the same result
+LIQUID_AUTOTEST(interleaver_inplace_copy,"","",0.1)
+{
+    unsigned int n = 100;
+    unsigned int i;
+    unsigned char x[n], y[n], z[n];
+    for (i=0; i<n; i++)
+        x[i] = rand() & 0xFF;
+
+    interleaver q0 = interleaver_create(n);
+    interleaver_set_depth(q0, 2);
+    interleaver q1 = interleaver_copy(q0);
+
+    interleaver_encode(q0,x,y);
+    memmove(z, x, n);
+    interleaver_encode(q1,z,z);
+    LIQUID_CHECK_ARRAY(y, z, n);
+
+    interleaver_decode(q1,z,z);
+    LIQUID_CHECK_ARRAY(x, z, n);
+
+    interleaver_destroy(q0);
+    interleaver_destroy(q1);
+}
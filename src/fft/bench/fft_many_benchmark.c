@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_many_benchmark.c : benchmark batches of equal-length FFTs
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+#define FFT_MANY_BENCH_API(NFFT,HOWMANY,BATCH)  \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ fft_many_bench(_start, _finish, _num_iterations, NFFT, HOWMANY, BATCH); }
+
+// Helper function to keep code base small
+//  _nfft       :   transform size
+//  _howmany    :   number of transforms
+//  _batch      :   run as a single batched plan (1) or one plan at a time (0)
+void fft_many_bench(struct rusage *     _start,
+                    struct rusage *     _finish,
+                    unsigned long int * _num_iterations,
+                    unsigned int        _nfft,
+                    unsigned int        _howmany,
+                    int                 _batch)
+{
+    unsigned int n = _nfft*_howmany;
+    float complex * x = (float complex *) fft_malloc(n*sizeof(float complex));
+    float complex * y = (float complex *) fft_malloc(n*sizeof(float complex));
+
+    unsigned long int i;
+    for (i=0; i<n; i++)
+        x[i] = randnf() + randnf()*_Complex_I;
+
+    // create either one batched plan or one plan per transform
+    unsigned int num_plans = _batch ? 1 : _howmany;
+    fftplan * q = (fftplan*) malloc(num_plans*sizeof(fftplan));
+    if (_batch) {
+        q[0] = fft_create_plan_many(_nfft, _howmany, x, 1, _nfft, y, 1, _nfft,
+                                    LIQUID_FFT_FORWARD, 0);
+    } else {
+        for (i=0; i<_howmany; i++)
+            q[i] = fft_create_plan(_nfft, x+i*_nfft, y+i*_nfft, LIQUID_FFT_FORWARD, 0);
+    }
+
+    // scale number of iterations to keep execution time
+    // relatively linear
+    *_num_iterations /= n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // start trials
+    unsigned int j;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        for (j=0; j<num_plans; j++)
+            fft_execute(q[j]);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    for (i=0; i<num_plans; i++)
+        fft_destroy_plan(q[i]);
+    free(q);
+    fft_free(x);
+    fft_free(y);
+}
+
+// 64 transforms, one plan per transform
+void benchmark_fft_many_8_single    FFT_MANY_BENCH_API(  8, 64, 0)
+void benchmark_fft_many_16_single   FFT_MANY_BENCH_API( 16, 64, 0)
+void benchmark_fft_many_64_single   FFT_MANY_BENCH_API( 64, 64, 0)
+void benchmark_fft_many_256_single  FFT_MANY_BENCH_API(256, 64, 0)
+void benchmark_fft_many_1024_single FFT_MANY_BENCH_API(1024,64, 0)
+void benchmark_fft_many_24_single   FFT_MANY_BENCH_API( 24, 64, 0)
+
+// 64 transforms, single batched plan
+void benchmark_fft_many_8_batch     FFT_MANY_BENCH_API(  8, 64, 1)
+void benchmark_fft_many_16_batch    FFT_MANY_BENCH_API( 16, 64, 1)
+void benchmark_fft_many_64_batch    FFT_MANY_BENCH_API( 64, 64, 1)
+void benchmark_fft_many_256_batch   FFT_MANY_BENCH_API(256, 64, 1)
+void benchmark_fft_many_1024_batch  FFT_MANY_BENCH_API(1024,64, 1)
+void benchmark_fft_many_24_batch    FFT_MANY_BENCH_API( 24, 64, 1)
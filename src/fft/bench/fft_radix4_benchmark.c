@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include "liquid.internal.h"
+
+#if fftw3f_FOUND || HAVE_FFTW3_H
+#   include <fftw3.h>
+#endif
+
+// benchmark transform for a particular runtime; plans are created through
+// the generic interface so composite sizes exercise the radix-4 kernels
+// through their power-of-two factors
+void fft_radix4_runbench(struct rusage *     _start,
+                         struct rusage *     _finish,
+                         unsigned long int * _num_iterations,
+                         unsigned int        _nfft,
+                         liquid_runtime_t    _runtime)
+{
+    // check if runtime is available on this machine
+    struct liquid_cpuinfo_s impl;
+    memset(&impl, 0x00, sizeof(struct liquid_cpuinfo_s));
+    switch (_runtime) {
+    case LIQUID_RUNTIME_NEON:   impl.neon   = true; break;
+    case LIQUID_RUNTIME_SSE2:   impl.sse2   = true; break;
+    case LIQUID_RUNTIME_AVX2:   impl.avx2   = true; break;
+    case LIQUID_RUNTIME_AVX512: impl.avx512 = true; break;
+    default:;
+    }
+    if (liquid_runtime_detect(&impl) != _runtime) {
+        getrusage(RUSAGE_SELF, _start);
+        memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
+        return;
+    }
+
+    // create plan with selected kernels
+    float complex * x = (float complex *) fft_malloc(_nfft*sizeof(float complex));
+    float complex * y = (float complex *) fft_malloc(_nfft*sizeof(float complex));
+    fft_runtime_select(_runtime);
+    fftplan q = fft_create_plan(_nfft, x, y, LIQUID_FFT_FORWARD, 0);
+    fft_runtime_detect();
+
+    unsigned long int i;
+    for (i=0; i<_nfft; i++)
+        x[i] = randnf() + randnf()*_Complex_I;
+
+    // scale number of iterations to keep execution time relatively linear
+    *_num_iterations /= _nfft;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        fft_execute(q);
+        fft_execute(q);
+        fft_execute(q);
+        fft_execute(q);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    fft_destroy_plan(q);
+    fft_free(x);
+    fft_free(y);
+}
+
+// benchmark same transform with FFTW for comparison; reports nothing when
+// the library is not available
+void fft_radix4_runbench_fftw(struct rusage *     _start,
+                              struct rusage *     _finish,
+                              unsigned long int * _num_iterations,
+                              unsigned int        _nfft)
+{
+#if fftw3f_FOUND || HAVE_FFTW3_H
+    fftwf_complex * x = (fftwf_complex *) fftwf_malloc(_nfft*sizeof(fftwf_complex));
+    fftwf_complex * y = (fftwf_complex *) fftwf_malloc(_nfft*sizeof(fftwf_complex));
+    fftwf_plan q = fftwf_plan_dft_1d(_nfft, x, y, FFTW_FORWARD, FFTW_MEASURE);
+
+    unsigned long int i;
+    for (i=0; i<_nfft; i++) {
+        x[i][0] = randnf();
+        x[i][1] = randnf();
+    }
+
+    // scale number of iterations to keep execution time relatively linear
+    *_num_iterations /= _nfft;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        fftwf_execute(q);
+        fftwf_execute(q);
+        fftwf_execute(q);
+        fftwf_execute(q);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    fftwf_destroy_plan(q);
+    fftwf_free(x);
+    fftwf_free(y);
+#else
+    getrusage(RUSAGE_SELF, _start);
+    memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
+#endif
+}
+
+#define FFT_RADIX4_BENCH_API(NFFT,RUNTIME)  \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ fft_radix4_runbench(_start, _finish, _num_iterations, NFFT, RUNTIME); }
+
+#define FFT_RADIX4_BENCH_FFTW_API(NFFT)     \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ fft_radix4_runbench_fftw(_start, _finish, _num_iterations, NFFT); }
+
+// power-of-two sizes
+void benchmark_fft_radix4_64_port       FFT_RADIX4_BENCH_API(  64, LIQUID_RUNTIME_PORT  )
+void benchmark_fft_radix4_64_sse2       FFT_RADIX4_BENCH_API(  64, LIQUID_RUNTIME_SSE2  )
+void benchmark_fft_radix4_64_avx2       FFT_RADIX4_BENCH_API(  64, LIQUID_RUNTIME_AVX2  )
+void benchmark_fft_radix4_64_avx512     FFT_RADIX4_BENCH_API(  64, LIQUID_RUNTIME_AVX512)
+void benchmark_fft_radix4_64_neon       FFT_RADIX4_BENCH_API(  64, LIQUID_RUNTIME_NEON  )
+void benchmark_fft_radix4_64_fftw       FFT_RADIX4_BENCH_FFTW_API(  64)
+
+void benchmark_fft_radix4_512_port      FFT_RADIX4_BENCH_API( 512, LIQUID_RUNTIME_PORT  )
+void benchmark_fft_radix4_512_sse2      FFT_RADIX4_BENCH_API( 512, LIQUID_RUNTIME_SSE2  )
+void benchmark_fft_radix4_512_avx2      FFT_RADIX4_BENCH_API( 512, LIQUID_RUNTIME_AVX2  )
+void benchmark_fft_radix4_512_avx512    FFT_RADIX4_BENCH_API( 512, LIQUID_RUNTIME_AVX512)
+void benchmark_fft_radix4_512_neon      FFT_RADIX4_BENCH_API( 512, LIQUID_RUNTIME_NEON  )
+void benchmark_fft_radix4_512_fftw      FFT_RADIX4_BENCH_FFTW_API( 512)
+
+void benchmark_fft_radix4_4096_port     FFT_RADIX4_BENCH_API(4096, LIQUID_RUNTIME_PORT  )
+void benchmark_fft_radix4_4096_sse2     FFT_RADIX4_BENCH_API(4096, LIQUID_RUNTIME_SSE2  )
+void benchmark_fft_radix4_4096_avx2     FFT_RADIX4_BENCH_API(4096, LIQUID_RUNTIME_AVX2  )
+void benchmark_fft_radix4_4096_avx512   FFT_RADIX4_BENCH_API(4096, LIQUID_RUNTIME_AVX512)
+void benchmark_fft_radix4_4096_neon     FFT_RADIX4_BENCH_API(4096, LIQUID_RUNTIME_NEON  )
+void benchmark_fft_radix4_4096_fftw     FFT_RADIX4_BENCH_FFTW_API(4096)
+
+// composite sizes with power-of-two factors
+void benchmark_fft_radix4_384_port      FFT_RADIX4_BENCH_API( 384, LIQUID_RUNTIME_PORT  )
+void benchmark_fft_radix4_384_avx2      FFT_RADIX4_BENCH_API( 384, LIQUID_RUNTIME_AVX2  )
+void benchmark_fft_radix4_384_avx512    FFT_RADIX4_BENCH_API( 384, LIQUID_RUNTIME_AVX512)
+void benchmark_fft_radix4_384_neon      FFT_RADIX4_BENCH_API( 384, LIQUID_RUNTIME_NEON  )
+void benchmark_fft_radix4_384_fftw      FFT_RADIX4_BENCH_FFTW_API( 384)
+
+void benchmark_fft_radix4_1280_port     FFT_RADIX4_BENCH_API(1280, LIQUID_RUNTIME_PORT  )
+void benchmark_fft_radix4_1280_avx2     FFT_RADIX4_BENCH_API(1280, LIQUID_RUNTIME_AVX2  )
+void benchmark_fft_radix4_1280_avx512   FFT_RADIX4_BENCH_API(1280, LIQUID_RUNTIME_AVX512)
+void benchmark_fft_radix4_1280_neon     FFT_RADIX4_BENCH_API(1280, LIQUID_RUNTIME_NEON  )
+void benchmark_fft_radix4_1280_fftw     FFT_RADIX4_BENCH_FFTW_API(1280)
@@ -61,6 +61,16 @@ struct FFT(plan_s)
             TC * twiddle;               // twiddle factors
         } radix2;
 
+        // radix-4 Stockham autosort transform data
+        struct {
+            unsigned int num_stages4;   // number of radix-4 stages
+            int radix2;                 // final radix-2 stage?
+            TC * twiddle;               // twiddle factors for all stages
+            TC * t;                     // intermediate buffer
+            FFT(_radix4_stage_t) * stage4;  // radix-4 stage kernel
+            FFT(_radix2_stage_t) * stage2;  // radix-2 stage kernel
+        } radix4;
+
         // recursive mixed-radix transform data:
         //  - compute 'Q' FFTs of size 'P'
         //  - apply twiddle factors
@@ -97,7 +107,26 @@ struct FFT(plan_s)
             FFT(plan) fft;      // sub-FFT of size nfft_prime
             FFT(plan) ifft;     // sub-IFFT of size nfft_prime
         } rader2;
+
+        // batch of equal-length transforms
+        struct {
+            unsigned int howmany;   // number of transforms
+            unsigned int istride;   // input sample stride
+            unsigned int idist;     // distance between input transforms
+            unsigned int ostride;   // output sample stride
+            unsigned int odist;     // distance between output transforms
+            FFT(plan) fft;          // single transform (run one at a time)
+            TC * buf_x;             // single transform input buffer
+            TC * buf_y;             // single transform output buffer
+            unsigned int m;         // log2(nfft) (interleaved radix-2)
+            unsigned int * index_rev; // reversed indices
+            T * twiddle;            // twiddle factors, [real, imag] pairs
+            T * re;                 // interleaved buffer (real)
+            T * im;                 // interleaved buffer (imag)
+        } many;
     } data;
+
+    LIQUID_COUNTER_FIELD    // performance counters (when enabled)
 };
 
 // allocate one-dimensional array 
@@ -136,6 +165,10 @@ FFT(plan) FFT(_create_plan)(unsigned int _nfft,
         // use radix-2 decimation-in-time method
         return FFT(_create_plan_radix2)(_nfft, _x, _y, _dir, _flags);
 
+    case LIQUID_FFT_METHOD_RADIX4:
+        // use vectorized radix-4 Stockham method
+        return FFT(_create_plan_radix4)(_nfft, _x, _y, _dir, _flags);
+
     case LIQUID_FFT_METHOD_MIXED_RADIX:
         // use Cooley-Tukey mixed-radix algorithm
         return FFT(_create_plan_mixed_radix)(_nfft, _x, _y, _dir, _flags);
@@ -168,9 +201,11 @@ int FFT(_destroy_plan)(FFT(plan) _q)
         switch (_q->method) {
         case LIQUID_FFT_METHOD_DFT:         return FFT(_destroy_plan_dft)(_q);
         case LIQUID_FFT_METHOD_RADIX2:      return FFT(_destroy_plan_radix2)(_q);
+        case LIQUID_FFT_METHOD_RADIX4:      return FFT(_destroy_plan_radix4)(_q);
         case LIQUID_FFT_METHOD_MIXED_RADIX: return FFT(_destroy_plan_mixed_radix)(_q);
         case LIQUID_FFT_METHOD_RADER:       return FFT(_destroy_plan_rader)(_q);
         case LIQUID_FFT_METHOD_RADER2:      return FFT(_destroy_plan_rader2)(_q);
+        case LIQUID_FFT_METHOD_MANY:        return FFT(_destroy_plan_many)(_q);
         case LIQUID_FFT_METHOD_UNKNOWN:
         default:;
         }
@@ -212,9 +247,11 @@ int FFT(_print_plan)(FFT(plan) _q)
         switch (_q->method) {
         case LIQUID_FFT_METHOD_DFT:         printf("DFT\n");                break;
         case LIQUID_FFT_METHOD_RADIX2:      printf("Radix-2\n");            break;
+        case LIQUID_FFT_METHOD_RADIX4:      printf("Radix-4\n");            break;
         case LIQUID_FFT_METHOD_MIXED_RADIX: printf("Cooley-Tukey\n");       break;
         case LIQUID_FFT_METHOD_RADER:       printf("Rader (Type I)\n");     break;
         case LIQUID_FFT_METHOD_RADER2:      printf("Rader (Type II)\n");    break;
+        case LIQUID_FFT_METHOD_MANY:        printf("batch of %u\n", _q->data.many.howmany); break;
         case LIQUID_FFT_METHOD_UNKNOWN:
         default:
             return liquid_error(LIQUID_EIMODE,"fft_print_plan(), unknown/invalid fft method (%u)", _q->method);
@@ -262,6 +299,12 @@ int FFT(_print_plan_recursive)(FFT(plan)    _q,
         printf("Radix-2\n");
         break;
 
+    case LIQUID_FFT_METHOD_RADIX4:
+        printf("Radix-4 Stockham, %u radix-4 stage(s)%s\n",
+                _q->data.radix4.num_stages4,
+                _q->data.radix4.radix2 ? " + radix-2" : "");
+        break;
+
     case LIQUID_FFT_METHOD_MIXED_RADIX:
         // two internal transforms
         printf("Cooley-Tukey mixed radix, Q=%u, P=%u\n",
@@ -281,6 +324,16 @@ int FFT(_print_plan_recursive)(FFT(plan)    _q,
         FFT(_print_plan_recursive)(_q->data.rader2.fft, _level+1);
         break;
 
+    case LIQUID_FFT_METHOD_MANY:
+        printf("batch of %u transforms, ", _q->data.many.howmany);
+        if (_q->data.many.fft == NULL) {
+            printf("interleaved Radix-2\n");
+        } else {
+            printf("one at a time\n");
+            FFT(_print_plan_recursive)(_q->data.many.fft, _level+1);
+        }
+        break;
+
     case LIQUID_FFT_METHOD_UNKNOWN:     printf("(unknown)\n");      break;
     default:                            printf("(unknown)\n");      break;
     }
@@ -290,8 +343,12 @@ int FFT(_print_plan_recursive)(FFT(plan)    _q,
 // execute fft
 int FFT(_execute)(FFT(plan) _q)
 {
+    LIQUID_COUNTER_START(_q);
+
     // invoke internal function pointer
-    return _q->execute(_q);
+    int rc = _q->execute(_q);
+    LIQUID_COUNTER_STOP(_q, _q->nfft);
+    return rc;
 }
 
 // perform n-point FFT allocating plan internally
@@ -44,6 +44,10 @@ FFT(plan) FFT(_create_plan_dft)(unsigned int _nfft,
     // allocate plan and initialize all internal arrays to NULL
     FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
 
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "fftplan");
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct FFT(plan_s)));
+
     q->nfft      = _nfft;
     q->x         = _x;
     q->y         = _y;
@@ -116,6 +120,8 @@ int FFT(_destroy_plan_dft)(FFT(plan) _q)
         free(_q->data.dft.dotprod);
     }
 
+    LIQUID_COUNTER_UNREGISTER(_q);
+
     // free main object memory
     free(_q);
     return LIQUID_OK;
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_many.c : definitions for batches of equal-length transforms
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "liquid.internal.h"
+
+// number of transforms computed side by side when interleaving short
+// transforms across lanes; must be a multiple of the widest vector width
+#define FFT_MANY_LANES      (8)
+
+// range of radix-2 transform sizes computed by interleaving transforms;
+// smaller sizes are faster with the dedicated codelets, and larger sizes
+// are faster with the vectorized radix-4 transform
+#define FFT_MANY_MIN_NFFT   (16)
+#define FFT_MANY_MAX_NFFT   (16)
+
+// create plan for a batch of complex one-dimensional transforms
+//  _nfft       :   transform size
+//  _howmany    :   number of transforms
+//  _x          :   input array
+//  _istride    :   distance between input samples within a transform
+//  _idist      :   distance between first samples of consecutive inputs
+//  _y          :   output array
+//  _ostride    :   distance between output samples within a transform
+//  _odist      :   distance between first samples of consecutive outputs
+//  _dir        :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _flags      :   fft flags
+FFT(plan) FFT(_create_plan_many)(unsigned int _nfft,
+                                 unsigned int _howmany,
+                                 TC *         _x,
+                                 unsigned int _istride,
+                                 unsigned int _idist,
+                                 TC *         _y,
+                                 unsigned int _ostride,
+                                 unsigned int _odist,
+                                 int          _dir,
+                                 int          _flags)
+{
+    // validate input
+    if (_nfft == 0)
+        return liquid_error_config("fft_create_plan_many(), transform size must be greater than zero");
+    if (_howmany == 0)
+        return liquid_error_config("fft_create_plan_many(), number of transforms must be greater than zero");
+    if (_istride == 0 || _ostride == 0)
+        return liquid_error_config("fft_create_plan_many(), strides must be greater than zero");
+
+    // allocate plan and initialize all internal arrays to NULL
+    FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
+
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "fftplan");
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct FFT(plan_s)));
+
+    q->nfft      = _nfft;
+    q->x         = _x;
+    q->y         = _y;
+    q->flags     = _flags;
+    q->type      = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->direction = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->method    = LIQUID_FFT_METHOD_MANY;
+
+    q->execute   = FFT(_execute_many);
+
+    q->data.many.howmany   = _howmany;
+    q->data.many.istride   = _istride;
+    q->data.many.idist     = _idist;
+    q->data.many.ostride   = _ostride;
+    q->data.many.odist     = _odist;
+    q->data.many.fft       = NULL;
+    q->data.many.buf_x     = NULL;
+    q->data.many.buf_y     = NULL;
+    q->data.many.re        = NULL;
+    q->data.many.im        = NULL;
+    q->data.many.twiddle   = NULL;
+    q->data.many.index_rev = NULL;
+
+    unsigned int i;
+    if (_nfft >= FFT_MANY_MIN_NFFT && _nfft <= FFT_MANY_MAX_NFFT && fft_is_radix2(_nfft) && _howmany > 1) {
+        // short radix-2 transforms: compute FFT_MANY_LANES transforms at a
+        // time with samples of each transform interleaved across lanes so
+        // that every butterfly operates on full vectors
+        q->data.many.m = liquid_msb_index(_nfft) - 1;  // m = log2(nfft)
+        q->data.many.index_rev = (unsigned int *) malloc(_nfft*sizeof(unsigned int));
+        for (i=0; i<_nfft; i++)
+            q->data.many.index_rev[i] = fft_reverse_index(i,q->data.many.m);
+
+        // twiddle factors, stored as [real, imag] pairs
+        q->data.many.twiddle = (T *) malloc(_nfft*sizeof(T));
+        T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+        for (i=0; i<_nfft/2; i++) {
+            q->data.many.twiddle[2*i+0] = cosf(  2*M_PI*(T)i / (T)_nfft);
+            q->data.many.twiddle[2*i+1] = sinf(d*2*M_PI*(T)i / (T)_nfft);
+        }
+
+        // split real/imaginary working buffers, [size: _nfft x FFT_MANY_LANES]
+        q->data.many.re = (T *) liquid_aligned_alloc(64, _nfft*FFT_MANY_LANES*sizeof(T));
+        q->data.many.im = (T *) liquid_aligned_alloc(64, _nfft*FFT_MANY_LANES*sizeof(T));
+    } else {
+        // run transforms one at a time with a regular plan, operating on the
+        // user's buffers directly when they are contiguous and distinct
+        q->data.many.buf_x = (TC *) FFT_MALLOC(_nfft*sizeof(TC));
+        q->data.many.buf_y = (TC *) FFT_MALLOC(_nfft*sizeof(TC));
+        q->data.many.fft = FFT(_create_plan)(_nfft,
+                                             q->data.many.buf_x,
+                                             q->data.many.buf_y,
+                                             q->direction,
+                                             q->flags);
+    }
+    return q;
+}
+
+// destroy FFT plan
+int FFT(_destroy_plan_many)(FFT(plan) _q)
+{
+    if (_q->data.many.fft != NULL)
+        FFT(_destroy_plan)(_q->data.many.fft);
+
+    // free data specific to batched transforms
+    if (_q->data.many.buf_x != NULL) FFT_FREE(_q->data.many.buf_x);
+    if (_q->data.many.buf_y != NULL) FFT_FREE(_q->data.many.buf_y);
+    liquid_aligned_free(_q->data.many.re);
+    liquid_aligned_free(_q->data.many.im);
+    free(_q->data.many.twiddle);
+    free(_q->data.many.index_rev);
+
+    LIQUID_COUNTER_UNREGISTER(_q);
+
+    // free main object memory
+    free(_q);
+    return LIQUID_OK;
+}
+
+// radix-2 butterfly across all lanes; the pointers never overlap, which
+// lets the compiler operate on whole vectors
+static void FFT(_many_butterfly)(T * restrict _ar,
+                                 T * restrict _ai,
+                                 T * restrict _br,
+                                 T * restrict _bi,
+                                 T            _wr,
+                                 T            _wi)
+{
+    unsigned int l;
+    for (l=0; l<FFT_MANY_LANES; l++) {
+        T tr   = _br[l]*_wr - _bi[l]*_wi;
+        T ti   = _br[l]*_wi + _bi[l]*_wr;
+        _br[l] = _ar[l] - tr;
+        _bi[l] = _ai[l] - ti;
+        _ar[l] = _ar[l] + tr;
+        _ai[l] = _ai[l] + ti;
+    }
+}
+
+// run FFT_MANY_LANES interleaved radix-2 transforms in place on the split
+// real/imaginary buffers; sample k of lane l is stored at [k*FFT_MANY_LANES + l]
+static void FFT(_many_radix2_lanes)(FFT(plan) _q)
+{
+    unsigned int nfft = _q->nfft;
+    T * re = _q->data.many.re;
+    T * im = _q->data.many.im;
+    const T * tw = _q->data.many.twiddle;
+
+    unsigned int n1, n2, j, k;
+    unsigned int stride = nfft;
+    for (n1=1; n1<nfft; n1=n2) {
+        n2 = 2*n1;
+        stride >>= 1;
+        for (j=0; j<n1; j++) {
+            T wr = tw[2*j*stride+0];
+            T wi = tw[2*j*stride+1];
+            for (k=j; k<nfft; k+=n2) {
+                FFT(_many_butterfly)(re + (k   )*FFT_MANY_LANES,
+                                     im + (k   )*FFT_MANY_LANES,
+                                     re + (k+n1)*FFT_MANY_LANES,
+                                     im + (k+n1)*FFT_MANY_LANES,
+                                     wr, wi);
+            }
+        }
+    }
+}
+
+// execute batch of transforms
+int FFT(_execute_many)(FFT(plan) _q)
+{
+    unsigned int nfft    = _q->nfft;
+    unsigned int howmany = _q->data.many.howmany;
+    unsigned int istride = _q->data.many.istride;
+    unsigned int idist   = _q->data.many.idist;
+    unsigned int ostride = _q->data.many.ostride;
+    unsigned int odist   = _q->data.many.odist;
+    unsigned int t, k, l;
+
+    if (_q->data.many.fft == NULL) {
+        // interleaved transforms
+        T * re = _q->data.many.re;
+        T * im = _q->data.many.im;
+        const unsigned int * index_rev = _q->data.many.index_rev;
+        for (t=0; t<howmany; t+=FFT_MANY_LANES) {
+            unsigned int lanes = howmany - t < FFT_MANY_LANES ? howmany - t : FFT_MANY_LANES;
+
+            // load inputs in bit-reversed order, zero-padding unused lanes
+            if (lanes < FFT_MANY_LANES) {
+                memset(re, 0, nfft*FFT_MANY_LANES*sizeof(T));
+                memset(im, 0, nfft*FFT_MANY_LANES*sizeof(T));
+            }
+            for (l=0; l<lanes; l++) {
+                const TC * x = _q->x + (t+l)*idist;
+                for (k=0; k<nfft; k++) {
+                    TC v = x[index_rev[k]*istride];
+                    re[k*FFT_MANY_LANES + l] = crealf(v);
+                    im[k*FFT_MANY_LANES + l] = cimagf(v);
+                }
+            }
+
+            FFT(_many_radix2_lanes)(_q);
+
+            // store outputs
+            for (l=0; l<lanes; l++) {
+                TC * y = _q->y + (t+l)*odist;
+                for (k=0; k<nfft; k++)
+                    y[k*ostride] = re[k*FFT_MANY_LANES + l] + _Complex_I*im[k*FFT_MANY_LANES + l];
+            }
+        }
+        return LIQUID_OK;
+    }
+
+    // one transform at a time
+    FFT(plan) fft = _q->data.many.fft;
+    int direct = istride == 1 && ostride == 1 && _q->x != _q->y;
+    for (t=0; t<howmany; t++) {
+        TC * x = _q->x + t*idist;
+        TC * y = _q->y + t*odist;
+        if (direct) {
+            // point sub-transform at user buffers
+            fft->x = x;
+            fft->y = y;
+            FFT(_execute)(fft);
+        } else {
+            for (k=0; k<nfft; k++)
+                _q->data.many.buf_x[k] = x[k*istride];
+            fft->x = _q->data.many.buf_x;
+            fft->y = _q->data.many.buf_y;
+            FFT(_execute)(fft);
+            for (k=0; k<nfft; k++)
+                y[k*ostride] = _q->data.many.buf_y[k];
+        }
+    }
+    return LIQUID_OK;
+}
+
@@ -48,6 +48,10 @@ FFT(plan) FFT(_create_plan_mixed_radix)(unsigned int _nfft,
     // allocate plan and initialize all internal arrays to NULL
     FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
 
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "fftplan");
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct FFT(plan_s)));
+
     q->nfft      = _nfft;
     q->x         = _x;
     q->y         = _y;
@@ -117,6 +121,8 @@ int FFT(_destroy_plan_mixed_radix)(FFT(plan) _q)
     free(_q->data.mixedradix.x);
     free(_q->data.mixedradix.twiddle);
 
+    LIQUID_COUNTER_UNREGISTER(_q);
+
     // free main object memory
     free(_q);
     return LIQUID_OK;
@@ -227,6 +233,10 @@ unsigned int FFT(_estimate_mixed_radix)(unsigned int _nfft)
         // return 2^num_factors_2
         return 1 << num_factors_2;
 #else
+        // use vectorized radix-4 sub-transform for large power-of-two factor
+        if (num_factors_2 >= 6 && num_factors_2 < num_factors)
+            return 1 << num_factors_2;
+
         // use codelets
         if      ( (_nfft%16)==0 ) return 16;
         if      ( (_nfft% 8)==0 ) return  8;
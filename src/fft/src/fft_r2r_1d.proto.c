@@ -67,12 +67,17 @@ FFT(plan) FFT(_create_plan_r2r_1d)(unsigned int _nfft,
         return liquid_error_config("fft_create_plan_r2r_1d(), invalid type, %d", q->type);
     }
 
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "fftplan");
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct FFT(plan_s)));
     return q;
 }
 
 // destroy real-to-real transform plan
 int FFT(_destroy_plan_r2r_1d)(FFT(plan) _q)
 {
+    LIQUID_COUNTER_UNREGISTER(_q);
+
     // free main object memory
     free(_q);
     return LIQUID_OK;
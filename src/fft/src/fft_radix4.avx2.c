@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// radix-4 Stockham FFT stages (AVX2)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_AVX2
+
+// include proper SIMD extensions for x86 AVX2
+#include <immintrin.h>
+
+// multiply four pairs of complex values
+static inline __m256 __attribute__((target("avx2")))
+fft_cmul_avx2(__m256 _a, __m256 _b)
+{
+    __m256 br = _mm256_moveldup_ps(_b);         // { b.re, b.re, ... }
+    __m256 bi = _mm256_movehdup_ps(_b);         // { b.im, b.im, ... }
+    __m256 as = _mm256_permute_ps(_a, 0xb1);    // { a.im, a.re, ... }
+    return _mm256_addsub_ps(_mm256_mul_ps(_a, br), _mm256_mul_ps(as, bi));
+}
+
+// radix-4 butterfly with twiddles applied to outputs 1, 2, and 3
+static inline void __attribute__((target("avx2")))
+fft_butterfly4_avx2(__m256   _a,
+                    __m256   _b,
+                    __m256   _c,
+                    __m256   _e,
+                    __m256   _w1,
+                    __m256   _w2,
+                    __m256   _w3,
+                    __m256   _jmask,
+                    __m256 * _y)
+{
+    __m256 apc  = _mm256_add_ps(_a, _c);
+    __m256 amc  = _mm256_sub_ps(_a, _c);
+    __m256 bpe  = _mm256_add_ps(_b, _e);
+    __m256 jbme = _mm256_xor_ps(_mm256_permute_ps(_mm256_sub_ps(_b, _e), 0xb1), _jmask);
+    _y[0] = _mm256_add_ps(apc, bpe);
+    _y[1] = fft_cmul_avx2(_mm256_sub_ps(amc, jbme), _w1);
+    _y[2] = fft_cmul_avx2(_mm256_sub_ps(apc, bpe),  _w2);
+    _y[3] = fft_cmul_avx2(_mm256_add_ps(amc, jbme), _w3);
+}
+
+// radix-4 stage, four complex values at a time
+void __attribute__((target("avx2")))
+fft_radix4_stage_avx2(unsigned int    _n,
+                      unsigned int    _s,
+                      float complex * _x,
+                      float complex * _y,
+                      float complex * _tw,
+                      int             _dir)
+{
+    unsigned int m = _n / 4;
+    unsigned int p, q;
+
+    // multiplication by j (forward) or -j (reverse) after swapping re/im
+    __m256 jmask = _dir == LIQUID_FFT_FORWARD ?
+        _mm256_setr_ps(-0.0f, 0.0f,-0.0f, 0.0f,-0.0f, 0.0f,-0.0f, 0.0f) :
+        _mm256_setr_ps( 0.0f,-0.0f, 0.0f,-0.0f, 0.0f,-0.0f, 0.0f,-0.0f);
+    __m256 y[4];
+
+    if (_s >= 4) {
+        // vectorize across stride
+        for (p=0; p<m; p++) {
+            __m256 w1 = _mm256_castpd_ps(_mm256_broadcast_sd((double*)&_tw[      p]));
+            __m256 w2 = _mm256_castpd_ps(_mm256_broadcast_sd((double*)&_tw[  m + p]));
+            __m256 w3 = _mm256_castpd_ps(_mm256_broadcast_sd((double*)&_tw[2*m + p]));
+            for (q=0; q<_s; q+=4) {
+                fft_butterfly4_avx2(_mm256_loadu_ps((float*)&_x[q + _s*(p      )]),
+                                    _mm256_loadu_ps((float*)&_x[q + _s*(p +   m)]),
+                                    _mm256_loadu_ps((float*)&_x[q + _s*(p + 2*m)]),
+                                    _mm256_loadu_ps((float*)&_x[q + _s*(p + 3*m)]),
+                                    w1, w2, w3, jmask, y);
+                _mm256_storeu_ps((float*)&_y[q + _s*(4*p + 0)], y[0]);
+                _mm256_storeu_ps((float*)&_y[q + _s*(4*p + 1)], y[1]);
+                _mm256_storeu_ps((float*)&_y[q + _s*(4*p + 2)], y[2]);
+                _mm256_storeu_ps((float*)&_y[q + _s*(4*p + 3)], y[3]);
+            }
+        }
+    } else if (_s == 1 && (m % 4) == 0) {
+        // vectorize across butterflies, transposing outputs
+        for (p=0; p<m; p+=4) {
+            fft_butterfly4_avx2(_mm256_loadu_ps((float*)&_x[p      ]),
+                                _mm256_loadu_ps((float*)&_x[p +   m]),
+                                _mm256_loadu_ps((float*)&_x[p + 2*m]),
+                                _mm256_loadu_ps((float*)&_x[p + 3*m]),
+                                _mm256_loadu_ps((float*)&_tw[      p]),
+                                _mm256_loadu_ps((float*)&_tw[  m + p]),
+                                _mm256_loadu_ps((float*)&_tw[2*m + p]),
+                                jmask, y);
+            __m256d t0 = _mm256_unpacklo_pd(_mm256_castps_pd(y[0]), _mm256_castps_pd(y[1]));
+            __m256d t1 = _mm256_unpackhi_pd(_mm256_castps_pd(y[0]), _mm256_castps_pd(y[1]));
+            __m256d t2 = _mm256_unpacklo_pd(_mm256_castps_pd(y[2]), _mm256_castps_pd(y[3]));
+            __m256d t3 = _mm256_unpackhi_pd(_mm256_castps_pd(y[2]), _mm256_castps_pd(y[3]));
+            _mm256_storeu_pd((double*)&_y[4*p +  0], _mm256_permute2f128_pd(t0, t2, 0x20));
+            _mm256_storeu_pd((double*)&_y[4*p +  4], _mm256_permute2f128_pd(t1, t3, 0x20));
+            _mm256_storeu_pd((double*)&_y[4*p +  8], _mm256_permute2f128_pd(t0, t2, 0x31));
+            _mm256_storeu_pd((double*)&_y[4*p + 12], _mm256_permute2f128_pd(t1, t3, 0x31));
+        }
+    } else {
+        // short transforms
+        fft_radix4_stage_port(_n, _s, _x, _y, _tw, _dir);
+    }
+}
+
+// final radix-2 stage, four complex values at a time
+void __attribute__((target("avx2")))
+fft_radix2_stage_avx2(unsigned int    _s,
+                      float complex * _x,
+                      float complex * _y)
+{
+    // t = 4*(floor(_s/4))
+    unsigned int t = (_s >> 2) << 2;
+    unsigned int q;
+    for (q=0; q<t; q+=4) {
+        __m256 a = _mm256_loadu_ps((float*)&_x[q     ]);
+        __m256 b = _mm256_loadu_ps((float*)&_x[q + _s]);
+        _mm256_storeu_ps((float*)&_y[q     ], _mm256_add_ps(a, b));
+        _mm256_storeu_ps((float*)&_y[q + _s], _mm256_sub_ps(a, b));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    for ( ; q<_s; q++) {
+        float complex a = _x[q];
+        float complex b = _x[q + _s];
+        _y[q     ] = a + b;
+        _y[q + _s] = a - b;
+    }
+}
+
+// build guard
+#else
+
+// invalidated
+void fft_radix4_stage_avx2(unsigned int    _n,
+                           unsigned int    _s,
+                           float complex * _x,
+                           float complex * _y,
+                           float complex * _tw,
+                           int             _dir)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    fft_radix4_stage_port(_n, _s, _x, _y, _tw, _dir);
+}
+
+void fft_radix2_stage_avx2(unsigned int    _s,
+                           float complex * _x,
+                           float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    fft_radix2_stage_port(_s, _x, _y);
+}
+
+// build guard
+#endif
+
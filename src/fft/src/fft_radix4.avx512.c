@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// radix-4 Stockham FFT stages (AVX512)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_AVX512
+
+// include proper SIMD extensions for x86 AVX512
+#include <immintrin.h>
+
+// multiply eight pairs of complex values
+static inline __m512 __attribute__((target("avx512f")))
+fft_cmul_avx512(__m512 _a, __m512 _b)
+{
+    __m512 br = _mm512_moveldup_ps(_b);         // { b.re, b.re, ... }
+    __m512 bi = _mm512_movehdup_ps(_b);         // { b.im, b.im, ... }
+    __m512 as = _mm512_permute_ps(_a, 0xb1);    // { a.im, a.re, ... }
+    return _mm512_fmaddsub_ps(_a, br, _mm512_mul_ps(as, bi));
+}
+
+// radix-4 butterfly with twiddles applied to outputs 1, 2, and 3
+static inline void __attribute__((target("avx512f")))
+fft_butterfly4_avx512(__m512   _a,
+                      __m512   _b,
+                      __m512   _c,
+                      __m512   _e,
+                      __m512   _w1,
+                      __m512   _w2,
+                      __m512   _w3,
+                      __m512i  _jmask,
+                      __m512 * _y)
+{
+    __m512 apc  = _mm512_add_ps(_a, _c);
+    __m512 amc  = _mm512_sub_ps(_a, _c);
+    __m512 bpe  = _mm512_add_ps(_b, _e);
+    __m512 bme  = _mm512_permute_ps(_mm512_sub_ps(_b, _e), 0xb1);
+    __m512 jbme = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(bme), _jmask));
+    _y[0] = _mm512_add_ps(apc, bpe);
+    _y[1] = fft_cmul_avx512(_mm512_sub_ps(amc, jbme), _w1);
+    _y[2] = fft_cmul_avx512(_mm512_sub_ps(apc, bpe),  _w2);
+    _y[3] = fft_cmul_avx512(_mm512_add_ps(amc, jbme), _w3);
+}
+
+// store each half of register to separate locations
+static inline void __attribute__((target("avx512f")))
+fft_store_halves_avx512(float complex * _y0,
+                        float complex * _y1,
+                        __m512          _v)
+{
+    __m512d v = _mm512_castps_pd(_v);
+    _mm256_storeu_pd((double*)_y0, _mm512_castpd512_pd256(v));
+    _mm256_storeu_pd((double*)_y1, _mm512_extractf64x4_pd(v, 1));
+}
+
+// load single complex value into all eight slots of register
+static inline __m512 __attribute__((target("avx512f")))
+fft_broadcast_avx512(float complex * _v)
+{
+    __m128 v = _mm_loadl_pi(_mm_setzero_ps(), (__m64*)_v);
+    return _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_castps_pd(v)));
+}
+
+// radix-4 stage, eight complex values at a time
+void __attribute__((target("avx512f")))
+fft_radix4_stage_avx512(unsigned int    _n,
+                        unsigned int    _s,
+                        float complex * _x,
+                        float complex * _y,
+                        float complex * _tw,
+                        int             _dir)
+{
+    unsigned int m = _n / 4;
+    unsigned int p, q;
+
+    // multiplication by j (forward) or -j (reverse) after swapping re/im
+    __m512i jmask = _dir == LIQUID_FFT_FORWARD ?
+        _mm512_set1_epi64((long long)0x0000000080000000ULL) :
+        _mm512_set1_epi64((long long)0x8000000000000000ULL);
+    __m512 y[4];
+
+    if (_s >= 8) {
+        // vectorize across stride
+        for (p=0; p<m; p++) {
+            __m512 w1 = fft_broadcast_avx512(&_tw[      p]);
+            __m512 w2 = fft_broadcast_avx512(&_tw[  m + p]);
+            __m512 w3 = fft_broadcast_avx512(&_tw[2*m + p]);
+            for (q=0; q<_s; q+=8) {
+                fft_butterfly4_avx512(_mm512_loadu_ps((float*)&_x[q + _s*(p      )]),
+                                      _mm512_loadu_ps((float*)&_x[q + _s*(p +   m)]),
+                                      _mm512_loadu_ps((float*)&_x[q + _s*(p + 2*m)]),
+                                      _mm512_loadu_ps((float*)&_x[q + _s*(p + 3*m)]),
+                                      w1, w2, w3, jmask, y);
+                _mm512_storeu_ps((float*)&_y[q + _s*(4*p + 0)], y[0]);
+                _mm512_storeu_ps((float*)&_y[q + _s*(4*p + 1)], y[1]);
+                _mm512_storeu_ps((float*)&_y[q + _s*(4*p + 2)], y[2]);
+                _mm512_storeu_ps((float*)&_y[q + _s*(4*p + 3)], y[3]);
+            }
+        }
+    } else if (_s == 4 && (m % 2) == 0) {
+        // two butterflies of four values each: { p x4, p+1 x4 }
+        const __m512i idx = _mm512_set_epi64(1,1,1,1,0,0,0,0);
+        for (p=0; p<m; p+=2) {
+            __m512d t1 = _mm512_castpd128_pd512(_mm_loadu_pd((double*)&_tw[      p]));
+            __m512d t2 = _mm512_castpd128_pd512(_mm_loadu_pd((double*)&_tw[  m + p]));
+            __m512d t3 = _mm512_castpd128_pd512(_mm_loadu_pd((double*)&_tw[2*m + p]));
+            fft_butterfly4_avx512(_mm512_loadu_ps((float*)&_x[4*(p      )]),
+                                  _mm512_loadu_ps((float*)&_x[4*(p +   m)]),
+                                  _mm512_loadu_ps((float*)&_x[4*(p + 2*m)]),
+                                  _mm512_loadu_ps((float*)&_x[4*(p + 3*m)]),
+                                  _mm512_castpd_ps(_mm512_permutexvar_pd(idx, t1)),
+                                  _mm512_castpd_ps(_mm512_permutexvar_pd(idx, t2)),
+                                  _mm512_castpd_ps(_mm512_permutexvar_pd(idx, t3)),
+                                  jmask, y);
+            fft_store_halves_avx512(&_y[4*(4*p + 0)], &_y[4*(4*p + 4)], y[0]);
+            fft_store_halves_avx512(&_y[4*(4*p + 1)], &_y[4*(4*p + 5)], y[1]);
+            fft_store_halves_avx512(&_y[4*(4*p + 2)], &_y[4*(4*p + 6)], y[2]);
+            fft_store_halves_avx512(&_y[4*(4*p + 3)], &_y[4*(4*p + 7)], y[3]);
+        }
+    } else if (_s == 1 && (m % 8) == 0) {
+        // vectorize across butterflies, transposing outputs
+        const __m512i ilo = _mm512_set_epi64(11, 3,10, 2, 9, 1, 8, 0);
+        const __m512i ihi = _mm512_set_epi64(15, 7,14, 6,13, 5,12, 4);
+        const __m512i jlo = _mm512_set_epi64(11,10, 3, 2, 9, 8, 1, 0);
+        const __m512i jhi = _mm512_set_epi64(15,14, 7, 6,13,12, 5, 4);
+        for (p=0; p<m; p+=8) {
+            fft_butterfly4_avx512(_mm512_loadu_ps((float*)&_x[p      ]),
+                                  _mm512_loadu_ps((float*)&_x[p +   m]),
+                                  _mm512_loadu_ps((float*)&_x[p + 2*m]),
+                                  _mm512_loadu_ps((float*)&_x[p + 3*m]),
+                                  _mm512_loadu_ps((float*)&_tw[      p]),
+                                  _mm512_loadu_ps((float*)&_tw[  m + p]),
+                                  _mm512_loadu_ps((float*)&_tw[2*m + p]),
+                                  jmask, y);
+            // interleave outputs 0,1 and 2,3, then pairs of each
+            __m512d y0 = _mm512_castps_pd(y[0]);
+            __m512d y1 = _mm512_castps_pd(y[1]);
+            __m512d y2 = _mm512_castps_pd(y[2]);
+            __m512d y3 = _mm512_castps_pd(y[3]);
+            __m512d a  = _mm512_permutex2var_pd(y0, ilo, y1);
+            __m512d b  = _mm512_permutex2var_pd(y0, ihi, y1);
+            __m512d c  = _mm512_permutex2var_pd(y2, ilo, y3);
+            __m512d d  = _mm512_permutex2var_pd(y2, ihi, y3);
+            _mm512_storeu_pd((double*)&_y[4*p +  0], _mm512_permutex2var_pd(a, jlo, c));
+            _mm512_storeu_pd((double*)&_y[4*p +  8], _mm512_permutex2var_pd(a, jhi, c));
+            _mm512_storeu_pd((double*)&_y[4*p + 16], _mm512_permutex2var_pd(b, jlo, d));
+            _mm512_storeu_pd((double*)&_y[4*p + 24], _mm512_permutex2var_pd(b, jhi, d));
+        }
+    } else {
+        // short transforms
+        fft_radix4_stage_port(_n, _s, _x, _y, _tw, _dir);
+    }
+}
+
+// final radix-2 stage, eight complex values at a time
+void __attribute__((target("avx512f")))
+fft_radix2_stage_avx512(unsigned int    _s,
+                        float complex * _x,
+                        float complex * _y)
+{
+    // t = 8*(floor(_s/8))
+    unsigned int t = (_s >> 3) << 3;
+    unsigned int q;
+    for (q=0; q<t; q+=8) {
+        __m512 a = _mm512_loadu_ps((float*)&_x[q     ]);
+        __m512 b = _mm512_loadu_ps((float*)&_x[q + _s]);
+        _mm512_storeu_ps((float*)&_y[q     ], _mm512_add_ps(a, b));
+        _mm512_storeu_ps((float*)&_y[q + _s], _mm512_sub_ps(a, b));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    for ( ; q<_s; q++) {
+        float complex a = _x[q];
+        float complex b = _x[q + _s];
+        _y[q     ] = a + b;
+        _y[q + _s] = a - b;
+    }
+}
+
+// build guard
+#else
+
+// invalidated
+void fft_radix4_stage_avx512(unsigned int    _n,
+                             unsigned int    _s,
+                             float complex * _x,
+                             float complex * _y,
+                             float complex * _tw,
+                             int             _dir)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    fft_radix4_stage_port(_n, _s, _x, _y, _tw, _dir);
+}
+
+void fft_radix2_stage_avx512(unsigned int    _s,
+                             float complex * _x,
+                             float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    fft_radix2_stage_port(_s, _x, _y);
+}
+
+// build guard
+#endif
+
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// radix-4 Stockham FFT stages (ARM Neon)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_NEON
+
+// include proper SIMD extensions for ARM Neon
+#include <arm_neon.h>
+
+// multiply two pairs of complex values
+static inline float32x4_t fft_cmul_neon(float32x4_t _a, float32x4_t _b)
+{
+    const float sign[4] = {-1.0f, 1.0f, -1.0f, 1.0f};
+    float32x4x2_t b = vtrnq_f32(_b, _b);    // { b.re, b.re, ... }, { b.im, b.im, ... }
+    float32x4_t   t = vmulq_f32(vmulq_f32(vrev64q_f32(_a), b.val[1]), vld1q_f32(sign));
+    return vmlaq_f32(t, _a, b.val[0]);
+}
+
+// radix-4 butterfly with twiddles applied to outputs 1, 2, and 3
+static inline void fft_butterfly4_neon(float32x4_t   _a,
+                                       float32x4_t   _b,
+                                       float32x4_t   _c,
+                                       float32x4_t   _e,
+                                       float32x4_t   _w1,
+                                       float32x4_t   _w2,
+                                       float32x4_t   _w3,
+                                       float32x4_t   _jsign,
+                                       float32x4_t * _y)
+{
+    float32x4_t apc  = vaddq_f32(_a, _c);
+    float32x4_t amc  = vsubq_f32(_a, _c);
+    float32x4_t bpe  = vaddq_f32(_b, _e);
+    float32x4_t jbme = vmulq_f32(vrev64q_f32(vsubq_f32(_b, _e)), _jsign);
+    _y[0] = vaddq_f32(apc, bpe);
+    _y[1] = fft_cmul_neon(vsubq_f32(amc, jbme), _w1);
+    _y[2] = fft_cmul_neon(vsubq_f32(apc, bpe),  _w2);
+    _y[3] = fft_cmul_neon(vaddq_f32(amc, jbme), _w3);
+}
+
+// load single complex value into both halves of register
+static inline float32x4_t fft_broadcast_neon(float complex * _v)
+{
+    float32x2_t v = vld1_f32((float*)_v);
+    return vcombine_f32(v, v);
+}
+
+// radix-4 stage, two complex values at a time
+void fft_radix4_stage_neon(unsigned int    _n,
+                           unsigned int    _s,
+                           float complex * _x,
+                           float complex * _y,
+                           float complex * _tw,
+                           int             _dir)
+{
+    unsigned int m = _n / 4;
+    unsigned int p, q;
+
+    // multiplication by j (forward) or -j (reverse) after swapping re/im
+    const float jf[4] = {-1.0f, 1.0f,-1.0f, 1.0f};
+    const float jr[4] = { 1.0f,-1.0f, 1.0f,-1.0f};
+    float32x4_t jsign = vld1q_f32(_dir == LIQUID_FFT_FORWARD ? jf : jr);
+    float32x4_t y[4];
+
+    if (_s >= 2) {
+        // vectorize across stride
+        for (p=0; p<m; p++) {
+            float32x4_t w1 = fft_broadcast_neon(&_tw[      p]);
+            float32x4_t w2 = fft_broadcast_neon(&_tw[  m + p]);
+            float32x4_t w3 = fft_broadcast_neon(&_tw[2*m + p]);
+            for (q=0; q<_s; q+=2) {
+                fft_butterfly4_neon(vld1q_f32((float*)&_x[q + _s*(p      )]),
+                                    vld1q_f32((float*)&_x[q + _s*(p +   m)]),
+                                    vld1q_f32((float*)&_x[q + _s*(p + 2*m)]),
+                                    vld1q_f32((float*)&_x[q + _s*(p + 3*m)]),
+                                    w1, w2, w3, jsign, y);
+                vst1q_f32((float*)&_y[q + _s*(4*p + 0)], y[0]);
+                vst1q_f32((float*)&_y[q + _s*(4*p + 1)], y[1]);
+                vst1q_f32((float*)&_y[q + _s*(4*p + 2)], y[2]);
+                vst1q_f32((float*)&_y[q + _s*(4*p + 3)], y[3]);
+            }
+        }
+    } else if ((m % 2) == 0) {
+        // vectorize across butterflies, transposing outputs
+        for (p=0; p<m; p+=2) {
+            fft_butterfly4_neon(vld1q_f32((float*)&_x[p      ]),
+                                vld1q_f32((float*)&_x[p +   m]),
+                                vld1q_f32((float*)&_x[p + 2*m]),
+                                vld1q_f32((float*)&_x[p + 3*m]),
+                                vld1q_f32((float*)&_tw[      p]),
+                                vld1q_f32((float*)&_tw[  m + p]),
+                                vld1q_f32((float*)&_tw[2*m + p]),
+                                jsign, y);
+            vst1q_f32((float*)&_y[4*p + 0], vcombine_f32(vget_low_f32 (y[0]), vget_low_f32 (y[1])));
+            vst1q_f32((float*)&_y[4*p + 2], vcombine_f32(vget_low_f32 (y[2]), vget_low_f32 (y[3])));
+            vst1q_f32((float*)&_y[4*p + 4], vcombine_f32(vget_high_f32(y[0]), vget_high_f32(y[1])));
+            vst1q_f32((float*)&_y[4*p + 6], vcombine_f32(vget_high_f32(y[2]), vget_high_f32(y[3])));
+        }
+    } else {
+        // short transforms
+        fft_radix4_stage_port(_n, _s, _x, _y, _tw, _dir);
+    }
+}
+
+// final radix-2 stage, two complex values at a time
+void fft_radix2_stage_neon(unsigned int    _s,
+                           float complex * _x,
+                           float complex * _y)
+{
+    // t = 2*(floor(_s/2))
+    unsigned int t = (_s >> 1) << 1;
+    unsigned int q;
+    for (q=0; q<t; q+=2) {
+        float32x4_t a = vld1q_f32((float*)&_x[q     ]);
+        float32x4_t b = vld1q_f32((float*)&_x[q + _s]);
+        vst1q_f32((float*)&_y[q     ], vaddq_f32(a, b));
+        vst1q_f32((float*)&_y[q + _s], vsubq_f32(a, b));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    for ( ; q<_s; q++) {
+        float complex a = _x[q];
+        float complex b = _x[q + _s];
+        _y[q     ] = a + b;
+        _y[q + _s] = a - b;
+    }
+}
+
+// build guard
+#else
+
+// invalidated
+void fft_radix4_stage_neon(unsigned int    _n,
+                           unsigned int    _s,
+                           float complex * _x,
+                           float complex * _y,
+                           float complex * _tw,
+                           int             _dir)
+{
+    liquid_error(LIQUID_EICONFIG,"neon extensions not available");
+    fft_radix4_stage_port(_n, _s, _x, _y, _tw, _dir);
+}
+
+void fft_radix2_stage_neon(unsigned int    _s,
+                           float complex * _x,
+                           float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"neon extensions not available");
+    fft_radix2_stage_port(_s, _x, _y);
+}
+
+// build guard
+#endif
+
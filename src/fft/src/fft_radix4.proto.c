@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_radix4.c : definitions for transforms of the form 2^m using the
+//                Stockham autosort algorithm with radix-4 stages
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdatomic.h>
+#include "liquid.internal.h"
+
+// Each radix-4 stage with sub-transform length n and stride s reads
+// x[q + s*(p + k*n/4)] and writes y[q + s*(4*p + k)] for k in [0,3],
+// p < n/4 and q < s, with n*s = nfft. A final radix-2 stage is added when
+// log2(nfft) is odd. Stages ping-pong between the output and an internal
+// buffer so no bit reversal is necessary, and the stride s gives a unit
+// stride inner loop for vector kernels.
+
+// kernels for a particular extension
+struct FFT(_kernels_s) {
+    FFT(_radix4_stage_t) * stage4;  // radix-4 stage
+    FFT(_radix2_stage_t) * stage2;  // final radix-2 stage
+};
+
+// constant kernel tables for each extension
+static const struct FFT(_kernels_s) FFT(_kernels_port)   = { FFT(_radix4_stage_port),   FFT(_radix2_stage_port)   };
+static const struct FFT(_kernels_s) FFT(_kernels_neon)   = { FFT(_radix4_stage_neon),   FFT(_radix2_stage_neon)   };
+static const struct FFT(_kernels_s) FFT(_kernels_sse2)   = { FFT(_radix4_stage_sse2),   FFT(_radix2_stage_sse2)   };
+static const struct FFT(_kernels_s) FFT(_kernels_avx2)   = { FFT(_radix4_stage_avx2),   FFT(_radix2_stage_avx2)   };
+static const struct FFT(_kernels_s) FFT(_kernels_avx512) = { FFT(_radix4_stage_avx512), FFT(_radix2_stage_avx512) };
+
+// Kernel table shared by all plans, selected automatically on first use.
+// Switching tables is a single atomic store so a plan created concurrently
+// always captures a consistent pair of kernels.
+static _Atomic(const struct FFT(_kernels_s) *) FFT(_kernels) = NULL;
+
+// find best available runtime execution method
+static liquid_runtime_t FFT(_runtime_best)(void);
+
+// get kernel table, selecting best available on first use
+static const struct FFT(_kernels_s) * FFT(_get_kernels)(void);
+
+// create FFT plan for radix-4 Stockham transform
+//  _nfft   :   FFT size (power of two, at least 4)
+//  _x      :   input array [size: _nfft x 1]
+//  _y      :   output array [size: _nfft x 1]
+//  _dir    :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _method :   fft method
+FFT(plan) FFT(_create_plan_radix4)(unsigned int _nfft,
+                                   TC *         _x,
+                                   TC *         _y,
+                                   int          _dir,
+                                   int          _flags)
+{
+    if (_nfft < 4 || !fft_is_radix2(_nfft))
+        return liquid_error_config("fft_create_plan_radix4(), _nfft=%u must be a power of two greater than 2", _nfft);
+
+    // allocate plan and initialize all internal arrays to NULL
+    FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
+
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "fftplan");
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct FFT(plan_s)));
+
+    q->nfft      = _nfft;
+    q->x         = _x;
+    q->y         = _y;
+    q->flags     = _flags;
+    q->type      = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->direction = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->method    = LIQUID_FFT_METHOD_RADIX4;
+
+    q->execute   = FFT(_execute_radix4);
+
+    // number of stages
+    unsigned int m = liquid_msb_index(_nfft) - 1;   // m = log2(nfft)
+    q->data.radix4.num_stages4 = m / 2;
+    q->data.radix4.radix2      = m % 2;
+
+    // twiddle factors for each radix-4 stage, stored as three consecutive
+    // arrays { w^p, w^2p, w^3p } for p < n/4 where w = exp(-j*2*pi/n)
+    unsigned int num_twiddles = 0;
+    unsigned int n, p, k;
+    for (n=_nfft; n>=4; n/=4)
+        num_twiddles += 3*(n/4);
+    q->data.radix4.twiddle = (TC *) liquid_aligned_alloc(64, num_twiddles*sizeof(TC));
+    T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+    TC * tw = q->data.radix4.twiddle;
+    for (n=_nfft; n>=4; n/=4) {
+        for (k=1; k<=3; k++) {
+            for (p=0; p<n/4; p++)
+                tw[(k-1)*(n/4) + p] = cexpf(_Complex_I*d*2*M_PI*(T)(k*p) / (T)n);
+        }
+        tw += 3*(n/4);
+    }
+
+    // internal buffer for intermediate stages
+    q->data.radix4.t = (TC *) liquid_aligned_alloc(64, _nfft*sizeof(TC));
+
+    // assign kernels
+    const struct FFT(_kernels_s) * kernels = FFT(_get_kernels)();
+    q->data.radix4.stage4 = kernels->stage4;
+    q->data.radix4.stage2 = kernels->stage2;
+    return q;
+}
+
+// destroy FFT plan
+int FFT(_destroy_plan_radix4)(FFT(plan) _q)
+{
+    // free data specific to radix-4 transforms
+    liquid_aligned_free(_q->data.radix4.twiddle);
+    liquid_aligned_free(_q->data.radix4.t);
+
+    LIQUID_COUNTER_UNREGISTER(_q);
+
+    // free main object memory
+    free(_q);
+    return LIQUID_OK;
+}
+
+// execute radix-4 FFT
+int FFT(_execute_radix4)(FFT(plan) _q)
+{
+    unsigned int num_stages = _q->data.radix4.num_stages4 + _q->data.radix4.radix2;
+    unsigned int n = _q->nfft;
+    unsigned int s = 1;
+    unsigned int i;
+    TC * tw  = _q->data.radix4.twiddle;
+    TC * src = _q->x;
+
+    // in-place transform with an odd number of stages: first stage would
+    // overwrite its own input, so start from a copy in the internal buffer
+    if (_q->x == _q->y && (num_stages % 2)) {
+        memmove(_q->data.radix4.t, _q->x, _q->nfft*sizeof(TC));
+        src = _q->data.radix4.t;
+    }
+
+    for (i=0; i<_q->data.radix4.num_stages4; i++) {
+        // alternate destination so that last stage writes to output
+        TC * dst = ((num_stages - 1 - i) % 2) ? _q->data.radix4.t : _q->y;
+        _q->data.radix4.stage4(n, s, src, dst, tw, _q->direction);
+        tw  += 3*(n/4);
+        src  = dst;
+        n   /= 4;
+        s   *= 4;
+    }
+
+    // final radix-2 stage (output array)
+    if (_q->data.radix4.radix2)
+        _q->data.radix4.stage2(s, src, _q->y);
+    return LIQUID_OK;
+}
+
+// radix-4 stage (portable)
+//  _n      :   sub-transform length
+//  _s      :   stride, _n*_s = nfft
+//  _x      :   stage input
+//  _y      :   stage output
+//  _tw     :   twiddle factors for this stage, [size: 3*_n/4 x 1]
+//  _dir    :   fft direction
+void FFT(_radix4_stage_port)(unsigned int _n,
+                             unsigned int _s,
+                             TC *         _x,
+                             TC *         _y,
+                             TC *         _tw,
+                             int          _dir)
+{
+    unsigned int m = _n / 4;
+    unsigned int p, q;
+    for (p=0; p<m; p++) {
+        TC w1 = _tw[      p];
+        TC w2 = _tw[  m + p];
+        TC w3 = _tw[2*m + p];
+        for (q=0; q<_s; q++) {
+            TC a = _x[q + _s*(p      )];
+            TC b = _x[q + _s*(p +   m)];
+            TC c = _x[q + _s*(p + 2*m)];
+            TC e = _x[q + _s*(p + 3*m)];
+            TC apc = a + c;
+            TC amc = a - c;
+            TC bpe = b + e;
+            // j*(b - e) for forward transform, -j*(b - e) for reverse
+            TC bme = b - e;
+            TC jbme = _dir == LIQUID_FFT_FORWARD ? _Complex_I*bme : -_Complex_I*bme;
+            _y[q + _s*(4*p + 0)] =      apc + bpe;
+            _y[q + _s*(4*p + 1)] = w1*(amc - jbme);
+            _y[q + _s*(4*p + 2)] = w2*(apc - bpe);
+            _y[q + _s*(4*p + 3)] = w3*(amc + jbme);
+        }
+    }
+}
+
+// final radix-2 stage (portable)
+//  _s      :   stride, 2*_s = nfft
+//  _x      :   stage input
+//  _y      :   stage output
+void FFT(_radix2_stage_port)(unsigned int _s,
+                             TC *         _x,
+                             TC *         _y)
+{
+    unsigned int q;
+    for (q=0; q<_s; q++) {
+        TC a = _x[q];
+        TC b = _x[q + _s];
+        _y[q     ] = a + b;
+        _y[q + _s] = a - b;
+    }
+}
+
+// select runtime execution method for plans created hereafter
+int FFT(_runtime_select)(liquid_runtime_t _select)
+{
+    const struct FFT(_kernels_s) * k = NULL;
+    switch (_select) {
+    case LIQUID_RUNTIME_PORT:
+        liquid_log_trace("fft_runtime_select(), port");
+        k = &FFT(_kernels_port);
+        break;
+    case LIQUID_RUNTIME_NEON:
+        liquid_log_trace("fft_runtime_select(), neon");
+        k = &FFT(_kernels_neon);
+        break;
+    case LIQUID_RUNTIME_SSE2:
+        liquid_log_trace("fft_runtime_select(), sse2");
+        k = &FFT(_kernels_sse2);
+        break;
+    case LIQUID_RUNTIME_AVX2:
+        liquid_log_trace("fft_runtime_select(), avx2");
+        k = &FFT(_kernels_avx2);
+        break;
+    case LIQUID_RUNTIME_AVX512:
+        liquid_log_trace("fft_runtime_select(), avx512");
+        k = &FFT(_kernels_avx512);
+        break;
+    default:;
+    }
+
+    if (k == NULL) {
+        atomic_store_explicit(&FFT(_kernels), &FFT(_kernels_port), memory_order_release);
+        return liquid_error(LIQUID_EINT,
+            "fft_runtime_select(), invalid selection or mode not available (%d), falling back to portable version",
+            _select);
+    }
+    atomic_store_explicit(&FFT(_kernels), k, memory_order_release);
+    return LIQUID_OK;
+}
+
+// detect runtime execution method for plans created hereafter
+int FFT(_runtime_detect)(void)
+{
+    // invoke selection method
+    return FFT(_runtime_select)(FFT(_runtime_best)());
+}
+
+// find best available runtime execution method
+static liquid_runtime_t FFT(_runtime_best)(void)
+{
+    // implementations
+    struct liquid_cpuinfo_s impl =
+    {
+        .altivec = 0,
+        .neon    = true,
+        .mmx     = 0,
+        .sse     = 0,
+        .sse2    = true,
+        .sse3    = 0,
+        .ssse3   = 0,
+        .sse41   = 0,
+        .sse42   = 0,
+        .avx     = 0,
+        .fma3    = 0,
+        .avx2    = true,
+        .avx512  = true,
+        .amx     = 0,
+        .amx101  = 0,
+        .amx102  = 0,
+    };
+
+    // given implementations, find best method
+    return liquid_runtime_detect(&impl);
+}
+
+// get kernel table, selecting best available on first use; an explicit
+// selection made concurrently by another thread takes precedence
+static const struct FFT(_kernels_s) * FFT(_get_kernels)(void)
+{
+    const struct FFT(_kernels_s) * k =
+        atomic_load_explicit(&FFT(_kernels), memory_order_acquire);
+    if (k != NULL)
+        return k;
+
+    const struct FFT(_kernels_s) * best = &FFT(_kernels_port);
+    switch (FFT(_runtime_best)()) {
+    case LIQUID_RUNTIME_NEON:   best = &FFT(_kernels_neon);   break;
+    case LIQUID_RUNTIME_SSE2:   best = &FFT(_kernels_sse2);   break;
+    case LIQUID_RUNTIME_AVX2:   best = &FFT(_kernels_avx2);   break;
+    case LIQUID_RUNTIME_AVX512: best = &FFT(_kernels_avx512); break;
+    default:;
+    }
+    if (atomic_compare_exchange_strong(&FFT(_kernels), &k, best))
+        return best;
+    return k;   // set by another thread in the meantime
+}
+
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// radix-4 Stockham FFT stages (SSE2)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_SSE2
+
+// include proper SIMD extensions for x86 SSE2
+#include <immintrin.h>
+
+// multiply two pairs of complex values
+static inline __m128 __attribute__((target("sse2")))
+fft_cmul_sse2(__m128 _a, __m128 _b)
+{
+    const __m128 sign = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+    __m128 br = _mm_shuffle_ps(_b, _b, _MM_SHUFFLE(2,2,0,0)); // { b.re, b.re, ... }
+    __m128 bi = _mm_shuffle_ps(_b, _b, _MM_SHUFFLE(3,3,1,1)); // { b.im, b.im, ... }
+    __m128 as = _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(2,3,0,1)); // { a.im, a.re, ... }
+    return _mm_add_ps(_mm_mul_ps(_a, br), _mm_xor_ps(_mm_mul_ps(as, bi), sign));
+}
+
+// radix-4 butterfly with twiddles applied to outputs 1, 2, and 3
+static inline void __attribute__((target("sse2")))
+fft_butterfly4_sse2(__m128   _a,
+                    __m128   _b,
+                    __m128   _c,
+                    __m128   _e,
+                    __m128   _w1,
+                    __m128   _w2,
+                    __m128   _w3,
+                    __m128   _jmask,
+                    __m128 * _y)
+{
+    __m128 apc  = _mm_add_ps(_a, _c);
+    __m128 amc  = _mm_sub_ps(_a, _c);
+    __m128 bpe  = _mm_add_ps(_b, _e);
+    __m128 bme  = _mm_sub_ps(_b, _e);
+    __m128 jbme = _mm_xor_ps(_mm_shuffle_ps(bme, bme, _MM_SHUFFLE(2,3,0,1)), _jmask);
+    _y[0] = _mm_add_ps(apc, bpe);
+    _y[1] = fft_cmul_sse2(_mm_sub_ps(amc, jbme), _w1);
+    _y[2] = fft_cmul_sse2(_mm_sub_ps(apc, bpe),  _w2);
+    _y[3] = fft_cmul_sse2(_mm_add_ps(amc, jbme), _w3);
+}
+
+// load single complex value into both halves of register
+static inline __m128 __attribute__((target("sse2")))
+fft_broadcast_sse2(float complex * _v)
+{
+    __m128 v = _mm_loadl_pi(_mm_setzero_ps(), (__m64*)_v);
+    return _mm_movelh_ps(v, v);
+}
+
+// radix-4 stage, two complex values at a time
+void __attribute__((target("sse2")))
+fft_radix4_stage_sse2(unsigned int    _n,
+                      unsigned int    _s,
+                      float complex * _x,
+                      float complex * _y,
+                      float complex * _tw,
+                      int             _dir)
+{
+    unsigned int m = _n / 4;
+    unsigned int p, q;
+
+    // multiplication by j (forward) or -j (reverse) after swapping re/im
+    __m128 jmask = _dir == LIQUID_FFT_FORWARD ?
+        _mm_setr_ps(-0.0f, 0.0f,-0.0f, 0.0f) :
+        _mm_setr_ps( 0.0f,-0.0f, 0.0f,-0.0f);
+    __m128 y[4];
+
+    if (_s >= 2) {
+        // vectorize across stride
+        for (p=0; p<m; p++) {
+            __m128 w1 = fft_broadcast_sse2(&_tw[      p]);
+            __m128 w2 = fft_broadcast_sse2(&_tw[  m + p]);
+            __m128 w3 = fft_broadcast_sse2(&_tw[2*m + p]);
+            for (q=0; q<_s; q+=2) {
+                fft_butterfly4_sse2(_mm_loadu_ps((float*)&_x[q + _s*(p      )]),
+                                    _mm_loadu_ps((float*)&_x[q + _s*(p +   m)]),
+                                    _mm_loadu_ps((float*)&_x[q + _s*(p + 2*m)]),
+                                    _mm_loadu_ps((float*)&_x[q + _s*(p + 3*m)]),
+                                    w1, w2, w3, jmask, y);
+                _mm_storeu_ps((float*)&_y[q + _s*(4*p + 0)], y[0]);
+                _mm_storeu_ps((float*)&_y[q + _s*(4*p + 1)], y[1]);
+                _mm_storeu_ps((float*)&_y[q + _s*(4*p + 2)], y[2]);
+                _mm_storeu_ps((float*)&_y[q + _s*(4*p + 3)], y[3]);
+            }
+        }
+    } else if ((m % 2) == 0) {
+        // vectorize across butterflies, transposing outputs
+        for (p=0; p<m; p+=2) {
+            fft_butterfly4_sse2(_mm_loadu_ps((float*)&_x[p      ]),
+                                _mm_loadu_ps((float*)&_x[p +   m]),
+                                _mm_loadu_ps((float*)&_x[p + 2*m]),
+                                _mm_loadu_ps((float*)&_x[p + 3*m]),
+                                _mm_loadu_ps((float*)&_tw[      p]),
+                                _mm_loadu_ps((float*)&_tw[  m + p]),
+                                _mm_loadu_ps((float*)&_tw[2*m + p]),
+                                jmask, y);
+            _mm_storeu_ps((float*)&_y[4*p + 0], _mm_movelh_ps(y[0], y[1]));
+            _mm_storeu_ps((float*)&_y[4*p + 2], _mm_movelh_ps(y[2], y[3]));
+            _mm_storeu_ps((float*)&_y[4*p + 4], _mm_movehl_ps(y[1], y[0]));
+            _mm_storeu_ps((float*)&_y[4*p + 6], _mm_movehl_ps(y[3], y[2]));
+        }
+    } else {
+        // short transforms
+        fft_radix4_stage_port(_n, _s, _x, _y, _tw, _dir);
+    }
+}
+
+// final radix-2 stage, two complex values at a time
+void __attribute__((target("sse2")))
+fft_radix2_stage_sse2(unsigned int    _s,
+                      float complex * _x,
+                      float complex * _y)
+{
+    // t = 2*(floor(_s/2))
+    unsigned int t = (_s >> 1) << 1;
+    unsigned int q;
+    for (q=0; q<t; q+=2) {
+        __m128 a = _mm_loadu_ps((float*)&_x[q     ]);
+        __m128 b = _mm_loadu_ps((float*)&_x[q + _s]);
+        _mm_storeu_ps((float*)&_y[q     ], _mm_add_ps(a, b));
+        _mm_storeu_ps((float*)&_y[q + _s], _mm_sub_ps(a, b));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    for ( ; q<_s; q++) {
+        float complex a = _x[q];
+        float complex b = _x[q + _s];
+        _y[q     ] = a + b;
+        _y[q + _s] = a - b;
+    }
+}
+
+// build guard
+#else
+
+// invalidated
+void fft_radix4_stage_sse2(unsigned int    _n,
+                           unsigned int    _s,
+                           float complex * _x,
+                           float complex * _y,
+                           float complex * _tw,
+                           int             _dir)
+{
+    liquid_error(LIQUID_EICONFIG,"sse2 extensions not available");
+    fft_radix4_stage_port(_n, _s, _x, _y, _tw, _dir);
+}
+
+void fft_radix2_stage_sse2(unsigned int    _s,
+                           float complex * _x,
+                           float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"sse2 extensions not available");
+    fft_radix2_stage_port(_s, _x, _y);
+}
+
+// build guard
+#endif
+
@@ -53,13 +53,8 @@ liquid_fft_method liquid_fft_estimate_method(unsigned int _nfft)
 
     } else if (fft_is_radix2(_nfft)) {
         // transform is of the form 2^m
-#if 0
-        // use radix-2 algorithm
-        return LIQUID_FFT_METHOD_RADIX2;
-#else
-        // actually, prefer Cooley-Tukey algorithm
-        return LIQUID_FFT_METHOD_MIXED_RADIX;
-#endif
+        // use vectorized radix-4 Stockham algorithm
+        return LIQUID_FFT_METHOD_RADIX4;
 
     } else if (liquid_is_prime(_nfft)) {
         // prefer Rader's alternate method (using radix-2 transform)
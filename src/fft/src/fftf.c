@@ -40,8 +40,16 @@
 #include "fft_common.proto.c"       // common source must come first (object definition)
 #include "fft_dft.proto.c"          // FFT definitions for DFT
 #include "fft_radix2.proto.c"       // FFT definitions for radix-2 transforms
+#include "fft_radix4.proto.c"       // FFT definitions for radix-4 (Stockham) transforms
 #include "fft_mixed_radix.proto.c"  // FFT definitions for mixed-radix transforms (Cooley-Tukey)
 #include "fft_rader.proto.c"        // FFT definitions for transforms of prime length (Rader's algorithm)
 #include "fft_rader2.proto.c"       // FFT definitions for transforms of prime length (Rader's alternate algorithm)
 #include "fft_r2r_1d.proto.c"       // real-to-real definitions (DCT/DST)
+#include "fft_many.proto.c"         // batches of equal-length transforms
 
+
+// runtime-specific kernels
+#include "fft_radix4.neon.c"
+#include "fft_radix4.sse2.c"
+#include "fft_radix4.avx2.c"
+#include "fft_radix4.avx512.c"
@@ -35,6 +35,9 @@
 #define min(a,b) ((a)<(b)?(a):(b))
 #define max(a,b) ((a)>(b)?(a):(b))
 
+// number of segments queued for each thread before transforming
+#define SPGRAM_BATCH_PER_THREAD (8)
+
 struct SPGRAM(_s) {
     // options
     unsigned int    nfft;           // FFT length
@@ -62,6 +65,19 @@ struct SPGRAM(_s) {
     // parameters for display purposes only
     float           frequency;      // center frequency [Hz]
     float           sample_rate;    // sample rate [Hz]
+
+    // multithreaded processing: segments are queued while writing and
+    // transformed by the worker pool in batches; each worker has its own
+    // transform, and the periodograms are accumulated in segment order
+    unsigned int    num_threads;    // number of threads
+    liquid_workers  workers;        // worker pool (NULL for serial processing)
+    unsigned int    batch_size;     // maximum number of queued segments
+    unsigned int    num_batch;      // number of queued segments
+    TI *            batch_x;        // queued segments [batch_size x window_len]
+    T *             batch_psd;      // segment periodograms [batch_size x nfft]
+    TC **           worker_time;    // transform input for each worker
+    TC **           worker_freq;    // transform output for each worker
+    FFT_PLAN *      worker_fft;     // transform for each worker
 };
 
 //
@@ -72,6 +88,16 @@ struct SPGRAM(_s) {
 // from current buffer contents
 int SPGRAM(_step)(SPGRAM() _q);
 
+// create/destroy worker pool and its buffers
+int SPGRAM(_workers_create) (SPGRAM() _q);
+int SPGRAM(_workers_destroy)(SPGRAM() _q);
+
+// queue current buffer contents for transform by worker pool
+int SPGRAM(_queue)(SPGRAM() _q);
+
+// transform queued segments and accumulate periodograms
+int SPGRAM(_flush)(SPGRAM() _q);
+
 // create spgram object
 //  _nfft       : FFT size
 //  _wtype      : window type, e.g. LIQUID_WINDOW_HAMMING
@@ -104,6 +130,9 @@ SPGRAM() SPGRAM(_create)(unsigned int _nfft,
     q->delay      = _delay;
     q->frequency  =  0;
     q->sample_rate= -1;
+    q->num_threads=  1;
+    q->workers    = NULL;
+    q->num_batch  =  0;
 
     // set object for full accumulation
     SPGRAM(_set_alpha)(q, -1.0f);
@@ -202,6 +231,11 @@ SPGRAM() SPGRAM(_copy)(SPGRAM() q_orig)
     q_copy->w = (T*) malloc((q_copy->window_len)*sizeof(T));
     memmove(q_copy->w, q_orig->w, q_copy->window_len*sizeof(T));
 
+    // create new worker pool (queue is always empty between calls)
+    q_copy->workers = NULL;
+    if (q_copy->num_threads > 1)
+        SPGRAM(_workers_create)(q_copy);
+
     // return copied object
     return q_copy;
 }
@@ -219,6 +253,7 @@ int SPGRAM(_destroy)(SPGRAM() _q)
     free(_q->psd);
     WINDOW(_destroy)(_q->buffer);
     FFT_DESTROY_PLAN(_q->fft);
+    SPGRAM(_workers_destroy)(_q);
 
     // free main object
     free(_q);
@@ -291,6 +326,28 @@ int SPGRAM(_set_alpha)(SPGRAM() _q,
     return LIQUID_OK;
 }
 
+// set number of threads used to compute transforms
+int SPGRAM(_set_num_threads)(SPGRAM()     _q,
+                             unsigned int _num_threads)
+{
+    // validate input
+    if (_num_threads == 0)
+        return liquid_error(LIQUID_EICONFIG,"spgram%s_set_num_threads(), number of threads must be greater than zero", EXTENSION);
+
+    // replace worker pool
+    SPGRAM(_workers_destroy)(_q);
+    _q->num_threads = _num_threads;
+    if (_q->num_threads > 1)
+        return SPGRAM(_workers_create)(_q);
+    return LIQUID_OK;
+}
+
+// get number of threads used to compute transforms
+unsigned int SPGRAM(_get_num_threads)(SPGRAM() _q)
+{
+    return _q->num_threads;
+}
+
 // set center freuqncy
 int SPGRAM(_set_freq)(SPGRAM() _q,
                       float    _freq)
@@ -386,7 +443,12 @@ int SPGRAM(_push)(SPGRAM() _q,
 
     // reset timer and step through computation
     _q->sample_timer = _q->delay;
-    return SPGRAM(_step)(_q);
+    if (_q->workers == NULL)
+        return SPGRAM(_step)(_q);
+
+    // transform immediately so the object is consistent on return
+    SPGRAM(_queue)(_q);
+    return SPGRAM(_flush)(_q);
 }
 
 // write a block of samples to the spgram object
@@ -397,16 +459,32 @@ int SPGRAM(_write)(SPGRAM()     _q,
                    TI *         _x,
                    unsigned int _n)
 {
-#if 0
-    // write a block of samples to the internal window
-    WINDOW(_write)(_q->buffer, _x, _n);
-#else
-    // TODO: be smarter about how to write and execute samples
-    unsigned int i;
-    for (i=0; i<_n; i++)
-        SPGRAM(_push)(_q, _x[i]);
-#endif
-    return LIQUID_OK;
+    while (_n > 0) {
+        // write samples up to next transform
+        unsigned int k = min(_n, _q->sample_timer);
+        WINDOW(_write)(_q->buffer, _x, k);
+        _q->num_samples       += k;
+        _q->num_samples_total += k;
+        _q->sample_timer      -= k;
+        _x += k;
+        _n -= k;
+
+        if (_q->sample_timer)
+            continue;
+
+        // reset timer and either transform now or queue for workers
+        _q->sample_timer = _q->delay;
+        if (_q->workers == NULL) {
+            SPGRAM(_step)(_q);
+        } else {
+            SPGRAM(_queue)(_q);
+            if (_q->num_batch == _q->batch_size)
+                SPGRAM(_flush)(_q);
+        }
+    }
+
+    // transform remaining queued segments
+    return _q->workers == NULL ? LIQUID_OK : SPGRAM(_flush)(_q);
 }
 
 
@@ -441,6 +519,122 @@ int SPGRAM(_step)(SPGRAM() _q)
     return LIQUID_OK;
 }
 
+// create worker pool with a transform and buffers for each worker
+int SPGRAM(_workers_create)(SPGRAM() _q)
+{
+    _q->workers     = liquid_workers_create(_q->num_threads);
+    _q->batch_size  = SPGRAM_BATCH_PER_THREAD * _q->num_threads;
+    _q->num_batch   = 0;
+    _q->batch_x     = (TI*) malloc(_q->batch_size*_q->window_len*sizeof(TI));
+    _q->batch_psd   = (T *) malloc(_q->batch_size*_q->nfft*sizeof(T));
+    _q->worker_time = (TC**) malloc(_q->num_threads*sizeof(TC*));
+    _q->worker_freq = (TC**) malloc(_q->num_threads*sizeof(TC*));
+    _q->worker_fft  = (FFT_PLAN*) malloc(_q->num_threads*sizeof(FFT_PLAN));
+    unsigned int i, k;
+    for (i=0; i<_q->num_threads; i++) {
+        _q->worker_time[i] = (TC*) FFT_MALLOC((_q->nfft)*sizeof(TC));
+        _q->worker_freq[i] = (TC*) FFT_MALLOC((_q->nfft)*sizeof(TC));
+        _q->worker_fft[i]  = FFT_CREATE_PLAN(_q->nfft, _q->worker_time[i], _q->worker_freq[i], FFT_DIR_FORWARD, FFT_METHOD);
+        for (k=0; k<_q->nfft; k++)
+            _q->worker_time[i][k] = 0.0f;
+    }
+    return LIQUID_OK;
+}
+
+// destroy worker pool and its buffers
+int SPGRAM(_workers_destroy)(SPGRAM() _q)
+{
+    if (_q->workers == NULL)
+        return LIQUID_OK;
+
+    unsigned int i;
+    for (i=0; i<_q->num_threads; i++) {
+        FFT_DESTROY_PLAN(_q->worker_fft[i]);
+        FFT_FREE(_q->worker_time[i]);
+        FFT_FREE(_q->worker_freq[i]);
+    }
+    free(_q->worker_fft);
+    free(_q->worker_time);
+    free(_q->worker_freq);
+    free(_q->batch_x);
+    free(_q->batch_psd);
+    liquid_workers_destroy(_q->workers);
+    _q->workers = NULL;
+    return LIQUID_OK;
+}
+
+// queue current buffer contents for transform by worker pool
+int SPGRAM(_queue)(SPGRAM() _q)
+{
+    TI * rc;
+    WINDOW(_read)(_q->buffer, &rc);
+    memmove(_q->batch_x + _q->num_batch*_q->window_len, rc, _q->window_len*sizeof(TI));
+    _q->num_batch++;
+    return LIQUID_OK;
+}
+
+// worker share of batch: window and transform every num_workers-th
+// queued segment, storing its periodogram
+int SPGRAM(_flush_transform)(void *       _context,
+                             unsigned int _index,
+                             unsigned int _num_workers)
+{
+    SPGRAM() q = (SPGRAM()) _context;
+    TC * buf_time = q->worker_time[_index];
+    TC * buf_freq = q->worker_freq[_index];
+    unsigned int i, j;
+    for (j=_index; j<q->num_batch; j+=_num_workers) {
+        TI * rc = q->batch_x + j*q->window_len;
+        for (i=0; i<q->window_len; i++)
+            buf_time[i] = rc[i] * q->w[i];
+
+        FFT_EXECUTE(q->worker_fft[_index]);
+
+        T * v = q->batch_psd + j*q->nfft;
+        for (i=0; i<q->nfft; i++)
+            v[i] = crealf( buf_freq[i] * conjf(buf_freq[i]) );
+    }
+    return LIQUID_OK;
+}
+
+// worker share of batch: accumulate periodograms in segment order for a
+// contiguous range of frequency bins
+int SPGRAM(_flush_accumulate)(void *       _context,
+                              unsigned int _index,
+                              unsigned int _num_workers)
+{
+    SPGRAM() q = (SPGRAM()) _context;
+    unsigned int i0 = ( _index   *q->nfft) / _num_workers;
+    unsigned int i1 = ((_index+1)*q->nfft) / _num_workers;
+    unsigned int i, j;
+    for (j=0; j<q->num_batch; j++) {
+        T * v = q->batch_psd + j*q->nfft;
+        for (i=i0; i<i1; i++) {
+            if (q->num_transforms + j == 0)
+                q->psd[i] = v[i];
+            else
+                q->psd[i] = q->gamma*q->psd[i] + q->alpha*v[i];
+        }
+    }
+    return LIQUID_OK;
+}
+
+// transform queued segments and accumulate periodograms
+int SPGRAM(_flush)(SPGRAM() _q)
+{
+    if (_q->num_batch == 0)
+        return LIQUID_OK;
+
+    int rc = liquid_workers_run(_q->workers, SPGRAM(_flush_transform), _q);
+    if (rc == LIQUID_OK)
+        rc = liquid_workers_run(_q->workers, SPGRAM(_flush_accumulate), _q);
+
+    _q->num_transforms       += _q->num_batch;
+    _q->num_transforms_total += _q->num_batch;
+    _q->num_batch = 0;
+    return rc;
+}
+
 // compute spectral periodogram output (fft-shifted values, linear)
 // from current buffer contents
 //  _q      :   spgram object
@@ -296,6 +296,19 @@ int SPWATERFALL(_set_commands)(SPWATERFALL() _q,
     return LIQUID_OK;
 }
 
+// set number of threads used by internal periodogram
+int SPWATERFALL(_set_num_threads)(SPWATERFALL() _q,
+                                  unsigned int  _num_threads)
+{
+    return SPGRAM(_set_num_threads)(_q->periodogram, _num_threads);
+}
+
+// get number of threads used by internal periodogram
+unsigned int SPWATERFALL(_get_num_threads)(SPWATERFALL() _q)
+{
+    return SPGRAM(_get_num_threads)(_q->periodogram);
+}
+
 // push a single sample into the spwaterfall object
 //  _q      :   spwaterfall object
 //  _x      :   input sample
@@ -318,10 +331,22 @@ int SPWATERFALL(_write)(SPWATERFALL() _q,
                         TI *          _x,
                         unsigned int  _n)
 {
-    // TODO: be smarter about how to write and execute samples
-    unsigned int i;
-    for (i=0; i<_n; i++)
-        SPWATERFALL(_push)(_q, _x[i]);
+    // write samples to periodogram in blocks which end no later than the
+    // transform that fills the next time slot; transforms occur every
+    // 'delay' samples since the periodogram was last cleared
+    unsigned int delay = SPGRAM(_get_delay)(_q->periodogram);
+    while (_n > 0) {
+        unsigned long long int rollover    = (unsigned long long int)_q->rollover * delay;
+        unsigned long long int num_samples = SPGRAM(_get_num_samples)(_q->periodogram);
+        unsigned long long int remaining   = rollover > num_samples ? rollover - num_samples : 1;
+        unsigned int k = remaining < _n ? (unsigned int)remaining : _n;
+        if (SPGRAM(_write)(_q->periodogram, _x, k))
+            return liquid_error(LIQUID_EINT,"spwaterfall%s_write(), could not write to internal spgram object",EXTENSION);
+        if (SPWATERFALL(_step)(_q))
+            return liquid_error(LIQUID_EINT,"spwaterfall%s_write(), could not step internal state",EXTENSION);
+        _x += k;
+        _n -= k;
+    }
     return LIQUID_OK;
 }
 
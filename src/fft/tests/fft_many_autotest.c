@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include "liquid.internal.h"
+#include "liquid.autotest.h"
+
+// compare batched transform against individual transforms
+//  _nfft       :   transform size
+//  _howmany    :   number of transforms
+//  _istride    :   input sample stride
+//  _idist      :   distance between input transforms
+//  _ostride    :   output sample stride
+//  _odist      :   distance between output transforms
+//  _dir        :   transform direction
+//  _inplace    :   run batch in place?
+void testbench_fft_many(liquid_autotest __q__,
+                        unsigned int _nfft,
+                        unsigned int _howmany,
+                        unsigned int _istride,
+                        unsigned int _idist,
+                        unsigned int _ostride,
+                        unsigned int _odist,
+                        int          _dir,
+                        int          _inplace)
+{
+    unsigned int nx = (_nfft-1)*_istride + (_howmany-1)*_idist + 1;
+    unsigned int ny = (_nfft-1)*_ostride + (_howmany-1)*_odist + 1;
+    unsigned int n  = nx > ny ? nx : ny;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    float complex * b0= (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * b1= (float complex*) malloc(_nfft*sizeof(float complex));
+
+    unsigned int i, t, k;
+    for (i=0; i<n; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        y[i] = 0.0f;
+    }
+
+    // compute reference output one transform at a time
+    float complex * y_ref = (float complex*) malloc(_howmany*_nfft*sizeof(float complex));
+    fftplan q = fft_create_plan(_nfft, b0, b1, _dir, 0);
+    for (t=0; t<_howmany; t++) {
+        for (k=0; k<_nfft; k++)
+            b0[k] = x[t*_idist + k*_istride];
+        fft_execute(q);
+        for (k=0; k<_nfft; k++)
+            y_ref[t*_nfft + k] = b1[k];
+    }
+    fft_destroy_plan(q);
+
+    // run batch
+    float complex * y_batch = _inplace ? x : y;
+    fftplan p = fft_create_plan_many(_nfft, _howmany, x, _istride, _idist,
+                                     y_batch, _ostride, _odist, _dir, 0);
+    fft_execute(p);
+    fft_destroy_plan(p);
+
+    float tol = 2e-5f * _nfft;
+    for (t=0; t<_howmany; t++) {
+        for (k=0; k<_nfft; k++) {
+            float complex v = y_batch[t*_odist + k*_ostride];
+            LIQUID_CHECK_DELTA(crealf(v), crealf(y_ref[t*_nfft+k]), tol);
+            LIQUID_CHECK_DELTA(cimagf(v), cimagf(y_ref[t*_nfft+k]), tol);
+        }
+    }
+
+    free(x);
+    free(y);
+    free(b0);
+    free(b1);
+    free(y_ref);
+}
+
+// contiguous transforms, interleaved radix-2 with partial final group
+LIQUID_AUTOTEST(fft_many_radix2_16, "batch of 19 16-point transforms","fft",0.1)
+    { testbench_fft_many(__q__,  16, 19,  1,  16,  1,  16, LIQUID_FFT_FORWARD,  0); }
+LIQUID_AUTOTEST(fft_many_radix2_1024,"batch of 3 1024-point transforms","fft",0.1)
+    { testbench_fft_many(__q__,1024,  3,  1,1024,  1,1024, LIQUID_FFT_FORWARD,  0); }
+LIQUID_AUTOTEST(fft_many_radix2_256,"batch of 5 256-point inverse transforms","fft",0.1)
+    { testbench_fft_many(__q__, 256,  5,  1, 256,  1, 256, LIQUID_FFT_BACKWARD, 0); }
+
+// transforms interleaved in memory (e.g. one sample from each channel)
+LIQUID_AUTOTEST(fft_many_interleaved, "batch with samples interleaved","fft",0.1)
+    { testbench_fft_many(__q__,  32, 12, 12,   1, 12,   1, LIQUID_FFT_FORWARD,  0); }
+
+// padded rows on input, transposed output
+LIQUID_AUTOTEST(fft_many_strided,     "batch with padded input, transposed output","fft",0.1)
+    { testbench_fft_many(__q__,  64,  9,  1,  70,  9,   1, LIQUID_FFT_FORWARD,  0); }
+
+// in place
+LIQUID_AUTOTEST(fft_many_inplace,     "batch computed in place","fft",0.1)
+    { testbench_fft_many(__q__,  64, 10,  1,  64,  1,  64, LIQUID_FFT_FORWARD,  1); }
+
+// sizes run one transform at a time
+LIQUID_AUTOTEST(fft_many_radix2_2,  "batch of 8 2-point transforms","fft",0.1)
+    { testbench_fft_many(__q__,   2,  8,  1,   2,  1,   2, LIQUID_FFT_FORWARD,  0); }
+LIQUID_AUTOTEST(fft_many_composite,   "batch of composite-length transforms","fft",0.1)
+    { testbench_fft_many(__q__,  24,  7,  1,  24,  1,  24, LIQUID_FFT_FORWARD,  0); }
+LIQUID_AUTOTEST(fft_many_prime,       "batch of prime-length transforms, strided","fft",0.1)
+    { testbench_fft_many(__q__,  17,  6,  3,   1,  1,  17, LIQUID_FFT_BACKWARD, 0); }
+LIQUID_AUTOTEST(fft_many_composite_inplace,"batch of composite-length transforms in place","fft",0.1)
+    { testbench_fft_many(__q__,  20,  4,  1,  20,  1,  20, LIQUID_FFT_FORWARD,  1); }
+LIQUID_AUTOTEST(fft_many_radix2_8192, "batch of large radix-2 transforms","fft",0.1)
+    { testbench_fft_many(__q__,8192,  2,  1,8192,  1,8192, LIQUID_FFT_FORWARD,  0); }
+LIQUID_AUTOTEST(fft_many_single,      "batch of one transform","fft",0.1)
+    { testbench_fft_many(__q__,  16,  1,  1,   0,  1,   0, LIQUID_FFT_FORWARD,  0); }
+
+// configuration
+LIQUID_AUTOTEST(fft_many_config,"batched fft configuration","fft",0.1)
+{
+    _liquid_error_downgrade_enable();
+    float complex x[16], y[16];
+    LIQUID_CHECK(fft_create_plan_many( 0, 1, x, 1, 16, y, 1, 16, LIQUID_FFT_FORWARD, 0) == NULL);
+    LIQUID_CHECK(fft_create_plan_many(16, 0, x, 1, 16, y, 1, 16, LIQUID_FFT_FORWARD, 0) == NULL);
+    LIQUID_CHECK(fft_create_plan_many(16, 1, x, 0, 16, y, 1, 16, LIQUID_FFT_FORWARD, 0) == NULL);
+    LIQUID_CHECK(fft_create_plan_many(16, 1, x, 1, 16, y, 0, 16, LIQUID_FFT_FORWARD, 0) == NULL);
+    _liquid_error_downgrade_disable();
+}
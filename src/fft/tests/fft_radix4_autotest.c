@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "liquid.internal.h"
+#include "liquid.autotest.h"
+
+// compare radix-4 transform for a particular runtime against the radix-2
+// transform, restoring automatic selection when done
+//  _runtime    :   runtime kernels
+//  _nfft       :   transform size
+//  _dir        :   transform direction
+//  _inplace    :   run transform in place?
+void testbench_fft_radix4(liquid_autotest  __q__,
+                          liquid_runtime_t _runtime,
+                          unsigned int     _nfft,
+                          int              _dir,
+                          int              _inplace)
+{
+    // check if runtime is available on this machine
+    struct liquid_cpuinfo_s impl;
+    memset(&impl, 0x00, sizeof(struct liquid_cpuinfo_s));
+    switch (_runtime) {
+    case LIQUID_RUNTIME_NEON:   impl.neon   = true; break;
+    case LIQUID_RUNTIME_SSE2:   impl.sse2   = true; break;
+    case LIQUID_RUNTIME_AVX2:   impl.avx2   = true; break;
+    case LIQUID_RUNTIME_AVX512: impl.avx512 = true; break;
+    default:;
+    }
+    if (liquid_runtime_detect(&impl) != _runtime) {
+        LIQUID_WARN("runtime unavailable on this machine");
+        return;
+    }
+
+    float complex * x     = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y     = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y_ref = (float complex*) malloc(_nfft*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<_nfft; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // compute reference output
+    fftplan q = fft_create_plan_radix2(_nfft, x, y_ref, _dir, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    // compute output with selected kernels
+    fft_runtime_select(_runtime);
+    float complex * y_test = _inplace ? x : y;
+    fftplan p = fft_create_plan_radix4(_nfft, x, y_test, _dir, 0);
+    fft_execute(p);
+    fft_destroy_plan(p);
+    fft_runtime_detect();
+
+    float tol = 2e-5f * _nfft;
+    for (i=0; i<_nfft; i++) {
+        LIQUID_CHECK_DELTA(crealf(y_test[i]), crealf(y_ref[i]), tol);
+        LIQUID_CHECK_DELTA(cimagf(y_test[i]), cimagf(y_ref[i]), tol);
+    }
+
+    free(x);
+    free(y);
+    free(y_ref);
+}
+
+// run all transform sizes for a particular runtime
+void testbench_fft_radix4_runtime(liquid_autotest  __q__,
+                                  liquid_runtime_t _runtime)
+{
+    unsigned int nfft;
+    for (nfft=4; nfft<=4096; nfft*=2) {
+        testbench_fft_radix4(__q__, _runtime, nfft, LIQUID_FFT_FORWARD,  0);
+        testbench_fft_radix4(__q__, _runtime, nfft, LIQUID_FFT_BACKWARD, 0);
+        testbench_fft_radix4(__q__, _runtime, nfft, LIQUID_FFT_FORWARD,  1);
+    }
+}
+
+LIQUID_AUTOTEST(fft_radix4_port,  "radix-4 transforms, portable kernels","fft",0.1)
+    { testbench_fft_radix4_runtime(__q__, LIQUID_RUNTIME_PORT  ); }
+LIQUID_AUTOTEST(fft_radix4_neon,  "radix-4 transforms, Neon kernels",    "fft",0.1)
+    { testbench_fft_radix4_runtime(__q__, LIQUID_RUNTIME_NEON  ); }
+LIQUID_AUTOTEST(fft_radix4_sse2,  "radix-4 transforms, SSE2 kernels",    "fft",0.1)
+    { testbench_fft_radix4_runtime(__q__, LIQUID_RUNTIME_SSE2  ); }
+LIQUID_AUTOTEST(fft_radix4_avx2,  "radix-4 transforms, AVX2 kernels",    "fft",0.1)
+    { testbench_fft_radix4_runtime(__q__, LIQUID_RUNTIME_AVX2  ); }
+LIQUID_AUTOTEST(fft_radix4_avx512,"radix-4 transforms, AVX512 kernels",  "fft",0.1)
+    { testbench_fft_radix4_runtime(__q__, LIQUID_RUNTIME_AVX512); }
+
+// plans created through the generic interface use the radix-4 method
+LIQUID_AUTOTEST(fft_radix4_method,"power-of-two plans use radix-4 method","fft",0.1)
+{
+    LIQUID_CHECK(liquid_fft_estimate_method(  16) == LIQUID_FFT_METHOD_DFT   );
+    LIQUID_CHECK(liquid_fft_estimate_method(  32) == LIQUID_FFT_METHOD_RADIX4);
+    LIQUID_CHECK(liquid_fft_estimate_method(2048) == LIQUID_FFT_METHOD_RADIX4);
+}
+
+// invalid configurations
+LIQUID_AUTOTEST(fft_radix4_config,"radix-4 plan configuration","fft",0.1)
+{
+    _liquid_error_downgrade_enable();
+    float complex x[12], y[12];
+    LIQUID_CHECK(fft_create_plan_radix4( 2, x, y, LIQUID_FFT_FORWARD, 0) == NULL);
+    LIQUID_CHECK(fft_create_plan_radix4(12, x, y, LIQUID_FFT_FORWARD, 0) == NULL);
+    _liquid_error_downgrade_disable();
+}
@@ -350,6 +350,97 @@ LIQUID_AUTOTEST(spgramcf_copy,"","",0.1)
 }
 
 // check spectral periodogram behavior on null input (zero samples)
+// compare multithreaded block processing against serial sample-by-sample
+// processing; output must be identical
+void testbench_spgramcf_threads(liquid_autotest __q__,
+                                unsigned int    _nfft,
+                                unsigned int    _wlen,
+                                unsigned int    _delay,
+                                float           _alpha,
+                                unsigned int    _num_threads,
+                                unsigned int    _block)
+{
+    unsigned int num_samples = 40*_nfft + 17;
+    spgramcf q0 = spgramcf_create(_nfft, LIQUID_WINDOW_HANN, _wlen, _delay);
+    spgramcf q1 = spgramcf_create(_nfft, LIQUID_WINDOW_HANN, _wlen, _delay);
+    spgramcf_set_alpha(q0, _alpha);
+    spgramcf_set_alpha(q1, _alpha);
+    LIQUID_CHECK(spgramcf_set_num_threads(q1, _num_threads) == LIQUID_OK);
+    LIQUID_CHECK(spgramcf_get_num_threads(q1) == _num_threads);
+
+    float complex * buf = (float complex*) malloc(num_samples*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<num_samples; i++)
+        buf[i] = randnf() + _Complex_I*randnf();
+
+    // run serial object one sample at a time and threaded object in blocks
+    for (i=0; i<num_samples; i++)
+        spgramcf_push(q0, buf[i]);
+    for (i=0; i<num_samples; i+=_block)
+        spgramcf_write(q1, buf+i, i+_block < num_samples ? _block : num_samples-i);
+
+    LIQUID_CHECK(spgramcf_get_num_samples   (q0) == spgramcf_get_num_samples   (q1));
+    LIQUID_CHECK(spgramcf_get_num_transforms(q0) == spgramcf_get_num_transforms(q1));
+
+    float psd_0[_nfft], psd_1[_nfft];
+    spgramcf_get_psd(q0, psd_0);
+    spgramcf_get_psd(q1, psd_1);
+    LIQUID_CHECK_ARRAY(psd_0, psd_1, _nfft*sizeof(float));
+
+    free(buf);
+    spgramcf_destroy(q0);
+    spgramcf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(spgramcf_threads_1,"serial block writes match push","",0.1)
+    { testbench_spgramcf_threads(__q__, 400, 300, 100, -1.0f, 1,  777); }
+LIQUID_AUTOTEST(spgramcf_threads_2,"two threads, accumulate","",0.1)
+    { testbench_spgramcf_threads(__q__, 400, 300, 100, -1.0f, 2, 4000); }
+LIQUID_AUTOTEST(spgramcf_threads_3,"three threads, time average","",0.1)
+    { testbench_spgramcf_threads(__q__, 512, 511,  37,  0.1f, 3,  999); }
+LIQUID_AUTOTEST(spgramcf_threads_4,"four threads, small blocks","",0.1)
+    { testbench_spgramcf_threads(__q__, 240, 200,  60, -1.0f, 4,   50); }
+LIQUID_AUTOTEST(spgramcf_threads_8,"eight threads, single write","",0.1)
+    { testbench_spgramcf_threads(__q__,1024, 800, 200,  0.5f, 8,1<<20); }
+
+LIQUID_AUTOTEST(spgramf_threads,"real input, multithreaded","",0.1)
+{
+    unsigned int nfft = 300, num_samples = 9000;
+    spgramf q0 = spgramf_create(nfft, LIQUID_WINDOW_KAISER, 200, 50);
+    spgramf q1 = spgramf_create(nfft, LIQUID_WINDOW_KAISER, 200, 50);
+    spgramf_set_num_threads(q1, 3);
+
+    float buf[num_samples];
+    unsigned int i;
+    for (i=0; i<num_samples; i++)
+        buf[i] = randnf();
+    spgramf_write(q0, buf, num_samples);
+    spgramf_write(q1, buf, num_samples);
+
+    float psd_0[nfft], psd_1[nfft];
+    spgramf_get_psd(q0, psd_0);
+    spgramf_get_psd(q1, psd_1);
+    LIQUID_CHECK_ARRAY(psd_0, psd_1, nfft*sizeof(float));
+
+    // copied object keeps thread count
+    spgramf q2 = spgramf_copy(q1);
+    LIQUID_CHECK(spgramf_get_num_threads(q2) == 3);
+    spgramf_write(q1, buf, num_samples);
+    spgramf_write(q2, buf, num_samples);
+    spgramf_get_psd(q1, psd_0);
+    spgramf_get_psd(q2, psd_1);
+    LIQUID_CHECK_ARRAY(psd_0, psd_1, nfft*sizeof(float));
+
+    // invalid configuration
+    _liquid_error_downgrade_enable();
+    LIQUID_CHECK(spgramf_set_num_threads(q0, 0) != LIQUID_OK);
+    _liquid_error_downgrade_disable();
+
+    spgramf_destroy(q0);
+    spgramf_destroy(q1);
+    spgramf_destroy(q2);
+}
+
 LIQUID_AUTOTEST(spgramcf_null,"","",0.1)
 {
     unsigned int nfft = 1200;   // transform size
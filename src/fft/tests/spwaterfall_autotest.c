@@ -187,6 +187,37 @@ LIQUID_AUTOTEST(spwaterfall_copy,"","",0.1)
     spwaterfallcf_destroy(q1);
 }
 
+LIQUID_AUTOTEST(spwaterfall_threads,"multithreaded block writes match push","",0.1)
+{
+    unsigned int nfft =  240;   // transform size
+    unsigned int time =   64;   // time size
+
+    spwaterfallcf q0 = spwaterfallcf_create(nfft, LIQUID_WINDOW_KAISER, 217, 37, time);
+    spwaterfallcf q1 = spwaterfallcf_create(nfft, LIQUID_WINDOW_KAISER, 217, 37, time);
+    spwaterfallcf_set_num_threads(q1, 4);
+    LIQUID_CHECK(spwaterfallcf_get_num_threads(q1) == 4);
+
+    // push enough samples to consolidate buffer several times
+    unsigned int i, block = 5000;
+    unsigned int num_samples = 9 * nfft * time + 123;
+    float complex * buf = (float complex*) malloc(num_samples*sizeof(float complex));
+    for (i=0; i<num_samples; i++)
+        buf[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<num_samples; i++)
+        spwaterfallcf_push(q0, buf[i]);
+    for (i=0; i<num_samples; i+=block)
+        spwaterfallcf_write(q1, buf+i, i+block < num_samples ? block : num_samples-i);
+
+    LIQUID_CHECK(spwaterfallcf_get_num_samples_total(q0) == spwaterfallcf_get_num_samples_total(q1));
+    LIQUID_CHECK(spwaterfallcf_get_num_time(q0) == spwaterfallcf_get_num_time(q1));
+    unsigned int nt = spwaterfallcf_get_num_time(q0);
+    LIQUID_CHECK_ARRAY(spwaterfallcf_get_psd(q0), spwaterfallcf_get_psd(q1), nfft*nt*sizeof(float));
+
+    free(buf);
+    spwaterfallcf_destroy(q0);
+    spwaterfallcf_destroy(q1);
+}
+
 LIQUID_AUTOTEST(spwaterfall_gnuplot,"test file export","",0.1)
 {
     // create default object
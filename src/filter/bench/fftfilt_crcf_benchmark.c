@@ -81,3 +81,57 @@ void benchmark_fftfilt_crcf_16   FFTFILT_CRCF_BENCHMARK_API(16)
 void benchmark_fftfilt_crcf_32   FFTFILT_CRCF_BENCHMARK_API(32)
 void benchmark_fftfilt_crcf_64   FFTFILT_CRCF_BENCHMARK_API(64)
 
+
+// Helper function: long filter, partitioned into blocks of size _n
+void fftfilt_crcf_partitioned_bench(struct rusage *     _start,
+                                    struct rusage *     _finish,
+                                    unsigned long int * _num_iterations,
+                                    unsigned int        _h_len,
+                                    unsigned int        _n)
+{
+    // adjust number of iterations: target constant number of samples
+    *_num_iterations = *_num_iterations * 20 / _h_len;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // generate coefficients
+    float h[_h_len];
+    unsigned long int i;
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+
+    // create filter object
+    fftfilt_crcf q = fftfilt_crcf_create_partitioned(h,_h_len,_n);
+
+    // generate input vector
+    float complex x[_n];
+    for (i=0; i<_n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // output vector
+    float complex y[_n];
+
+    // start trials, running in blocks of 4096 samples
+    unsigned int num_blocks = 4096 / _n;
+    unsigned long int j;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        for (j=0; j<num_blocks; j++)
+            fftfilt_crcf_execute(q, x, y);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= num_blocks * _n;
+
+    // destroy filter object
+    fftfilt_crcf_destroy(q);
+}
+
+#define FFTFILT_CRCF_PARTITIONED_BENCHMARK_API(H_LEN,N) \
+(   struct rusage *_start,                              \
+    struct rusage *_finish,                             \
+    unsigned long int *_num_iterations)                 \
+{ fftfilt_crcf_partitioned_bench(_start, _finish, _num_iterations, H_LEN, N); }
+
+void benchmark_fftfilt_crcf_h2049_n64   FFTFILT_CRCF_PARTITIONED_BENCHMARK_API(2049,   64)
+void benchmark_fftfilt_crcf_h2049_n256  FFTFILT_CRCF_PARTITIONED_BENCHMARK_API(2049,  256)
+void benchmark_fftfilt_crcf_h2049_n1024 FFTFILT_CRCF_PARTITIONED_BENCHMARK_API(2049, 1024)
+void benchmark_fftfilt_crcf_h2049_n2048 FFTFILT_CRCF_PARTITIONED_BENCHMARK_API(2049, 2048)
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+//  _h_len      : filter length
+//  _block_len  : number of samples per execute_block() call
+void firfilt_crcf_block_bench(struct rusage *     _start,
+                              struct rusage *     _finish,
+                              unsigned long int * _num_iterations,
+                              unsigned int        _h_len,
+                              unsigned int        _block_len)
+{
+    // adjust number of iterations:
+    // cycles/trial ~ 107 + 4.3*_h_len (per sample)
+    *_num_iterations *= 1000;
+    *_num_iterations /= (unsigned int)(107+4.3*_h_len);
+    *_num_iterations /= _block_len;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // generate coefficients
+    float h[_h_len];
+    unsigned long int i;
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+
+    // create filter object
+    firfilt_crcf f = firfilt_crcf_create(h,_h_len);
+
+    // generate input vector
+    float complex * x = (float complex*) malloc(_block_len*sizeof(float complex));
+    float complex * y = (float complex*) malloc(_block_len*sizeof(float complex));
+    for (i=0; i<_block_len; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        firfilt_crcf_execute_block(f, x, _block_len, y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= _block_len;
+
+    firfilt_crcf_destroy(f);
+    free(x);
+    free(y);
+}
+
+#define FIRFILT_CRCF_BLOCK_BENCHMARK_API(H_LEN,BLOCK_LEN)   \
+(   struct rusage *_start,                                  \
+    struct rusage *_finish,                                 \
+    unsigned long int *_num_iterations)                     \
+{ firfilt_crcf_block_bench(_start, _finish, _num_iterations, H_LEN, BLOCK_LEN); }
+
+void benchmark_firfilt_crcf_block_h64_n1      FIRFILT_CRCF_BLOCK_BENCHMARK_API( 64,    1)
+void benchmark_firfilt_crcf_block_h64_n16     FIRFILT_CRCF_BLOCK_BENCHMARK_API( 64,   16)
+void benchmark_firfilt_crcf_block_h64_n256    FIRFILT_CRCF_BLOCK_BENCHMARK_API( 64,  256)
+void benchmark_firfilt_crcf_block_h64_n1024   FIRFILT_CRCF_BLOCK_BENCHMARK_API( 64, 1024)
+
+void benchmark_firfilt_crcf_block_h128_n1     FIRFILT_CRCF_BLOCK_BENCHMARK_API(128,    1)
+void benchmark_firfilt_crcf_block_h128_n16    FIRFILT_CRCF_BLOCK_BENCHMARK_API(128,   16)
+void benchmark_firfilt_crcf_block_h128_n256   FIRFILT_CRCF_BLOCK_BENCHMARK_API(128,  256)
+void benchmark_firfilt_crcf_block_h128_n1024  FIRFILT_CRCF_BLOCK_BENCHMARK_API(128, 1024)
+
+void benchmark_firfilt_crcf_block_h256_n1     FIRFILT_CRCF_BLOCK_BENCHMARK_API(256,    1)
+void benchmark_firfilt_crcf_block_h256_n16    FIRFILT_CRCF_BLOCK_BENCHMARK_API(256,   16)
+void benchmark_firfilt_crcf_block_h256_n256   FIRFILT_CRCF_BLOCK_BENCHMARK_API(256,  256)
+void benchmark_firfilt_crcf_block_h256_n1024  FIRFILT_CRCF_BLOCK_BENCHMARK_API(256, 1024)
+
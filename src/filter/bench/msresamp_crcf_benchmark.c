@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <sys/resource.h>
+#include <stdlib.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+void msresamp_crcf_bench(struct rusage *     _start,
+                         struct rusage *     _finish,
+                         unsigned long int * _num_iterations,
+                         float               _rate,
+                         unsigned int        _num_input)
+{
+    // adjust number of iterations: cycles/trial ~ 40 n (1 + r)
+    *_num_iterations /= 40.0f * _num_input * (1.0f + _rate);
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // create resampling object
+    msresamp_crcf q = msresamp_crcf_create(_rate, 60.0f);
+
+    // buffering
+    unsigned int num_output = 16 + (unsigned int)(2.0f*_rate*_num_input);
+    float complex * buf_0 = (float complex*) malloc(_num_input*sizeof(float complex));
+    float complex * buf_1 = (float complex*) malloc( num_output*sizeof(float complex));
+    unsigned int num_written;
+
+    unsigned long int i;
+    for (i=0; i<_num_input; i++)
+        buf_0[i] = i % 7 ? 1 : -1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        msresamp_crcf_execute(q, buf_0, _num_input, buf_1, &num_written);
+        msresamp_crcf_execute(q, buf_0, _num_input, buf_1, &num_written);
+        msresamp_crcf_execute(q, buf_0, _num_input, buf_1, &num_written);
+        msresamp_crcf_execute(q, buf_0, _num_input, buf_1, &num_written);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    // destroy object
+    msresamp_crcf_destroy(q);
+    free(buf_0);
+    free(buf_1);
+}
+
+#define MSRESAMP_CRCF_BENCHMARK_API(R,N)    \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ msresamp_crcf_bench(_start, _finish, _num_iterations, R, N); }
+
+//
+// Multi-stage resampler benchmarks; each trial is a block of N input samples
+//
+void benchmark_msresamp_crcf_decim_r1280_n8192  MSRESAMP_CRCF_BENCHMARK_API(48e3f/61.44e6f, 8192)
+void benchmark_msresamp_crcf_decim_r0p1_n1024   MSRESAMP_CRCF_BENCHMARK_API(0.1f,           1024)
+void benchmark_msresamp_crcf_decim_r0p77_n1024  MSRESAMP_CRCF_BENCHMARK_API(0.77f,          1024)
+void benchmark_msresamp_crcf_interp_r1p3_n1024  MSRESAMP_CRCF_BENCHMARK_API(1.3f,           1024)
+void benchmark_msresamp_crcf_interp_r10_n1024   MSRESAMP_CRCF_BENCHMARK_API(10.0f,          1024)
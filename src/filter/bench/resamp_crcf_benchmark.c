@@ -29,7 +29,8 @@ void resamp_crcf_bench(struct rusage *     _start,
                        struct rusage *     _finish,
                        unsigned long int * _num_iterations,
                        unsigned int        _P,
-                       unsigned int        _Q)
+                       unsigned int        _Q,
+                       int                 _block)
 {
     // adjust number of iterations: cycles/trial ~ 500 + 100 Q
     *_num_iterations /= (500 + 100*_Q);
@@ -46,18 +47,27 @@ void resamp_crcf_bench(struct rusage *     _start,
     float complex buf_0[_P];
     float complex buf_1[_Q*4];
     unsigned int num_written;
-    
+
     unsigned long int i;
     for (i=0; i<_P; i++)
         buf_0[i] = i % 7 ? 1 : -1;
 
     // start trials
     getrusage(RUSAGE_SELF, _start);
-    for (i=0; i<(*_num_iterations); i++) {
-        resamp_crcf_execute_block(q, buf_0, _P, buf_1, &num_written);
-        resamp_crcf_execute_block(q, buf_0, _P, buf_1, &num_written);
-        resamp_crcf_execute_block(q, buf_0, _P, buf_1, &num_written);
-        resamp_crcf_execute_block(q, buf_0, _P, buf_1, &num_written);
+    if (_block) {
+        for (i=0; i<(*_num_iterations); i++) {
+            resamp_crcf_execute_block(q, buf_0, _P, buf_1, &num_written);
+            resamp_crcf_execute_block(q, buf_0, _P, buf_1, &num_written);
+            resamp_crcf_execute_block(q, buf_0, _P, buf_1, &num_written);
+            resamp_crcf_execute_block(q, buf_0, _P, buf_1, &num_written);
+        }
+    } else {
+        // run one sample at a time for comparison
+        unsigned int j, n;
+        for (i=0; i<(*_num_iterations); i++) {
+            for (j=0; j<4*_P; j++)
+                resamp_crcf_execute(q, buf_0[j%_P], buf_1 + (j%_P)*_Q/_P, &n);
+        }
     }
     getrusage(RUSAGE_SELF, _finish);
     *_num_iterations *= 4;
@@ -70,7 +80,13 @@ void resamp_crcf_bench(struct rusage *     _start,
 (   struct rusage *_start,              \
     struct rusage *_finish,             \
     unsigned long int *_num_iterations) \
-{ resamp_crcf_bench(_start, _finish, _num_iterations, P, Q); }
+{ resamp_crcf_bench(_start, _finish, _num_iterations, P, Q, 1); }
+
+#define RESAMP_CRCF_SAMPLE_BENCHMARK_API(P,Q)   \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ resamp_crcf_bench(_start, _finish, _num_iterations, P, Q, 0); }
 
 //
 // Resampler benchmark prototypes; compare to rational rate resampler
@@ -85,3 +101,6 @@ void benchmark_resamp_crcf_P17_Q64  RESAMP_CRCF_BENCHMARK_API(17,  64)
 void benchmark_resamp_crcf_P17_Q128 RESAMP_CRCF_BENCHMARK_API(17, 128)
 void benchmark_resamp_crcf_P17_Q256 RESAMP_CRCF_BENCHMARK_API(17, 256)
 
+// compare block and sample-by-sample execution with long input blocks
+void benchmark_resamp_crcf_P1024_Q1024          RESAMP_CRCF_BENCHMARK_API       (1024, 1024)
+void benchmark_resamp_crcf_sample_P1024_Q1024   RESAMP_CRCF_SAMPLE_BENCHMARK_API(1024, 1024)
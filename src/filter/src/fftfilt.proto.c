@@ -20,25 +20,43 @@
  * THE SOFTWARE.
  */
 
+//
 // finite impulse response (FIR) filter using fast Fourier transforms (FFTs)
+//
+// Samples are filtered in blocks of _n using overlap-save with a transform
+// size of 2*_n. Filters longer than _n+1 taps are split into uniform
+// partitions of _n taps each whose spectra are applied to a frequency-domain
+// delay line of past input blocks; this keeps the latency at _n samples
+// regardless of the filter length.
+//
 
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 
+#if BUILD_PTHREADS
+#include <pthread.h>
+#endif
+
 // fftfilt object structure
 struct FFTFILT(_s) {
     TC *         h;     // filter coefficients array [size; h_len x 1]
     unsigned int h_len; // filter length
     unsigned int n;     // input/output block size
+    unsigned int num_partitions;    // number of filter partitions, P
 
     // internal memory arrays
     // TODO: make TI/TO type, but ensuring complex
     // TODO: use special format for fftfilt_rrrf type
     float complex * time_buf;   // time buffer [size: 2*n x 1]
     float complex * freq_buf;   // freq buffer [size: 2*n x 1]
-    float complex * H;          // FFT of filter coefficients [size: 2*n x 1]
-    float complex * w;          // overlap array [size: n x 1]
+    float complex * H;          // FFT of filter partitions [size: 2*n x P]
+    float complex * w;          // previous input block [size: n x 1]
+
+    // frequency-domain delay line (partitioned mode only, P > 1)
+    float complex * X;          // FFT of past input blocks [size: 2*n x P]
+    float complex * scratch;    // partial product buffer [size: 2*n x 1]
+    unsigned int    X_index;    // delay line slot for newest block
 
     // FFT objects
     FFT_PLAN fft;       // FFT object (forward)
@@ -46,6 +64,12 @@ struct FFTFILT(_s) {
     TC scale;           // output scaling factor
 };
 
+// allocate object for a given block size and number of partitions
+FFTFILT() FFTFILT(_create_internal)(TC *         _h,
+                                    unsigned int _h_len,
+                                    unsigned int _n,
+                                    unsigned int _num_partitions);
+
 // create FFT-based FIR filter using external coefficients
 //  _h      : filter coefficients [size: _h_len x 1]
 //  _h_len  : filter length, _h_len > 0
@@ -60,32 +84,72 @@ FFTFILT() FFTFILT(_create)(TC *         _h,
     if (_n < _h_len-1)
         return liquid_error_config("fftfilt_%s_create(), block length must be greater than _h_len-1 (%u)",EXTENSION_FULL,_h_len-1);
 
+    return FFTFILT(_create_internal)(_h, _h_len, _n, 1);
+}
+
+// create FFT-based FIR filter using uniformly partitioned convolution
+//  _h      : filter coefficients [size: _h_len x 1]
+//  _h_len  : filter length, _h_len > 0
+//  _n      : block size = nfft/2 = partition length, _n > 0
+FFTFILT() FFTFILT(_create_partitioned)(TC *         _h,
+                                       unsigned int _h_len,
+                                       unsigned int _n)
+{
+    // validate input
+    if (_h_len == 0)
+        return liquid_error_config("fftfilt_%s_create_partitioned(), filter length must be greater than zero",EXTENSION_FULL);
+    if (_n == 0)
+        return liquid_error_config("fftfilt_%s_create_partitioned(), block length must be greater than zero",EXTENSION_FULL);
+
+    // a single partition can hold up to _n+1 taps; otherwise split the
+    // filter into partitions of exactly _n taps
+    unsigned int num_partitions = (_h_len <= _n+1) ? 1 : (_h_len + _n - 1) / _n;
+    return FFTFILT(_create_internal)(_h, _h_len, _n, num_partitions);
+}
+
+// allocate object for a given block size and number of partitions
+FFTFILT() FFTFILT(_create_internal)(TC *         _h,
+                                    unsigned int _h_len,
+                                    unsigned int _n,
+                                    unsigned int _num_partitions)
+{
     // create filter object and initialize
     FFTFILT() q = (FFTFILT()) malloc(sizeof(struct FFTFILT(_s)));
     q->h_len    = _h_len;
     q->n        = _n;
+    q->num_partitions = _num_partitions;
 
     // copy filter coefficients
     q->h = (TC *) malloc((q->h_len)*sizeof(TC));
     memmove(q->h, _h, _h_len*sizeof(TC));
 
     // allocate internal memory arrays
+    unsigned int P = q->num_partitions;
     q->time_buf = (float complex *) FFT_MALLOC((2*q->n)* sizeof(float complex)); // time buffer
     q->freq_buf = (float complex *) FFT_MALLOC((2*q->n)* sizeof(float complex)); // frequency buffer
-    q->H        = (float complex *) malloc((2*q->n)* sizeof(float complex));     // FFT{ h }
+    q->H        = (float complex *) malloc((2*q->n*P)* sizeof(float complex));   // FFT{ h }
     q->w        = (float complex *) malloc((  q->n)* sizeof(float complex));     // delay buffer
+    q->X        = NULL;
+    q->scratch  = NULL;
+    if (P > 1) {
+        q->X       = (float complex *) malloc((2*q->n*P)* sizeof(float complex));
+        q->scratch = (float complex *) malloc((2*q->n)*  sizeof(float complex));
+    }
 
     // create internal FFT objects
     q->fft  = FFT_CREATE_PLAN(2*q->n, q->time_buf, q->freq_buf, FFT_DIR_FORWARD,  FFT_METHOD);
     q->ifft = FFT_CREATE_PLAN(2*q->n, q->freq_buf, q->time_buf, FFT_DIR_BACKWARD, FFT_METHOD);
 
-    // compute FFT of filter coefficients and copy to internal H array
-    unsigned int i;
-    for (i=0; i<2*q->n; i++)
-        q->time_buf[i] = (i < q->h_len) ? q->h[i] : 0;
-    // time_buf > {FFT} > freq_buf
-    FFT_EXECUTE(q->fft);
-    memmove(q->H, q->freq_buf, 2*q->n*sizeof(float complex));
+    // compute FFT of each filter partition and copy to internal H array
+    unsigned int L = (P == 1) ? q->h_len : q->n;  // partition length
+    unsigned int i, p;
+    for (p=0; p<P; p++) {
+        for (i=0; i<2*q->n; i++)
+            q->time_buf[i] = (i < L && p*L+i < q->h_len) ? q->h[p*L+i] : 0;
+        // time_buf > {FFT} > freq_buf
+        FFT_EXECUTE(q->fft);
+        memmove(&q->H[2*q->n*p], q->freq_buf, 2*q->n*sizeof(float complex));
+    }
 
     // set default scaling
     FFTFILT(_set_scale)(q, 1);
@@ -116,10 +180,15 @@ FFTFILT() FFTFILT(_copy)(FFTFILT() q_orig)
     q_copy->freq_buf = (float complex*) FFT_MALLOC((2*q_orig->n) * sizeof(float complex));
 
     // copy buffers
+    unsigned int P = q_orig->num_partitions;
     memmove(q_copy->time_buf, q_orig->time_buf, (2*q_orig->n) * sizeof(float complex));
     memmove(q_copy->freq_buf, q_orig->freq_buf, (2*q_orig->n) * sizeof(float complex));
-    q_copy->H = (float complex*) liquid_malloc_copy(q_orig->H, 2*q_orig->n, sizeof(float complex));
-    q_copy->w = (float complex*) liquid_malloc_copy(q_orig->w,   q_orig->n, sizeof(float complex));
+    q_copy->H = (float complex*) liquid_malloc_copy(q_orig->H, 2*q_orig->n*P, sizeof(float complex));
+    q_copy->w = (float complex*) liquid_malloc_copy(q_orig->w,   q_orig->n,   sizeof(float complex));
+    if (P > 1) {
+        q_copy->X       = (float complex*) liquid_malloc_copy(q_orig->X, 2*q_orig->n*P, sizeof(float complex));
+        q_copy->scratch = (float complex*) malloc((2*q_orig->n) * sizeof(float complex));
+    }
 
     // create internal FFT objects and return
     q_copy->fft  = FFT_CREATE_PLAN(2*q_copy->n, q_copy->time_buf, q_copy->freq_buf, FFT_DIR_FORWARD,  FFT_METHOD);
@@ -134,8 +203,10 @@ int FFTFILT(_destroy)(FFTFILT() _q)
     free(_q->h);                // filter coefficients
     FFT_FREE(_q->time_buf);     // buffer (time domain)
     FFT_FREE(_q->freq_buf);     // buffer (frequency domain)
-    free(_q->H);                // frequency response of filter coefficients
-    free(_q->w);                // output window buffer
+    free(_q->H);                // frequency response of filter partitions
+    free(_q->w);                // previous input block
+    free(_q->X);                // frequency-domain delay line
+    free(_q->scratch);          // partial product buffer
 
     // destroy FFT objects
     FFT_DESTROY_PLAN(_q->fft);  // forward transform
@@ -149,19 +220,19 @@ int FFTFILT(_destroy)(FFTFILT() _q)
 // reset internal state of filter object
 int FFTFILT(_reset)(FFTFILT() _q)
 {
-    // reset overlap window
-    unsigned int i;
-    for (i=0; i<_q->n; i++) {
-        _q->w[i] = 0;
-    }
+    // reset previous input block and frequency-domain delay line
+    memset(_q->w, 0, _q->n*sizeof(float complex));
+    if (_q->num_partitions > 1)
+        memset(_q->X, 0, 2*_q->n*_q->num_partitions*sizeof(float complex));
+    _q->X_index = 0;
     return LIQUID_OK;
 }
 
 // print filter object internals (taps, buffer)
 int FFTFILT(_print)(FFTFILT() _q)
 {
-    printf("<liquid.fftfilt_%s, len=%u, nfft=%u",
-        EXTENSION_FULL, _q->h_len, _q->n);
+    printf("<liquid.fftfilt_%s, len=%u, nfft=%u, partitions=%u",
+        EXTENSION_FULL, _q->h_len, _q->n, _q->num_partitions);
 
     printf(", scale=");
     PRINTVAL_TC(_q->scale,%g);
@@ -196,60 +267,51 @@ int FFTFILT(_execute)(FFTFILT() _q,
                       TO *      _y)
 {
     unsigned int i;
+    unsigned int n = _q->n;
 
-    // copy input
-#if 0 //TI_COMPLEX
-    memmove(_q->time_buf, _x, _q->n*sizeof(TI));
-#else
+    // time buffer holds previous and current input blocks
+    memmove(_q->time_buf, _q->w, n*sizeof(float complex));
     // manual copy for type conversion
     // TODO: use DCT or equivalent
-    for (i=0; i<_q->n; i++)
-        _q->time_buf[i] = _x[i];
-#endif
-
-    // pad end of time-domain buffer with zeros
-    // TODO: not necessary to do this every time
-#if 0
-    memset(&_q->time_buf[_q->n], 0, _q->n*sizeof(TI));
-#else
-    for (i=0; i<_q->n; i++)
-        _q->time_buf[_q->n + i] = 0;
-#endif
+    for (i=0; i<n; i++)
+        _q->time_buf[n + i] = _x[i];
+    memmove(_q->w, &_q->time_buf[n], n*sizeof(float complex));
 
     // run forward transform
     FFT_EXECUTE(_q->fft);
 
     // compute inner product between FFT{ _x } and FFT{ H }
-#if 1
-    for (i=0; i<2*_q->n; i++)
-        _q->freq_buf[i] *= _q->H[i];
-#else
-    // use SIMD vector extensions
-# if TI_COMPLEX
-    // complex floating-point inner product
-    liquid_vectorcf_mul(_q->freq_buf, _q->H, 2*_q->n, _q->freq_buf);
-# else
-    // real floating-point inner product
-    liquid_vectorf_mul(_q->freq_buf, _q->H, 2*_q->n, _q->freq_buf);
-# endif
-#endif
+    unsigned int P = _q->num_partitions;
+    if (P == 1) {
+        liquid_vectorcf_mul(_q->freq_buf, _q->H, 2*n, _q->freq_buf);
+    } else {
+        // push newest spectrum into delay line and accumulate products of
+        // each partition with the input block delayed by that many blocks
+        unsigned int k = _q->X_index;
+        memmove(&_q->X[2*n*k], _q->freq_buf, 2*n*sizeof(float complex));
+        liquid_vectorcf_mul(&_q->X[2*n*k], _q->H, 2*n, _q->freq_buf);
+        unsigned int p;
+        for (p=1; p<P; p++) {
+            k = (k == 0) ? P-1 : k-1;
+            liquid_vectorcf_mul(&_q->X[2*n*k], &_q->H[2*n*p], 2*n, _q->scratch);
+            liquid_vectorcf_add(_q->freq_buf, _q->scratch, 2*n, _q->freq_buf);
+        }
+        _q->X_index = (_q->X_index + 1) % P;
+    }
 
     // compute inverse transform
     FFT_EXECUTE(_q->ifft);
 
-    // copy output summed with buffer and scaled
+    // last half of the circular convolution is free of aliasing
 #if TI_COMPLEX
-    for (i=0; i<_q->n; i++)
-        _y[i] = (_q->time_buf[i] + _q->w[i]) * _q->scale;
+    for (i=0; i<n; i++)
+        _y[i] = _q->time_buf[n + i] * _q->scale;
 #else
     // manual copy for type conversion
     // TODO: use DCT or equivalent
-    for (i=0; i<_q->n; i++)
-        _y[i] = (T) crealf(_q->time_buf[i] + _q->w[i]) * _q->scale;
+    for (i=0; i<n; i++)
+        _y[i] = (T) crealf(_q->time_buf[n + i]) * _q->scale;
 #endif
-
-    // copy buffer
-    memmove(_q->w, &_q->time_buf[_q->n], _q->n*sizeof(float complex));
     return LIQUID_OK;
 }
 
@@ -259,3 +321,211 @@ unsigned int FFTFILT(_get_length)(FFTFILT() _q)
     return _q->h_len;
 }
 
+// return block size (number of samples consumed and produced per execute)
+unsigned int FFTFILT(_get_block_size)(FFTFILT() _q)
+{
+    return _q->n;
+}
+
+// return number of uniform filter partitions
+unsigned int FFTFILT(_get_num_partitions)(FFTFILT() _q)
+{
+    return _q->num_partitions;
+}
+
+//
+// autotuning
+//
+
+// maximum number of cached block-size decisions per type
+#define FFTFILT_AUTOTUNE_CACHE_LEN  (32)
+
+// block-size decisions, keyed on filter length and block-size limit
+static struct {
+    unsigned int h_len;
+    unsigned int max_block;
+    unsigned int n;
+} FFTFILT(_autotune_cache)[FFTFILT_AUTOTUNE_CACHE_LEN];
+static unsigned int FFTFILT(_autotune_cache_num)  = 0;
+static unsigned int FFTFILT(_autotune_crossover_len) = 0;
+
+#if BUILD_PTHREADS
+static pthread_mutex_t FFTFILT(_autotune_lock)  = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t FFTFILT(_crossover_lock) = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+// measure run time per sample of a filter with a given block size;
+// block size of zero runs regular firfilt for comparison
+static float FFTFILT(_autotune_measure)(TC *         _h,
+                                        unsigned int _h_len,
+                                        unsigned int _n)
+{
+    // start with at least 4k samples and 2 blocks per trial
+    unsigned int block_len  = _n == 0 ? 256 : _n;
+    unsigned int num_blocks = 4096 / block_len;
+    if (num_blocks < 2) num_blocks = 2;
+
+    TI * x = (TI *) malloc(block_len*sizeof(TI));
+    TO * y = (TO *) malloc(block_len*sizeof(TO));
+    unsigned int i;
+    for (i=0; i<block_len; i++)
+        x[i] = randnf();
+
+    FFTFILT() qf = NULL;
+    FIRFILT() qd = NULL;
+    if (_n == 0)
+        qd = FIRFILT(_create)(_h, _h_len);
+    else
+        qf = FFTFILT(_create_partitioned)(_h, _h_len, _n);
+
+    // double trial length until it spans at least 1 ms, then keep best of
+    // several trials to reject scheduling noise
+    float t_min = 0.0f;
+    unsigned int t = 0;
+    liquid_timer timer = liquid_timer_create(LIQUID_TIMER_CLOCK);
+    while (t < 3) {
+        liquid_timer_tic(timer);
+        for (i=0; i<num_blocks; i++) {
+            if (qd != NULL) FIRFILT(_execute_block)(qd, x, block_len, y);
+            else            FFTFILT(_execute)(qf, x, y);
+        }
+        float runtime = liquid_timer_toc(timer);
+        if (runtime < 1e-3f && num_blocks < (1U<<24)) {
+            num_blocks *= 2;
+            continue;
+        }
+        if (t==0 || runtime < t_min)
+            t_min = runtime;
+        t++;
+    }
+    liquid_timer_destroy(timer);
+
+    if (qd != NULL) FIRFILT(_destroy)(qd);
+    if (qf != NULL) FFTFILT(_destroy)(qf);
+    free(x);
+    free(y);
+    return t_min / (float)(num_blocks*block_len);
+}
+
+// search candidate block sizes for the fastest throughput
+static unsigned int FFTFILT(_autotune_search)(TC *         _h,
+                                              unsigned int _h_len,
+                                              unsigned int _max_block)
+{
+    // smallest unpartitioned block size, 2^k_full >= _h_len-1
+    unsigned int k_full = liquid_nextpow2(_h_len > 2 ? _h_len-1 : 1);
+
+    // candidates span partitioned (2^k < _h_len-1) through oversized blocks
+    unsigned int k_max = k_full + 3 > 8 ? k_full + 3 : 8;
+    unsigned int k_min = k_full > 10 ? k_full - 6 : 4;
+    if (k_max < k_min)
+        k_max = k_min;
+    if (_max_block > 0) {
+        unsigned int k_lim = liquid_nextpow2(_max_block+1) - 1; // floor(log2)
+        if (k_max > k_lim) k_max = k_lim;
+        if (k_min > k_max) k_min = k_max;
+    }
+
+    unsigned int k, n_best = 1 << k_max;
+    float t_best = 0.0f;
+    for (k=k_min; k<=k_max; k++) {
+        float t = FFTFILT(_autotune_measure)(_h, _h_len, 1<<k);
+        liquid_log_trace("fftfilt_%s_autotune(), h_len=%u, n=%u: %.3e s/sample",
+                EXTENSION_FULL, _h_len, 1<<k, t);
+        if (k==k_min || t < t_best) {
+            t_best = t;
+            n_best = 1 << k;
+        }
+    }
+    return n_best;
+}
+
+// look up fastest block size in cache, running search on first use
+static unsigned int FFTFILT(_autotune_block_size)(TC *         _h,
+                                                  unsigned int _h_len,
+                                                  unsigned int _max_block)
+{
+#if BUILD_PTHREADS
+    pthread_mutex_lock(&FFTFILT(_autotune_lock));
+#endif
+    unsigned int i, n = 0;
+    unsigned int num = FFTFILT(_autotune_cache_num) < FFTFILT_AUTOTUNE_CACHE_LEN ?
+                       FFTFILT(_autotune_cache_num) : FFTFILT_AUTOTUNE_CACHE_LEN;
+    for (i=0; i<num; i++) {
+        if (FFTFILT(_autotune_cache)[i].h_len     == _h_len &&
+            FFTFILT(_autotune_cache)[i].max_block == _max_block)
+        {
+            n = FFTFILT(_autotune_cache)[i].n;
+            break;
+        }
+    }
+
+    if (n == 0) {
+        n = FFTFILT(_autotune_search)(_h, _h_len, _max_block);
+
+        // store result, replacing oldest entry once cache is full
+        i = FFTFILT(_autotune_cache_num) % FFTFILT_AUTOTUNE_CACHE_LEN;
+        FFTFILT(_autotune_cache)[i].h_len     = _h_len;
+        FFTFILT(_autotune_cache)[i].max_block = _max_block;
+        FFTFILT(_autotune_cache)[i].n         = n;
+        FFTFILT(_autotune_cache_num)++;
+        liquid_log_debug("fftfilt_%s_autotune(), h_len=%u, max_block=%u: selected n=%u",
+                EXTENSION_FULL, _h_len, _max_block, n);
+    }
+#if BUILD_PTHREADS
+    pthread_mutex_unlock(&FFTFILT(_autotune_lock));
+#endif
+    return n;
+}
+
+// create FFT-based FIR filter, selecting the block size with the highest
+// throughput on this host
+//  _h          : filter coefficients [size: _h_len x 1]
+//  _h_len      : filter length, _h_len > 0
+//  _max_block  : maximum block size (latency), 0 for no limit
+FFTFILT() FFTFILT(_create_autotune)(TC *         _h,
+                                    unsigned int _h_len,
+                                    unsigned int _max_block)
+{
+    // validate input
+    if (_h_len == 0)
+        return liquid_error_config("fftfilt_%s_create_autotune(), filter length must be greater than zero",EXTENSION_FULL);
+
+    unsigned int n = FFTFILT(_autotune_block_size)(_h, _h_len, _max_block);
+    return FFTFILT(_create_partitioned)(_h, _h_len, n);
+}
+
+// estimate filter length above which fftfilt outperforms firfilt on this
+// host; measured once and cached
+unsigned int FFTFILT(_autotune_crossover)(void)
+{
+#if BUILD_PTHREADS
+    pthread_mutex_lock(&FFTFILT(_crossover_lock));
+#endif
+    if (FFTFILT(_autotune_crossover_len) == 0) {
+        // double filter length until the tuned fftfilt beats firfilt
+        unsigned int h_len;
+        for (h_len=4; h_len<4096; h_len*=2) {
+            TC * h = (TC *) malloc(h_len*sizeof(TC));
+            unsigned int i;
+            for (i=0; i<h_len; i++)
+                h[i] = randnf();
+            unsigned int n = FFTFILT(_autotune_block_size)(h, h_len, 0);
+            float t_fft = FFTFILT(_autotune_measure)(h, h_len, n);
+            float t_fir = FFTFILT(_autotune_measure)(h, h_len, 0);
+            free(h);
+            liquid_log_trace("fftfilt_%s_autotune_crossover(), h_len=%u, firfilt: %.3e, fftfilt: %.3e s/sample",
+                    EXTENSION_FULL, h_len, t_fir, t_fft);
+            if (t_fft < t_fir)
+                break;
+        }
+        FFTFILT(_autotune_crossover_len) = h_len;
+        liquid_log_debug("fftfilt_%s_autotune_crossover(), crossover at h_len=%u",
+                EXTENSION_FULL, h_len);
+    }
+    unsigned int crossover = FFTFILT(_autotune_crossover_len);
+#if BUILD_PTHREADS
+    pthread_mutex_unlock(&FFTFILT(_crossover_lock));
+#endif
+    return crossover;
+}
@@ -31,6 +31,9 @@
 // NOTE: using the window is about 27% slower, but fixes a valgrind issue
 #define LIQUID_FIRFILT_USE_WINDOW   (1)
 
+// maximum number of output samples computed in each pass of execute_block()
+#define LIQUID_FIRFILT_BLOCK_LEN    (256)
+
 // firfilt object structure
 struct FIRFILT(_s) {
     TC * h;             // filter coefficients array [size; h_len x 1]
@@ -48,6 +51,12 @@ struct FIRFILT(_s) {
 #endif
     DOTPROD() dp;           // dot product object
     TC scale;               // output scaling factor
+
+    // buffer for block execution: filter history followed by new
+    // input samples [size: h_len - 1 + LIQUID_FIRFILT_BLOCK_LEN x 1]
+    TI * buf;
+
+    LIQUID_COUNTER_FIELD    // performance counters (when enabled)
 };
 
 // create firfilt object
@@ -82,9 +91,17 @@ FIRFILT() FIRFILT(_create)(TC * _h,
     // create dot product object with coefficients in reverse order
     q->dp = DOTPROD(_create_rev)(q->h, q->h_len);
 
+    // allocate buffer for block execution
+    q->buf = (TI *) malloc((q->h_len - 1 + LIQUID_FIRFILT_BLOCK_LEN)*sizeof(TI));
+
     // set default scaling
     q->scale = 1;
 
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "firfilt_" EXTENSION_FULL);
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct FIRFILT(_s)) +
+        q->h_len*sizeof(TC) + (q->h_len - 1 + LIQUID_FIRFILT_BLOCK_LEN)*sizeof(TI));
+
     // reset filter state (clear buffer)
     FIRFILT(_reset)(q);
 
@@ -269,6 +286,8 @@ FIRFILT() FIRFILT(_recreate)(FIRFILT() _q,
         _q->w       = (TI *) malloc((_q->w_len + _q->h_len + 1)*sizeof(TI));
         _q->w_index = 0;
 #endif
+        // reallocate buffer for block execution
+        _q->buf = (TI *) realloc(_q->buf, (_q->h_len - 1 + LIQUID_FIRFILT_BLOCK_LEN)*sizeof(TI));
     }
 
     // move coefficients
@@ -302,20 +321,30 @@ FIRFILT() FIRFILT(_copy)(FIRFILT() q_orig)
     q_copy->w = (TI *) liquid_malloc_copy(q_orig->w, q_orig->w_len, sizeof(TI));
 #endif
 
-    // copy dot product object and return
+    // allocate buffer for block execution (contents need not be copied)
+    q_copy->buf = (TI *) malloc((q_copy->h_len - 1 + LIQUID_FIRFILT_BLOCK_LEN)*sizeof(TI));
+
+    // copy dot product object
     q_copy->dp    = DOTPROD(_copy)(q_orig->dp);
+
+    // register performance counters for new object
+    LIQUID_COUNTER_REGISTER(q_copy, "firfilt_" EXTENSION_FULL);
+    LIQUID_COUNTER_ALLOC(q_copy, sizeof(struct FIRFILT(_s)) +
+        q_copy->h_len*sizeof(TC) + (q_copy->h_len - 1 + LIQUID_FIRFILT_BLOCK_LEN)*sizeof(TI));
     return q_copy;
 }
 
 // destroy firfilt object
 int FIRFILT(_destroy)(FIRFILT() _q)
 {
+    LIQUID_COUNTER_UNREGISTER(_q);
 #if LIQUID_FIRFILT_USE_WINDOW
     WINDOW(_destroy)(_q->w);
 #else
     free(_q->w);
 #endif
     DOTPROD(_destroy)(_q->dp);
+    free(_q->buf);
     free(_q->h);
     free(_q);
     return LIQUID_OK;
@@ -415,6 +444,8 @@ int FIRFILT(_write)(FIRFILT()    _q,
 int FIRFILT(_execute)(FIRFILT() _q,
                       TO *      _y)
 {
+    LIQUID_COUNTER_START(_q);
+
     // read buffer (retrieve pointer to aligned memory array)
 #if LIQUID_FIRFILT_USE_WINDOW
     TI *r;
@@ -428,6 +459,7 @@ int FIRFILT(_execute)(FIRFILT() _q,
 
     // apply scaling factor
     *_y *= _q->scale;
+    LIQUID_COUNTER_STOP(_q, 1);
     return LIQUID_OK;
 }
 
@@ -451,14 +483,47 @@ int FIRFILT(_execute_block)(FIRFILT()    _q,
                             unsigned int _n,
                             TO *         _y)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        // push sample into filter
-        FIRFILT(_push)(_q, _x[i]);
+    LIQUID_COUNTER_START(_q);
+
+    // length of filter history preceding each block
+    unsigned int m = _q->h_len - 1;
+
+    unsigned int i, k = 0;
+    while (k < _n) {
+        // number of samples to process in this pass
+        unsigned int num = _n - k < LIQUID_FIRFILT_BLOCK_LEN ? _n - k : LIQUID_FIRFILT_BLOCK_LEN;
+
+        // read buffer (retrieve pointer to aligned memory array)
+#if LIQUID_FIRFILT_USE_WINDOW
+        TI *r;
+        WINDOW(_read)(_q->w, &r);
+#else
+        TI *r = _q->w + _q->w_index;
+#endif
+
+        // arrange history and new inputs contiguously; this also
+        // protects the input from being overwritten when _x == _y
+        memmove(_q->buf,     r+1,    m  *sizeof(TI));
+        memmove(_q->buf + m, _x + k, num*sizeof(TI));
+
+        // update internal buffer; only the most recent h_len samples
+        // need to be retained
+        if (num < _q->h_len)
+            FIRFILT(_write)(_q, _q->buf + m, num);
+        else
+            FIRFILT(_write)(_q, _q->buf + num - 1, _q->h_len);
+
+        // compute all output samples in this pass at once
+        DOTPROD(_execute_block)(_q->dp, _q->buf, num, _y + k);
+
+        // apply scaling factor
+        for (i=0; i<num; i++)
+            _y[k+i] *= _q->scale;
 
-        // compute output sample
-        FIRFILT(_execute)(_q, &_y[i]);
+        // advance to next pass
+        k += num;
     }
+    LIQUID_COUNTER_STOP(_q, _n);
     return LIQUID_OK;
 }
 
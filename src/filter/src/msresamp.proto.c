@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007 - 2022 Joseph Gaeddert
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -33,6 +33,10 @@
 
 #define min(a,b) ((a)<(b)?(a):(b))
 
+// length of buffer between the arbitrary and half-band stages for block
+// execution
+#define MSRESAMP_BLOCK_LEN (256)
+
 // 
 // forward declaration of internal methods
 //
@@ -73,6 +77,9 @@ struct MSRESAMP(_s) {
     unsigned int buffer_len;            // length of each buffer
     T * buffer;                         // buffer[0]
     unsigned int buffer_index;          // index of buffer
+
+    // buffer between arbitrary and half-band stages
+    T * buffer_block;                   // [size: MSRESAMP_BLOCK_LEN x 1]
 };
 
 // create msresamp object
@@ -122,6 +129,7 @@ MSRESAMP() MSRESAMP(_create)(float _r,
     // allocate memory for buffer
     q->buffer_len = 4 + (1 << q->num_halfband_stages);
     q->buffer = (T*) malloc( q->buffer_len*sizeof(T) );
+    q->buffer_block = (T*) malloc( MSRESAMP_BLOCK_LEN*sizeof(T) );
 
     // create single multi-stage half-band resampler object
     // TODO: compute appropriate cut-off frequency
@@ -162,6 +170,7 @@ MSRESAMP() MSRESAMP(_copy)(MSRESAMP() q_orig)
     // create and copy buffer
     q_copy->buffer = (T*) malloc( q_copy->buffer_len*sizeof(T) );
     memmove(q_copy->buffer, q_orig->buffer, q_copy->buffer_len*sizeof(T) );
+    q_copy->buffer_block = (T*) malloc( MSRESAMP_BLOCK_LEN*sizeof(T) );
 
     // return object
     return q_copy;
@@ -170,8 +179,9 @@ MSRESAMP() MSRESAMP(_copy)(MSRESAMP() q_orig)
 // destroy msresamp object, freeing all internally-allocated memory
 int MSRESAMP(_destroy)(MSRESAMP() _q)
 {
-    // free buffer
+    // free buffers
     free(_q->buffer);
+    free(_q->buffer_block);
 
     // destroy arbitrary resampler
     RESAMP(_destroy)(_q->arbitrary_resamp);
@@ -346,20 +356,21 @@ int MSRESAMP(_interp_execute)(MSRESAMP()     _q,
     unsigned int nw;
     unsigned int ny = 0;
 
-    // operate one sample at a time so that we don't overflow the internal
-    // buffer
-    for (i=0; i<_nx; i++) {
+    // Operate on chunks of input small enough that the arbitrary resampler
+    // output (at most two samples per input) fits in the internal buffer,
+    // then run the half-band cascade on the whole buffer at once.
+    unsigned int num_inputs = MSRESAMP_BLOCK_LEN / 2;
+    for (i=0; i<_nx; i+=num_inputs) {
+        unsigned int n = min(_nx-i, num_inputs);
+
         // run arbitrary resampler
-        RESAMP(_execute)(_q->arbitrary_resamp, _x[i], _q->buffer, &nw);
+        RESAMP(_execute_block)(_q->arbitrary_resamp, _x+i, n, _q->buffer_block, &nw);
 
-        // run multi-stage half-band resampler on each output sample
-        unsigned int k;
-        for (k=0; k<nw; k++) {
-            MSRESAMP2(_execute)(_q->halfband_resamp, &_q->buffer[k], &_y[ny]);
+        // run multi-stage half-band resampler on all outputs at once
+        MSRESAMP2(_execute_block)(_q->halfband_resamp, _q->buffer_block, nw, &_y[ny]);
 
-            // increase output counter by halfband interpolation rate
-            ny += 1 << _q->num_halfband_stages;
-        }
+        // increase output counter by halfband interpolation rate
+        ny += nw << _q->num_halfband_stages;
     }
 
     // set return value for number of samples written
@@ -378,17 +389,18 @@ int MSRESAMP(_decim_execute)(MSRESAMP()     _q,
                              TO *           _y,
                              unsigned int * _ny)
 {
-    unsigned int i;
+    unsigned int i = 0;
     unsigned int M = 1 << _q->num_halfband_stages;
     unsigned int nw;        // number of samples written for arbitrary resamp
     unsigned int ny = 0;    // running counter of output samples
     TO halfband_output;     // single half-band decimator output sample
 
-    // write samples to buffer until it contains 2^num_halfband_stages
-    // TODO: write block of samples
-    for (i=0; i<_nx; i++) {
-        // push sample into buffer
-        _q->buffer[_q->buffer_index++] = _x[i];
+    // complete any partially-filled buffer from a previous call
+    if (_q->buffer_index > 0) {
+        unsigned int n = min(_nx, M - _q->buffer_index);
+        memmove(&_q->buffer[_q->buffer_index], _x, n*sizeof(TI));
+        _q->buffer_index += n;
+        i = n;
 
         // check if buffer has 'M' elements
         if (_q->buffer_index == M) {
@@ -406,6 +418,20 @@ int MSRESAMP(_decim_execute)(MSRESAMP()     _q,
         }
     }
 
+    // run the half-band cascade directly on the input, one chunk of
+    // half-band outputs at a time, then the arbitrary resampler on each
+    while (_nx - i >= M) {
+        unsigned int n = min((_nx-i) / M, MSRESAMP_BLOCK_LEN);
+        MSRESAMP2(_execute_block)(_q->halfband_resamp, _x+i, n, _q->buffer_block);
+        RESAMP(_execute_block)(_q->arbitrary_resamp, _q->buffer_block, n, &_y[ny], &nw);
+        ny += nw;
+        i  += n*M;
+    }
+
+    // buffer remaining samples
+    memmove(&_q->buffer[_q->buffer_index], &_x[i], (_nx-i)*sizeof(TI));
+    _q->buffer_index += _nx - i;
+
     // set return value for number of samples written
     *_ny = ny;
     return LIQUID_OK;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007 - 2023 Joseph Gaeddert
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -31,6 +31,10 @@
 
 #include "liquid.internal.h"
 
+// number of samples at the widest stage processed at a time by
+// execute_block(); sizes the intermediate stage buffers
+#define MSRESAMP2_BLOCK_LEN (512)
+
 // 
 // forward declaration of internal methods
 //
@@ -54,6 +58,7 @@ struct MSRESAMP2(_s) {
     RESAMP2() *     resamp2;    // array of half-band resamplers
     T *             buffer0;    // buffer[0]
     T *             buffer1;    // buffer[1]
+    unsigned int    buffer_len;    // length of each buffer
     unsigned int    buffer_index;  // index of buffer
     float           zeta;       // scaling factor
 };
@@ -74,6 +79,26 @@ int MSRESAMP2(_decim_execute)(MSRESAMP2() _q,
                               TI *        _x,
                               TO *        _y);
 
+// execute multi-stage resampler as interpolator on a block of samples
+//  _q      : msresamp object
+//  _x      : input sample array  [size: _n x 1]
+//  _n      : number of input samples
+//  _y      : output sample array [size: _n*2^_num_stages x 1]
+int MSRESAMP2(_interp_execute_block)(MSRESAMP2()  _q,
+                                     TI *         _x,
+                                     unsigned int _n,
+                                     TO *         _y);
+
+// execute multi-stage resampler as decimator on a block of samples
+//  _q      : msresamp object
+//  _x      : input sample array  [size: _n*2^_num_stages x 1]
+//  _n      : number of output samples
+//  _y      : output sample array [size: _n x 1]
+int MSRESAMP2(_decim_execute_block)(MSRESAMP2()  _q,
+                                    TI *         _x,
+                                    unsigned int _n,
+                                    TO *         _y);
+
 // create multi-stage half-band resampler
 //  _type       : resampler type (e.g. LIQUID_RESAMP_DECIM)
 //  _num_stages : number of resampling stages
@@ -115,9 +140,10 @@ MSRESAMP2() MSRESAMP2(_create)(int          _type,
     q->M    = 1 << q->num_stages;
     q->zeta = 1.0f / (float)(q->M);
 
-    // allocate memory for buffers
-    q->buffer0 = (T*) malloc( q->M * sizeof(T) );
-    q->buffer1 = (T*) malloc( q->M * sizeof(T) );
+    // allocate memory for buffers, large enough for block execution
+    q->buffer_len = q->M > MSRESAMP2_BLOCK_LEN ? q->M : MSRESAMP2_BLOCK_LEN;
+    q->buffer0 = (T*) malloc( q->buffer_len * sizeof(T) );
+    q->buffer1 = (T*) malloc( q->buffer_len * sizeof(T) );
 
     // allocate arrays for half-band resampler parameters
     q->fc_stage = (float*)        malloc(q->num_stages*sizeof(float)       );
@@ -174,8 +200,8 @@ MSRESAMP2() MSRESAMP2(_copy)(MSRESAMP2() q_orig)
     memmove(q_copy, q_orig, sizeof(struct MSRESAMP2(_s)));
 
     // allocate memory for buffers
-    q_copy->buffer0 = (T*) malloc( q_copy->M * sizeof(T) );
-    q_copy->buffer1 = (T*) malloc( q_copy->M * sizeof(T) );
+    q_copy->buffer0 = (T*) malloc( q_copy->buffer_len * sizeof(T) );
+    q_copy->buffer1 = (T*) malloc( q_copy->buffer_len * sizeof(T) );
 
     // allocate arrays for half-band resampler parameters
     q_copy->fc_stage = (float*)        malloc(q_copy->num_stages*sizeof(float)       );
@@ -343,6 +369,31 @@ int MSRESAMP2(_execute)(MSRESAMP2() _q,
     return liquid_error(LIQUID_EINT,"msresamp2_%s_execute(), invalid internal mode",EXTENSION_FULL);
 }
 
+// execute multi-stage resampler _n times on a block of samples
+//  _q      : msresamp object
+//  _x      : input sample array
+//  _n      : number of executions
+//  _y      : output sample array
+int MSRESAMP2(_execute_block)(MSRESAMP2()  _q,
+                              TI *         _x,
+                              unsigned int _n,
+                              TO *         _y)
+{
+    // switch resampling method based on type
+    if (_q->num_stages == 0) {
+        // pass through
+        memmove(_y, _x, _n*sizeof(TO));
+        return LIQUID_OK;
+    } else if (_q->type == LIQUID_RESAMP_INTERP) {
+        // execute multi-stage resampler as interpolator
+        return MSRESAMP2(_interp_execute_block)(_q, _x, _n, _y);
+    } else {
+        // execute multi-stage resampler as decimator
+        return MSRESAMP2(_decim_execute_block)(_q, _x, _n, _y);
+    }
+    return liquid_error(LIQUID_EINT,"msresamp2_%s_execute_block(), invalid internal mode",EXTENSION_FULL);
+}
+
 //
 // internal methods
 //
@@ -418,3 +469,81 @@ int MSRESAMP2(_decim_execute)(MSRESAMP2() _q,
     return LIQUID_OK;
 }
 
+// execute multi-stage resampler as interpolator on a block of samples
+//  _q      : msresamp object
+//  _x      : input sample array  [size: _n x 1]
+//  _n      : number of input samples
+//  _y      : output sample array [size: _n*2^_num_stages x 1]
+int MSRESAMP2(_interp_execute_block)(MSRESAMP2()  _q,
+                                     TI *         _x,
+                                     unsigned int _n,
+                                     TO *         _y)
+{
+    // number of inputs per pass such that the widest intermediate stage
+    // fits in the internal buffers
+    unsigned int num_inputs = _q->buffer_len / _q->M;
+
+    unsigned int i;
+    for (i=0; i<_n; i+=num_inputs) {
+        unsigned int n = (_n-i) < num_inputs ? (_n-i) : num_inputs;
+
+        // run each stage across the full pass before the next
+        T * b0 = _x + i;        // input buffer pointer
+        T * b1 = _q->buffer1;   // output buffer pointer
+        unsigned int s;
+        for (s=0; s<_q->num_stages; s++) {
+            // set final stage output as supplied output pointer
+            if (s == _q->num_stages-1)
+                b1 = _y + i*_q->M;
+
+            RESAMP2(_interp_execute_block)(_q->resamp2[s], b0, n << s, b1);
+
+            // toggle output buffer pointers
+            b0 = (s % 2) == 0 ? _q->buffer1 : _q->buffer0;
+            b1 = (s % 2) == 0 ? _q->buffer0 : _q->buffer1;
+        }
+    }
+    return LIQUID_OK;
+}
+
+// execute multi-stage resampler as decimator on a block of samples
+//  _q      : msresamp object
+//  _x      : input sample array  [size: _n*2^_num_stages x 1]
+//  _n      : number of output samples
+//  _y      : output sample array [size: _n x 1]
+int MSRESAMP2(_decim_execute_block)(MSRESAMP2()  _q,
+                                    TI *         _x,
+                                    unsigned int _n,
+                                    TO *         _y)
+{
+    // number of outputs per pass such that the widest intermediate stage
+    // fits in the internal buffers
+    unsigned int num_outputs = _q->buffer_len / _q->M;
+
+    unsigned int i, k;
+    for (i=0; i<_n; i+=num_outputs) {
+        unsigned int n = (_n-i) < num_outputs ? (_n-i) : num_outputs;
+
+        // run each stage across the full pass before the next
+        T * b0 = _x + i*_q->M;  // input buffer pointer
+        T * b1 = _q->buffer1;   // output buffer pointer
+        unsigned int s;
+        for (s=0; s<_q->num_stages; s++) {
+            // set final stage output as supplied output pointer
+            if (s == _q->num_stages-1)
+                b1 = _y + i;
+
+            unsigned int g = _q->num_stages-s-1;    // reversed resampler index
+            RESAMP2(_decim_execute_block)(_q->resamp2[g], b0, n << g, b1);
+
+            // toggle output buffer pointers
+            b0 = (s % 2) == 0 ? _q->buffer1 : _q->buffer0;
+            b1 = (s % 2) == 0 ? _q->buffer0 : _q->buffer1;
+        }
+
+        // scale output appropriately
+        for (k=0; k<n; k++)
+            _y[i+k] *= _q->zeta;
+    }
+    return LIQUID_OK;
+}
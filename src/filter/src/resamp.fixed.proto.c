@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007 - 2022 Joseph Gaeddert
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -29,6 +29,22 @@
 
 #define DEBUG_RESAMP_PRINT  0
 
+// number of input samples buffered and number of outputs scheduled at a
+// time by execute_block()
+#define RESAMP_BLOCK_LEN    (256)
+
+// internal: run resampler on contiguous buffer of input samples
+//  _q      : resampling object
+//  _r      : input buffer with history, [size: h_sub_len-1+_nx x 1]
+//  _nx     : number of new input samples
+//  _y      : output sample array
+//  _ny     : number of samples written to _y
+int RESAMP(_execute_buffer)(RESAMP()       _q,
+                            TI *           _r,
+                            unsigned int   _nx,
+                            TO *           _y,
+                            unsigned int * _ny);
+
 // main object
 struct RESAMP(_s) {
     // filter design parameters
@@ -42,7 +58,15 @@ struct RESAMP(_s) {
     uint32_t        phase;  // sampling phase
     unsigned int    bits_index;
     unsigned int    npfb;   // 256
-    FIRPFB()        pfb;    // filter bank
+
+    // filter bank, one dot product per phase
+    unsigned int    h_sub_len;  // length of each filter in the bank
+    DOTPROD() *     dp;         // filter bank dot products
+    WINDOW()        w;          // input sample buffer
+    TC              scale;      // output scaling factor
+
+    // contiguous input buffer for execute_block()
+    TI *            buf;        // [size: h_sub_len-1+RESAMP_BLOCK_LEN x 1]
 };
 
 // create arbitrary resampler
@@ -102,7 +126,20 @@ RESAMP() RESAMP(_create)(float        _rate,
     // copy to type-specific array, applying gain
     for (i=0; i<n; i++)
         h[i] = hf[i]*gain;
-    q->pfb = FIRPFB(_create)(q->npfb,h,n-1);
+
+    // create filter bank, loading each filter in reverse order
+    q->h_sub_len = 2*q->m;
+    q->dp = (DOTPROD()*) malloc(q->npfb*sizeof(DOTPROD()));
+    TC h_sub[q->h_sub_len];
+    unsigned int k;
+    for (i=0; i<q->npfb; i++) {
+        for (k=0; k<q->h_sub_len; k++)
+            h_sub[q->h_sub_len-k-1] = h[i + k*q->npfb];
+        q->dp[i] = DOTPROD(_create)(h_sub, q->h_sub_len);
+    }
+    q->w     = WINDOW(_create)(q->h_sub_len);
+    q->scale = 1;
+    q->buf   = (TI*) malloc((q->h_sub_len-1+RESAMP_BLOCK_LEN)*sizeof(TI));
 
     // free allocated arrays
     free(hf);
@@ -146,8 +183,13 @@ RESAMP() RESAMP(_copy)(RESAMP() q_orig)
     RESAMP() q_copy = (RESAMP()) malloc(sizeof(struct RESAMP(_s)));
     memmove(q_copy, q_orig, sizeof(struct RESAMP(_s)));
 
-    // copy filter bank
-    q_copy->pfb = FIRPFB(_copy)(q_orig->pfb);
+    // copy filter bank and buffers
+    unsigned int i;
+    q_copy->dp = (DOTPROD()*) malloc(q_copy->npfb*sizeof(DOTPROD()));
+    for (i=0; i<q_copy->npfb; i++)
+        q_copy->dp[i] = DOTPROD(_copy)(q_orig->dp[i]);
+    q_copy->w   = WINDOW(_copy)(q_orig->w);
+    q_copy->buf = (TI*) liquid_malloc_copy(q_orig->buf, q_copy->h_sub_len-1+RESAMP_BLOCK_LEN, sizeof(TI));
 
     // return object
     return q_copy;
@@ -156,8 +198,13 @@ RESAMP() RESAMP(_copy)(RESAMP() q_orig)
 // free arbitrary resampler object
 int RESAMP(_destroy)(RESAMP() _q)
 {
-    // free polyphase filterbank
-    FIRPFB(_destroy)(_q->pfb);
+    // free polyphase filterbank and buffers
+    unsigned int i;
+    for (i=0; i<_q->npfb; i++)
+        DOTPROD(_destroy)(_q->dp[i]);
+    free(_q->dp);
+    WINDOW(_destroy)(_q->w);
+    free(_q->buf);
 
     // free main object memory
     free(_q);
@@ -179,8 +226,8 @@ int RESAMP(_reset)(RESAMP() _q)
     // reset state
     _q->phase = 0;
 
-    // clear filterbank
-    return FIRPFB(_reset)(_q->pfb);
+    // clear input buffer
+    return WINDOW(_reset)(_q->w);
 }
 
 // get resampler filter delay (semi-length m)
@@ -189,6 +236,22 @@ unsigned int RESAMP(_get_delay)(RESAMP() _q)
     return _q->m;
 }
 
+// Set output scaling for resampler
+int RESAMP(_set_scale)(RESAMP() _q,
+                       TC       _scale)
+{
+    _q->scale = _scale;
+    return LIQUID_OK;
+}
+
+// Get output scaling for resampler
+int RESAMP(_get_scale)(RESAMP() _q,
+                       TC *     _scale)
+{
+    *_scale = _q->scale;
+    return LIQUID_OK;
+}
+
 // set rate of arbitrary resampler
 //  _q      : resampling object
 //  _rate   : new sampling rate, _rate > 0
@@ -290,14 +353,17 @@ int RESAMP(_execute)(RESAMP()       _q,
                      unsigned int * _num_written)
 {
     // push input
-    FIRPFB(_push)(_q->pfb, _x);
+    WINDOW(_push)(_q->w, _x);
+    TI * r;
+    WINDOW(_read)(_q->w, &r);
 
     // continue to produce output
     unsigned int n=0;
     while (_q->phase <= 0x00ffffff) {
         //unsigned int index = (_q->phase + 0x00008000) >> 16;
         unsigned int index = _q->phase >> (24 - _q->bits_index); // round down
-        FIRPFB(_execute)(_q->pfb, index, &_y[n++]);
+        DOTPROD(_execute)(_q->dp[index], r, &_y[n]);
+        _y[n++] *= _q->scale;
         _q->phase += _q->step;
     }
 
@@ -321,20 +387,26 @@ int RESAMP(_execute_block)(RESAMP()       _q,
                            TO *           _y,
                            unsigned int * _ny)
 {
-    // initialize number of output samples to zero
+    // Copy the filter history followed by each chunk of input into a
+    // contiguous buffer so every output is a single dot product at an
+    // offset into the buffer rather than a push and read of the window.
+    unsigned int p = _q->h_sub_len - 1;
     unsigned int ny = 0;
-
-    // number of samples written for each individual iteration
-    unsigned int num_written;
-
-    // iterate over each input sample
     unsigned int i;
-    for (i=0; i<_nx; i++) {
-        // run resampler on single input
-        RESAMP(_execute)(_q, _x[i], &_y[ny], &num_written);
-
-        // update output counter
+    TI * r;
+    for (i=0; i<_nx; i+=RESAMP_BLOCK_LEN) {
+        unsigned int n = (_nx-i) < RESAMP_BLOCK_LEN ? (_nx-i) : RESAMP_BLOCK_LEN;
+        WINDOW(_read)(_q->w, &r);
+        memmove(_q->buf,   r+1,  p*sizeof(TI));
+        memmove(_q->buf+p, _x+i, n*sizeof(TI));
+
+        // run resampler on buffer
+        unsigned int num_written;
+        RESAMP(_execute_buffer)(_q, _q->buf, n, _y+ny, &num_written);
         ny += num_written;
+
+        // retain most recent samples as history
+        WINDOW(_write)(_q->w, _x+i, n);
     }
 
     // set return value for number of output samples written
@@ -342,3 +414,57 @@ int RESAMP(_execute_block)(RESAMP()       _q,
     return LIQUID_OK;
 }
 
+//
+// internal methods
+//
+
+// run resampler on contiguous buffer of input samples; the filter
+// for input sample i is applied to _r[i], ..., _r[i+h_sub_len-1]
+//  _q      : resampling object
+//  _r      : input buffer with history, [size: h_sub_len-1+_nx x 1]
+//  _nx     : number of new input samples
+//  _y      : output sample array
+//  _ny     : number of samples written to _y
+int RESAMP(_execute_buffer)(RESAMP()       _q,
+                            TI *           _r,
+                            unsigned int   _nx,
+                            TO *           _y,
+                            unsigned int * _ny)
+{
+    // output schedule: input offset and filter index for each output
+    unsigned int offset[RESAMP_BLOCK_LEN];
+    unsigned int index [RESAMP_BLOCK_LEN];
+    unsigned int shift = 24 - _q->bits_index;
+
+    unsigned int ny = 0;
+    unsigned int i = 0;
+    while (i < _nx) {
+        // advance phase accumulator to fill schedule
+        unsigned int num_scheduled = 0;
+        while (i < _nx && num_scheduled < RESAMP_BLOCK_LEN) {
+            while (_q->phase <= 0x00ffffff && num_scheduled < RESAMP_BLOCK_LEN) {
+                offset[num_scheduled] = i;
+                index [num_scheduled] = _q->phase >> shift; // round down
+                num_scheduled++;
+                _q->phase += _q->step;
+            }
+
+            // move to next input once all of its outputs are scheduled
+            if (_q->phase > 0x00ffffff) {
+                _q->phase -= (1<<24);
+                i++;
+            }
+        }
+
+        // compute scheduled outputs
+        unsigned int k;
+        for (k=0; k<num_scheduled; k++) {
+            DOTPROD(_execute)(_q->dp[index[k]], _r + offset[k], &_y[ny+k]);
+            _y[ny+k] *= _q->scale;
+        }
+        ny += num_scheduled;
+    }
+
+    *_ny = ny;
+    return LIQUID_OK;
+}
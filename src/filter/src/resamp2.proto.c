@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007 - 2023 Joseph Gaeddert
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -27,6 +27,10 @@
 #include <stdlib.h>
 #include <math.h>
 
+// maximum number of samples per branch processed at a time by the block
+// execution methods
+#define RESAMP2_BLOCK_LEN   (256)
+
 struct RESAMP2(_s) {
     TC *            h;      // filter prototype
     unsigned int    m;      // primitive filter length
@@ -44,6 +48,10 @@ struct RESAMP2(_s) {
     WINDOW()        w1;     // input buffer (odd samples)
     TC              scale;  // output scaling factor
 
+    // contiguous branch buffers for block execution
+    TI *            buf0;   // delay branch  [size: 2*m-1+RESAMP2_BLOCK_LEN x 1]
+    TI *            buf1;   // filter branch [size: 2*m-1+RESAMP2_BLOCK_LEN x 1]
+
     // halfband filter operation
     unsigned int    toggle;
 };
@@ -104,6 +112,10 @@ RESAMP2() RESAMP2(_create)(unsigned int _m,
     q->w0 = WINDOW(_create)(2*(q->m));
     q->w1 = WINDOW(_create)(2*(q->m));
 
+    // allocate branch buffers for block execution
+    q->buf0 = (TI*) malloc((q->h1_len-1+RESAMP2_BLOCK_LEN)*sizeof(TI));
+    q->buf1 = (TI*) malloc((q->h1_len-1+RESAMP2_BLOCK_LEN)*sizeof(TI));
+
     RESAMP2(_reset)(q);
     RESAMP2(_set_scale)(q, 1);
 
@@ -179,6 +191,10 @@ RESAMP2() RESAMP2(_copy)(RESAMP2() q_orig)
     q_copy->w0 = WINDOW (_copy)(q_orig->w0);
     q_copy->w1 = WINDOW (_copy)(q_orig->w1);
 
+    // allocate branch buffers for block execution
+    q_copy->buf0 = (TI*) malloc((q_copy->h1_len-1+RESAMP2_BLOCK_LEN)*sizeof(TI));
+    q_copy->buf1 = (TI*) malloc((q_copy->h1_len-1+RESAMP2_BLOCK_LEN)*sizeof(TI));
+
     // return object
     return q_copy;
 }
@@ -196,6 +212,8 @@ int RESAMP2(_destroy)(RESAMP2() _q)
     // free arrays
     free(_q->h);
     free(_q->h1);
+    free(_q->buf0);
+    free(_q->buf1);
 
     // free main object memory
     free(_q);
@@ -393,3 +411,78 @@ int RESAMP2(_interp_execute)(RESAMP2() _q,
     return LIQUID_OK;
 }
 
+// execute half-band decimation on a block of samples
+//  _q      :   resamp2 object
+//  _x      :   input array [size: 2*_n x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+int RESAMP2(_decim_execute_block)(RESAMP2()    _q,
+                                  TI *         _x,
+                                  unsigned int _n,
+                                  TO *         _y)
+{
+    // Split each chunk of input into its even (filter) and odd (delay)
+    // branches behind the samples retained in the windows, so the filter
+    // branch is a single block dot product and the delay branch a copy.
+    unsigned int p = _q->h1_len - 1;
+    unsigned int i, k;
+    TI * r;
+    for (i=0; i<_n; i+=RESAMP2_BLOCK_LEN) {
+        unsigned int n = (_n-i) < RESAMP2_BLOCK_LEN ? (_n-i) : RESAMP2_BLOCK_LEN;
+        WINDOW(_read)(_q->w0, &r);
+        memmove(_q->buf0, r+1, p*sizeof(TI));
+        WINDOW(_read)(_q->w1, &r);
+        memmove(_q->buf1, r+1, p*sizeof(TI));
+        for (k=0; k<n; k++) {
+            _q->buf1[p+k] = _x[2*(i+k)  ];
+            _q->buf0[p+k] = _x[2*(i+k)+1];
+        }
+
+        // compute filter branch and add delay branch
+        DOTPROD(_execute_block)(_q->dp, _q->buf1, n, _y+i);
+        for (k=0; k<n; k++)
+            _y[i+k] = (_q->buf0[_q->m-1+k] + _y[i+k]) * _q->scale;
+
+        // retain most recent samples in each branch
+        WINDOW(_write)(_q->w0, _q->buf0+p, n);
+        WINDOW(_write)(_q->w1, _q->buf1+p, n);
+    }
+    return LIQUID_OK;
+}
+
+// execute half-band interpolation on a block of samples
+//  _q      :   resamp2 object
+//  _x      :   input array [size: _n x 1]
+//  _n      :   number of *input* samples
+//  _y      :   output array [size: 2*_n x 1]
+int RESAMP2(_interp_execute_block)(RESAMP2()    _q,
+                                   TI *         _x,
+                                   unsigned int _n,
+                                   TO *         _y)
+{
+    unsigned int p = _q->h1_len - 1;
+    unsigned int i, k;
+    TI * r;
+    TO   v[RESAMP2_BLOCK_LEN];
+    for (i=0; i<_n; i+=RESAMP2_BLOCK_LEN) {
+        unsigned int n = (_n-i) < RESAMP2_BLOCK_LEN ? (_n-i) : RESAMP2_BLOCK_LEN;
+        WINDOW(_read)(_q->w0, &r);
+        memmove(_q->buf0,   r+1,  p*sizeof(TI));
+        memmove(_q->buf0+p, _x+i, n*sizeof(TI));
+        WINDOW(_read)(_q->w1, &r);
+        memmove(_q->buf1,   r+1,  p*sizeof(TI));
+        memmove(_q->buf1+p, _x+i, n*sizeof(TI));
+
+        // compute filter branch and interleave with delay branch
+        DOTPROD(_execute_block)(_q->dp, _q->buf1, n, v);
+        for (k=0; k<n; k++) {
+            _y[2*(i+k)  ] = _q->buf0[_q->m-1+k] * _q->scale;
+            _y[2*(i+k)+1] = v[k]                * _q->scale;
+        }
+
+        // retain most recent samples in each branch
+        WINDOW(_write)(_q->w0, _x+i, n);
+        WINDOW(_write)(_q->w1, _x+i, n);
+    }
+    return LIQUID_OK;
+}
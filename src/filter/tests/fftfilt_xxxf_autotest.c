@@ -329,6 +329,9 @@ LIQUID_AUTOTEST(fftfilt_config,"fftfilt testbench","",0.1)
     float h[9] = {0,1,2,3,4,5,6,7,8,};
     LIQUID_CHECK(NULL ==fftfilt_crcf_create(h,0,64)); // filter length too small
     LIQUID_CHECK(NULL ==fftfilt_crcf_create(h,9, 7)); // block length too small
+    LIQUID_CHECK(NULL ==fftfilt_crcf_create_partitioned(h,0,64)); // filter length too small
+    LIQUID_CHECK(NULL ==fftfilt_crcf_create_partitioned(h,9, 0)); // block length too small
+    LIQUID_CHECK(NULL ==fftfilt_crcf_create_autotune(h,0,64)); // filter length too small
 
     // create proper object and test configurations
     fftfilt_crcf filt = fftfilt_crcf_create(h, 9, 64);
@@ -339,6 +342,8 @@ LIQUID_AUTOTEST(fftfilt_config,"fftfilt testbench","",0.1)
     LIQUID_CHECK(LIQUID_OK == fftfilt_crcf_get_scale(filt,  &scale));
     LIQUID_CHECK(scale ==  3.0f);
     LIQUID_CHECK(9 ==  fftfilt_crcf_get_length(filt));
+    LIQUID_CHECK(64 == fftfilt_crcf_get_block_size(filt));
+    LIQUID_CHECK(1 ==  fftfilt_crcf_get_num_partitions(filt));
 
     fftfilt_crcf_destroy(filt);
     _liquid_error_downgrade_disable();
@@ -385,3 +390,135 @@ LIQUID_AUTOTEST(fftfilt_copy,"fftfilt copy","",0.1)
     fftfilt_crcf_destroy(q1);
 }
 
+
+// compare partitioned fftfilt output against regular firfilt
+void testbench_fftfilt_crcf_partitioned(liquid_autotest __q__,
+                                        unsigned int    _h_len,
+                                        unsigned int    _n)
+{
+    float tol = 1e-3f;
+    unsigned int i, j, num_blocks = (2*_h_len)/_n + 4;
+
+    // generate random filter coefficients
+    float h[_h_len];
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf() / sqrtf(_h_len);
+
+    // create objects
+    fftfilt_crcf q0 = fftfilt_crcf_create_partitioned(h, _h_len, _n);
+    firfilt_crcf q1 = firfilt_crcf_create(h, _h_len);
+    LIQUID_CHECK(fftfilt_crcf_get_block_size(q0) == _n);
+    LIQUID_CHECK(fftfilt_crcf_get_num_partitions(q0) ==
+            (_h_len <= _n+1 ? 1 : (_h_len + _n - 1)/_n));
+
+    // run filters in parallel and compare results
+    float complex buf[_n], buf_0[_n], buf_1[_n];
+    for (i=0; i<num_blocks; i++) {
+        for (j=0; j<_n; j++)
+            buf[j] = randnf() + _Complex_I*randnf();
+        fftfilt_crcf_execute(q0, buf, buf_0);
+        firfilt_crcf_execute_block(q1, buf, _n, buf_1);
+        for (j=0; j<_n; j++) {
+            LIQUID_CHECK_DELTA( crealf(buf_0[j]), crealf(buf_1[j]), tol );
+            LIQUID_CHECK_DELTA( cimagf(buf_0[j]), cimagf(buf_1[j]), tol );
+        }
+    }
+
+    // destroy objects
+    fftfilt_crcf_destroy(q0);
+    firfilt_crcf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(fftfilt_crcf_partitioned_h200_n256,"partitioned fftfilt","",0.1)
+    { testbench_fftfilt_crcf_partitioned(__q__,  200, 256); }
+LIQUID_AUTOTEST(fftfilt_crcf_partitioned_h257_n256,"partitioned fftfilt","",0.1)
+    { testbench_fftfilt_crcf_partitioned(__q__,  257, 256); }
+LIQUID_AUTOTEST(fftfilt_crcf_partitioned_h258_n256,"partitioned fftfilt","",0.1)
+    { testbench_fftfilt_crcf_partitioned(__q__,  258, 256); }
+LIQUID_AUTOTEST(fftfilt_crcf_partitioned_h1000_n64,"partitioned fftfilt","",0.1)
+    { testbench_fftfilt_crcf_partitioned(__q__, 1000,  64); }
+LIQUID_AUTOTEST(fftfilt_crcf_partitioned_h4000_n48,"partitioned fftfilt","",0.1)
+    { testbench_fftfilt_crcf_partitioned(__q__, 4000,  48); }
+
+LIQUID_AUTOTEST(fftfilt_partitioned_reset,"partitioned fftfilt reset/copy","",0.1)
+{
+    // generate random filter coefficients
+    unsigned int i, j, h_len = 500, n = 64;
+    float h[h_len];
+    for (i=0; i<h_len; i++)
+        h[i] = randnf();
+
+    // run object for a while, then copy and reset
+    fftfilt_rrrf q0 = fftfilt_rrrf_create_partitioned(h, h_len, n);
+    fftfilt_rrrf q1 = fftfilt_rrrf_create_partitioned(h, h_len, n);
+    float buf[n], buf_0[n], buf_1[n];
+    for (i=0; i<20; i++) {
+        for (j=0; j<n; j++)
+            buf[j] = randnf();
+        fftfilt_rrrf_execute(q0, buf, buf_0);
+    }
+    fftfilt_rrrf q2 = fftfilt_rrrf_copy(q0);
+    fftfilt_rrrf_reset(q0);
+
+    // reset object should match fresh object; copy should match original
+    fftfilt_rrrf q3 = fftfilt_rrrf_copy(q2);
+    for (i=0; i<20; i++) {
+        for (j=0; j<n; j++)
+            buf[j] = randnf();
+        fftfilt_rrrf_execute(q0, buf, buf_0);
+        fftfilt_rrrf_execute(q1, buf, buf_1);
+        LIQUID_CHECK_ARRAY( buf_0, buf_1, n*sizeof(float));
+
+        fftfilt_rrrf_execute(q2, buf, buf_0);
+        fftfilt_rrrf_execute(q3, buf, buf_1);
+        LIQUID_CHECK_ARRAY( buf_0, buf_1, n*sizeof(float));
+    }
+
+    // destroy objects
+    fftfilt_rrrf_destroy(q0);
+    fftfilt_rrrf_destroy(q1);
+    fftfilt_rrrf_destroy(q2);
+    fftfilt_rrrf_destroy(q3);
+}
+
+LIQUID_AUTOTEST(fftfilt_autotune,"fftfilt block-size autotuning","",0.1)
+{
+    // generate random filter coefficients
+    unsigned int i, j, h_len = 300, max_block = 128;
+    float complex h[h_len];
+    for (i=0; i<h_len; i++)
+        h[i] = (randnf() + _Complex_I*randnf()) / sqrtf(2*h_len);
+
+    // create objects; tuned block size must be a power of two within limit
+    fftfilt_cccf q0 = fftfilt_cccf_create_autotune(h, h_len, max_block);
+    unsigned int n = fftfilt_cccf_get_block_size(q0);
+    LIQUID_CHECK(n <= max_block);
+    LIQUID_CHECK((n & (n-1)) == 0);
+
+    // tuning result is cached and reused
+    fftfilt_cccf q1 = fftfilt_cccf_create_autotune(h, h_len, max_block);
+    LIQUID_CHECK(fftfilt_cccf_get_block_size(q1) == n);
+    fftfilt_cccf_destroy(q1);
+
+    // compare against regular firfilt
+    firfilt_cccf q2 = firfilt_cccf_create(h, h_len);
+    float complex buf[n], buf_0[n], buf_1[n];
+    for (i=0; i<(2*h_len)/n + 4; i++) {
+        for (j=0; j<n; j++)
+            buf[j] = randnf() + _Complex_I*randnf();
+        fftfilt_cccf_execute(q0, buf, buf_0);
+        firfilt_cccf_execute_block(q2, buf, n, buf_1);
+        for (j=0; j<n; j++) {
+            LIQUID_CHECK_DELTA( crealf(buf_0[j]), crealf(buf_1[j]), 1e-3f );
+            LIQUID_CHECK_DELTA( cimagf(buf_0[j]), cimagf(buf_1[j]), 1e-3f );
+        }
+    }
+    fftfilt_cccf_destroy(q0);
+    firfilt_cccf_destroy(q2);
+
+    // crossover length is a power of two within search range, and cached
+    unsigned int crossover = fftfilt_rrrf_autotune_crossover();
+    LIQUID_CHECK(crossover >= 4 && crossover <= 4096);
+    LIQUID_CHECK((crossover & (crossover-1)) == 0);
+    LIQUID_CHECK(fftfilt_rrrf_autotune_crossover() == crossover);
+}
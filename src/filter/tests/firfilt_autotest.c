@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
 #include "liquid.autotest.h"
 #include "liquid.internal.h"
 
@@ -211,3 +212,101 @@ LIQUID_AUTOTEST(firfilt_push_write,"compare push vs write methods", "", 0.1)
     firfilt_rrrf_destroy(q1);
 }
 
+
+// compare block execution to pushing samples one at a time
+void testbench_firfilt_crcf_block(liquid_autotest __q__,
+                                  unsigned int    _h_len,
+                                  unsigned int    _block_len)
+{
+    float tol = 1e-3f;
+    unsigned int i, j;
+    float h[_h_len];
+    for (i=0; i<_h_len; i++)
+        h[i] = cosf(0.3f*i) + sinf(sqrtf(2.0f)*i);
+    firfilt_crcf q0 = firfilt_crcf_create(h, _h_len);
+    firfilt_crcf q1 = firfilt_crcf_create(h, _h_len);
+    firfilt_crcf_set_scale(q0, 2.0f);
+    firfilt_crcf_set_scale(q1, 2.0f);
+
+    // run several blocks through filter to exercise internal buffer wrapping
+    unsigned int num_blocks = 7;
+    float complex x[_block_len], y0[_block_len], y1[_block_len];
+    for (i=0; i<num_blocks; i++) {
+        for (j=0; j<_block_len; j++)
+            x[j] = cexpf(_Complex_I*(0.1f*j + 0.7f*i)) + 0.1f*j;
+
+        // run one sample at a time
+        for (j=0; j<_block_len; j++) {
+            firfilt_crcf_push(q0, x[j]);
+            firfilt_crcf_execute(q0, &y0[j]);
+        }
+
+        // run block in place
+        memmove(y1, x, _block_len*sizeof(float complex));
+        firfilt_crcf_execute_block(q1, y1, _block_len, y1);
+
+        for (j=0; j<_block_len; j++) {
+            LIQUID_CHECK_DELTA(crealf(y0[j]), crealf(y1[j]), tol);
+            LIQUID_CHECK_DELTA(cimagf(y0[j]), cimagf(y1[j]), tol);
+        }
+    }
+
+    // ensure internal state is consistent for subsequent single-sample execution
+    float complex v0, v1;
+    firfilt_crcf_execute(q0, &v0);
+    firfilt_crcf_execute(q1, &v1);
+    LIQUID_CHECK_DELTA(crealf(v0), crealf(v1), tol);
+    LIQUID_CHECK_DELTA(cimagf(v0), cimagf(v1), tol);
+
+    firfilt_crcf_destroy(q0);
+    firfilt_crcf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(firfilt_crcf_block_h1_n7,    "compare block to sample execution","",0.1) { testbench_firfilt_crcf_block(__q__,   1,   7); }
+LIQUID_AUTOTEST(firfilt_crcf_block_h13_n3,   "compare block to sample execution","",0.1) { testbench_firfilt_crcf_block(__q__,  13,   3); }
+LIQUID_AUTOTEST(firfilt_crcf_block_h13_n64,  "compare block to sample execution","",0.1) { testbench_firfilt_crcf_block(__q__,  13,  64); }
+LIQUID_AUTOTEST(firfilt_crcf_block_h63_n37,  "compare block to sample execution","",0.1) { testbench_firfilt_crcf_block(__q__,  63,  37); }
+LIQUID_AUTOTEST(firfilt_crcf_block_h127_n600,"compare block to sample execution","",0.1) { testbench_firfilt_crcf_block(__q__, 127, 600); }
+
+LIQUID_AUTOTEST(firfilt_cccf_block,"compare block to sample execution","",0.1)
+{
+    float tol = 1e-4f;
+    unsigned int i, h_len = 37, n = 300;
+    float complex h[h_len];
+    for (i=0; i<h_len; i++)
+        h[i] = cexpf(_Complex_I*0.3f*i) * expf(-0.1f*i);
+    firfilt_cccf q0 = firfilt_cccf_create(h, h_len);
+    firfilt_cccf q1 = firfilt_cccf_create(h, h_len);
+
+    float complex x[n], y0[n], y1[n];
+    for (i=0; i<n; i++) {
+        x[i] = cosf(0.21f*i) + _Complex_I*sinf(0.47f*i*i);
+        firfilt_cccf_execute_one(q0, x[i], &y0[i]);
+    }
+    firfilt_cccf_execute_block(q1, x, n, y1);
+    for (i=0; i<n; i++) {
+        LIQUID_CHECK_DELTA(crealf(y0[i]), crealf(y1[i]), tol);
+        LIQUID_CHECK_DELTA(cimagf(y0[i]), cimagf(y1[i]), tol);
+    }
+    firfilt_cccf_destroy(q0);
+    firfilt_cccf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(firfilt_rrrf_block,"compare block to sample execution","",0.1)
+{
+    float tol = 1e-4f;
+    unsigned int i, n = 300;
+    firfilt_rrrf q0 = firfilt_rrrf_create_kaiser(45, 0.1f, 60.0f, 0.0f);
+    firfilt_rrrf q1 = firfilt_rrrf_create_kaiser(45, 0.1f, 60.0f, 0.0f);
+
+    float x[n], y0[n], y1[n];
+    for (i=0; i<n; i++) {
+        x[i] = cosf(0.21f*i) + sinf(0.47f*i*i);
+        firfilt_rrrf_execute_one(q0, x[i], &y0[i]);
+    }
+    firfilt_rrrf_execute_block(q1, x, n, y1);
+    for (i=0; i<n; i++)
+        LIQUID_CHECK_DELTA(y0[i], y1[i], tol);
+    firfilt_rrrf_destroy(q0);
+    firfilt_rrrf_destroy(q1);
+}
@@ -126,3 +126,54 @@ LIQUID_AUTOTEST(msresamp2_copy,"test copy method", "", 0.1)
     msresamp2_crcf_destroy(q1);
 }
 
+
+// test that execute_block() matches invoking execute() on each block
+void testbench_msresamp2_crcf_block(liquid_autotest __q__,
+                                    int          _type,
+                                    unsigned int _num_stages)
+{
+    // create identical resamplers
+    msresamp2_crcf q0 = msresamp2_crcf_create(_type, _num_stages, 0.4f, 0.0f, 60.0f);
+    msresamp2_crcf q1 = msresamp2_crcf_create(_type, _num_stages, 0.4f, 0.0f, 60.0f);
+
+    // number of executions to run in sequence
+    unsigned int M = 1 << _num_stages;
+    unsigned int sizes[5] = {1, 3, 70, 2, 40};
+    unsigned int len = 70*M;
+    float complex x[len], y0[len], y1[len];
+    unsigned int i, j;
+    for (i=0; i<5; i++) {
+        unsigned int n    = sizes[i];
+        unsigned int n_in = _type == LIQUID_RESAMP_DECIM ? n*M : n;
+        unsigned int n_out= _type == LIQUID_RESAMP_DECIM ? n   : n*M;
+        for (j=0; j<n_in; j++)
+            x[j] = randnf() + _Complex_I*randnf();
+
+        // run block method
+        msresamp2_crcf_execute_block(q0, x, n, y0);
+
+        // run one execution at a time
+        for (j=0; j<n; j++) {
+            if (_type == LIQUID_RESAMP_DECIM)
+                msresamp2_crcf_execute(q1, x+j*M, y1+j);
+            else
+                msresamp2_crcf_execute(q1, x+j, y1+j*M);
+        }
+
+        for (j=0; j<n_out; j++) {
+            LIQUID_CHECK_DELTA(crealf(y0[j]), crealf(y1[j]), 1e-5f);
+            LIQUID_CHECK_DELTA(cimagf(y0[j]), cimagf(y1[j]), 1e-5f);
+        }
+    }
+
+    // clean up allocated objects
+    msresamp2_crcf_destroy(q0);
+    msresamp2_crcf_destroy(q1);
+}
+LIQUID_AUTOTEST(msresamp2_crcf_block_decim_0, "description","",0.1) { testbench_msresamp2_crcf_block(__q__, LIQUID_RESAMP_DECIM,  0); }
+LIQUID_AUTOTEST(msresamp2_crcf_block_decim_1, "description","",0.1) { testbench_msresamp2_crcf_block(__q__, LIQUID_RESAMP_DECIM,  1); }
+LIQUID_AUTOTEST(msresamp2_crcf_block_decim_4, "description","",0.1) { testbench_msresamp2_crcf_block(__q__, LIQUID_RESAMP_DECIM,  4); }
+LIQUID_AUTOTEST(msresamp2_crcf_block_decim_10,"description","",0.1) { testbench_msresamp2_crcf_block(__q__, LIQUID_RESAMP_DECIM, 10); }
+LIQUID_AUTOTEST(msresamp2_crcf_block_interp_1,"description","",0.1) { testbench_msresamp2_crcf_block(__q__, LIQUID_RESAMP_INTERP, 1); }
+LIQUID_AUTOTEST(msresamp2_crcf_block_interp_4,"description","",0.1) { testbench_msresamp2_crcf_block(__q__, LIQUID_RESAMP_INTERP, 4); }
+LIQUID_AUTOTEST(msresamp2_crcf_block_interp_10,"description","",0.1){ testbench_msresamp2_crcf_block(__q__, LIQUID_RESAMP_INTERP,10); }
@@ -167,3 +167,54 @@ LIQUID_AUTOTEST(msresamp_crcf_copy,"test copy method", "", 0.1)
     msresamp_crcf_destroy(q1);
 }
 
+
+// test that splitting the input into irregular blocks does not change output
+void testbench_msresamp_crcf_split(liquid_autotest __q__, float _rate)
+{
+    // create identical resamplers
+    msresamp_crcf q0 = msresamp_crcf_create(_rate, 60.0f);
+    msresamp_crcf q1 = msresamp_crcf_create(_rate, 60.0f);
+
+    // generate input
+    unsigned int i, num_input = 4000;
+    float complex x[num_input];
+    for (i=0; i<num_input; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // allocate output buffers
+    unsigned int max_output = 16 + (unsigned int)(2.0f * num_input * _rate);
+    float complex *y0 = (float complex*) malloc(max_output*sizeof(float complex));
+    float complex *y1 = (float complex*) malloc(max_output*sizeof(float complex));
+
+    // run entire input at once
+    unsigned int ny0;
+    msresamp_crcf_execute(q0, x, num_input, y0, &ny0);
+
+    // run irregular sized blocks
+    unsigned int sizes[6] = {1, 33, 700, 2, 1031, 5};
+    unsigned int ny1 = 0, nw, n = 0, k = 0;
+    while (n < num_input) {
+        unsigned int b = sizes[k++ % 6];
+        b = b < num_input - n ? b : num_input - n;
+        msresamp_crcf_execute(q1, x+n, b, y1+ny1, &nw);
+        n   += b;
+        ny1 += nw;
+    }
+
+    // check that the same samples were written
+    LIQUID_CHECK(ny0 ==  ny1);
+    for (i=0; i<ny0 && i<ny1; i++) {
+        LIQUID_CHECK_DELTA(crealf(y0[i]), crealf(y1[i]), 1e-5f);
+        LIQUID_CHECK_DELTA(cimagf(y0[i]), cimagf(y1[i]), 1e-5f);
+    }
+
+    // destroy objects
+    msresamp_crcf_destroy(q0);
+    msresamp_crcf_destroy(q1);
+    free(y0);
+    free(y1);
+}
+LIQUID_AUTOTEST(msresamp_crcf_split_0,"description","",0.1){ testbench_msresamp_crcf_split(__q__, 0.0071239f); }
+LIQUID_AUTOTEST(msresamp_crcf_split_1,"description","",0.1){ testbench_msresamp_crcf_split(__q__, 0.7123921f); }
+LIQUID_AUTOTEST(msresamp_crcf_split_2,"description","",0.1){ testbench_msresamp_crcf_split(__q__, 1.6180339f); }
+LIQUID_AUTOTEST(msresamp_crcf_split_3,"description","",0.1){ testbench_msresamp_crcf_split(__q__, 21.123456f); }
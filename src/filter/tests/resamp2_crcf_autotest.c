@@ -280,3 +280,47 @@ LIQUID_AUTOTEST(resamp2_copy,"test copy method", "", 0.1)
     resamp2_crcf_destroy(qb);
 }
 
+
+// test that block decimation and interpolation match sample-by-sample
+void testbench_resamp2_crcf_block(liquid_autotest __q__, int _decim)
+{
+    // create identical half-band resamplers
+    resamp2_crcf q0 = resamp2_crcf_create(9,0,60.0f);
+    resamp2_crcf q1 = resamp2_crcf_create(9,0,60.0f);
+    resamp2_crcf_set_scale(q0, 0.7f);
+    resamp2_crcf_set_scale(q1, 0.7f);
+
+    // block sizes to test in sequence, including sizes longer than internal buffer
+    unsigned int sizes[6] = {1, 5, 300, 2, 600, 17};
+    float complex x [1200], y0[1200], y1[1200];
+    unsigned int i, j;
+    for (i=0; i<6; i++) {
+        unsigned int n = sizes[i];
+        for (j=0; j<2*n; j++)
+            x[j] = randnf() + _Complex_I*randnf();
+
+        if (_decim) {
+            // n outputs from 2*n inputs
+            resamp2_crcf_decim_execute_block(q0, x, n, y0);
+            for (j=0; j<n; j++)
+                resamp2_crcf_decim_execute(q1, x+2*j, y1+j);
+        } else {
+            // 2*n outputs from n inputs
+            resamp2_crcf_interp_execute_block(q0, x, n, y0);
+            for (j=0; j<n; j++)
+                resamp2_crcf_interp_execute(q1, x[j], y1+2*j);
+        }
+
+        unsigned int num_output = _decim ? n : 2*n;
+        for (j=0; j<num_output; j++) {
+            LIQUID_CHECK_DELTA(crealf(y0[j]), crealf(y1[j]), 1e-5f);
+            LIQUID_CHECK_DELTA(cimagf(y0[j]), cimagf(y1[j]), 1e-5f);
+        }
+    }
+
+    // clean up allocated objects
+    resamp2_crcf_destroy(q0);
+    resamp2_crcf_destroy(q1);
+}
+LIQUID_AUTOTEST(resamp2_crcf_decim_block, "test block decimation",    "", 0.1) { testbench_resamp2_crcf_block(__q__, 1); }
+LIQUID_AUTOTEST(resamp2_crcf_interp_block,"test block interpolation", "", 0.1) { testbench_resamp2_crcf_block(__q__, 0); }
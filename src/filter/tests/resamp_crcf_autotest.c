@@ -177,3 +177,88 @@ LIQUID_AUTOTEST(resamp_crcf_copy,"test copy method", "", 0.1)
     resamp_crcf_destroy(q1);
 }
 
+
+// test that execute_block() matches running execute() on each sample
+void testbench_resamp_crcf_block(liquid_autotest __q__,
+        float _rate, unsigned int _npfb)
+{
+    liquid_log_debug("testing resamp_crcf_execute_block() with r=%g, npfb=%u", _rate, _npfb);
+
+    // create objects
+    resamp_crcf q0 = resamp_crcf_create(_rate, 12, 0.4f, 60.0f, _npfb);
+    resamp_crcf q1 = resamp_crcf_create(_rate, 12, 0.4f, 60.0f, _npfb);
+
+    // sizes to test in sequence, including sizes longer than internal buffer
+    unsigned int sizes[8] = {1, 7, 300, 2, 1000, 64, 257, 3};
+
+    // allocate buffers
+    unsigned int max_input  = 1000;
+    unsigned int max_output = 16 + (unsigned int)(2.0f * max_input * _rate);
+    float complex x [max_input];
+    float complex y0[max_output];
+    float complex y1[max_output];
+
+    unsigned int i, j;
+    for (i=0; i<8; i++) {
+        unsigned int num_input = sizes[i];
+        for (j=0; j<num_input; j++)
+            x[j] = randnf() + _Complex_I*randnf();
+
+        // run block method
+        unsigned int nw0;
+        resamp_crcf_execute_block(q0, x, num_input, y0, &nw0);
+
+        // run sample-by-sample
+        unsigned int nw1 = 0, n;
+        for (j=0; j<num_input; j++) {
+            resamp_crcf_execute(q1, x[j], y1+nw1, &n);
+            nw1 += n;
+        }
+
+        // check that the same samples were written
+        LIQUID_CHECK(nw0 ==  nw1);
+        for (j=0; j<nw0 && j<nw1; j++)
+            LIQUID_CHECK(y0[j] ==  y1[j]);
+    }
+
+    // destroy objects
+    resamp_crcf_destroy(q0);
+    resamp_crcf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(resamp_crcf_block_0,"description","",0.1){ testbench_resamp_crcf_block(__q__, 1.00f,       64); }
+LIQUID_AUTOTEST(resamp_crcf_block_1,"description","",0.1){ testbench_resamp_crcf_block(__q__, 0.373737373f,64); }
+LIQUID_AUTOTEST(resamp_crcf_block_2,"description","",0.1){ testbench_resamp_crcf_block(__q__, sqrtf(2),   256); }
+LIQUID_AUTOTEST(resamp_crcf_block_3,"description","",0.1){ testbench_resamp_crcf_block(__q__, sqrtf(17),   16); }
+
+LIQUID_AUTOTEST(resamp_crcf_scale,"test set/get scale", "", 0.1)
+{
+    float rate = 0.71239213987520f;
+    resamp_crcf q0 = resamp_crcf_create(rate, 12, 0.4f, 60.0f, 64);
+    resamp_crcf q1 = resamp_crcf_create(rate, 12, 0.4f, 60.0f, 64);
+
+    // set and get scale
+    float scale = -2.5f;
+    float s;
+    resamp_crcf_set_scale(q1, scale);
+    resamp_crcf_get_scale(q1, &s);
+    LIQUID_CHECK(s ==  scale);
+
+    // run samples through both resamplers and check output is scaled
+    unsigned int i, nw0, nw1;
+    float complex y0[4], y1[4];
+    for (i=0; i<80; i++) {
+        float complex v = randnf() + _Complex_I*randnf();
+        resamp_crcf_execute(q0, v, y0, &nw0);
+        resamp_crcf_execute(q1, v, y1, &nw1);
+        LIQUID_CHECK(nw0 ==  nw1);
+        if (nw0==1 && nw1==1) {
+            LIQUID_CHECK_DELTA(crealf(y0[0]*scale), crealf(y1[0]), 1e-6f);
+            LIQUID_CHECK_DELTA(cimagf(y0[0]*scale), cimagf(y1[0]), 1e-6f);
+        }
+    }
+
+    // destroy objects
+    resamp_crcf_destroy(q0);
+    resamp_crcf_destroy(q1);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <math.h>
+#include "liquid.h"
+
+// Helper function to keep code base small; pushes noise through _num_streams
+// idle streams either with independent synchronizers or a single
+// multi-stream synchronizer
+void framesync64bank_bench(struct rusage *     _start,
+                           struct rusage *     _finish,
+                           unsigned long int * _num_iterations,
+                           unsigned int        _num_streams,
+                           int                 _bank)
+{
+    // adjust number of iterations: one trial is one sample on one stream
+    unsigned int num_samples = 256;
+    *_num_iterations /= num_samples * _num_streams;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // generate stream-interleaved input (noise) and per-stream copies
+    unsigned long int i;
+    unsigned int j, s;
+    float complex x[num_samples*_num_streams];
+    float complex y[_num_streams][num_samples];
+    for (j=0; j<num_samples; j++) {
+        for (s=0; s<_num_streams; s++) {
+            x[j*_num_streams + s] = 0.1f*(randnf() + _Complex_I*randnf());
+            y[s][j] = x[j*_num_streams + s];
+        }
+    }
+
+    // create synchronizers
+    framesync64bank q = framesync64bank_create(_num_streams, NULL, NULL);
+    framesync64 fs[_num_streams];
+    for (s=0; s<_num_streams; s++)
+        fs[s] = framesync64_create(NULL, NULL);
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        if (_bank) {
+            framesync64bank_execute(q, x, num_samples);
+        } else {
+            for (s=0; s<_num_streams; s++)
+                framesync64_execute(fs[s], y[s], num_samples);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= num_samples * _num_streams;
+
+    // clean up allocated objects
+    framesync64bank_destroy(q);
+    for (s=0; s<_num_streams; s++)
+        framesync64_destroy(fs[s]);
+}
+
+#define FRAMESYNC64BANK_BENCHMARK_API(N,B)      \
+(   struct rusage *     _start,                 \
+    struct rusage *     _finish,                \
+    unsigned long int * _num_iterations)        \
+{ framesync64bank_bench(_start, _finish, _num_iterations, N, B); }
+
+// independent synchronizers
+void benchmark_framesync64_streams_4        FRAMESYNC64BANK_BENCHMARK_API(  4, 0);
+void benchmark_framesync64_streams_32       FRAMESYNC64BANK_BENCHMARK_API( 32, 0);
+void benchmark_framesync64_streams_256      FRAMESYNC64BANK_BENCHMARK_API(256, 0);
+
+// multi-stream synchronizer
+void benchmark_framesync64bank_streams_4    FRAMESYNC64BANK_BENCHMARK_API(  4, 1);
+void benchmark_framesync64bank_streams_32   FRAMESYNC64BANK_BENCHMARK_API( 32, 1);
+void benchmark_framesync64bank_streams_256  FRAMESYNC64BANK_BENCHMARK_API(256, 1);
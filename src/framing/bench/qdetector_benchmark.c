@@ -31,7 +31,8 @@
 void qdetector_cccf_bench(struct rusage *     _start,
                           struct rusage *     _finish,
                           unsigned long int * _num_iterations,
-                          unsigned int        _n)
+                          unsigned int        _n,
+                          int                 _range_index)
 {
     // adjust number of iterations
     *_num_iterations *= 4;
@@ -51,10 +52,9 @@ void qdetector_cccf_bench(struct rusage *     _start,
     unsigned int m            =    7;   // filter delay [symbols]
     float        beta         = 0.3f;   // excess bandwidth factor
     float        threshold    = 0.5f;   // threshold for detection
-    int          range_index  =    5;   // carrier offset search range [index]
     qdetector_cccf q = qdetector_cccf_create_linear(h, _n, ftype, k, m, beta);
     qdetector_cccf_set_threshold(q,threshold);
-    qdetector_cccf_set_range_index(q, range_index);
+    qdetector_cccf_set_range_index(q, _range_index);
     //qdetector_cccf_print(q);
 
     // input sequence (random)
@@ -91,7 +91,13 @@ void qdetector_cccf_bench(struct rusage *     _start,
 (   struct rusage *     _start,             \
     struct rusage *     _finish,            \
     unsigned long int * _num_iterations)    \
-{ qdetector_cccf_bench(_start, _finish, _num_iterations, N); }
+{ qdetector_cccf_bench(_start, _finish, _num_iterations, N, 5); }
+
+#define QDETECTOR_CCCF_RANGE_BENCHMARK_API(N,R) \
+(   struct rusage *     _start,                 \
+    struct rusage *     _finish,                \
+    unsigned long int * _num_iterations)        \
+{ qdetector_cccf_bench(_start, _finish, _num_iterations, N, R); }
 
 void benchmark_qdetector_cccf_16    QDETECTOR_CCCF_BENCHMARK_API(16);
 void benchmark_qdetector_cccf_32    QDETECTOR_CCCF_BENCHMARK_API(32);
@@ -105,3 +111,8 @@ void benchmark_qdetector_cccf_4096  QDETECTOR_CCCF_BENCHMARK_API(4096);
 void benchmark_qdetector_cccf_8192  QDETECTOR_CCCF_BENCHMARK_API(8192);
 void benchmark_qdetector_cccf_16384 QDETECTOR_CCCF_BENCHMARK_API(16384);
 
+// wide carrier offset search range [index]
+void benchmark_qdetector_cccf_256_r0    QDETECTOR_CCCF_RANGE_BENCHMARK_API(256,  0);
+void benchmark_qdetector_cccf_256_r16   QDETECTOR_CCCF_RANGE_BENCHMARK_API(256, 16);
+void benchmark_qdetector_cccf_256_r64   QDETECTOR_CCCF_RANGE_BENCHMARK_API(256, 64);
+void benchmark_qdetector_cccf_1024_r64  QDETECTOR_CCCF_RANGE_BENCHMARK_API(1024,64);
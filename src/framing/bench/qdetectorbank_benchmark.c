@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include "liquid.internal.h"
+
+// Helper function to keep code base small; searches for one of _num_syncs
+// preambles either with independent synchronizers or through detector bank
+void qdetectorbank_cccf_bench(struct rusage *     _start,
+                              struct rusage *     _finish,
+                              unsigned long int * _num_iterations,
+                              unsigned int        _num_syncs,
+                              int                 _bank)
+{
+    // adjust number of iterations
+    *_num_iterations *= 4;
+    *_num_iterations /= _num_syncs;
+
+    // generate synchronizers with random sequences
+    unsigned int n = 256;   // sequence length [symbols]
+    int          ftype        = LIQUID_FIRFILT_ARKAISER;
+    unsigned int k            =    2;   // samples/symbol
+    unsigned int m            =    7;   // filter delay [symbols]
+    float        beta         = 0.3f;   // excess bandwidth factor
+    float complex h[n];
+    qdsync_cccf sync[_num_syncs];
+    unsigned long int i;
+    unsigned int j;
+    for (j=0; j<_num_syncs; j++) {
+        for (i=0; i<n; i++) {
+            h[i] = (rand() % 2 ? 1.0f : -1.0f) +
+                   (rand() % 2 ? 1.0f : -1.0f)*_Complex_I;
+        }
+        sync[j] = qdsync_cccf_create_linear(h, n, ftype, k, m, beta, NULL, NULL);
+        qdsync_cccf_set_range(sync[j], 0.001f);
+    }
+
+    // optionally register synchronizers with bank
+    qdetectorbank_cccf q = qdetectorbank_cccf_create();
+    for (j=0; _bank && j<_num_syncs; j++)
+        qdetectorbank_cccf_add(q, sync[j]);
+
+    // input sequence (random)
+    float complex x[7];
+    for (i=0; i<7; i++) {
+        x[i] = (rand() % 2 ? 1.0f : -1.0f) +
+               (rand() % 2 ? 1.0f : -1.0f)*_Complex_I;
+    }
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        // push input sequence through synchronizers
+        if (_bank) {
+            qdetectorbank_cccf_execute(q, x, 7);
+        } else {
+            for (j=0; j<_num_syncs; j++)
+                qdsync_cccf_execute(sync[j], x, 7);
+        }
+
+        // randomize input
+        x[0] += (i & 1) ? -1e-3f : 1e-3f;
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 7;
+
+    // clean up allocated objects
+    qdetectorbank_cccf_destroy(q);
+    for (j=0; j<_num_syncs; j++)
+        qdsync_cccf_destroy(sync[j]);
+}
+
+#define QDETECTORBANK_CCCF_BENCHMARK_API(N,B)   \
+(   struct rusage *     _start,                 \
+    struct rusage *     _finish,                \
+    unsigned long int * _num_iterations)        \
+{ qdetectorbank_cccf_bench(_start, _finish, _num_iterations, N, B); }
+
+// independent synchronizers
+void benchmark_qdsync_cccf_n1           QDETECTORBANK_CCCF_BENCHMARK_API(1, 0);
+void benchmark_qdsync_cccf_n2           QDETECTORBANK_CCCF_BENCHMARK_API(2, 0);
+void benchmark_qdsync_cccf_n4           QDETECTORBANK_CCCF_BENCHMARK_API(4, 0);
+void benchmark_qdsync_cccf_n8           QDETECTORBANK_CCCF_BENCHMARK_API(8, 0);
+
+// synchronizers sharing detector bank
+void benchmark_qdetectorbank_cccf_n1    QDETECTORBANK_CCCF_BENCHMARK_API(1, 1);
+void benchmark_qdetectorbank_cccf_n2    QDETECTORBANK_CCCF_BENCHMARK_API(2, 1);
+void benchmark_qdetectorbank_cccf_n4    QDETECTORBANK_CCCF_BENCHMARK_API(4, 1);
+void benchmark_qdetectorbank_cccf_n8    QDETECTORBANK_CCCF_BENCHMARK_API(8, 1);
@@ -34,6 +34,10 @@
 
 #include "liquid.internal.h"
 
+#if BUILD_PTHREADS
+#include <pthread.h>
+#endif
+
 #define DEBUG_FLEXFRAMESYNC         1
 #define DEBUG_FLEXFRAMESYNC_PRINT   0
 #define DEBUG_FILENAME              "flexframesync_internal_debug.m"
@@ -68,6 +72,24 @@ int flexframesync_execute_rxheader(flexframesync _q,
 int flexframesync_execute_rxpayload(flexframesync _q,
                                     float complex _x);
 
+// hand completed frame to background decoding threads
+int flexframesync_submit_frame(flexframesync _q);
+
+// decode payload of queued frame (background thread)
+int flexframesync_job_process(void * _context, unsigned int _slot);
+
+// update statistics and invoke callback for queued frame, in order
+int flexframesync_job_deliver(void * _context, unsigned int _slot);
+
+// object whose callback is being invoked on the current thread, if any
+static _Thread_local flexframesync flexframesync_delivering = NULL;
+
+// count received frame in data statistics
+int flexframesync_update_framedatastats(flexframesync _q,
+                                        int           _header_valid,
+                                        int           _payload_valid,
+                                        unsigned int  _payload_len);
+
 static flexframegenprops_s flexframesyncprops_header_default = {
    FLEXFRAME_H_CRC,
    FLEXFRAME_H_FEC0,
@@ -75,6 +97,20 @@ static flexframegenprops_s flexframesyncprops_header_default = {
    FLEXFRAME_H_MOD,
 };
 
+// frame queued for background decoding
+struct flexframesync_job_s {
+    qpacketmodem     decoder;           // payload demodulator/decoder
+    float complex *  payload_sym;       // payload symbols (received)
+    unsigned int     payload_sym_len;   // payload symbols (length)
+    unsigned char *  payload_dec;       // payload data (bytes)
+    unsigned int     payload_dec_len;   // payload data (length)
+    int              payload_soft;      // payload performs soft demod
+    int              payload_valid;     // payload CRC flag
+    unsigned char *  header_dec;        // header bytes (decoded)
+    int              header_valid;      // header CRC flag
+    framesyncstats_s framesyncstats;    // frame statistics
+};
+
 // flexframesync object structure
 struct flexframesync_s {
     // callback
@@ -131,6 +167,13 @@ struct flexframesync_s {
     unsigned char * payload_dec;        // payload data (bytes)
     unsigned int    payload_dec_len;    // payload data (length)
     int             payload_valid;      // payload CRC flag
+
+    // background decoding
+    liquid_workqueue             workqueue; // ordered decoding queue (NULL if inline)
+    struct flexframesync_job_s * jobs;      // queued frames, one per slot
+#if BUILD_PTHREADS
+    pthread_mutex_t              stats_lock;// protects framedatastats
+#endif
     
     // status variables
     unsigned int    preamble_counter;   // counter: num of p/n syms received
@@ -148,6 +191,8 @@ struct flexframesync_s {
     int         debug_qdetector_flush;  // debug: flag to set if we are flushing detector
     windowcf    debug_x;                // debug: raw input samples
 #endif
+
+    LIQUID_COUNTER_FIELD                    // performance counters (when enabled)
 };
 
 // create flexframesync object
@@ -224,7 +269,14 @@ flexframesync flexframesync_create(framesync_callback _callback,
     q->payload_dec = (unsigned char*) malloc(q->payload_dec_len*sizeof(unsigned char));
     q->payload_soft = 0;
 
+    // decode payloads inline by default
+    q->workqueue = NULL;
+    q->jobs      = NULL;
+
     // reset global data counters
+#if BUILD_PTHREADS
+    pthread_mutex_init(&q->stats_lock, NULL);
+#endif
     flexframesync_reset_framedatastats(q);
 
 #if DEBUG_FLEXFRAMESYNC
@@ -235,6 +287,11 @@ flexframesync flexframesync_create(framesync_callback _callback,
     q->debug_x               = NULL;
 #endif
 
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "flexframesync");
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct flexframesync_s) +
+        128*sizeof(float complex) + q->payload_sym_len*sizeof(float complex) + q->payload_dec_len);
+
     // reset state and return
     flexframesync_reset(q);
     return q;
@@ -243,6 +300,13 @@ flexframesync flexframesync_create(framesync_callback _callback,
 // destroy frame synchronizer object, freeing all internal memory
 int flexframesync_destroy(flexframesync _q)
 {
+    if (flexframesync_delivering == _q)
+        return liquid_error(LIQUID_EICONFIG,"flexframesync_destroy(), cannot destroy from within callback");
+    LIQUID_COUNTER_UNREGISTER(_q);
+
+    // deliver outstanding frames and stop decoding threads
+    flexframesync_set_num_threads(_q, 0);
+
 #if DEBUG_FLEXFRAMESYNC
     // clean up debug objects (if created)
     if (_q->debug_objects_created)
@@ -270,6 +334,9 @@ int flexframesync_destroy(flexframesync _q)
 #if FLEXFRAMESYNC_ENABLE_EQ
     eqlms_cccf_destroy    (_q->equalizer);        // LMS equalizer
 #endif
+#if BUILD_PTHREADS
+    pthread_mutex_destroy(&_q->stats_lock);
+#endif
 
     // free main object memory
     free(_q);
@@ -375,6 +442,57 @@ int flexframesync_set_header_props(flexframesync          _q,
     return flexframesync_set_header_len(_q, _q->header_user_len);
 }
 
+// set number of background threads used to decode payloads
+int flexframesync_set_num_threads(flexframesync _q,
+                                  unsigned int  _num_threads)
+{
+    // waiting on the queue from its own delivery would never return
+    if (flexframesync_delivering == _q)
+        return liquid_error(LIQUID_EICONFIG,"flexframesync_set_num_threads(), cannot change threads from within callback");
+
+    // deliver outstanding frames and release existing queue
+    if (_q->workqueue != NULL) {
+        unsigned int i, num_slots = liquid_workqueue_get_num_slots(_q->workqueue);
+        liquid_workqueue_destroy(_q->workqueue);
+        for (i=0; i<num_slots; i++) {
+            qpacketmodem_destroy(_q->jobs[i].decoder);
+            free(_q->jobs[i].payload_sym);
+            free(_q->jobs[i].payload_dec);
+            free(_q->jobs[i].header_dec);
+        }
+        free(_q->jobs);
+        _q->workqueue = NULL;
+        _q->jobs      = NULL;
+    }
+    if (_num_threads == 0)
+        return LIQUID_OK;
+
+    // allow synchronizer to run ahead of decoding by one frame per thread
+    unsigned int i, num_slots = 2*_num_threads;
+    _q->jobs = (struct flexframesync_job_s *) malloc(num_slots*sizeof(struct flexframesync_job_s));
+    for (i=0; i<num_slots; i++) {
+        _q->jobs[i].decoder     = qpacketmodem_create();
+        _q->jobs[i].payload_sym = NULL;
+        _q->jobs[i].payload_dec = NULL;
+        _q->jobs[i].header_dec  = NULL;
+    }
+    _q->workqueue = liquid_workqueue_create(_num_threads, num_slots,
+                                            flexframesync_job_process,
+                                            flexframesync_job_deliver,
+                                            (void*)_q);
+    return LIQUID_OK;
+}
+
+// wait for all queued frames to be decoded and delivered
+int flexframesync_flush(flexframesync _q)
+{
+    if (flexframesync_delivering == _q)
+        return liquid_error(LIQUID_EICONFIG,"flexframesync_flush(), cannot flush from within callback");
+    if (_q->workqueue != NULL)
+        return liquid_workqueue_flush(_q->workqueue);
+    return LIQUID_OK;
+}
+
 // execute frame synchronizer
 //  _q  :   frame synchronizer object
 //  _x  :   input sample array [size: _n x 1]
@@ -383,6 +501,7 @@ int flexframesync_execute(flexframesync   _q,
                           float complex * _x,
                           unsigned int    _n)
 {
+    LIQUID_COUNTER_START(_q);
     unsigned int i;
     for (i=0; i<_n; i++) {
 #if DEBUG_FLEXFRAMESYNC
@@ -412,6 +531,7 @@ int flexframesync_execute(flexframesync   _q,
             return liquid_error(LIQUID_EINT,"flexframesync_exeucte(), unknown/unsupported internal state");
         }
     }
+    LIQUID_COUNTER_STOP(_q, _n);
     return LIQUID_OK;
 }
 
@@ -591,23 +711,29 @@ int flexframesync_execute_rxheader(flexframesync _q,
                 return LIQUID_OK;
             }
 
+            // header invalid: set framestats internals
+            _q->framesyncstats.evm           = 0.0f; //20*log10f(sqrtf(_q->framesyncstats.evm / 600));
+            _q->framesyncstats.rssi          = 20*log10f(_q->gamma_hat);
+            _q->framesyncstats.cfo           = nco_crcf_get_frequency(_q->mixer);
+            _q->framesyncstats.framesyms     = NULL;
+            _q->framesyncstats.num_framesyms = 0;
+            _q->framesyncstats.mod_scheme    = LIQUID_MODEM_UNKNOWN;
+            _q->framesyncstats.mod_bps       = 0;
+            _q->framesyncstats.check         = LIQUID_CRC_UNKNOWN;
+            _q->framesyncstats.fec0          = LIQUID_FEC_UNKNOWN;
+            _q->framesyncstats.fec1          = LIQUID_FEC_UNKNOWN;
+
+            // queue frame so callbacks remain in order
+            if (_q->workqueue != NULL) {
+                flexframesync_submit_frame(_q);
+                return flexframesync_reset(_q);
+            }
+
             // update statistics
-            _q->framedatastats.num_frames_detected++;
+            flexframesync_update_framedatastats(_q, 0, 0, 0);
 
-            // header invalid: invoke callback
+            // invoke callback
             if (_q->callback != NULL) {
-                // set framestats internals
-                _q->framesyncstats.evm           = 0.0f; //20*log10f(sqrtf(_q->framesyncstats.evm / 600));
-                _q->framesyncstats.rssi          = 20*log10f(_q->gamma_hat);
-                _q->framesyncstats.cfo           = nco_crcf_get_frequency(_q->mixer);
-                _q->framesyncstats.framesyms     = NULL;
-                _q->framesyncstats.num_framesyms = 0;
-                _q->framesyncstats.mod_scheme    = LIQUID_MODEM_UNKNOWN;
-                _q->framesyncstats.mod_bps       = 0;
-                _q->framesyncstats.check         = LIQUID_CRC_UNKNOWN;
-                _q->framesyncstats.fec0          = LIQUID_FEC_UNKNOWN;
-                _q->framesyncstats.fec1          = LIQUID_FEC_UNKNOWN;
-
                 // invoke callback method
                 _q->callback(_q->header_dec,
                              _q->header_valid,
@@ -768,6 +894,25 @@ int flexframesync_execute_rxpayload(flexframesync _q,
         _q->symbol_counter++;
 
         if (_q->symbol_counter == _q->payload_sym_len) {
+            // set framestats internals
+            int ms = qpacketmodem_get_modscheme(_q->payload_decoder);
+            _q->framesyncstats.evm           = 10*log10f(_q->framesyncstats.evm / (float)_q->payload_sym_len);
+            _q->framesyncstats.rssi          = 20*log10f(_q->gamma_hat);
+            _q->framesyncstats.cfo           = nco_crcf_get_frequency(_q->mixer);
+            _q->framesyncstats.framesyms     = _q->payload_sym;
+            _q->framesyncstats.num_framesyms = _q->payload_sym_len;
+            _q->framesyncstats.mod_scheme    = ms;
+            _q->framesyncstats.mod_bps       = modulation_types[ms].bps;
+            _q->framesyncstats.check         = qpacketmodem_get_crc(_q->payload_decoder);
+            _q->framesyncstats.fec0          = qpacketmodem_get_fec0(_q->payload_decoder);
+            _q->framesyncstats.fec1          = qpacketmodem_get_fec1(_q->payload_decoder);
+
+            // hand off to background decoding threads
+            if (_q->workqueue != NULL) {
+                flexframesync_submit_frame(_q);
+                return flexframesync_reset(_q);
+            }
+
             // decode payload
             if (_q->payload_soft) {
                 _q->payload_valid = qpacketmodem_decode_soft(_q->payload_decoder,
@@ -780,28 +925,10 @@ int flexframesync_execute_rxpayload(flexframesync _q,
             }
 
             // update statistics
-            _q->framedatastats.num_frames_detected++;
-            _q->framedatastats.num_headers_valid++;
-            if (_q->payload_valid) {
-                _q->framedatastats.num_payloads_valid += 1;
-                _q->framedatastats.num_bytes_received += _q->payload_dec_len;
-            }
+            flexframesync_update_framedatastats(_q, 1, _q->payload_valid, _q->payload_dec_len);
 
             // invoke callback
             if (_q->callback != NULL) {
-                // set framestats internals
-                int ms = qpacketmodem_get_modscheme(_q->payload_decoder);
-                _q->framesyncstats.evm           = 10*log10f(_q->framesyncstats.evm / (float)_q->payload_sym_len);
-                _q->framesyncstats.rssi          = 20*log10f(_q->gamma_hat);
-                _q->framesyncstats.cfo           = nco_crcf_get_frequency(_q->mixer);
-                _q->framesyncstats.framesyms     = _q->payload_sym;
-                _q->framesyncstats.num_framesyms = _q->payload_sym_len;
-                _q->framesyncstats.mod_scheme    = ms;
-                _q->framesyncstats.mod_bps       = modulation_types[ms].bps;
-                _q->framesyncstats.check         = qpacketmodem_get_crc(_q->payload_decoder);
-                _q->framesyncstats.fec0          = qpacketmodem_get_fec0(_q->payload_decoder);
-                _q->framesyncstats.fec1          = qpacketmodem_get_fec1(_q->payload_decoder);
-
                 // invoke callback method
                 _q->callback(_q->header_dec,
                              _q->header_valid,
@@ -819,16 +946,152 @@ int flexframesync_execute_rxpayload(flexframesync _q,
     return LIQUID_OK;
 }
 
+// hand completed frame to background decoding threads
+int flexframesync_submit_frame(flexframesync _q)
+{
+    // wait for free slot
+    unsigned int slot = liquid_workqueue_acquire(_q->workqueue);
+    struct flexframesync_job_s * job = &_q->jobs[slot];
+
+    // resize slot buffers before copying anything; on failure the slot is
+    // not submitted and keeps whichever buffers were already resized
+    unsigned char * header_dec = (unsigned char*) realloc(job->header_dec, _q->header_dec_len*sizeof(unsigned char));
+    if (header_dec == NULL)
+        return liquid_error(LIQUID_EIMEM,"flexframesync_submit_frame(), could not re-allocate header array");
+    job->header_dec = header_dec;
+    if (_q->header_valid) {
+        float complex * payload_sym = (float complex*) realloc(job->payload_sym, _q->payload_sym_len*sizeof(float complex));
+        if (payload_sym == NULL)
+            return liquid_error(LIQUID_EIMEM,"flexframesync_submit_frame(), could not re-allocate payload symbol array");
+        job->payload_sym = payload_sym;
+        unsigned char * payload_dec = (unsigned char*) realloc(job->payload_dec, _q->payload_dec_len*sizeof(unsigned char));
+        if (payload_dec == NULL && _q->payload_dec_len > 0)
+            return liquid_error(LIQUID_EIMEM,"flexframesync_submit_frame(), could not re-allocate payload array");
+        job->payload_dec = payload_dec;
+    }
+
+    // copy frame into slot
+    job->header_valid = _q->header_valid;
+    memmove(job->header_dec, _q->header_dec, _q->header_dec_len*sizeof(unsigned char));
+    job->framesyncstats = _q->framesyncstats;
+    if (_q->header_valid) {
+        job->payload_soft    = _q->payload_soft;
+        job->payload_sym_len = _q->payload_sym_len;
+        job->payload_dec_len = _q->payload_dec_len;
+        memmove(job->payload_sym, _q->payload_sym, job->payload_sym_len*sizeof(float complex));
+        job->framesyncstats.framesyms = job->payload_sym;
+    }
+    return liquid_workqueue_submit(_q->workqueue);
+}
+
+// decode payload of queued frame (background thread)
+int flexframesync_job_process(void *       _context,
+                              unsigned int _slot)
+{
+    flexframesync q = (flexframesync) _context;
+    struct flexframesync_job_s * job = &q->jobs[_slot];
+    if (!job->header_valid)
+        return LIQUID_OK;
+
+    // configure decoder from frame properties and decode
+    qpacketmodem_configure(job->decoder,
+                           job->payload_dec_len,
+                           job->framesyncstats.check,
+                           job->framesyncstats.fec0,
+                           job->framesyncstats.fec1,
+                           job->framesyncstats.mod_scheme);
+    if (job->payload_soft) {
+        job->payload_valid = qpacketmodem_decode_soft(job->decoder,
+                                                      job->payload_sym,
+                                                      job->payload_dec);
+    } else {
+        job->payload_valid = qpacketmodem_decode(job->decoder,
+                                                 job->payload_sym,
+                                                 job->payload_dec);
+    }
+    return LIQUID_OK;
+}
+
+// update statistics and invoke callback for queued frame, in order
+int flexframesync_job_deliver(void *       _context,
+                              unsigned int _slot)
+{
+    flexframesync q = (flexframesync) _context;
+    struct flexframesync_job_s * job = &q->jobs[_slot];
+
+    // update statistics
+    flexframesync_update_framedatastats(q, job->header_valid,
+        job->header_valid && job->payload_valid, job->payload_dec_len);
+
+    // invoke callback, marking this thread as delivering for the object
+    if (q->callback == NULL)
+        return LIQUID_OK;
+    flexframesync_delivering = q;
+    if (!job->header_valid) {
+        q->callback(job->header_dec, 0, NULL, 0, 0,
+                    job->framesyncstats, q->userdata);
+    } else {
+        q->callback(job->header_dec,
+                    job->header_valid,
+                    job->payload_dec,
+                    job->payload_dec_len,
+                    job->payload_valid,
+                    job->framesyncstats,
+                    q->userdata);
+    }
+    flexframesync_delivering = NULL;
+    return LIQUID_OK;
+}
+
+// count received frame in data statistics; frames decoded in the
+// background are counted on the thread delivering them, so the counters
+// are guarded against concurrent reads and resets by the caller
+int flexframesync_update_framedatastats(flexframesync _q,
+                                        int           _header_valid,
+                                        int           _payload_valid,
+                                        unsigned int  _payload_len)
+{
+#if BUILD_PTHREADS
+    pthread_mutex_lock(&_q->stats_lock);
+#endif
+    _q->framedatastats.num_frames_detected++;
+    if (_header_valid) {
+        _q->framedatastats.num_headers_valid++;
+        if (_payload_valid) {
+            _q->framedatastats.num_payloads_valid += 1;
+            _q->framedatastats.num_bytes_received += _payload_len;
+        }
+    }
+#if BUILD_PTHREADS
+    pthread_mutex_unlock(&_q->stats_lock);
+#endif
+    return LIQUID_OK;
+}
+
 // reset frame data statistics
 int flexframesync_reset_framedatastats(flexframesync _q)
 {
-    return framedatastats_reset(&_q->framedatastats);
+#if BUILD_PTHREADS
+    pthread_mutex_lock(&_q->stats_lock);
+#endif
+    int rc = framedatastats_reset(&_q->framedatastats);
+#if BUILD_PTHREADS
+    pthread_mutex_unlock(&_q->stats_lock);
+#endif
+    return rc;
 }
 
 // retrieve frame data statistics
 framedatastats_s flexframesync_get_framedatastats(flexframesync _q)
 {
-    return _q->framedatastats;
+#if BUILD_PTHREADS
+    pthread_mutex_lock(&_q->stats_lock);
+#endif
+    framedatastats_s stats = _q->framedatastats;
+#if BUILD_PTHREADS
+    pthread_mutex_unlock(&_q->stats_lock);
+#endif
+    return stats;
 }
 
 // enable debugging
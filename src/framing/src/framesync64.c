@@ -71,6 +71,8 @@ struct framesync64_s {
     char *       prefix;                // debug: filename prefix
     char *       filename;              // debug: filename buffer
     unsigned int num_files_exported;    // debug: number of files exported
+
+    LIQUID_COUNTER_FIELD                // performance counters (when enabled)
 };
 
 // create framesync64 object
@@ -129,6 +131,10 @@ framesync64 framesync64_create(framesync_callback _callback,
     framesync64_set_threshold(q, 0.32f);
     framesync64_set_range(q, 0.003f);
 
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "framesync64");
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct framesync64_s));
+
     // reset state and return
     framesync64_reset(q);
     return q;
@@ -166,12 +172,17 @@ framesync64 framesync64_copy(framesync64 q_orig)
     // apply to this new frame synchronizer object
     qdsync_cccf_set_context(q_copy->sync, q_copy);
 
+    // register performance counters for new object
+    LIQUID_COUNTER_REGISTER(q_copy, "framesync64");
+    LIQUID_COUNTER_ALLOC(q_copy, sizeof(struct framesync64_s));
     return q_copy;
 }
 
 // destroy frame synchronizer object, freeing all internal memory
 int framesync64_destroy(framesync64 _q)
 {
+    LIQUID_COUNTER_UNREGISTER(_q);
+
     // destroy synchronization objects
     qdsync_cccf_destroy (_q->sync);      // frame detector/synchronizer
     qpacketmodem_destroy(_q->dec);       // payload demodulator
@@ -230,13 +241,22 @@ int framesync64_execute(framesync64     _q,
                         float complex * _x,
                         unsigned int    _n)
 {
-    return qdsync_cccf_execute(_q->sync, _x, _n);
+    LIQUID_COUNTER_START(_q);
+    int rc = qdsync_cccf_execute(_q->sync, _x, _n);
+    LIQUID_COUNTER_STOP(_q, _n);
+    return rc;
 }
 
 //
 // internal methods
 //
 
+// get internal frame synchronizer object
+qdsync_cccf framesync64_get_sync(framesync64 _q)
+{
+    return _q->sync;
+}
+
 // synchronization callback, return 0:continue, 1:reset
 int framesync64_callback_internal(float complex * _buf,
                                   unsigned int    _buf_len,
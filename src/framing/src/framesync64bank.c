@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// multi-stream framesync64 receiver with lockstep frame detection
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+
+#include "liquid.internal.h"
+
+// search for frames on all idle streams (shared input buffer full)
+int framesync64bank_seek(framesync64bank _q);
+
+// discard samples of a single stream received before its synchronizer
+// was reset, as a reset clears the buffer of a single framesync64
+//  _q      :   multi-stream frame synchronizer object
+//  _stream :   stream index
+//  _n      :   number of samples at start of detection buffer to clear
+int framesync64bank_clear(framesync64bank _q,
+                          unsigned int    _stream,
+                          unsigned int    _n);
+
+// framesync64bank object structure
+struct framesync64bank_s {
+    unsigned int    num_streams;    // number of streams
+    framesync64 *   fs;             // per-stream synchronizers (alignment, decoding)
+
+    // lockstep frame detection
+    unsigned int    nfft;           // detector transform size
+    float complex * buf_time;       // input buffer (time), stream-interleaved [size: nfft x num_streams]
+    float complex * buf_freq;       // input buffer (freq), per stream [size: num_streams x nfft]
+    float complex * buf_seek;       // time buffer of single stream [size: nfft x 1]
+    FFT_PLAN        fft;            // batched forward transform: buf_time > buf_freq
+    unsigned int    counter;        // sample counter for determining when to compute FFTs
+    unsigned int    num_transforms; // number of batched transforms taken
+    float *         x2_sum_0;       // sum{ |x|^2 } of first half of buffer, per stream
+    float *         x2_sum_1;       // sum{ |x|^2 } of second half of buffer, per stream
+
+    // streams aligning to or receiving a frame
+    unsigned int *  active;         // indices of active streams [size: num_streams x 1]
+    unsigned int    num_active;     // number of active streams
+    unsigned int *  released;       // indices of streams released within block [size: num_streams x 1]
+    unsigned int *  released_len;   // buffer position at release [size: num_streams x 1]
+    unsigned int    num_released;   // number of streams released within block
+
+    LIQUID_COUNTER_FIELD            // performance counters (when enabled)
+};
+
+// create multi-stream frame synchronizer
+//  _num_streams:   number of streams, _num_streams > 0
+//  _callback   :   callback function invoked for every stream
+//  _userdata   :   user data pointer passed to callback for every stream
+framesync64bank framesync64bank_create(unsigned int       _num_streams,
+                                       framesync_callback _callback,
+                                       void *             _userdata)
+{
+    // validate input
+    if (_num_streams == 0)
+        return liquid_error_config("framesync64bank_create(), number of streams must be greater than zero");
+
+    framesync64bank q = (framesync64bank) malloc(sizeof(struct framesync64bank_s));
+    q->num_streams = _num_streams;
+
+    // create per-stream synchronizers
+    unsigned int i;
+    q->fs = (framesync64*) malloc(q->num_streams*sizeof(framesync64));
+    for (i=0; i<q->num_streams; i++)
+        q->fs[i] = framesync64_create(_callback, _userdata);
+
+    // allocate detection buffers; every stream uses the same preamble and
+    // therefore the same detector transform size
+    q->nfft     = qdetector_cccf_get_buf_len(qdsync_cccf_get_detector(framesync64_get_sync(q->fs[0])));
+    q->buf_time = (float complex*) FFT_MALLOC(q->nfft*q->num_streams*sizeof(float complex));
+    q->buf_freq = (float complex*) FFT_MALLOC(q->nfft*q->num_streams*sizeof(float complex));
+    q->buf_seek = (float complex*) malloc(q->nfft*sizeof(float complex));
+    q->fft      = FFT_CREATE_PLAN_MANY(q->nfft, q->num_streams,
+                                       q->buf_time, q->num_streams, 1,
+                                       q->buf_freq, 1, q->nfft,
+                                       FFT_DIR_FORWARD, FFT_METHOD);
+    q->x2_sum_0 = (float*) malloc(q->num_streams*sizeof(float));
+    q->x2_sum_1 = (float*) malloc(q->num_streams*sizeof(float));
+    q->active   = (unsigned int*) malloc(q->num_streams*sizeof(unsigned int));
+    q->released     = (unsigned int*) malloc(q->num_streams*sizeof(unsigned int));
+    q->released_len = (unsigned int*) malloc(q->num_streams*sizeof(unsigned int));
+
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "framesync64bank");
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct framesync64bank_s) +
+        (2*q->num_streams+1)*q->nfft*sizeof(float complex));
+
+    // reset state and return
+    framesync64bank_reset(q);
+    return q;
+}
+
+// destroy multi-stream frame synchronizer, freeing all internal memory
+int framesync64bank_destroy(framesync64bank _q)
+{
+    LIQUID_COUNTER_UNREGISTER(_q);
+
+    unsigned int i;
+    for (i=0; i<_q->num_streams; i++)
+        framesync64_destroy(_q->fs[i]);
+    free(_q->fs);
+
+    // free detection buffers and transform
+    FFT_DESTROY_PLAN(_q->fft);
+    FFT_FREE(_q->buf_time);
+    FFT_FREE(_q->buf_freq);
+    free(_q->buf_seek);
+    free(_q->x2_sum_0);
+    free(_q->x2_sum_1);
+    free(_q->active);
+    free(_q->released);
+    free(_q->released_len);
+
+    // free main object memory
+    free(_q);
+    return LIQUID_OK;
+}
+
+// print multi-stream frame synchronizer internals
+int framesync64bank_print(framesync64bank _q)
+{
+    printf("<liquid.framesync64bank, streams=%u, nfft=%u, active=%u>\n",
+        _q->num_streams, _q->nfft, _q->num_active);
+    return LIQUID_OK;
+}
+
+// reset multi-stream frame synchronizer internal state for all streams
+int framesync64bank_reset(framesync64bank _q)
+{
+    unsigned int i;
+    for (i=0; i<_q->num_streams; i++) {
+        framesync64_reset(_q->fs[i]);
+        _q->x2_sum_0[i] = 0.0f;
+        _q->x2_sum_1[i] = 0.0f;
+    }
+    memset(_q->buf_time, 0x00, _q->nfft*_q->num_streams*sizeof(float complex));
+    _q->counter        = _q->nfft/2;
+    _q->num_transforms = 0;
+    _q->num_active     = 0;
+    return LIQUID_OK;
+}
+
+// get number of streams
+unsigned int framesync64bank_get_num_streams(framesync64bank _q)
+{
+    return _q->num_streams;
+}
+
+// set the user-defined data field passed to callback for a single stream
+int framesync64bank_set_userdata(framesync64bank _q,
+                                 unsigned int    _stream,
+                                 void *          _userdata)
+{
+    if (_stream >= _q->num_streams)
+        return liquid_error(LIQUID_EIRANGE,"framesync64bank_set_userdata(), stream index (%u) exceeds maximum (%u)",
+                _stream, _q->num_streams-1);
+    return framesync64_set_userdata(_q->fs[_stream], _userdata);
+}
+
+// push samples from all streams through frame synchronizer
+//  _q      :   multi-stream frame synchronizer object
+//  _x      :   input samples, stream-interleaved [size: _n x num_streams]
+//  _n      :   number of input samples per stream
+int framesync64bank_execute(framesync64bank _q,
+                            float complex * _x,
+                            unsigned int    _n)
+{
+    LIQUID_COUNTER_START(_q);
+    unsigned int M = _q->num_streams;
+    unsigned int i = 0;
+    unsigned int j, k, s;
+    while (i < _n) {
+        // number of samples until detection buffer is full
+        unsigned int n = _q->nfft - _q->counter;
+        n = n < _n - i ? n : _n - i;
+
+        // streams aligning to or receiving a frame consume samples directly
+        // and are released once their synchronizer resets
+        _q->num_released = 0;
+        for (j=0; j<n && _q->num_active > 0; j++) {
+            for (k=0; k<_q->num_active; ) {
+                s = _q->active[k];
+                framesync64_execute(_q->fs[s], &_x[(i+j)*M + s], 1);
+                qdsync_cccf sync = framesync64_get_sync(_q->fs[s]);
+                if (!qdsync_cccf_is_open(sync) &&
+                    !qdetector_cccf_is_aligning(qdsync_cccf_get_detector(sync)))
+                {
+                    _q->released    [_q->num_released  ] = s;
+                    _q->released_len[_q->num_released++] = _q->counter + j + 1;
+                    _q->active[k] = _q->active[--_q->num_active];
+                } else {
+                    k++;
+                }
+            }
+        }
+
+        // write block to detection buffer for all streams and accumulate
+        // signal level of each stream
+        memmove(&_q->buf_time[_q->counter*M], &_x[i*M], n*M*sizeof(float complex));
+        for (j=0; j<n; j++) {
+            float complex * x = &_x[(i+j)*M];
+            for (s=0; s<M; s++)
+                _q->x2_sum_1[s] += crealf(x[s])*crealf(x[s]) + cimagf(x[s])*cimagf(x[s]);
+        }
+        _q->counter += n;
+        i += n;
+
+        // released streams only search samples received after reset
+        for (k=0; k<_q->num_released; k++)
+            framesync64bank_clear(_q, _q->released[k], _q->released_len[k]);
+
+        if (_q->counter == _q->nfft)
+            framesync64bank_seek(_q);
+    }
+    LIQUID_COUNTER_STOP(_q, _n*M);
+    return LIQUID_OK;
+}
+
+// set frame detection threshold for all streams
+int framesync64bank_set_threshold(framesync64bank _q,
+                                  float           _threshold)
+{
+    unsigned int i;
+    for (i=0; i<_q->num_streams; i++) {
+        if (framesync64_set_threshold(_q->fs[i], _threshold) != LIQUID_OK)
+            return liquid_error(LIQUID_EICONFIG,"framesync64bank_set_threshold(), could not set threshold");
+    }
+    return LIQUID_OK;
+}
+
+// set carrier frequency offset detection range for all streams
+int framesync64bank_set_range(framesync64bank _q,
+                              float           _range)
+{
+    unsigned int i;
+    for (i=0; i<_q->num_streams; i++) {
+        if (framesync64_set_range(_q->fs[i], _range) != LIQUID_OK)
+            return liquid_error(LIQUID_EICONFIG,"framesync64bank_set_range(), could not set range");
+    }
+    return LIQUID_OK;
+}
+
+// reset frame data statistics for all streams
+int framesync64bank_reset_framedatastats(framesync64bank _q)
+{
+    unsigned int i;
+    for (i=0; i<_q->num_streams; i++)
+        framesync64_reset_framedatastats(_q->fs[i]);
+    return LIQUID_OK;
+}
+
+// get frame data statistics for a single stream
+framedatastats_s framesync64bank_get_framedatastats(framesync64bank _q,
+                                                    unsigned int    _stream)
+{
+    if (_stream >= _q->num_streams) {
+        liquid_error(LIQUID_EIRANGE,"framesync64bank_get_framedatastats(), stream index (%u) exceeds maximum (%u)",
+                _stream, _q->num_streams-1);
+        framedatastats_s stats;
+        framedatastats_reset(&stats);
+        return stats;
+    }
+    return framesync64_get_framedatastats(_q->fs[_stream]);
+}
+
+//
+// internal methods
+//
+
+// search for frames on all idle streams (shared input buffer full)
+int framesync64bank_seek(framesync64bank _q)
+{
+    unsigned int M    = _q->num_streams;
+    unsigned int nfft = _q->nfft;
+
+    // reset counter (last half of time buffer)
+    _q->counter = nfft/2;
+
+    // run forward transforms of all streams at once
+    FFT_EXECUTE(_q->fft);
+    _q->num_transforms++;
+
+    // correlate each idle stream against template; streams detecting a
+    // frame begin aligning from their own time samples
+    unsigned int i, s;
+    for (s=0; s<M; s++) {
+        qdsync_cccf    sync     = framesync64_get_sync(_q->fs[s]);
+        qdetector_cccf detector = qdsync_cccf_get_detector(sync);
+        if (qdsync_cccf_is_open(sync) || qdetector_cccf_is_aligning(detector))
+            continue;
+
+        // gather time samples of stream
+        for (i=0; i<nfft; i++)
+            _q->buf_seek[i] = _q->buf_time[i*M + s];
+
+        float x2_prime = _q->x2_sum_0[s] > _q->x2_sum_1[s] ? _q->x2_sum_0[s] : _q->x2_sum_1[s];
+        if (qdetector_cccf_seek_spectrum(detector, _q->buf_seek, &_q->buf_freq[s*nfft], x2_prime))
+            _q->active[_q->num_active++] = s;
+    }
+
+    // copy last half of time buffer to front
+    memmove(_q->buf_time, &_q->buf_time[(nfft/2)*M], (nfft/2)*M*sizeof(float complex));
+
+    // swap accumulated signal levels
+    float * x2_sum = _q->x2_sum_0;
+    _q->x2_sum_0 = _q->x2_sum_1;
+    _q->x2_sum_1 = x2_sum;
+    memset(_q->x2_sum_1, 0x00, M*sizeof(float));
+    return LIQUID_OK;
+}
+
+// discard samples of a single stream received before its synchronizer
+// was reset, as a reset clears the buffer of a single framesync64
+int framesync64bank_clear(framesync64bank _q,
+                          unsigned int    _stream,
+                          unsigned int    _n)
+{
+    unsigned int M = _q->num_streams;
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _q->buf_time[i*M + _stream] = 0.0f;
+
+    // recompute signal level of each half of buffer
+    _q->x2_sum_0[_stream] = 0.0f;
+    _q->x2_sum_1[_stream] = 0.0f;
+    for (i=_n; i<_q->counter; i++) {
+        float complex x = _q->buf_time[i*M + _stream];
+        float x2 = crealf(x)*crealf(x) + cimagf(x)*cimagf(x);
+        if (i < _q->nfft/2) _q->x2_sum_0[_stream] += x2;
+        else                _q->x2_sum_1[_stream] += x2;
+    }
+    return LIQUID_OK;
+}
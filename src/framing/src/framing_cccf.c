@@ -58,6 +58,7 @@
 #define BSYNC(name)         LIQUID_CONCAT(bsync_cccf,name)
 #define PRESYNC(name)       LIQUID_CONCAT(presync_cccf,name)
 #define QDETECTOR(name)     LIQUID_CONCAT(qdetector_cccf,name)
+#define QDETECTORBANK(name) LIQUID_CONCAT(qdetectorbank_cccf,name)
 #define QDSYNC(name)        LIQUID_CONCAT(qdsync_cccf,name)
 #define SYMTRACK(name)      LIQUID_CONCAT(symtrack_cccf,name)
 
@@ -67,5 +68,6 @@
 #include "presync.proto.c"
 #include "qdetector.proto.c"
 #include "qdsync.proto.c"
+#include "qdetectorbank.proto.c"
 #include "symtrack.proto.c"
 
@@ -720,9 +720,9 @@ int ofdmflexframesync_rxpayload(ofdmflexframesync _q,
             // store received symbol
             _q->payload_syms[_q->payload_symbol_index] = _X[i];
 
-            if (_q->payload_soft) {
-                modemcf_demodulate_soft(_q->mod_payload, _X[i], &sym, &_q->payload_enc[_q->bps_payload*_q->payload_symbol_index]);
-            } else {
+            // soft-decision symbols are demodulated together once the
+            // full payload has been received
+            if (!_q->payload_soft) {
                 modemcf_demodulate(_q->mod_payload, _X[i], &sym);
 
                 // pack decoded symbol into array
@@ -742,6 +742,8 @@ int ofdmflexframesync_rxpayload(ofdmflexframesync _q,
             if (_q->payload_symbol_index == _q->payload_mod_len) {
                 // payload extracted
                 if (_q->payload_soft) {
+                    modemcf_demodsoft_block_dispatch(_q->mod_payload, _q->payload_syms, _q->payload_mod_len,
+                                                     NULL, _q->payload_enc);
                     _q->payload_valid = packetizer_decode_soft(_q->p_payload, _q->payload_enc, _q->payload_dec);
                 } else {
                     // decode payload
@@ -33,9 +33,37 @@
 #define DEBUG_QDETECTOR_PRINT        0
 #define DEBUG_QDETECTOR_FILENAME     "qdetector_cccf_debug.m"
 
+// maximum number of carrier offsets correlated in each batch
+#define QDETECTOR_BATCH_MAX          (8)
+
+// create detector with generic sequence and transform size
+QDETECTOR() QDETECTOR(_create_nfft)(TI *         _s,
+                                    unsigned int _s_len,
+                                    unsigned int _nfft);
+
 // seek signal (initial detection)
 int QDETECTOR(_execute_seek)(QDETECTOR() _q, TI _x);
 
+// correlate transform of input buffer against template over carrier offset
+// range; on detection, begin alignment from time buffer and return 1
+//  _q          :   detector object
+//  _buf_time   :   input buffer (time), [size: nfft x 1]
+//  _buf_freq   :   transform of input buffer, [size: nfft x 1]
+//  _x2_prime   :   input energy of larger buffer half
+int QDETECTOR(_seek_spectrum)(QDETECTOR() _q,
+                              TI *        _buf_time,
+                              TI *        _buf_freq,
+                              float       _x2_prime);
+
+// is detector aligning to signal after initial detection?
+int QDETECTOR(_is_aligning)(QDETECTOR() _q);
+
+// (re)allocate batched correlation buffers for current search range
+int QDETECTOR(_set_batch)(QDETECTOR() _q);
+
+// index into conjugated template for carrier offset (FFT bin)
+unsigned int QDETECTOR(_template_index)(QDETECTOR() _q, int _offset);
+
 // align signal in time, compute offset estimates
 int QDETECTOR(_execute_align)(QDETECTOR() _q, TI _x);
 
@@ -44,6 +72,8 @@ struct QDETECTOR(_s) {
     unsigned int    s_len;          // template (time) length: k * (sequence_len + 2*m)
     TI *            s;              // template (time), [size: s_len x 1]
     TI *            S;              // template (freq), [size: nfft x 1]
+    TI *            S_conj;         // conjugated template (freq) repeated twice so
+                                    // each circular shift is contiguous [size: 2 nfft x 1]
     float           s2_sum;         // sum{ s^2 }
 
     TI *            buf_time_0;     // time-domain buffer (FFT)
@@ -54,6 +84,12 @@ struct QDETECTOR(_s) {
     FFT_PLAN        fft;            // FFT object:  buf_time_0 > buf_freq_0
     FFT_PLAN        ifft;           // IFFT object: buf_freq_1 > buf_freq_1
 
+    // batched correlation over carrier offsets
+    unsigned int    batch_len;      // number of offsets correlated at once
+    TI *            batch_freq;     // cross-multiplied spectra [size: batch_len nfft x 1]
+    TI *            batch_time;     // correlator outputs [size: batch_len nfft x 1]
+    FFT_PLAN        ifft_batch;     // batched IFFT: batch_freq > batch_time
+
     unsigned int    counter;        // sample counter for determining when to compute FFTs
     float           threshold;      // detection threshold
     float           dphi_max;       // carrier offset search range (radians/sample)
@@ -75,6 +111,8 @@ struct QDETECTOR(_s) {
         QDETECTOR_STATE_ALIGN,      // align sequence
     }               state;          // execution state
     int             frame_detected; // frame detected?
+
+    LIQUID_COUNTER_FIELD            // performance counters (when enabled)
 };
 
 // create detector with generic sequence
@@ -86,7 +124,23 @@ QDETECTOR() QDETECTOR(_create)(TI *         _s,
     // validate input
     if (_s_len == 0)
         return liquid_error_config("QDETECTOR(_create)(), sequence length cannot be zero");
-    
+
+    // transform at least twice the sequence length; NOTE: must be even
+    unsigned int nfft = 1 << liquid_nextpow2( (unsigned int)( 2 * _s_len ) );
+    return QDETECTOR(_create_nfft)(_s, _s_len, nfft);
+}
+
+// create detector with generic sequence and transform size
+QDETECTOR() QDETECTOR(_create_nfft)(TI *         _s,
+                                    unsigned int _s_len,
+                                    unsigned int _nfft)
+{
+    // validate input
+    if (_s_len == 0)
+        return liquid_error_config("QDETECTOR(_create_nfft)(), sequence length cannot be zero");
+    if (_nfft < 2*_s_len || (_nfft % 2))
+        return liquid_error_config("QDETECTOR(_create_nfft)(), transform size must be even and at least twice the sequence length");
+
     // allocate memory for main object and set internal properties
     QDETECTOR() q = (QDETECTOR()) malloc(sizeof(struct QDETECTOR(_s)));
     q->s_len = _s_len;
@@ -97,7 +151,7 @@ QDETECTOR() QDETECTOR(_create)(TI *         _s,
     q->s2_sum = liquid_sumsqcf(q->s, q->s_len); // compute sum{ s^2 }
 
     // prepare transforms
-    q->nfft       = 1 << liquid_nextpow2( (unsigned int)( 2 * q->s_len ) ); // NOTE: must be even
+    q->nfft       = _nfft;
     q->buf_time_0 = (TI*) FFT_MALLOC(q->nfft * sizeof(TI));
     q->buf_freq_0 = (TI*) FFT_MALLOC(q->nfft * sizeof(TI));
     q->buf_freq_1 = (TI*) FFT_MALLOC(q->nfft * sizeof(TI));
@@ -113,6 +167,19 @@ QDETECTOR() QDETECTOR(_create)(TI *         _s,
     FFT_EXECUTE(q->fft);
     memmove(q->S, q->buf_freq_0, q->nfft*sizeof(TI));
 
+    // conjugated template, repeated
+    q->S_conj = (TI*) malloc(2 * q->nfft * sizeof(TI));
+    unsigned int i;
+    for (i=0; i<q->nfft; i++) {
+        q->S_conj[i]           = conjf(q->S[i]);
+        q->S_conj[i + q->nfft] = conjf(q->S[i]);
+    }
+
+    // batched correlation buffers are allocated when setting the range
+    q->batch_len  = 0;
+    q->batch_freq = NULL;
+    q->batch_time = NULL;
+
     // clear estimates
     q->rxy       = 0.0f;
     q->tau_hat   = 0.0f;
@@ -127,6 +194,11 @@ QDETECTOR() QDETECTOR(_create)(TI *         _s,
     QDETECTOR(_set_threshold)(q,0.5f);
     QDETECTOR(_set_range    )(q,0.3f); // set initial range for higher detection
 
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "qdetector_" EXTENSION_FULL);
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct QDETECTOR(_s)) +
+        q->s_len*sizeof(TI) + (7 + 2*q->batch_len)*q->nfft*sizeof(TI));
+
     // return object
     return q;
 }
@@ -271,7 +343,7 @@ QDETECTOR() QDETECTOR(_copy)(QDETECTOR() q_orig)
         return liquid_error_config("qdetector_%s_copy(), object cannot be NULL", EXTENSION_FULL);
 
     // create new object from internal sequence
-    QDETECTOR() q_copy = QDETECTOR(_create)(q_orig->s, q_orig->s_len);
+    QDETECTOR() q_copy = QDETECTOR(_create_nfft)(q_orig->s, q_orig->s_len, q_orig->nfft);
 
     // copy buffer contents
     memmove(q_copy->buf_time_0, q_orig->buf_time_0, q_orig->nfft*sizeof(TI));
@@ -282,8 +354,8 @@ QDETECTOR() QDETECTOR(_copy)(QDETECTOR() q_orig)
     // copy internal state
     q_copy->counter         = q_orig->counter;
     q_copy->threshold       = q_orig->threshold;
+    QDETECTOR(_set_range_index)(q_copy, q_orig->range);
     q_copy->dphi_max        = q_orig->dphi_max;
-    q_copy->range           = q_orig->range;
     q_copy->num_transforms  = q_orig->num_transforms;
     // buffer power magnitude
     q_copy->x2_sum_0        = q_orig->x2_sum_0;
@@ -305,9 +377,12 @@ QDETECTOR() QDETECTOR(_copy)(QDETECTOR() q_orig)
 
 int QDETECTOR(_destroy)(QDETECTOR() _q)
 {
+    LIQUID_COUNTER_UNREGISTER(_q);
+
     // free allocated arrays
     free(_q->s);
     free(_q->S);
+    free(_q->S_conj);
     FFT_FREE(_q->buf_time_0);
     FFT_FREE(_q->buf_freq_0);
     FFT_FREE(_q->buf_freq_1);
@@ -316,6 +391,11 @@ int QDETECTOR(_destroy)(QDETECTOR() _q)
     // destroy objects
     FFT_DESTROY_PLAN(_q->fft);
     FFT_DESTROY_PLAN(_q->ifft);
+    if (_q->batch_len > 0) {
+        FFT_DESTROY_PLAN(_q->ifft_batch);
+        FFT_FREE(_q->batch_freq);
+        FFT_FREE(_q->batch_time);
+    }
 
     // free main object memory
     free(_q);
@@ -351,6 +431,7 @@ int QDETECTOR(_reset)(QDETECTOR() _q)
 
 void * QDETECTOR(_execute)(QDETECTOR() _q, TI _x)
 {
+    LIQUID_COUNTER_START(_q);
     switch (_q->state) {
     case QDETECTOR_STATE_SEEK:
         // seek signal
@@ -362,6 +443,7 @@ void * QDETECTOR(_execute)(QDETECTOR() _q, TI _x)
         QDETECTOR(_execute_align)(_q, _x);
         break;
     }
+    LIQUID_COUNTER_STOP(_q, 1);
 
     // check if frame was detected
     if (_q->frame_detected) {
@@ -412,7 +494,7 @@ int QDETECTOR(_set_range)(QDETECTOR() _q,
     _q->range    = (int)(_q->dphi_max * _q->nfft / (2*M_PI));
     _q->range    = _q->range < 0 ? 0 : _q->range;
     //printf("range: %d / %u\n", _q->range, _q->nfft);
-    return LIQUID_OK;
+    return QDETECTOR(_set_batch)(_q);
 }
 
 // set carrier offset search range based on FFT index
@@ -430,7 +512,7 @@ int QDETECTOR(_set_range_index)(QDETECTOR() _q,
     // set internal search range
     _q->range    = _index_max;
     _q->dphi_max = (float)(_q->range) * 2.0f * M_PI / (float)(_q->nfft);
-    return LIQUID_OK;
+    return QDETECTOR(_set_batch)(_q);
 }
 
 // get sequence length
@@ -504,89 +586,98 @@ int QDETECTOR(_execute_seek)(QDETECTOR() _q, TI _x)
     // run forward transform
     FFT_EXECUTE(_q->fft);
 
-    // compute scaling factor (TODO: use median rather than mean signal level)
-    float g0;
-#if 0
-    if (_q->x2_sum_0 == 0.f) {
-        g0 = sqrtf(_q->x2_sum_1) * sqrtf((float)(_q->s_len) / (float)(_q->nfft / 2));
-    } else {
-        g0 = sqrtf(_q->x2_sum_0 + _q->x2_sum_1) * sqrtf((float)(_q->s_len) / (float)(_q->nfft));
-    }
-    //printf("x2: {%12.6f, %12.6f}: g0=%12.6f\n", _q->x2_sum_0, _q->x2_sum_1, g0);
-#else
+    // correlate against template, aligning to signal if detected
     float x2_prime = _q->x2_sum_0 > _q->x2_sum_1 ? _q->x2_sum_0 : _q->x2_sum_1;
-    g0 = sqrtf(x2_prime) * sqrtf((float)(_q->s_len) / (float)(_q->nfft / 2));
-    //printf("x2: {%12.6f, %12.6f} (%12.6f): g0=%12.6f\n", _q->x2_sum_0, _q->x2_sum_1, x2_prime, g0);
-#endif
-    if (g0 < 1e-10) {
-        memmove(_q->buf_time_0,
-                _q->buf_time_0 + _q->nfft / 2,
-                (_q->nfft / 2) * sizeof(liquid_float_complex));
-
-        // swap accumulated signal levels
-        _q->x2_sum_0 = _q->x2_sum_1;
-        _q->x2_sum_1 = 0.0f;
+    if (QDETECTOR(_seek_spectrum)(_q, _q->buf_time_0, _q->buf_freq_0, x2_prime))
         return LIQUID_OK;
-    }
-    float g = 1.0f / ((float)(_q->nfft) * g0 * sqrtf(_q->s2_sum));
-    
-    // sweep over carrier frequency offset range
-    int offset;
-    unsigned int i;
-    float        rxy_peak   = 0.0f;
-    unsigned int rxy_index  = 0;
-    int          rxy_offset = 0;
-    // NOTE: this offset may be coarse as a fine carrier estimate is computed later
-    for (offset=-_q->range; offset<=_q->range; offset++) {
 
-        // cross-multiply, aligning appropriately
-        for (i=0; i<_q->nfft; i++) {
-            // shifted index
-            unsigned int j = (i + _q->nfft - offset) % _q->nfft;
+    // copy last half of fft input buffer to front
+    memmove(_q->buf_time_0, _q->buf_time_0 + _q->nfft/2, (_q->nfft/2)*sizeof(TI));
 
-            _q->buf_freq_1[i] = _q->buf_freq_0[i] * conjf(_q->S[j]);
+    // swap accumulated signal levels
+    _q->x2_sum_0 = _q->x2_sum_1;
+    _q->x2_sum_1 = 0.0f;
+    return LIQUID_OK;
+}
+
+// correlate transform of input buffer against template over carrier offset
+// range; on detection, begin alignment from time buffer and return 1
+int QDETECTOR(_seek_spectrum)(QDETECTOR() _q,
+                              TI *        _buf_time,
+                              TI *        _buf_freq,
+                              float       _x2_prime)
+{
+    // compute scaling factor (TODO: use median rather than mean signal level)
+    float g0 = sqrtf(_x2_prime) * sqrtf((float)(_q->s_len) / (float)(_q->nfft / 2));
+    if (g0 < 1e-10)
+        return 0;
+    float g = 1.0f / ((float)(_q->nfft) * g0 * sqrtf(_q->s2_sum));
+
+    // sweep over carrier frequency offset range, correlating batch_len
+    // offsets at once; the last batch repeats the final offset as needed
+    // NOTE: this offset may be coarse as a fine carrier estimate is computed later
+    unsigned int nfft        = _q->nfft;
+    unsigned int num_offsets = 2*_q->range + 1;
+    unsigned int i, k, b;
+    float        rxy_peak    = 0.0f;    // peak squared magnitude (unscaled)
+    unsigned int rxy_index   = 0;
+    int          rxy_offset  = 0;
+    for (k=0; k<num_offsets; k+=_q->batch_len) {
+        // cross-multiply with circularly-shifted template
+        for (b=0; b<_q->batch_len; b++) {
+            int offset = -_q->range + (int)(k+b < num_offsets ? k+b : num_offsets-1);
+            liquid_vectorcf_mul(_buf_freq,
+                                _q->S_conj + QDETECTOR(_template_index)(_q, offset),
+                                nfft,
+                                _q->batch_freq + b*nfft);
         }
 
-        // run inverse transform
-        FFT_EXECUTE(_q->ifft);
-        
-        // scale output appropriately
-        liquid_vectorcf_mulscalar(_q->buf_time_1, _q->nfft, g, _q->buf_time_1);
+        // run inverse transforms
+        FFT_EXECUTE(_q->ifft_batch);
 
-#if DEBUG_QDETECTOR
-        // debug output
-        char filename[64];
-        sprintf(filename,"qdetector_out_%u_%d.m", _q->num_transforms, offset+2);
-        FILE * fid = fopen(filename, "w");
-        fprintf(fid,"clear all; close all;\n");
-        fprintf(fid,"nfft = %u;\n", _q->nfft);
-        for (i=0; i<_q->nfft; i++)
-            fprintf(fid,"rxy(%6u) = %12.4e + 1i*%12.4e;\n", i+1, crealf(_q->buf_time_1[i]), cimagf(_q->buf_time_1[i]));
-        fprintf(fid,"figure;\n");
-        fprintf(fid,"t=[0:(nfft-1)];\n");
-        fprintf(fid,"plot(t,abs(rxy));\n");
-        fprintf(fid,"grid on;\n");
-        fprintf(fid,"axis([0 %u 0 1.5]);\n", _q->nfft);
-        fprintf(fid,"[v i] = max(abs(rxy));\n");
-        fprintf(fid,"title(sprintf('peak of %%12.8f at index %%u', v, i));\n");
-        fclose(fid);
-        printf("debug: %s\n", filename);
-#endif
         // search for peak
         // TODO: only search over range [-nfft/2, nfft/2)
-        for (i=0; i<_q->nfft; i++) {
-            //float rxy_abs = cabsf(_q->buf_time_1[i]); // <-- slow
-            float vi = crealf(_q->buf_time_1[i]);
-            float vq = cimagf(_q->buf_time_1[i]);
-            float rxy_abs = vi*vi + vq*vq;
-            if (rxy_abs > rxy_peak) {
-                rxy_peak   = rxy_abs;
-                rxy_index  = i;
-                rxy_offset = offset;
+        for (b=0; b<_q->batch_len && k+b<num_offsets; b++) {
+            TI * r = _q->batch_time + b*nfft;
+#if DEBUG_QDETECTOR
+            // debug output
+            char filename[64];
+            sprintf(filename,"qdetector_out_%u_%u.m", _q->num_transforms, k+b);
+            FILE * fid = fopen(filename, "w");
+            fprintf(fid,"clear all; close all;\n");
+            fprintf(fid,"nfft = %u;\n", nfft);
+            for (i=0; i<nfft; i++)
+                fprintf(fid,"rxy(%6u) = %12.4e + 1i*%12.4e;\n", i+1, g*crealf(r[i]), g*cimagf(r[i]));
+            fprintf(fid,"figure;\n");
+            fprintf(fid,"t=[0:(nfft-1)];\n");
+            fprintf(fid,"plot(t,abs(rxy));\n");
+            fprintf(fid,"grid on;\n");
+            fprintf(fid,"axis([0 %u 0 1.5]);\n", nfft);
+            fprintf(fid,"[v i] = max(abs(rxy));\n");
+            fprintf(fid,"title(sprintf('peak of %%12.8f at index %%u', v, i));\n");
+            fclose(fid);
+            printf("debug: %s\n", filename);
+#endif
+            // maximum squared magnitude (no branches in loop)
+            float v_max = 0.0f;
+            for (i=0; i<nfft; i++) {
+                float v = crealf(r[i])*crealf(r[i]) + cimagf(r[i])*cimagf(r[i]);
+                v_max = v > v_max ? v : v_max;
+            }
+
+            // skip index search unless peak improves
+            if (v_max <= rxy_peak)
+                continue;
+            for (i=0; i<nfft; i++) {
+                if (crealf(r[i])*crealf(r[i]) + cimagf(r[i])*cimagf(r[i]) == v_max)
+                    break;
             }
+            rxy_peak   = v_max;
+            rxy_index  = i;
+            rxy_offset = -_q->range + (int)(k+b);
         }
     }
-    rxy_peak = sqrtf(rxy_peak);
+    rxy_peak = sqrtf(rxy_peak) * g;
 
     // increment number of transforms (debugging)
     _q->num_transforms++;
@@ -602,22 +693,20 @@ int QDETECTOR(_execute_seek)(QDETECTOR() _q, TI _x)
         // TODO: check for edge case where rxy_index is zero (signal already aligned)
 
         // copy last part of fft input buffer to front
-        memmove(_q->buf_time_0, _q->buf_time_0 + rxy_index, (_q->nfft - rxy_index)*sizeof(TI));
+        memmove(_q->buf_time_0, _buf_time + rxy_index, (_q->nfft - rxy_index)*sizeof(TI));
         _q->counter = _q->nfft - rxy_index;
-
-        return LIQUID_OK;
+        return 1;
     }
 #if DEBUG_QDETECTOR_PRINT
     printf(" no detect, rxy = %12.8f, time index=%u, freq. offset=%d\n", rxy_peak, rxy_index, rxy_offset);
 #endif
-    
-    // copy last half of fft input buffer to front
-    memmove(_q->buf_time_0, _q->buf_time_0 + _q->nfft/2, (_q->nfft/2)*sizeof(TI));
+    return 0;
+}
 
-    // swap accumulated signal levels
-    _q->x2_sum_0 = _q->x2_sum_1;
-    _q->x2_sum_1 = 0.0f;
-    return LIQUID_OK;
+// is detector aligning to signal after initial detection?
+int QDETECTOR(_is_aligning)(QDETECTOR() _q)
+{
+    return _q->state == QDETECTOR_STATE_ALIGN;
 }
 
 // align signal in time, compute offset estimates
@@ -636,11 +725,10 @@ int QDETECTOR(_execute_align)(QDETECTOR() _q, TI _x)
     // cross-multiply frequency-domain components, aligning appropriately with
     // estimated FFT offset index due to carrier frequency offset in received signal
     unsigned int i;
-    for (i=0; i<_q->nfft; i++) {
-        // shifted index
-        unsigned int j = (i + _q->nfft - _q->offset) % _q->nfft;
-        _q->buf_freq_1[i] = _q->buf_freq_0[i] * conjf(_q->S[j]);
-    }
+    liquid_vectorcf_mul(_q->buf_freq_0,
+                        _q->S_conj + QDETECTOR(_template_index)(_q, _q->offset),
+                        _q->nfft,
+                        _q->buf_freq_1);
     FFT_EXECUTE(_q->ifft);
     // time aligned to index 0
     // NOTE: taking the sqrt removes bias in the timing estimate, but messes up gamma estimate
@@ -751,3 +839,38 @@ int QDETECTOR(_execute_align)(QDETECTOR() _q, TI _x)
     return LIQUID_OK;
 }
 
+// (re)allocate batched correlation buffers for current search range
+int QDETECTOR(_set_batch)(QDETECTOR() _q)
+{
+    // split offsets evenly into fewest batches of at most QDETECTOR_BATCH_MAX
+    unsigned int num_offsets = 2*_q->range + 1;
+    unsigned int num_batches = (num_offsets + QDETECTOR_BATCH_MAX - 1) / QDETECTOR_BATCH_MAX;
+    unsigned int batch_len   = (num_offsets + num_batches - 1) / num_batches;
+    if (batch_len == _q->batch_len)
+        return LIQUID_OK;
+
+    // destroy existing buffers and plan
+    if (_q->batch_len > 0) {
+        FFT_DESTROY_PLAN(_q->ifft_batch);
+        FFT_FREE(_q->batch_freq);
+        FFT_FREE(_q->batch_time);
+    }
+
+    // create new buffers and plan
+    _q->batch_len  = batch_len;
+    _q->batch_freq = (TI*) FFT_MALLOC(_q->batch_len * _q->nfft * sizeof(TI));
+    _q->batch_time = (TI*) FFT_MALLOC(_q->batch_len * _q->nfft * sizeof(TI));
+    _q->ifft_batch = FFT_CREATE_PLAN_MANY(_q->nfft, _q->batch_len,
+                                          _q->batch_freq, 1, _q->nfft,
+                                          _q->batch_time, 1, _q->nfft,
+                                          FFT_DIR_BACKWARD, FFT_METHOD);
+    return LIQUID_OK;
+}
+
+// index into conjugated template for carrier offset (FFT bin) such that
+// S_conj[index + i] = conj(S[(i - offset) mod nfft]) for i in [0, nfft)
+unsigned int QDETECTOR(_template_index)(QDETECTOR() _q, int _offset)
+{
+    int n = (int)(_q->nfft);
+    return (unsigned int)( ((-_offset % n) + n) % n );
+}
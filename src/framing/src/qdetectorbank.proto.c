@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// Detector bank: runs several qdsync frame synchronizers on the same input
+// stream, computing the forward transform of each input block once and
+// correlating it against the preamble template of every synchronizer
+// that is still searching for a frame.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+// resize shared buffers and member detectors to transform size
+int QDETECTORBANK(_set_nfft)(QDETECTORBANK() _q, unsigned int _nfft);
+
+// clear shared input buffer without touching registered synchronizers
+int QDETECTORBANK(_reset_buffer)(QDETECTORBANK() _q);
+
+// search for frames in shared input buffer (full)
+int QDETECTORBANK(_seek)(QDETECTORBANK() _q);
+
+// main object definition
+struct QDETECTORBANK(_s) {
+    unsigned int    num_syncs;      // number of registered synchronizers
+    QDSYNC() *      syncs;          // registered synchronizers (not owned)
+
+    unsigned int    nfft;           // shared transform size
+    TI *            buf_time;       // input buffer (time), [size: nfft x 1]
+    TI *            buf_freq;       // input buffer (freq), [size: nfft x 1]
+    FFT_PLAN        fft;            // forward transform: buf_time > buf_freq
+    unsigned int    counter;        // sample counter for determining when to compute FFTs
+    unsigned int    num_transforms; // number of transforms taken
+
+    float           x2_sum_0;       // sum{ |x|^2 } of first half of buffer
+    float           x2_sum_1;       // sum{ |x|^2 } of second half of buffer
+};
+
+// create empty detector bank
+QDETECTORBANK() QDETECTORBANK(_create)(void)
+{
+    QDETECTORBANK() q = (QDETECTORBANK()) malloc(sizeof(struct QDETECTORBANK(_s)));
+    q->num_syncs = 0;
+    q->syncs     = NULL;
+    q->nfft      = 0;
+    q->buf_time  = NULL;
+    q->buf_freq  = NULL;
+    QDETECTORBANK(_reset)(q);
+    return q;
+}
+
+// destroy detector bank; registered synchronizers are not destroyed
+int QDETECTORBANK(_destroy)(QDETECTORBANK() _q)
+{
+    if (_q->nfft > 0) {
+        FFT_FREE(_q->buf_time);
+        FFT_FREE(_q->buf_freq);
+        FFT_DESTROY_PLAN(_q->fft);
+    }
+    free(_q->syncs);
+    free(_q);
+    return LIQUID_OK;
+}
+
+int QDETECTORBANK(_print)(QDETECTORBANK() _q)
+{
+    printf("<liquid.qdetectorbank_%s", EXTENSION_FULL);
+    printf(", syncs=%u", _q->num_syncs);
+    printf(", nfft=%u", _q->nfft);
+    printf(">\n");
+    return LIQUID_OK;
+}
+
+// reset shared buffer and all registered synchronizers
+int QDETECTORBANK(_reset)(QDETECTORBANK() _q)
+{
+    unsigned int i;
+    for (i=0; i<_q->num_syncs; i++)
+        QDSYNC(_reset)(_q->syncs[i]);
+
+    _q->num_transforms = 0;
+    return QDETECTORBANK(_reset_buffer)(_q);
+}
+
+// register synchronizer with detector bank
+int QDETECTORBANK(_add)(QDETECTORBANK() _q,
+                        QDSYNC()        _sync)
+{
+    if (_sync == NULL)
+        return liquid_error(LIQUID_EIOBJ,"QDETECTORBANK(_add)(), synchronizer cannot be NULL");
+    unsigned int i;
+    for (i=0; i<_q->num_syncs; i++) {
+        if (_q->syncs[i] == _sync)
+            return liquid_error(LIQUID_EICONFIG,"QDETECTORBANK(_add)(), synchronizer already registered");
+    }
+
+    QDSYNC() * syncs = (QDSYNC()*) realloc(_q->syncs, (_q->num_syncs+1)*sizeof(QDSYNC()));
+    if (syncs == NULL)
+        return liquid_error(LIQUID_EIMEM,"QDETECTORBANK(_add)(), could not allocate memory");
+    _q->syncs = syncs;
+    _q->syncs[_q->num_syncs++] = _sync;
+
+    // share transform of largest detector
+    unsigned int nfft = QDETECTOR(_get_buf_len)(QDSYNC(_get_detector)(_sync));
+    return QDETECTORBANK(_set_nfft)(_q, nfft > _q->nfft ? nfft : _q->nfft);
+}
+
+// get number of registered synchronizers
+unsigned int QDETECTORBANK(_get_num_syncs)(QDETECTORBANK() _q)
+{
+    return _q->num_syncs;
+}
+
+// get shared transform size
+unsigned int QDETECTORBANK(_get_buf_len)(QDETECTORBANK() _q)
+{
+    return _q->nfft;
+}
+
+// get number of shared transforms taken
+unsigned int QDETECTORBANK(_get_num_transforms)(QDETECTORBANK() _q)
+{
+    return _q->num_transforms;
+}
+
+// execute detector bank on block of samples
+int QDETECTORBANK(_execute)(QDETECTORBANK() _q,
+                            TI *            _buf,
+                            unsigned int    _buf_len)
+{
+    unsigned int i, j;
+    for (i=0; i<_buf_len; i++) {
+        TI x = _buf[i];
+
+        // synchronizers aligning to or receiving a frame consume samples
+        // directly
+        for (j=0; j<_q->num_syncs; j++) {
+            if (QDSYNC(_is_open)(_q->syncs[j]) ||
+                QDETECTOR(_is_aligning)(QDSYNC(_get_detector)(_q->syncs[j])))
+            {
+                QDSYNC(_execute)(_q->syncs[j], &x, 1);
+            }
+        }
+
+        // write sample to shared buffer and accumulate signal magnitude
+        if (_q->nfft == 0)
+            continue;
+        _q->buf_time[_q->counter++] = x;
+        _q->x2_sum_1 += crealf(x)*crealf(x) + cimagf(x)*cimagf(x);
+        if (_q->counter == _q->nfft)
+            QDETECTORBANK(_seek)(_q);
+    }
+    return LIQUID_OK;
+}
+
+//
+// internal methods
+//
+
+// resize shared buffers and member detectors to transform size; detectors
+// of synchronizers aligning to or receiving a frame are left alone and
+// resized once they return to searching (see _seek)
+int QDETECTORBANK(_set_nfft)(QDETECTORBANK() _q,
+                             unsigned int    _nfft)
+{
+    unsigned int i;
+    for (i=0; i<_q->num_syncs; i++) {
+        QDETECTOR() detector = QDSYNC(_get_detector)(_q->syncs[i]);
+        if (QDSYNC(_is_open)(_q->syncs[i]) || QDETECTOR(_is_aligning)(detector))
+            continue;
+        if (QDSYNC(_set_detector_nfft)(_q->syncs[i], _nfft) != LIQUID_OK)
+            return liquid_error(LIQUID_EICONFIG,"QDETECTORBANK(_set_nfft)(), could not resize detector");
+    }
+    if (_nfft == _q->nfft)
+        return LIQUID_OK;
+
+    // re-create shared buffers and transform
+    if (_q->nfft > 0) {
+        FFT_FREE(_q->buf_time);
+        FFT_FREE(_q->buf_freq);
+        FFT_DESTROY_PLAN(_q->fft);
+    }
+    _q->nfft     = _nfft;
+    _q->buf_time = (TI*) FFT_MALLOC(_q->nfft * sizeof(TI));
+    _q->buf_freq = (TI*) FFT_MALLOC(_q->nfft * sizeof(TI));
+    _q->fft      = FFT_CREATE_PLAN(_q->nfft, _q->buf_time, _q->buf_freq, FFT_DIR_FORWARD, FFT_METHOD);
+    return QDETECTORBANK(_reset_buffer)(_q);
+}
+
+// clear shared input buffer without touching registered synchronizers
+int QDETECTORBANK(_reset_buffer)(QDETECTORBANK() _q)
+{
+    _q->counter  = _q->nfft/2;
+    _q->x2_sum_0 = 0.0f;
+    _q->x2_sum_1 = 0.0f;
+    if (_q->nfft > 0)
+        memset(_q->buf_time, 0x00, _q->nfft*sizeof(TI));
+    return LIQUID_OK;
+}
+
+// search for frames in shared input buffer (full)
+int QDETECTORBANK(_seek)(QDETECTORBANK() _q)
+{
+    // reset counter (last half of time buffer)
+    _q->counter = _q->nfft/2;
+
+    // run forward transform once for all synchronizers
+    FFT_EXECUTE(_q->fft);
+    _q->num_transforms++;
+
+    // correlate against templates of synchronizers still searching; those
+    // detecting a frame begin aligning from the shared buffer
+    float x2_prime = _q->x2_sum_0 > _q->x2_sum_1 ? _q->x2_sum_0 : _q->x2_sum_1;
+    unsigned int i;
+    for (i=0; i<_q->num_syncs; i++) {
+        QDETECTOR() detector = QDSYNC(_get_detector)(_q->syncs[i]);
+        if (QDSYNC(_is_open)(_q->syncs[i]) || QDETECTOR(_is_aligning)(detector))
+            continue;
+
+        // apply resize deferred while synchronizer was busy with a frame
+        if (QDETECTOR(_get_buf_len)(detector) != _q->nfft) {
+            if (QDSYNC(_set_detector_nfft)(_q->syncs[i], _q->nfft) != LIQUID_OK)
+                continue;
+            detector = QDSYNC(_get_detector)(_q->syncs[i]);
+        }
+        QDETECTOR(_seek_spectrum)(detector, _q->buf_time, _q->buf_freq, x2_prime);
+    }
+
+    // copy last half of fft input buffer to front
+    memmove(_q->buf_time, _q->buf_time + _q->nfft/2, (_q->nfft/2)*sizeof(TI));
+
+    // swap accumulated signal levels
+    _q->x2_sum_0 = _q->x2_sum_1;
+    _q->x2_sum_1 = 0.0f;
+    return LIQUID_OK;
+}
@@ -43,6 +43,13 @@ int QDSYNC(_step)(QDSYNC() _q, float complex _x);
 // append sample to output buffer
 int QDSYNC(_buf_append)(QDSYNC() _q, float complex _x);
 
+// internal use only - get frame detector
+QDETECTOR() QDSYNC(_get_detector)(QDSYNC() _q);
+
+// internal use only - rebuild frame detector with larger transform size,
+// preserving detection threshold and carrier offset search range
+int QDSYNC(_set_detector_nfft)(QDSYNC() _q, unsigned int _nfft);
+
 // main object definition
 struct QDSYNC(_s) {
     int             ftype;      // filter type
@@ -452,6 +459,32 @@ int QDSYNC(_step)(QDSYNC() _q, TI _x)
     return LIQUID_OK;
 }
 
+// internal use only - get frame detector
+QDETECTOR() QDSYNC(_get_detector)(QDSYNC() _q)
+{
+    return _q->detector;
+}
+
+// internal use only - rebuild frame detector with larger transform size,
+// preserving detection threshold and carrier offset search range
+int QDSYNC(_set_detector_nfft)(QDSYNC()     _q,
+                               unsigned int _nfft)
+{
+    if (_nfft == QDETECTOR(_get_buf_len)(_q->detector))
+        return LIQUID_OK;
+
+    QDETECTOR() detector = QDETECTOR(_create_nfft)((TI*)QDETECTOR(_get_sequence)(_q->detector),
+                                                   QDETECTOR(_get_seq_len)(_q->detector),
+                                                   _nfft);
+    if (detector == NULL)
+        return liquid_error(LIQUID_EICONFIG,"QDSYNC(_set_detector_nfft)(), invalid transform size %u", _nfft);
+    QDETECTOR(_set_threshold)(detector, QDETECTOR(_get_threshold)(_q->detector));
+    QDETECTOR(_set_range    )(detector, QDETECTOR(_get_range    )(_q->detector));
+    QDETECTOR(_destroy)(_q->detector);
+    _q->detector = detector;
+    return LIQUID_OK;
+}
+
 // append sample to output buffer
 int QDSYNC(_buf_append)(QDSYNC() _q, TO _x)
 {
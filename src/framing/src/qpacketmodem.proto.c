@@ -346,28 +346,13 @@ int QPACKETMODEM(_decode_soft)(qpacketmodem    _q,
                                TO *            _frame,
                                unsigned char * _payload)
 {
-    unsigned int i;
-
-    // demodulate and pack bytes into decoder input buffer
-    unsigned int sym;
-    //memset(_q->payload_enc, 0x00, _q->payload_enc_len*sizeof(unsigned char));
-    unsigned int n = 0;
-    _q->evm = 0.0f;
-    for (i=0; i<_q->payload_mod_len; i++) {
-        // demodulate symbol
-        MODEM(_demodulate_soft)(_q->mod_payload, _frame[i], &sym, _q->payload_enc+n);
-        n += _q->bits_per_symbol;
+    // demodulate entire payload into decoder input buffer
+    MODEM(_demodsoft_block_dispatch)(_q->mod_payload, _frame, _q->payload_mod_len,
+                                     NULL, _q->payload_enc);
 
-        // accumulate error vector magnitude estimate
-        float e = MODEM(_get_demodulator_evm)(_q->mod_payload);
-        _q->evm += e*e;
-    }
-    //printf("received %u bits (expected %u)\n", n, _q->payload_mod_len * _q->bits_per_symbol);
-    if (n != _q->payload_mod_len * _q->bits_per_symbol)
-        return liquid_error(LIQUID_EINT,"qpacketmodem_decode_soft(), unexpected number of bits received");
-
-    // update internal error vector magnitude estimate
-    _q->evm = 10*log10f(_q->evm / (float)(_q->payload_mod_len));
+    // update internal error vector magnitude estimate (rms over payload)
+    float e = MODEM(_get_demodulator_evm)(_q->mod_payload);
+    _q->evm = 10*log10f(e*e);
 
     // decode payload, returning flag if decoded payload is valid
     return packetizer_decode_soft(_q->p, _q->payload_enc, _payload);
@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
 #include "liquid.autotest.h"
 #include "liquid.internal.h"
 
@@ -86,6 +87,160 @@ LIQUID_AUTOTEST(flexframesync,"simple recovery of flexframe in noise","",0.1)
     flexframesync_destroy(fs);
 }
 
+// record order and validity of frames recovered by pipelined synchronizer
+struct flexframesync_autotest_s {
+    unsigned int index[8];      // first payload byte of each frame, in order
+    unsigned int num_frames;    // number of frames received
+    unsigned int num_valid;     // number of frames with valid payload
+};
+
+static int flexframesync_autotest_callback(unsigned char *  _header,
+                                           int              _header_valid,
+                                           unsigned char *  _payload,
+                                           unsigned int     _payload_len,
+                                           int              _payload_valid,
+                                           framesyncstats_s _stats,
+                                           void *           _context)
+{
+    struct flexframesync_autotest_s * c = (struct flexframesync_autotest_s *) _context;
+    if (c->num_frames < 8)
+        c->index[c->num_frames] = _header_valid && _payload_len > 0 ? _payload[0] : 0xff;
+    c->num_frames++;
+    c->num_valid += _payload_valid && _stats.framesyms != NULL ? 1 : 0;
+    return 0;
+}
+
+// run several back-to-back frames through synchronizer with background decoding
+void testbench_flexframesync_threads(liquid_autotest __q__,
+                                     unsigned int    _num_threads)
+{
+    unsigned int i, num_frames = 8;
+
+    // create flexframegen object
+    flexframegenprops_s fgprops;
+    flexframegenprops_init_default(&fgprops);
+    fgprops.mod_scheme  = LIQUID_MODEM_QPSK;
+    fgprops.check       = LIQUID_CRC_32;
+    fgprops.fec0        = LIQUID_FEC_NONE;
+    fgprops.fec1        = LIQUID_FEC_HAMMING74;
+    flexframegen fg = flexframegen_create(&fgprops);
+
+    // create flexframesync object
+    struct flexframesync_autotest_s context;
+    memset(&context, 0x00, sizeof(context));
+    flexframesync fs = flexframesync_create(flexframesync_autotest_callback, (void*)&context);
+    flexframesync_set_num_threads(fs, _num_threads);
+    flexframesync_decode_payload_soft(fs, 1);
+
+    // assemble and synchronize frames of varying length
+    unsigned char header[14] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+    unsigned char payload[400];
+    float complex buf[64];
+    for (i=0; i<num_frames; i++) {
+        unsigned int j, payload_len = 40 + 40*(i % 4);
+        payload[0] = i;
+        for (j=1; j<payload_len; j++)
+            payload[j] = rand() & 0xff;
+        flexframegen_assemble(fg, header, payload, payload_len);
+
+        int frame_complete = 0;
+        while (!frame_complete) {
+            frame_complete = flexframegen_write_samples(fg, buf, 64);
+            flexframesync_execute(fs, buf, 64);
+        }
+    }
+
+    // flush trailing samples and wait for decoding to complete
+    memset(buf, 0x00, sizeof(buf));
+    for (i=0; i<8; i++)
+        flexframesync_execute(fs, buf, 64);
+    flexframesync_flush(fs);
+    framedatastats_s stats = flexframesync_get_framedatastats(fs);
+
+    // ensure frames were delivered in order
+    LIQUID_CHECK( context.num_frames == num_frames );
+    LIQUID_CHECK( context.num_valid  == num_frames );
+    for (i=0; i<num_frames; i++)
+        LIQUID_CHECK( context.index[i] == i );
+
+    LIQUID_CHECK( stats.num_frames_detected == num_frames );
+    LIQUID_CHECK( stats.num_headers_valid   == num_frames );
+    LIQUID_CHECK( stats.num_payloads_valid  == num_frames );
+    LIQUID_CHECK( stats.num_bytes_received  == 2*40*(1+2+3+4) );
+
+    // destroy objects
+    flexframegen_destroy(fg);
+    flexframesync_destroy(fs);
+}
+
+LIQUID_AUTOTEST(flexframesync_threads_0,"frame order with inline decoding","",0.1) { testbench_flexframesync_threads(__q__, 0); }
+LIQUID_AUTOTEST(flexframesync_threads_1,"frame order with 1 decoding thread","",0.1) { testbench_flexframesync_threads(__q__, 1); }
+LIQUID_AUTOTEST(flexframesync_threads_3,"frame order with 3 decoding threads","",0.1) { testbench_flexframesync_threads(__q__, 3); }
+
+// callback attempting to wait on its own synchronizer
+struct flexframesync_autotest_reentry_s {
+    flexframesync fs;           // synchronizer invoking callback
+    unsigned int  num_frames;   // number of frames received
+    int           rc[3];        // return values of flush/set_num_threads/destroy
+};
+
+static int flexframesync_autotest_reentry_callback(unsigned char *  _header,
+                                                   int              _header_valid,
+                                                   unsigned char *  _payload,
+                                                   unsigned int     _payload_len,
+                                                   int              _payload_valid,
+                                                   framesyncstats_s _stats,
+                                                   void *           _context)
+{
+    struct flexframesync_autotest_reentry_s * c = (struct flexframesync_autotest_reentry_s *) _context;
+    c->rc[0] = flexframesync_flush(c->fs);
+    c->rc[1] = flexframesync_set_num_threads(c->fs, 0);
+    c->rc[2] = flexframesync_destroy(c->fs);
+    c->num_frames++;
+    return 0;
+}
+
+// calls from within the callback which would wait on the callback fail
+// rather than deadlock
+LIQUID_AUTOTEST(flexframesync_threads_reentry,"flush from callback","",0.1)
+{
+    _liquid_error_downgrade_enable();
+    flexframegenprops_s fgprops;
+    flexframegenprops_init_default(&fgprops);
+    flexframegen fg = flexframegen_create(&fgprops);
+
+    struct flexframesync_autotest_reentry_s context;
+    memset(&context, 0x00, sizeof(context));
+    flexframesync fs = flexframesync_create(flexframesync_autotest_reentry_callback, (void*)&context);
+    context.fs = fs;
+    flexframesync_set_num_threads(fs, 2);
+
+    // synchronize one frame followed by silence
+    unsigned char header[14] = {0};
+    unsigned char payload[64] = {0};
+    float complex buf[64];
+    flexframegen_assemble(fg, header, payload, 64);
+    int frame_complete = 0;
+    while (!frame_complete) {
+        frame_complete = flexframegen_write_samples(fg, buf, 64);
+        flexframesync_execute(fs, buf, 64);
+    }
+    memset(buf, 0x00, sizeof(buf));
+    unsigned int i;
+    for (i=0; i<8; i++)
+        flexframesync_execute(fs, buf, 64);
+    LIQUID_CHECK( flexframesync_flush(fs) == LIQUID_OK );
+
+    LIQUID_CHECK( context.num_frames == 1 );
+    LIQUID_CHECK( context.rc[0] == LIQUID_EICONFIG );
+    LIQUID_CHECK( context.rc[1] == LIQUID_EICONFIG );
+    LIQUID_CHECK( context.rc[2] == LIQUID_EICONFIG );
+
+    flexframegen_destroy(fg);
+    flexframesync_destroy(fs);
+    _liquid_error_downgrade_disable();
+}
+
 LIQUID_AUTOTEST(flexframe_config,"check configuration validity","",0.1)
 {
     _liquid_error_downgrade_enable();
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "liquid.autotest.h"
+#include "liquid.internal.h"
+
+// count valid payloads received on a stream
+int framesync64bank_autotest_callback(unsigned char *  _header,
+                                      int              _header_valid,
+                                      unsigned char *  _payload,
+                                      unsigned int     _payload_len,
+                                      int              _payload_valid,
+                                      framesyncstats_s _stats,
+                                      void *           _context)
+{
+    unsigned int * num_valid = (unsigned int*) _context;
+    *num_valid += _payload_valid ? 1 : 0;
+    return 0;
+}
+
+// transmit frames on a subset of streams and ensure each is recovered on
+// its own stream only; input is pushed in irregular block sizes
+void testbench_framesync64bank(liquid_autotest __q__,
+                               unsigned int    _num_streams,
+                               unsigned int    _num_frames)
+{
+    unsigned int num_streams = _num_streams;
+    unsigned int num_samples = (_num_frames + 1)*LIQUID_FRAME64_LEN;
+    float        nstd        = 0.01f;
+    unsigned int i, j, s;
+
+    // generate stream-interleaved input with noise on every stream
+    float complex * x = (float complex*) malloc(num_samples*num_streams*sizeof(float complex));
+    for (i=0; i<num_samples*num_streams; i++)
+        x[i] = nstd*(randnf() + _Complex_I*randnf())*M_SQRT1_2;
+
+    // add frames to every other stream, each with different delay
+    framegen64 fg = framegen64_create();
+    float complex frame[LIQUID_FRAME64_LEN];
+    for (s=1; s<num_streams; s+=2) {
+        unsigned int delay = 97*s % (LIQUID_FRAME64_LEN/2);
+        for (j=0; j<_num_frames; j++) {
+            framegen64_execute(fg, NULL, NULL, frame);
+            for (i=0; i<LIQUID_FRAME64_LEN; i++)
+                x[(delay + j*LIQUID_FRAME64_LEN + i)*num_streams + s] += frame[i];
+        }
+    }
+
+    // create synchronizer with separate context for each stream
+    unsigned int num_valid[num_streams];
+    framesync64bank q = framesync64bank_create(num_streams, framesync64bank_autotest_callback, NULL);
+    LIQUID_CHECK(framesync64bank_get_num_streams(q) == num_streams);
+    for (s=0; s<num_streams; s++) {
+        num_valid[s] = 0;
+        framesync64bank_set_userdata(q, s, (void*)&num_valid[s]);
+    }
+
+    // run samples through in irregular blocks
+    unsigned int block_len[] = {1, 37, 256, 1000, 3};
+    for (i=0, j=0; i<num_samples; j++) {
+        unsigned int n = block_len[j % 5];
+        n = i + n < num_samples ? n : num_samples - i;
+        framesync64bank_execute(q, &x[i*num_streams], n);
+        i += n;
+    }
+
+    // check results for each stream
+    for (s=0; s<num_streams; s++) {
+        unsigned int num_expected = (s & 1) ? _num_frames : 0;
+        framedatastats_s stats = framesync64bank_get_framedatastats(q, s);
+        LIQUID_CHECK(num_valid[s]              == num_expected);
+        LIQUID_CHECK(stats.num_frames_detected == num_expected);
+        LIQUID_CHECK(stats.num_payloads_valid  == num_expected);
+    }
+
+    // destroy objects
+    framegen64_destroy(fg);
+    framesync64bank_destroy(q);
+    free(x);
+}
+
+LIQUID_AUTOTEST(framesync64bank_n1,"","",0.1) { testbench_framesync64bank(__q__,  1, 1); }
+LIQUID_AUTOTEST(framesync64bank_n2,"","",0.1) { testbench_framesync64bank(__q__,  2, 1); }
+LIQUID_AUTOTEST(framesync64bank_n7,"","",0.1) { testbench_framesync64bank(__q__,  7, 2); }
+LIQUID_AUTOTEST(framesync64bank_n16,"","",0.1){ testbench_framesync64bank(__q__, 16, 3); }
+
+LIQUID_AUTOTEST(framesync64bank_config,"framesync64bank config","",0.1)
+{
+    _liquid_error_downgrade_enable();
+    // check invalid function calls
+    LIQUID_CHECK(NULL == framesync64bank_create(0, NULL, NULL));
+
+    // create proper object and test configurations
+    framesync64bank q = framesync64bank_create(4, NULL, NULL);
+    LIQUID_CHECK(LIQUID_OK == framesync64bank_print(q))
+    LIQUID_CHECK(LIQUID_OK == framesync64bank_set_threshold(q, 0.4f))
+    LIQUID_CHECK(LIQUID_OK == framesync64bank_set_range(q, 0.01f))
+    LIQUID_CHECK(LIQUID_OK == framesync64bank_set_userdata(q, 3, NULL))
+    LIQUID_CHECK(LIQUID_OK != framesync64bank_set_userdata(q, 4, NULL))
+    LIQUID_CHECK(LIQUID_OK == framesync64bank_reset_framedatastats(q))
+    LIQUID_CHECK(0 == framesync64bank_get_framedatastats(q, 4).num_frames_detected)
+    LIQUID_CHECK(LIQUID_OK == framesync64bank_reset(q))
+
+    // destroy object
+    framesync64bank_destroy(q);
+    _liquid_error_downgrade_disable();
+}
@@ -187,3 +187,43 @@ void qdetector_cccf_runtest(liquid_autotest __q__, qdetector_cccf _q)
     }
 }
 
+
+// detect frame with large carrier frequency offset, searching over many
+// offsets in multiple batches
+void qdetector_cccf_runtest_cfo(liquid_autotest __q__, float _dphi, float _range)
+{
+    unsigned int sequence_len = 128;
+    unsigned int i;
+    float complex sequence[sequence_len];
+    for (i=0; i<sequence_len; i++) {
+        sequence[i] = (rand() % 2 ? 1.0f : -1.0f) * M_SQRT1_2 +
+                      (rand() % 2 ? 1.0f : -1.0f) * M_SQRT1_2 * _Complex_I;
+    }
+    qdetector_cccf q = qdetector_cccf_create_linear(sequence, sequence_len,
+        LIQUID_FIRFILT_ARKAISER, 2, 7, 0.3f);
+    qdetector_cccf_set_range(q, _range);
+
+    // generate frame with carrier offset
+    float complex * seq = (float complex*)qdetector_cccf_get_sequence(q);
+    unsigned int seq_len     = qdetector_cccf_get_seq_len(q);
+    unsigned int num_samples = 8*seq_len;
+    float complex buf_rx[num_samples];
+    for (i=0; i<num_samples; i++)
+        buf_rx[i] = (i < seq_len ? seq[i] : 0.0f) * cexpf(_Complex_I*(_dphi*i + 0.5f));
+
+    // run detector
+    int frame_detected = 0;
+    for (i=0; i<num_samples && !frame_detected; i++)
+        frame_detected = qdetector_cccf_execute(q, buf_rx[i]) != NULL;
+
+    LIQUID_CHECK(frame_detected);
+    if (frame_detected) {
+        LIQUID_CHECK_DELTA(qdetector_cccf_get_dphi(q), _dphi, 0.01f);
+        LIQUID_CHECK_DELTA(qdetector_cccf_get_tau (q), 0.0f,  0.05f);
+    }
+    qdetector_cccf_destroy(q);
+}
+
+LIQUID_AUTOTEST(qdetector_cccf_cfo_p100,"","",0.1) { qdetector_cccf_runtest_cfo(__q__,  0.100f, 0.3f); }
+LIQUID_AUTOTEST(qdetector_cccf_cfo_m200,"","",0.1) { qdetector_cccf_runtest_cfo(__q__, -0.200f, 0.3f); }
+LIQUID_AUTOTEST(qdetector_cccf_cfo_p010,"","",0.1) { qdetector_cccf_runtest_cfo(__q__,  0.010f, 0.02f); }
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "liquid.autotest.h"
+#include "liquid.internal.h"
+
+// common structure for relaying information to/from callback
+typedef struct {
+    int             id;
+    float complex * buf;
+    unsigned int    buf_len;
+    unsigned int    count;
+} autotest_qdetectorbank_s;
+
+// synchronization callback, return 0:continue, 1:reset
+int autotest_qdetectorbank_callback(float complex * _buf,
+                                    unsigned int    _buf_len,
+                                    void *          _context)
+{
+    // save samples to buffer as appropriate
+    autotest_qdetectorbank_s * q = (autotest_qdetectorbank_s *) _context;
+    liquid_log_debug("[%d] qdetectorbank callback got %u samples", q->id, _buf_len);
+    unsigned int i;
+    for (i=0; i<_buf_len; i++) {
+        if (q->count == q->buf_len)
+            return 1; // buffer full; reset synchronizer
+
+        // save payload
+        q->buf[q->count++] = _buf[i];
+    }
+    return 0;
+}
+
+// transmit each frame in turn on a common stream and ensure that only the
+// matching synchronizer in the bank receives it
+void testbench_qdetectorbank(liquid_autotest __q__,
+                             unsigned int    _k,
+                             unsigned int    _m,
+                             float           _beta)
+{
+    // options
+    unsigned int num_syncs    =    3;   // number of synchronizers in bank
+    unsigned int seq_len      =  400;   // total number of symbols in each frame
+    unsigned int k            =   _k;   // samples/symbol
+    unsigned int m            =   _m;   // filter delay [symbols]
+    float        beta         = _beta;  // excess bandwidth factor
+    int          ftype        = LIQUID_FIRFILT_ARKAISER;
+    float        nstd         = 0.001f;
+    unsigned int gap          =  600;   // number of symbols between frames
+    unsigned int preamble_len[3] = {64, 96, 160};
+
+    // generate frame sequences (QPSK symbols)
+    float complex seq_tx[num_syncs][seq_len];   // transmitted
+    float complex seq_rx[num_syncs][seq_len];   // received with initial correction
+    unsigned int i, j, n;
+    for (n=0; n<num_syncs; n++) {
+        for (i=0; i<seq_len; i++) {
+            seq_tx[n][i] = (rand() % 2 ? 1.0f : -1.0f) * M_SQRT1_2 +
+                           (rand() % 2 ? 1.0f : -1.0f) * M_SQRT1_2 * _Complex_I;
+        }
+    }
+
+    // create sync objects, each using first few symbols of its frame, and
+    // register them with detector bank
+    autotest_qdetectorbank_s obj[num_syncs];
+    qdsync_cccf sync[num_syncs];
+    qdetectorbank_cccf q = qdetectorbank_cccf_create();
+    for (n=0; n<num_syncs; n++) {
+        obj[n] = (autotest_qdetectorbank_s){.id=n, .buf=seq_rx[n], .buf_len=seq_len, .count=0};
+        sync[n] = qdsync_cccf_create_linear(seq_tx[n], preamble_len[n], ftype, k, m, beta,
+                autotest_qdetectorbank_callback, (void*)&obj[n]);
+        qdsync_cccf_set_range(sync[n], 0.001f);
+        LIQUID_CHECK(LIQUID_OK == qdetectorbank_cccf_add(q, sync[n]));
+    }
+    LIQUID_CHECK(qdetectorbank_cccf_get_num_syncs(q) == num_syncs);
+
+    // transform size is shared by all detectors and set by longest preamble
+    unsigned int nfft = qdetectorbank_cccf_get_buf_len(q);
+    LIQUID_CHECK(nfft == 1 << liquid_nextpow2(2*(preamble_len[num_syncs-1] + 2*m)*k));
+
+    // create interpolator
+    firinterp_crcf interp = firinterp_crcf_create_prototype(ftype,k,m,beta,0);
+
+    // transmit each frame followed by gap, checking each is received only by
+    // its own synchronizer
+    float complex buf[k];
+    for (n=0; n<num_syncs; n++) {
+        for (i=0; i<seq_len + gap; i++) {
+            // produce symbol (frame sequence or zero)
+            float complex s = (i < seq_len) ? seq_tx[n][i] : 0;
+
+            // interpolate symbol
+            firinterp_crcf_execute(interp, s, buf);
+
+            // add noise
+            for (j=0; j<k; j++)
+                buf[j] += nstd*(randnf() + _Complex_I*randnf())*M_SQRT1_2;
+
+            // run through detector bank
+            qdetectorbank_cccf_execute(q, buf, k);
+        }
+        for (j=0; j<num_syncs; j++)
+            LIQUID_CHECK(obj[j].count == (j <= n ? seq_len : 0));
+    }
+
+    // compute error in terms of offset from unity; might be residual carrier phase/gain
+    for (n=0; n<num_syncs; n++) {
+        float rmse = 0.0f;
+        for (i=0; i<seq_len; i++) {
+            float e = cabsf(seq_rx[n][i]) - 1.0f;
+            rmse += e*e;
+        }
+        rmse = 10*log10f( rmse / (float)seq_len );
+        liquid_log_debug("qdetectorbank: [%u] rmse:%5.2f", n, rmse);
+        LIQUID_CHECK( rmse < -30.0f );
+    }
+
+    // one transform for every half buffer across the stream
+    unsigned int num_samples = num_syncs*(seq_len + gap)*k;
+    LIQUID_CHECK(qdetectorbank_cccf_get_num_transforms(q) <= num_samples/(nfft/2));
+
+    // clean up objects
+    qdetectorbank_cccf_destroy(q);
+    for (n=0; n<num_syncs; n++)
+        qdsync_cccf_destroy(sync[n]);
+    firinterp_crcf_destroy(interp);
+}
+
+// test specific configurations
+LIQUID_AUTOTEST(qdetectorbank_cccf_k2,"","",0.1) { testbench_qdetectorbank(__q__, 2, 7, 0.3f); }
+LIQUID_AUTOTEST(qdetectorbank_cccf_k4,"","",0.1) { testbench_qdetectorbank(__q__, 4, 7, 0.3f); }
+
+// register synchronizer with larger preamble while another is receiving a
+// frame; the frame in progress must not be interrupted
+LIQUID_AUTOTEST(qdetectorbank_cccf_add_busy,"add to bank during frame","",0.1)
+{
+    unsigned int seq_len = 400;     // total number of symbols in each frame
+    unsigned int k       =   2;     // samples/symbol
+    unsigned int m       =   7;     // filter delay [symbols]
+    float        beta    = 0.3f;    // excess bandwidth factor
+    int          ftype   = LIQUID_FIRFILT_ARKAISER;
+    unsigned int gap     = 600;     // number of symbols between frames
+    unsigned int preamble_len[2] = {64, 160};
+
+    // generate frame sequences (QPSK symbols)
+    float complex seq_tx[2][seq_len];
+    float complex seq_rx[2][seq_len];
+    unsigned int i, j, n;
+    for (n=0; n<2; n++) {
+        for (i=0; i<seq_len; i++) {
+            seq_tx[n][i] = (rand() % 2 ? 1.0f : -1.0f) * M_SQRT1_2 +
+                           (rand() % 2 ? 1.0f : -1.0f) * M_SQRT1_2 * _Complex_I;
+        }
+    }
+
+    // create sync objects, registering only the first one for now
+    autotest_qdetectorbank_s obj[2];
+    qdsync_cccf sync[2];
+    for (n=0; n<2; n++) {
+        obj[n] = (autotest_qdetectorbank_s){.id=n, .buf=seq_rx[n], .buf_len=seq_len, .count=0};
+        sync[n] = qdsync_cccf_create_linear(seq_tx[n], preamble_len[n], ftype, k, m, beta,
+                autotest_qdetectorbank_callback, (void*)&obj[n]);
+        qdsync_cccf_set_range(sync[n], 0.001f);
+    }
+    qdetectorbank_cccf q = qdetectorbank_cccf_create();
+    LIQUID_CHECK(LIQUID_OK == qdetectorbank_cccf_add(q, sync[0]));
+    unsigned int nfft_0 = qdetectorbank_cccf_get_buf_len(q);
+
+    // transmit each frame followed by gap, adding second synchronizer as soon
+    // as the first one starts receiving its frame
+    firinterp_crcf interp = firinterp_crcf_create_prototype(ftype,k,m,beta,0);
+    float complex buf[k];
+    for (n=0; n<2; n++) {
+        for (i=0; i<seq_len + gap; i++) {
+            if (qdetectorbank_cccf_get_num_syncs(q) == 1 && qdsync_cccf_is_open(sync[0])) {
+                LIQUID_CHECK(LIQUID_OK == qdetectorbank_cccf_add(q, sync[1]));
+                LIQUID_CHECK(qdsync_cccf_is_open(sync[0]));
+                LIQUID_CHECK(qdetectorbank_cccf_get_buf_len(q) > nfft_0);
+            }
+            float complex s = (i < seq_len) ? seq_tx[n][i] : 0;
+            firinterp_crcf_execute(interp, s, buf);
+            qdetectorbank_cccf_execute(q, buf, k);
+        }
+        for (j=0; j<2; j++)
+            LIQUID_CHECK(obj[j].count == (j <= n ? seq_len : 0));
+    }
+
+    // first synchronizer picks up shared transform size once frame completes
+    LIQUID_CHECK(qdetector_cccf_get_buf_len(qdsync_cccf_get_detector(sync[0])) ==
+                 qdetectorbank_cccf_get_buf_len(q));
+
+    // clean up objects
+    qdetectorbank_cccf_destroy(q);
+    for (n=0; n<2; n++)
+        qdsync_cccf_destroy(sync[n]);
+    firinterp_crcf_destroy(interp);
+}
+
+LIQUID_AUTOTEST(qdetectorbank_cccf_config,"qdetectorbank config","",0.1)
+{
+    _liquid_error_downgrade_enable();
+    // create empty bank
+    qdetectorbank_cccf q = qdetectorbank_cccf_create();
+    LIQUID_CHECK(LIQUID_OK == qdetectorbank_cccf_print(q))
+    LIQUID_CHECK(0 == qdetectorbank_cccf_get_num_syncs(q))
+    LIQUID_CHECK(0 == qdetectorbank_cccf_get_buf_len(q))
+
+    // executing empty bank is permitted
+    float complex buf[8] = {0};
+    LIQUID_CHECK(LIQUID_OK == qdetectorbank_cccf_execute(q, buf, 8))
+
+    // add invalid synchronizer
+    LIQUID_CHECK(LIQUID_OK != qdetectorbank_cccf_add(q, NULL))
+
+    // add valid synchronizer, but only once
+    float complex seq[] = {+1,-1,+1,-1,-1,+1,-1,+1,-1,+1,-1,+1,+1,+1,-1,+1,-1,-1,-1,-1,};
+    qdsync_cccf sync = qdsync_cccf_create_linear(seq,20,LIQUID_FIRFILT_ARKAISER,4,12,0.25f,NULL,NULL);
+    LIQUID_CHECK(LIQUID_OK == qdetectorbank_cccf_add(q, sync))
+    LIQUID_CHECK(LIQUID_OK != qdetectorbank_cccf_add(q, sync))
+    LIQUID_CHECK(1 == qdetectorbank_cccf_get_num_syncs(q))
+    LIQUID_CHECK(0 <  qdetectorbank_cccf_get_buf_len(q))
+    LIQUID_CHECK(LIQUID_OK == qdetectorbank_cccf_reset(q))
+    LIQUID_CHECK(0 == qdetectorbank_cccf_get_num_transforms(q))
+
+    // destroy objects
+    qdetectorbank_cccf_destroy(q);
+    qdsync_cccf_destroy(sync);
+    _liquid_error_downgrade_disable();
+}
@@ -459,6 +459,29 @@ T SMATRIX(_get)(SMATRIX()    _q,
     return 0;
 }
 
+// get column indices of all non-zero elements in a row
+int SMATRIX(_get_row)(SMATRIX()      _q,
+                      unsigned int   _m,
+                      unsigned int * _cols,
+                      unsigned int * _num)
+{
+    // validate input
+    if (_m >= _q->M)
+        return liquid_error(LIQUID_EIRANGE,"SMATRIX(_get_row)(%u), index exceeds matrix dimension (%u)",_m, _q->M);
+
+    unsigned int j;
+    unsigned int num = 0;
+    for (j=0; j<_q->num_mlist[_m]; j++) {
+        if (_q->mvals[_m][j] == 0)
+            continue;
+        if (_cols != NULL)
+            _cols[num] = _q->mlist[_m][j];
+        num++;
+    }
+    *_num = num;
+    return LIQUID_OK;
+}
+
 // initialize to identity matrix
 int SMATRIX(_eye)(SMATRIX() _q)
 {
@@ -355,3 +355,40 @@ LIQUID_AUTOTEST(smatrixb_vmulf,"","",0.1)
     smatrixb_destroy(A);
 }
 
+
+LIQUID_AUTOTEST(smatrixb_get_row,"test extracting non-zero column indices of a row","",0.1)
+{
+    // create sparse matrix and set values
+    smatrixb A = smatrixb_create(4,8);
+    smatrixb_set(A,0,6, 1);
+    smatrixb_set(A,0,1, 1);
+    smatrixb_set(A,0,3, 1);
+    smatrixb_set(A,2,7, 1);
+    smatrixb_set(A,2,0, 1);
+    smatrixb_set(A,2,0, 0); // clear value; entry remains allocated
+
+    unsigned int cols[8];
+    unsigned int num = 0;
+
+    // row with multiple values, returned in ascending order
+    LIQUID_CHECK( smatrixb_get_row(A,0,cols,&num) == LIQUID_OK );
+    LIQUID_CHECK( num     == 3 );
+    LIQUID_CHECK( cols[0] == 1 );
+    LIQUID_CHECK( cols[1] == 3 );
+    LIQUID_CHECK( cols[2] == 6 );
+
+    // empty row
+    LIQUID_CHECK( smatrixb_get_row(A,1,cols,&num) == LIQUID_OK );
+    LIQUID_CHECK( num == 0 );
+
+    // cleared entries are skipped; count only without output array
+    LIQUID_CHECK( smatrixb_get_row(A,2,NULL,&num) == LIQUID_OK );
+    LIQUID_CHECK( num == 1 );
+
+    // index out of range
+    _liquid_error_downgrade_enable();
+    LIQUID_CHECK( smatrixb_get_row(A,4,cols,&num) != LIQUID_OK );
+    _liquid_error_downgrade_disable();
+
+    smatrixb_destroy(A);
+}
@@ -93,3 +93,144 @@ void benchmark_gmskmodem_demodulate(struct rusage *_start,
     gmskdem_destroy(demod);
 }
 
+
+// 
+void benchmark_gmskmodem_demodulate_block(struct rusage *_start,
+                                          struct rusage *_finish,
+                                          unsigned long int *_num_iterations)
+{
+    // options
+    unsigned int k=2;   // filter samples/symbol
+    unsigned int m=3;   // filter delay (symbols)
+    float BT=0.3f;      // bandwidth-time product
+    unsigned int n=1024;// number of symbols per block
+
+    // create modem object
+    gmskdem demod = gmskdem_create(k, m, BT);
+
+    // normalize number of iterations
+    *_num_iterations /= n/4;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float complex * x = (float complex*) malloc(n*k*sizeof(float complex));
+    unsigned int * symbols_out = (unsigned int*) malloc(n*sizeof(unsigned int));
+
+    unsigned long int i;
+    for (i=0; i<n*k; i++)
+        x[i] = randnf()*cexpf(_Complex_I*2*M_PI*randf());
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        gmskdem_demodulate_block(demod, x, n, symbols_out);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    // destroy modem objects
+    gmskdem_destroy(demod);
+    free(x);
+    free(symbols_out);
+}
+
+// 
+void benchmark_gmskmodem_demodulate_soft_block(struct rusage *_start,
+                                               struct rusage *_finish,
+                                               unsigned long int *_num_iterations)
+{
+    // options
+    unsigned int k=2;   // filter samples/symbol
+    unsigned int m=3;   // filter delay (symbols)
+    float BT=0.3f;      // bandwidth-time product
+    unsigned int n=1024;// number of symbols per block
+
+    // create modem object
+    gmskdem demod = gmskdem_create(k, m, BT);
+
+    // normalize number of iterations
+    *_num_iterations /= n/4;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float complex * x = (float complex*) malloc(n*k*sizeof(float complex));
+    unsigned char * soft_bits = (unsigned char*) malloc(n*sizeof(unsigned char));
+
+    unsigned long int i;
+    for (i=0; i<n*k; i++)
+        x[i] = randnf()*cexpf(_Complex_I*2*M_PI*randf());
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        gmskdem_demodulate_soft_block(demod, x, n, soft_bits);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    // destroy modem objects
+    gmskdem_destroy(demod);
+    free(x);
+    free(soft_bits);
+}
+
+// 
+void benchmark_cpfskdem_gmsk_demodulate(struct rusage *_start,
+                                        struct rusage *_finish,
+                                        unsigned long int *_num_iterations)
+{
+    // create modem object
+    unsigned int k=2;   // filter samples/symbol
+    cpfskdem demod = cpfskdem_create_gmsk(k, 3, 0.3f);
+
+    float complex x[k];
+    unsigned int symbol_out = 0;
+
+    unsigned long int i;
+    for (i=0; i<k; i++)
+        x[i] = randnf()*cexpf(_Complex_I*2*M_PI*randf());
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        symbol_out ^= cpfskdem_demodulate(demod, x);
+        symbol_out ^= cpfskdem_demodulate(demod, x);
+        symbol_out ^= cpfskdem_demodulate(demod, x);
+        symbol_out ^= cpfskdem_demodulate(demod, x);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    // destroy modem objects
+    cpfskdem_destroy(demod);
+}
+
+// 
+void benchmark_cpfskdem_gmsk_demodulate_block(struct rusage *_start,
+                                              struct rusage *_finish,
+                                              unsigned long int *_num_iterations)
+{
+    // create modem object
+    unsigned int k=2;   // filter samples/symbol
+    unsigned int n=1024;// number of symbols per block
+    cpfskdem demod = cpfskdem_create_gmsk(k, 3, 0.3f);
+
+    // normalize number of iterations
+    *_num_iterations /= n/4;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float complex * x = (float complex*) malloc(n*k*sizeof(float complex));
+    unsigned int * symbols_out = (unsigned int*) malloc(n*sizeof(unsigned int));
+
+    unsigned long int i;
+    for (i=0; i<n*k; i++)
+        x[i] = randnf()*cexpf(_Complex_I*2*M_PI*randf());
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        cpfskdem_demodulate_block(demod, x, n, symbols_out);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    // destroy modem objects
+    cpfskdem_destroy(demod);
+    free(x);
+    free(symbols_out);
+}
@@ -30,6 +30,9 @@
 
 #define DEBUG_CPFSKDEM()  0
 
+// number of symbols processed at a time by the block demodulator
+#define CPFSKDEM_BLOCK_LEN  (64)
+
 // initialize coherent demodulator
 int CPFSKDEM(_init_coherent)(CPFSKDEM() _q);
 
@@ -91,6 +94,10 @@ struct CPFSKDEM(_s) {
     unsigned int  index;    // debug
     unsigned int  counter;  // sample counter
     float complex z_prime;  // (coherent only)
+
+    // block processing
+    TC *          buf_z;    // matched filter outputs [size: CPFSKDEM_BLOCK_LEN x 1]
+    float *       buf_phi;  // phase differences      [size: CPFSKDEM_BLOCK_LEN x 1]
 };
 
 // create CPFSKDEM() object (frequency demodulator)
@@ -149,6 +156,10 @@ CPFSKDEM() CPFSKDEM(_create)(unsigned int _bps,
         { liquid_log_warn("cpfskdem_create(), coherent demodulation with h > 2/3 not recommended"); }
     CPFSKDEM(_init_noncoherent)(q);
 
+    // allocate memory for block processing
+    q->buf_z   = (TC*)    malloc(CPFSKDEM_BLOCK_LEN*sizeof(TC));
+    q->buf_phi = (float*) malloc(CPFSKDEM_BLOCK_LEN*sizeof(float));
+
     // reset modem object
     CPFSKDEM(_reset)(q);
 #if DEBUG_CPFSKDEM
@@ -177,6 +188,10 @@ CPFSKDEM() CPFSKDEM(_copy)(CPFSKDEM() q_orig)
         q_copy->demod.noncoherent.mf = firfilt_crcf_copy(q_orig->demod.noncoherent.mf);
     }
 
+    // allocate block processing buffers (contents are not retained between calls)
+    q_copy->buf_z   = (TC*)    malloc(CPFSKDEM_BLOCK_LEN*sizeof(TC));
+    q_copy->buf_phi = (float*) malloc(CPFSKDEM_BLOCK_LEN*sizeof(float));
+
     // return new object
     return q_copy;
 }
@@ -280,7 +295,9 @@ int CPFSKDEM(_destroy)(CPFSKDEM() _q)
         break;
     }
 
-    // free main object memory
+    // free block processing buffers and main object memory
+    free(_q->buf_z);
+    free(_q->buf_phi);
     free(_q);
     return LIQUID_OK;
 }
@@ -516,5 +533,50 @@ unsigned int CPFSKDEM(_demodulate_noncoherent)(CPFSKDEM() _q,
     return sym_out;
 }
 
+// demodulate block of symbols, assuming perfect timing
+//  _q      :   continuous-phase frequency demodulator object
+//  _y      :   input sample array, [size: _k*_n x 1]
+//  _n      :   number of symbols to demodulate
+//  _syms   :   output symbol array, [size: _n x 1]
+int CPFSKDEM(_demodulate_block)(CPFSKDEM()     _q,
+                                TC *           _y,
+                                unsigned int   _n,
+                                unsigned int * _syms)
+{
+    if (_q->demod_type != CPFSKDEM_NONCOHERENT)
+        return liquid_error(LIQUID_EINT,"cpfskdem_demodulate_block(), coherent mode not supported");
+
+    unsigned int k = _q->k;
+    float scale = 1.0f / (_q->h * M_PI);
+    unsigned int i, j;
+    for (i=0; i<_n; i+=CPFSKDEM_BLOCK_LEN) {
+        unsigned int n = (_n - i) < CPFSKDEM_BLOCK_LEN ? _n - i : CPFSKDEM_BLOCK_LEN;
+        TC * y = _y + i*k;
+
+        // run matched filter, computing output only at symbol boundaries
+        for (j=0; j<n; j++) {
+            firfilt_crcf_push   (_q->demod.noncoherent.mf, y[j*k]);
+            firfilt_crcf_execute(_q->demod.noncoherent.mf, &_q->buf_z[j]);
+            firfilt_crcf_write  (_q->demod.noncoherent.mf, y + j*k + 1, k-1);
+        }
+
+        // compute instantaneous frequency for entire block, re-using
+        // output buffer for the conjugate products in reverse order
+        TC z_prime = _q->z_prime;
+        _q->z_prime = _q->buf_z[n-1];
+        for (j=n-1; j>0; j--)
+            _q->buf_z[j] = conjf(_q->buf_z[j-1]) * _q->buf_z[j];
+        _q->buf_z[0] = conjf(z_prime) * _q->buf_z[0];
+        liquid_vectorcf_carg(_q->buf_z, n, _q->buf_phi);
+
+        // estimate transmitted symbols
+        for (j=0; j<n; j++) {
+            float v = (_q->buf_phi[j]*scale + (_q->M-1.0))*0.5f;
+            _syms[i+j] = ((int) roundf(v)) % _q->M;
+        }
+    }
+    return LIQUID_OK;
+}
+
 #endif
 
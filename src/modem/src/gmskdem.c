@@ -35,8 +35,17 @@
 
 #define GMSKDEM_USE_EQUALIZER   0
 
+// number of symbols processed at a time by the block demodulator
+#define GMSKDEM_BLOCK_LEN       (64)
+
 int gmskdem_debug_print(gmskdem _q, const char * _filename);
 
+// run block of up to GMSKDEM_BLOCK_LEN symbols through phase detector and
+// matched filter, storing filter outputs in internal buffer
+int gmskdem_demodulate_mf_block(gmskdem         _q,
+                                float complex * _x,
+                                unsigned int    _n);
+
 struct gmskdem_s {
     unsigned int k;         // samples/symbol
     unsigned int m;         // symbol delay
@@ -54,6 +63,12 @@ struct gmskdem_s {
 
     float complex x_prime;  // received signal state
 
+    // block processing
+    float complex * buf_diff;   // conjugate products [size: GMSKDEM_BLOCK_LEN*k x 1]
+    float *         buf_phi;    // phase differences  [size: GMSKDEM_BLOCK_LEN*k x 1]
+    float *         buf_mf;     // filter outputs     [size: GMSKDEM_BLOCK_LEN x 1]
+    float           soft_scale; // matched filter output to soft bit scaling
+
     // demodulated symbols counter
     unsigned int num_symbols_demod;
 
@@ -106,6 +121,19 @@ gmskdem gmskdem_create(unsigned int _k,
     q->filter = firfilt_rrrf_create(q->h, q->h_len);
 #endif
 
+    // allocate memory for block processing
+    q->buf_diff = (float complex*) malloc(GMSKDEM_BLOCK_LEN*q->k*sizeof(float complex));
+    q->buf_phi  = (float*)         malloc(GMSKDEM_BLOCK_LEN*q->k*sizeof(float));
+    q->buf_mf   = (float*)         malloc(GMSKDEM_BLOCK_LEN     *sizeof(float));
+
+    // nominal filter output for a long run of identical symbols, where the
+    // phase advances by pi/(2k) each sample
+    unsigned int i;
+    float h_sum = 0.0f;
+    for (i=0; i<q->h_len; i++)
+        h_sum += q->h[i];
+    q->soft_scale = 127.0f / (0.5f * M_PI / (float)(q->k) * h_sum);
+
     // reset modem state
     gmskdem_reset(q);
 
@@ -138,6 +166,11 @@ gmskdem gmskdem_copy(gmskdem q_orig)
     q_copy->filter = firfilt_rrrf_copy(q_orig->filter);
 #endif
 
+    // allocate block processing buffers (contents are not retained between calls)
+    q_copy->buf_diff = (float complex*) malloc(GMSKDEM_BLOCK_LEN*q_orig->k*sizeof(float complex));
+    q_copy->buf_phi  = (float*)         malloc(GMSKDEM_BLOCK_LEN*q_orig->k*sizeof(float));
+    q_copy->buf_mf   = (float*)         malloc(GMSKDEM_BLOCK_LEN          *sizeof(float));
+
 #if DEBUG_GMSKDEM
     q_copy->debug_mfout = windowf_copy(q_orig->debug_mfout);
 #endif
@@ -162,8 +195,11 @@ int gmskdem_destroy(gmskdem _q)
     firfilt_rrrf_destroy(_q->filter);
 #endif
 
-    // free filter array
+    // free filter array and block processing buffers
     free(_q->h);
+    free(_q->buf_diff);
+    free(_q->buf_phi);
+    free(_q->buf_mf);
 
     // free main object memory
     free(_q);
@@ -277,6 +313,92 @@ int gmskdem_demodulate(gmskdem         _q,
     return LIQUID_OK;
 }
 
+// demodulate block of symbols, assuming perfect symbol timing
+int gmskdem_demodulate_block(gmskdem         _q,
+                             float complex * _x,
+                             unsigned int    _n,
+                             unsigned int *  _syms)
+{
+    unsigned int i, j;
+    for (i=0; i<_n; i+=GMSKDEM_BLOCK_LEN) {
+        unsigned int n = (_n - i) < GMSKDEM_BLOCK_LEN ? _n - i : GMSKDEM_BLOCK_LEN;
+        gmskdem_demodulate_mf_block(_q, _x + i*_q->k, n);
+
+        // make decisions
+        for (j=0; j<n; j++)
+            _syms[i+j] = _q->buf_mf[j] > 0.0f ? 1 : 0;
+    }
+    return LIQUID_OK;
+}
+
+// demodulate block of symbols to soft bits, assuming perfect symbol timing
+int gmskdem_demodulate_soft_block(gmskdem         _q,
+                                  float complex * _x,
+                                  unsigned int    _n,
+                                  unsigned char * _soft_bits)
+{
+    unsigned int i, j;
+    for (i=0; i<_n; i+=GMSKDEM_BLOCK_LEN) {
+        unsigned int n = (_n - i) < GMSKDEM_BLOCK_LEN ? _n - i : GMSKDEM_BLOCK_LEN;
+        gmskdem_demodulate_mf_block(_q, _x + i*_q->k, n);
+
+        // scale filter output to soft bit, clipping to valid range and
+        // keeping sign consistent with hard decision
+        for (j=0; j<n; j++) {
+            float d_hat = _q->buf_mf[j];
+            int   v     = (int)(d_hat * _q->soft_scale);
+            if (d_hat > 0.0f) _soft_bits[i+j] = 128 + (v > 127 ? 127 : v);
+            else              _soft_bits[i+j] = 127 + (v < -127 ? -127 : v);
+        }
+    }
+    return LIQUID_OK;
+}
+
+// run block of up to GMSKDEM_BLOCK_LEN symbols through phase detector and
+// matched filter, storing filter outputs in internal buffer
+int gmskdem_demodulate_mf_block(gmskdem         _q,
+                                float complex * _x,
+                                unsigned int    _n)
+{
+    unsigned int k = _q->k;
+    unsigned int num_samples = _n * k;
+    if (num_samples == 0)
+        return LIQUID_OK;
+
+    // compute phase differences for entire block at once
+    unsigned int i;
+    _q->buf_diff[0] = conjf(_q->x_prime) * _x[0];
+    for (i=1; i<num_samples; i++)
+        _q->buf_diff[i] = conjf(_x[i-1]) * _x[i];
+    _q->x_prime = _x[num_samples-1];
+    liquid_vectorcf_carg(_q->buf_diff, num_samples, _q->buf_phi);
+
+    // run matched filter, computing output only at symbol boundaries
+    for (i=0; i<_n; i++) {
+        float * phi = _q->buf_phi + i*k;
+        _q->num_symbols_demod++;
+#if GMSKDEM_USE_EQUALIZER
+        unsigned int j;
+        eqlms_rrrf_push(_q->eq, phi[0]);
+        eqlms_rrrf_execute(_q->eq, &_q->buf_mf[i]);
+        for (j=1; j<k; j++)
+            eqlms_rrrf_push(_q->eq, phi[j]);
+
+        // update equalizer, after appropriate delay
+        if (_q->num_symbols_demod >= 2*_q->m) {
+            float d_hat   = _q->buf_mf[i];
+            float d_prime = d_hat > 0 ? _q->k_inv : -_q->k_inv;
+            eqlms_rrrf_step(_q->eq, d_prime, d_hat);
+        }
+#else
+        firfilt_rrrf_push   (_q->filter, phi[0]);
+        firfilt_rrrf_execute(_q->filter, &_q->buf_mf[i]);
+        firfilt_rrrf_write  (_q->filter, phi+1, k-1);
+#endif
+    }
+    return LIQUID_OK;
+}
+
 //
 // output debugging file
 //
@@ -64,6 +64,14 @@ int modem_demodulate_soft(modem _q, float complex _x,
         unsigned int * _s, unsigned char * _soft_bits)
     { return modemcf_demodulate_soft(_q, _x, _s, _soft_bits); }
 
+int modem_demodulate_soft_block(modem _q, float complex * _x, unsigned int _n,
+        unsigned int * _syms, unsigned char * _soft_bits)
+    { return modemcf_demodulate_soft_block(_q, _x, _n, _syms, _soft_bits); }
+
+int modem_demodulate_llr_block(modem _q, float complex * _x, unsigned int _n,
+        float * _nvar, unsigned int * _syms, float * _llr)
+    { return modemcf_demodulate_llr_block(_q, _x, _n, _nvar, _syms, _llr); }
+
 int modem_get_demodulator_sample(modem _q, float complex * _x_hat)
     { return modemcf_get_demodulator_sample(_q, _x_hat); }
 
@@ -177,7 +177,7 @@ int MODEM(_demodulate_apsk)(MODEM()        _q,
     *_sym_out = s_prime;
 
     // re-modulate symbol and store state
-    MODEM(_modulate)(_q, s_prime, &_q->x_hat);
+    _q->modulate_func(_q, s_prime, &_q->x_hat);
     _q->r = _x;
     return LIQUID_OK;
 }
@@ -62,6 +62,7 @@ struct MODEM(_s)
     // demodulation
     TC r;                // received state vector
     TC x_hat;            // estimated symbol (demodulator)
+    T evm_block;         // rms error over last block (negative if unset)
 
     // common data structure shared between specific modem types
     union {
@@ -133,6 +134,8 @@ struct MODEM(_s)
     // neighbors array
     unsigned char * demod_soft_neighbors;   // array of nearest neighbors
     unsigned int demod_soft_p;              // number of neighbors in array
+
+    LIQUID_COUNTER_FIELD    // performance counters (when enabled)
 };
 
 // create digital modem of a specific scheme and bits/symbol
@@ -275,6 +278,8 @@ MODEM() MODEM(_copy)(MODEM() q_orig)
 // destroy a modem object
 int MODEM(_destroy)(MODEM() _q)
 {
+    LIQUID_COUNTER_UNREGISTER(_q);
+
     // free symbol map
     if (_q->symbol_map != NULL)
         free(_q->symbol_map);
@@ -310,6 +315,7 @@ int MODEM(_reset)(MODEM() _q)
 {
     _q->r = 1.0f;         // received sample
     _q->x_hat = _q->r;  // estimated symbol
+    _q->evm_block = -1.0f;
 
     if ( liquid_modem_is_dpsk(_q->scheme) ) {
         _q->data.dpsk.phi = 0.0f;  // reset differential PSK phase state
@@ -343,6 +349,11 @@ int MODEM(_init)(MODEM()      _q,
     // soft demodulation
     _q->demod_soft_neighbors = NULL;
     _q->demod_soft_p = 0;
+    _q->evm_block = -1.0f;
+
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(_q, "modem" EXTENSION);
+    LIQUID_COUNTER_ALLOC(_q, sizeof(struct MODEM(_s)));
     return LIQUID_OK;
 }
 
@@ -393,6 +404,7 @@ int MODEM(_modulate)(MODEM()      _q,
     if (_symbol_in >= _q->M)
         return liquid_error(LIQUID_EICONFIG,"modem%s_modulate(), input symbol exceeds constellation size", EXTENSION);
 
+    LIQUID_COUNTER_START(_q);
     if (_q->modulate_using_map) {
         // modulate simply using map (look-up table)
         MODEM(_modulate_map)(_q, _symbol_in, _y);
@@ -400,6 +412,7 @@ int MODEM(_modulate)(MODEM()      _q,
         // invoke method specific to scheme (calculate symbol on the fly)
         _q->modulate_func(_q, _symbol_in, _y);
     }
+    LIQUID_COUNTER_STOP(_q, 1);
     return LIQUID_OK;
 }
 
@@ -423,8 +436,13 @@ int MODEM(_demodulate)(MODEM() _q,
                        TC x,
                        unsigned int *symbol_out)
 {
+    LIQUID_COUNTER_START(_q);
+
     // invoke method specific to scheme (calculate symbol on the fly)
-    return _q->demodulate_func(_q, x, symbol_out);
+    _q->evm_block = -1.0f;
+    int rc = _q->demodulate_func(_q, x, symbol_out);
+    LIQUID_COUNTER_STOP(_q, 1);
+    return rc;
 }
 
 // generic soft demodulation
@@ -433,30 +451,34 @@ int MODEM(_demodulate_soft)(MODEM() _q,
                             unsigned int  * _s,
                             unsigned char * _soft_bits)
 {
+    LIQUID_COUNTER_START(_q);
+    _q->evm_block = -1.0f;
+    int rc;
+
     // switch scheme
     switch (_q->scheme) {
-    case LIQUID_MODEM_ARB:  return MODEM(_demodulate_soft_arb)( _q,_x,_s,_soft_bits);
-    case LIQUID_MODEM_BPSK: return MODEM(_demodulate_soft_bpsk)(_q,_x,_s,_soft_bits);
-    case LIQUID_MODEM_QPSK: return MODEM(_demodulate_soft_qpsk)(_q,_x,_s,_soft_bits);
-    case LIQUID_MODEM_PI4DQPSK: return MODEM(_demodulate_soft_pi4dqpsk)(_q,_x,_s,_soft_bits);
-    default:;
-    }
-
-    // check if...
-    if (_q->demod_soft_neighbors != NULL && _q->demod_soft_p != 0) {
-        // demodulate using approximate log-likelihood method with
-        // look-up table for nearest neighbors
-        return MODEM(_demodulate_soft_table)(_q, _x, _s, _soft_bits);
+    case LIQUID_MODEM_ARB:  rc = MODEM(_demodulate_soft_arb)( _q,_x,_s,_soft_bits); break;
+    case LIQUID_MODEM_BPSK: rc = MODEM(_demodulate_soft_bpsk)(_q,_x,_s,_soft_bits); break;
+    case LIQUID_MODEM_QPSK: rc = MODEM(_demodulate_soft_qpsk)(_q,_x,_s,_soft_bits); break;
+    case LIQUID_MODEM_PI4DQPSK: rc = MODEM(_demodulate_soft_pi4dqpsk)(_q,_x,_s,_soft_bits); break;
+    default:
+        if (_q->demod_soft_neighbors != NULL && _q->demod_soft_p != 0) {
+            // demodulate using approximate log-likelihood method with
+            // look-up table for nearest neighbors
+            rc = MODEM(_demodulate_soft_table)(_q, _x, _s, _soft_bits);
+        } else {
+            // for now demodulate normally and simply copy the
+            // hard-demodulated bits
+            unsigned int symbol_out;
+            _q->demodulate_func(_q, _x, &symbol_out);
+            *_s = symbol_out;
+
+            // unpack soft bits
+            rc = liquid_unpack_soft_bits(symbol_out, _q->m, _soft_bits);
+        }
     }
-
-    // for now demodulate normally and simply copy the
-    // hard-demodulated bits
-    unsigned int symbol_out;
-    _q->demodulate_func(_q, _x, &symbol_out);
-    *_s = symbol_out;
-
-    // unpack soft bits
-    return liquid_unpack_soft_bits(symbol_out, _q->m, _soft_bits);
+    LIQUID_COUNTER_STOP(_q, 1);
+    return rc;
 }
 
 #if DEBUG_DEMODULATE_SOFT
@@ -483,7 +505,7 @@ int MODEM(_demodulate_soft_table)(MODEM() _q,
     // run hard demodulation; this will store re-modulated sample
     // as internal variable x_hat
     unsigned int s;
-    MODEM(_demodulate)(_q, _r, &s);
+    _q->demodulate_func(_q, _r, &s);
 
     unsigned int bps = MODEM(_get_bps)(_q);
 
@@ -520,7 +542,7 @@ int MODEM(_demodulate_soft_table)(MODEM() _q,
         if (_q->modulate_using_map)
             x_hat = _q->symbol_map[ softab[s*p + i] ];
         else
-            MODEM(_modulate)(_q, softab[s*p+i], &x_hat);
+            _q->modulate_func(_q, softab[s*p+i], &x_hat);
 
         // compute magnitude squared of Euclidean distance
         //d = crealf( (_r-x_hat)*conjf(_r-x_hat) );
@@ -572,6 +594,9 @@ T MODEM(_get_demodulator_phase_error)(MODEM() _q)
 // get error vector magnitude
 T MODEM(_get_demodulator_evm)(MODEM() _q)
 {
+    // rms error over block following block demodulation
+    if (_q->evm_block >= 0.0f)
+        return _q->evm_block;
     return cabsf(_q->x_hat - _q->r);
 }
 
@@ -667,7 +692,7 @@ int MODEM(_demodsoft_gentab)(MODEM()      _q,
     unsigned int M = _q->M;  // constellation size
     TC c[M];         // constellation
     for (i=0; i<M; i++)
-        MODEM(_modulate)(_q, i, &c[i]);
+        _q->modulate_func(_q, i, &c[i]);
 
     // 
     // find nearest symbols (see algorithm in sandbox/modem_demodulate_soft_gentab.c)
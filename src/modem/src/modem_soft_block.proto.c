@@ -0,0 +1,436 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// modem_soft_block.proto.c : block soft-decision demodulation
+//
+// Symbols are demodulated in batches of LIQUID_MODEM_SOFT_BLOCK, stored
+// as separate in-phase/quadrature arrays so that the distance and
+// minimum computations run across the batch and vectorize.  Each bit
+// metric is the exact max-log value, min|x-c|^2 over constellation points
+// with the bit cleared minus the same over points with the bit set.
+// Rectangular QAM and ASK decompose into independent per-axis searches;
+// all other static constellations compute the distance to every point
+// and reduce these to bit metrics with a tree over the symbol labels.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+// scaling of squared-distance metric to soft-bit units, consistent with
+// the approximate gamma used in the symbol-by-symbol soft demodulators
+T MODEM(_demodsoft_block_scale)(MODEM() _q)
+{
+    switch (_q->scheme) {
+    case LIQUID_MODEM_BPSK: return 2.0f;
+    case LIQUID_MODEM_QPSK: return 5.8f * M_SQRT1_2;
+    default:;
+    }
+    return 1.2f * _q->M;
+}
+
+// differential schemes carry phase state from one symbol to the next and
+// must be demodulated sequentially
+int MODEM(_demodsoft_block_is_differential)(MODEM() _q)
+{
+    return liquid_modem_is_dpsk(_q->scheme) || _q->scheme == LIQUID_MODEM_PI4DQPSK;
+}
+
+// schemes searched over the full constellation need every point; those
+// computed on the fly (e.g. BPSK, SQAM32, V29) have no symbol map until the
+// first block is demodulated, after which it is kept with the object
+int MODEM(_demodsoft_block_init_map)(MODEM() _q)
+{
+    if (liquid_modem_is_qam(_q->scheme) || liquid_modem_is_ask(_q->scheme) ||
+        _q->symbol_map != NULL)
+    {
+        return LIQUID_OK;
+    }
+
+    _q->symbol_map = (TC*) malloc(_q->M*sizeof(TC));
+    if (_q->symbol_map == NULL)
+        return liquid_error(LIQUID_EIMEM,"modem%s_demodulate_soft_block(), could not allocate symbol map",EXTENSION);
+    return MODEM(_init_map)(_q);
+}
+
+// reduce squared distances to max-log bit metrics
+//
+// Label bits are resolved from least to most significant: at each level
+// the even and odd entries are the points with the bit cleared and set,
+// respectively, and adjacent pairs are then merged for the next bit.
+// This requires about 3*2^_m minimum operations rather than _m*2^_m.
+//  _dist   :   squared distances indexed by label, destroyed on return,
+//              [size: 2^_m x LIQUID_MODEM_SOFT_BLOCK]
+//  _m      :   bits per label
+//  _d      :   output bit metrics, [size: _m x LIQUID_MODEM_SOFT_BLOCK]
+int MODEM(_demodsoft_block_reduce)(T *          _dist,
+                                   unsigned int _m,
+                                   T *          _d)
+{
+    T dmin_0[LIQUID_MODEM_SOFT_BLOCK];
+    T dmin_1[LIQUID_MODEM_SOFT_BLOCK];
+    unsigned int i, t, l;
+    for (l=0; l<_m; l++) {
+        unsigned int n = 1 << (_m - l);   // entries remaining at this level
+        T * e = _dist;
+        for (i=0; i<LIQUID_MODEM_SOFT_BLOCK; i++) {
+            dmin_0[i] = e[i];
+            dmin_1[i] = e[LIQUID_MODEM_SOFT_BLOCK + i];
+            e[i] = dmin_0[i] < dmin_1[i] ? dmin_0[i] : dmin_1[i];
+        }
+        for (t=1; t<n/2; t++) {
+            T * e0 = _dist + (2*t  )*LIQUID_MODEM_SOFT_BLOCK;
+            T * e1 = _dist + (2*t+1)*LIQUID_MODEM_SOFT_BLOCK;
+            T * y  = _dist + t*LIQUID_MODEM_SOFT_BLOCK;
+            for (i=0; i<LIQUID_MODEM_SOFT_BLOCK; i++) {
+                T v0 = e0[i];
+                T v1 = e1[i];
+                dmin_0[i] = v0 < dmin_0[i] ? v0 : dmin_0[i];
+                dmin_1[i] = v1 < dmin_1[i] ? v1 : dmin_1[i];
+                y[i] = v0 < v1 ? v0 : v1;
+            }
+        }
+
+        // level l resolves label bit index _m-l-1 (MSB first ordering)
+        T * d = _d + (_m - l - 1)*LIQUID_MODEM_SOFT_BLOCK;
+        for (i=0; i<LIQUID_MODEM_SOFT_BLOCK; i++)
+            d[i] = dmin_0[i] - dmin_1[i];
+    }
+    return LIQUID_OK;
+}
+
+// demodulate pulse-amplitude levels (2g-L+1)*alpha, g in [0,L), with
+// gray-coded labels along a single axis
+//  _v      :   input values, [size: _n x 1]
+//  _n      :   number of values, _n <= LIQUID_MODEM_SOFT_BLOCK
+//  _m      :   bits along this axis, L=2^_m
+//  _alpha  :   level scaling factor
+//  _d      :   output bit metrics, [size: _m x LIQUID_MODEM_SOFT_BLOCK]
+//  _s      :   output hard-decision labels, [size: _n x 1]
+//  _e      :   output squared error of hard decision, [size: _n x 1]
+int MODEM(_demodsoft_block_pam)(T *            _v,
+                                unsigned int   _n,
+                                unsigned int   _m,
+                                T              _alpha,
+                                T *            _d,
+                                unsigned int * _s,
+                                T *            _e)
+{
+    unsigned int L = 1 << _m;
+    T            dist[L*LIQUID_MODEM_SOFT_BLOCK];
+    T            emin[LIQUID_MODEM_SOFT_BLOCK];
+    unsigned int smin[LIQUID_MODEM_SOFT_BLOCK];
+    T            v   [LIQUID_MODEM_SOFT_BLOCK];
+
+    // operate on full (padded) batch so loops have a fixed trip count
+    unsigned int i, g;
+    for (i=0; i<LIQUID_MODEM_SOFT_BLOCK; i++) {
+        v[i]    = i < _n ? _v[i] : 0.0f;
+        emin[i] = 1e9f;
+        smin[i] = 0;
+    }
+
+    for (g=0; g<L; g++) {
+        T a = (2*(int)g - (int)L + 1) * _alpha;
+        unsigned int label = gray_encode(g);
+
+        // distance to this level, stored by label, and running hard decision
+        T * e = dist + label*LIQUID_MODEM_SOFT_BLOCK;
+        for (i=0; i<LIQUID_MODEM_SOFT_BLOCK; i++) {
+            e[i] = (v[i] - a) * (v[i] - a);
+            int c = e[i] < emin[i];
+            emin[i] = c ? e[i]  : emin[i];
+            smin[i] = c ? label : smin[i];
+        }
+    }
+
+    MODEM(_demodsoft_block_reduce)(dist, _m, _d);
+    memmove(_s, smin, _n*sizeof(unsigned int));
+    memmove(_e, emin, _n*sizeof(T));
+    return LIQUID_OK;
+}
+
+// demodulate against an explicit constellation by exhaustive search
+//  _c      :   constellation points, [size: 2^_m x 1]
+//  _m      :   bits per symbol
+//  _xr     :   input samples (in-phase), [size: _n x 1]
+//  _xi     :   input samples (quadrature), [size: _n x 1]
+//  _n      :   number of samples, _n <= LIQUID_MODEM_SOFT_BLOCK
+//  _d      :   output bit metrics, [size: _m x LIQUID_MODEM_SOFT_BLOCK]
+//  _s      :   output hard-decision symbols, [size: _n x 1]
+//  _e      :   output squared error of hard decision, [size: _n x 1]
+int MODEM(_demodsoft_block_map)(TC *           _c,
+                                unsigned int   _m,
+                                T *            _xr,
+                                T *            _xi,
+                                unsigned int   _n,
+                                T *            _d,
+                                unsigned int * _s,
+                                T *            _e)
+{
+    unsigned int M = 1 << _m;
+    T            dist[M*LIQUID_MODEM_SOFT_BLOCK];
+    T            emin[LIQUID_MODEM_SOFT_BLOCK];
+    unsigned int smin[LIQUID_MODEM_SOFT_BLOCK];
+    T            xr  [LIQUID_MODEM_SOFT_BLOCK];
+    T            xi  [LIQUID_MODEM_SOFT_BLOCK];
+
+    // operate on full (padded) batch so loops have a fixed trip count
+    unsigned int i, j;
+    for (i=0; i<LIQUID_MODEM_SOFT_BLOCK; i++) {
+        xr[i]   = i < _n ? _xr[i] : 0.0f;
+        xi[i]   = i < _n ? _xi[i] : 0.0f;
+        emin[i] = 1e9f;
+        smin[i] = 0;
+    }
+
+    for (j=0; j<M; j++) {
+        T cr = crealf(_c[j]);
+        T ci = cimagf(_c[j]);
+
+        // distance to this point and running hard decision
+        T * e = dist + j*LIQUID_MODEM_SOFT_BLOCK;
+        for (i=0; i<LIQUID_MODEM_SOFT_BLOCK; i++) {
+            T dr = xr[i] - cr;
+            T di = xi[i] - ci;
+            e[i] = dr*dr + di*di;
+            int c = e[i] < emin[i];
+            emin[i] = c ? e[i] : emin[i];
+            smin[i] = c ? j    : smin[i];
+        }
+    }
+
+    MODEM(_demodsoft_block_reduce)(dist, _m, _d);
+    memmove(_s, smin, _n*sizeof(unsigned int));
+    memmove(_e, emin, _n*sizeof(T));
+    return LIQUID_OK;
+}
+
+// compute max-log bit metrics for a batch of samples
+//  _q      :   modem object (must not be differential)
+//  _x      :   input samples, [size: _n x 1]
+//  _n      :   number of samples, _n <= LIQUID_MODEM_SOFT_BLOCK
+//  _d      :   output bit metrics, [size: m x LIQUID_MODEM_SOFT_BLOCK]
+//  _s      :   output hard-decision symbols, [size: _n x 1]
+//  _e      :   output squared error of hard decision, [size: _n x 1]
+int MODEM(_demodsoft_block_metric)(MODEM()        _q,
+                                   TC *           _x,
+                                   unsigned int   _n,
+                                   T *            _d,
+                                   unsigned int * _s,
+                                   T *            _e)
+{
+    // split input into in-phase and quadrature arrays
+    T xr[LIQUID_MODEM_SOFT_BLOCK];
+    T xi[LIQUID_MODEM_SOFT_BLOCK];
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        xr[i] = crealf(_x[i]);
+        xi[i] = cimagf(_x[i]);
+    }
+
+    if (liquid_modem_is_qam(_q->scheme)) {
+        // independent searches along in-phase and quadrature axes
+        unsigned int m_i = _q->data.qam.m_i;
+        unsigned int m_q = _q->data.qam.m_q;
+        unsigned int s_q[LIQUID_MODEM_SOFT_BLOCK];
+        T            e_q[LIQUID_MODEM_SOFT_BLOCK];
+        MODEM(_demodsoft_block_pam)(xr, _n, m_i, _q->data.qam.alpha, _d, _s, _e);
+        MODEM(_demodsoft_block_pam)(xi, _n, m_q, _q->data.qam.alpha,
+                                    _d + m_i*LIQUID_MODEM_SOFT_BLOCK, s_q, e_q);
+        for (i=0; i<_n; i++) {
+            _s[i] = (_s[i] << m_q) | s_q[i];
+            _e[i] += e_q[i];
+        }
+    } else if (liquid_modem_is_ask(_q->scheme)) {
+        // in-phase axis only; quadrature component is common to all points
+        MODEM(_demodsoft_block_pam)(xr, _n, _q->m, _q->data.ask.alpha, _d, _s, _e);
+        for (i=0; i<_n; i++)
+            _e[i] += xi[i]*xi[i];
+    } else {
+        // full search over symbol map (see _demodsoft_block_init_map)
+        MODEM(_demodsoft_block_map)(_q->symbol_map, _q->m, xr, xi, _n, _d, _s, _e);
+    }
+    return LIQUID_OK;
+}
+
+// demodulate differential schemes symbol by symbol, retaining state
+//  _q          :   modem object
+//  _x          :   input samples, [size: _n x 1]
+//  _n          :   number of input samples
+//  _syms       :   output hard-decision symbols (ignored if NULL)
+//  _soft_bits  :   output soft bits, [size: _n*m x 1]
+int MODEM(_demodsoft_block_sequential)(MODEM()         _q,
+                                       TC *            _x,
+                                       unsigned int    _n,
+                                       unsigned int *  _syms,
+                                       unsigned char * _soft_bits)
+{
+    unsigned int i;
+    unsigned int s;
+    T esum = 0.0f;
+    for (i=0; i<_n; i++) {
+        MODEM(_demodulate_soft)(_q, _x[i], &s, _soft_bits + i*_q->m);
+        if (_syms != NULL)
+            _syms[i] = s;
+        TC e = _q->x_hat - _q->r;
+        esum += crealf(e)*crealf(e) + cimagf(e)*cimagf(e);
+    }
+    _q->evm_block = sqrtf(esum / (T)_n);
+    return LIQUID_OK;
+}
+
+// demodulate a block of samples with 8-bit soft-bit output
+int MODEM(_demodulate_soft_block)(MODEM()         _q,
+                                  TC *            _x,
+                                  unsigned int    _n,
+                                  unsigned int *  _syms,
+                                  unsigned char * _soft_bits)
+{
+    if (_n == 0)
+        return LIQUID_OK;
+    if (MODEM(_demodsoft_block_is_differential)(_q))
+        return MODEM(_demodsoft_block_sequential)(_q, _x, _n, _syms, _soft_bits);
+
+    int rc = MODEM(_demodsoft_block_init_map)(_q);
+    if (rc != LIQUID_OK)
+        return rc;
+
+    LIQUID_COUNTER_START(_q);
+    unsigned int m = _q->m;
+    T scale = 16.0f * MODEM(_demodsoft_block_scale)(_q);
+    T d[MAX_MOD_BITS_PER_SYMBOL*LIQUID_MODEM_SOFT_BLOCK];
+    unsigned int s[LIQUID_MODEM_SOFT_BLOCK];
+    T e[LIQUID_MODEM_SOFT_BLOCK];
+    T esum = 0.0f;
+
+    unsigned int i, j, k;
+    for (i=0; i<_n; i+=LIQUID_MODEM_SOFT_BLOCK) {
+        unsigned int nb = _n - i < LIQUID_MODEM_SOFT_BLOCK ? _n - i : LIQUID_MODEM_SOFT_BLOCK;
+        MODEM(_demodsoft_block_metric)(_q, _x + i, nb, d, s, e);
+
+        // quantize metrics to soft bits
+        unsigned char * soft_bits = _soft_bits + i*m;
+        for (j=0; j<nb; j++) {
+            for (k=0; k<m; k++) {
+                int soft_bit = d[k*LIQUID_MODEM_SOFT_BLOCK + j]*scale + 127;
+                if (soft_bit > 255) soft_bit = 255;
+                if (soft_bit <   0) soft_bit = 0;
+                soft_bits[j*m + k] = (unsigned char)soft_bit;
+            }
+            esum += e[j];
+        }
+
+        if (_syms != NULL)
+            memmove(_syms + i, s, nb*sizeof(unsigned int));
+    }
+
+    // retain state of final sample and error over block
+    _q->r = _x[_n-1];
+    _q->modulate_func(_q, s[(_n-1) % LIQUID_MODEM_SOFT_BLOCK], &_q->x_hat);
+    _q->evm_block = sqrtf(esum / (T)_n);
+    LIQUID_COUNTER_STOP(_q, _n);
+    return LIQUID_OK;
+}
+
+// demodulate a block of samples with 8-bit soft-bit output, choosing the
+// faster method for the scheme: the exhaustive search of the batched path
+// grows with the number of points while the nearest-neighbour table of the
+// symbol-by-symbol demodulator does not, so the latter is kept for PSK
+// and APSK with 64 or more points (QAM and ASK search each axis, and
+// arbitrary constellations have no table, so these always use batches)
+int MODEM(_demodsoft_block_dispatch)(MODEM()         _q,
+                                     TC *            _x,
+                                     unsigned int    _n,
+                                     unsigned int *  _syms,
+                                     unsigned char * _soft_bits)
+{
+    if (_q->M >= 64 && (liquid_modem_is_psk(_q->scheme) || liquid_modem_is_apsk(_q->scheme)))
+        return MODEM(_demodsoft_block_sequential)(_q, _x, _n, _syms, _soft_bits);
+    return MODEM(_demodulate_soft_block)(_q, _x, _n, _syms, _soft_bits);
+}
+
+// demodulate a block of samples with floating-point LLR output
+int MODEM(_demodulate_llr_block)(MODEM()        _q,
+                                 TC *           _x,
+                                 unsigned int   _n,
+                                 float *        _nvar,
+                                 unsigned int * _syms,
+                                 float *        _llr)
+{
+    if (_n == 0)
+        return LIQUID_OK;
+
+    unsigned int m = _q->m;
+    unsigned int i, j, k;
+    if (MODEM(_demodsoft_block_is_differential)(_q)) {
+        // convert soft bits back to approximate metric
+        unsigned char soft_bits[_n*m];
+        MODEM(_demodsoft_block_sequential)(_q, _x, _n, _syms, soft_bits);
+        T g = 1.0f / (16.0f * MODEM(_demodsoft_block_scale)(_q));
+        for (i=0; i<_n; i++) {
+            T v = _nvar == NULL ? 1.0f : 1.0f / _nvar[i];
+            for (k=0; k<m; k++)
+                _llr[i*m + k] = ((T)soft_bits[i*m + k] - 127.0f) * g * v;
+        }
+        return LIQUID_OK;
+    }
+
+    int rc = MODEM(_demodsoft_block_init_map)(_q);
+    if (rc != LIQUID_OK)
+        return rc;
+
+    LIQUID_COUNTER_START(_q);
+    T d[MAX_MOD_BITS_PER_SYMBOL*LIQUID_MODEM_SOFT_BLOCK];
+    unsigned int s[LIQUID_MODEM_SOFT_BLOCK];
+    T e[LIQUID_MODEM_SOFT_BLOCK];
+    T esum = 0.0f;
+
+    for (i=0; i<_n; i+=LIQUID_MODEM_SOFT_BLOCK) {
+        unsigned int nb = _n - i < LIQUID_MODEM_SOFT_BLOCK ? _n - i : LIQUID_MODEM_SOFT_BLOCK;
+        MODEM(_demodsoft_block_metric)(_q, _x + i, nb, d, s, e);
+
+        // scale metrics by inverse noise variance
+        float * llr = _llr + i*m;
+        for (j=0; j<nb; j++) {
+            T v = _nvar == NULL ? 1.0f : 1.0f / _nvar[i+j];
+            for (k=0; k<m; k++)
+                llr[j*m + k] = d[k*LIQUID_MODEM_SOFT_BLOCK + j] * v;
+            esum += e[j];
+        }
+
+        if (_syms != NULL)
+            memmove(_syms + i, s, nb*sizeof(unsigned int));
+    }
+
+    // retain state of final sample and error over block
+    _q->r = _x[_n-1];
+    _q->modulate_func(_q, s[(_n-1) % LIQUID_MODEM_SOFT_BLOCK], &_q->x_hat);
+    _q->evm_block = sqrtf(esum / (T)_n);
+    LIQUID_COUNTER_STOP(_q, _n);
+    return LIQUID_OK;
+}
+
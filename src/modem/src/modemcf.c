@@ -63,6 +63,9 @@
 // arbitrary modems
 #include "modem_arb.proto.c"
 
+// block soft-decision demodulation
+#include "modem_soft_block.proto.c"
+
 // non-linear modems
 #include "cpfskdem.proto.c"
 #include "cpfskmod.proto.c"
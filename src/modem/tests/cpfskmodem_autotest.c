@@ -130,6 +130,61 @@ LIQUID_AUTOTEST(cpfskmodem_bps1_h0p5_k4_m7_gmsk,"","",0.1) { testbench_cpfskmode
 LIQUID_AUTOTEST(cpfskmodem_bps1_h0p5_k6_m7_gmsk,"","",0.1) { testbench_cpfskmodem(__q__, 1, 0.5f, 6, 7, 0.30f, LIQUID_CPFSK_GMSK ); }
 LIQUID_AUTOTEST(cpfskmodem_bps1_h0p5_k8_m7_gmsk,"","",0.1) { testbench_cpfskmodem(__q__, 1, 0.5f, 8, 7, 0.30f, LIQUID_CPFSK_GMSK ); }
 
+// test block demodulation against symbol-by-symbol demodulation
+void testbench_cpfskmodem_block(liquid_autotest __q__,
+                                unsigned int    _bps,
+                                float           _h,
+                                unsigned int    _k,
+                                int             _filter_type)
+{
+    // create modulator and pair of demodulators
+    cpfskmod mod  = cpfskmod_create(_bps, _h, _k, 3, 0.25f, _filter_type);
+    cpfskdem dem0 = cpfskdem_create(_bps, _h, _k, 3, 0.25f, _filter_type);
+    cpfskdem dem1 = cpfskdem_create(_bps, _h, _k, 3, 0.25f, _filter_type);
+
+    unsigned int  delay       = cpfskmod_get_delay(mod) + cpfskdem_get_delay(dem0);
+    unsigned int  num_symbols = 400 + delay;
+    float complex buf[num_symbols*_k];
+    unsigned int  sym_in  [num_symbols];
+    unsigned int  sym_out0[num_symbols];
+    unsigned int  sym_out1[num_symbols];
+
+    // modulate and demodulate one symbol at a time
+    msequence ms = msequence_create_default(7);
+    unsigned int i;
+    for (i=0; i<num_symbols; i++) {
+        sym_in[i] = msequence_generate_symbol(ms, _bps);
+        cpfskmod_modulate(mod, sym_in[i], buf + i*_k);
+        sym_out0[i] = cpfskdem_demodulate(dem0, buf + i*_k);
+    }
+    msequence_destroy(ms);
+
+    // demodulate in irregularly-sized blocks
+    unsigned int n = 0, block_len = 1;
+    while (n < num_symbols) {
+        unsigned int num = (num_symbols - n) < block_len ? num_symbols - n : block_len;
+        LIQUID_CHECK(LIQUID_OK == cpfskdem_demodulate_block(dem1, buf + n*_k, num, sym_out1 + n));
+        n += num;
+        block_len = 3*block_len + 1;
+    }
+
+    // compare results
+    for (i=0; i<num_symbols; i++) {
+        LIQUID_CHECK(sym_out0[i] == sym_out1[i]);
+        if (i >= delay)
+            LIQUID_CHECK(sym_in[i-delay] == sym_out1[i]);
+    }
+
+    // clean it up
+    cpfskmod_destroy(mod);
+    cpfskdem_destroy(dem0);
+    cpfskdem_destroy(dem1);
+}
+
+LIQUID_AUTOTEST(cpfskmodem_block_bps1_h0p5000_k4_gmsk,  "","",0.1) { testbench_cpfskmodem_block(__q__, 1, 0.5000f, 4, LIQUID_CPFSK_GMSK  ); }
+LIQUID_AUTOTEST(cpfskmodem_block_bps1_h0p2500_k8_square,"","",0.1) { testbench_cpfskmodem_block(__q__, 1, 0.2500f, 8, LIQUID_CPFSK_SQUARE); }
+LIQUID_AUTOTEST(cpfskmodem_block_bps2_h0p2500_k4_square,"","",0.1) { testbench_cpfskmodem_block(__q__, 2, 0.2500f, 4, LIQUID_CPFSK_SQUARE); }
+
 // test spectral response
 LIQUID_AUTOTEST(cpfskmodem_spectrum,"","",0.1)
 {
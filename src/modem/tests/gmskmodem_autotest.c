@@ -94,6 +94,72 @@ LIQUID_AUTOTEST(gmskmodem_k4_m3_b020,"","",0.1) { testbench_gmskmodem(__q__, 4,
 LIQUID_AUTOTEST(gmskmodem_k4_m3_b033,"","",0.1) { testbench_gmskmodem(__q__, 4, 3, 0.25f); }
 LIQUID_AUTOTEST(gmskmodem_k4_m3_b050,"","",0.1) { testbench_gmskmodem(__q__, 4, 3, 0.25f); }
 
+// test block demodulation against symbol-by-symbol demodulation
+void testbench_gmskmodem_block(liquid_autotest __q__,
+                               unsigned int    _k,
+                               unsigned int    _m,
+                               float           _bt)
+{
+    // create modulator and pair of demodulators
+    gmskmod mod  = gmskmod_create(_k, _m, _bt);
+    gmskdem dem0 = gmskdem_create(_k, _m, _bt);
+    gmskdem dem1 = gmskdem_create(_k, _m, _bt);
+
+    unsigned int  delay       = _m + _m;
+    unsigned int  num_symbols = 400 + delay;
+    float complex buf[num_symbols*_k];
+    unsigned int  sym_in  [num_symbols];
+    unsigned int  sym_out0[num_symbols];
+    unsigned int  sym_out1[num_symbols];
+    unsigned char soft_bits[num_symbols];
+
+    // modulate
+    msequence ms = msequence_create_default(7);
+    unsigned int i;
+    for (i=0; i<num_symbols; i++) {
+        sym_in[i] = msequence_generate_symbol(ms, 1);
+        gmskmod_modulate(mod, sym_in[i], buf + i*_k);
+    }
+    msequence_destroy(ms);
+
+    // demodulate one symbol at a time
+    for (i=0; i<num_symbols; i++)
+        gmskdem_demodulate(dem0, buf + i*_k, sym_out0 + i);
+
+    // demodulate in irregularly-sized blocks
+    unsigned int n = 0, block_len = 1;
+    while (n < num_symbols) {
+        unsigned int num = (num_symbols - n) < block_len ? num_symbols - n : block_len;
+        gmskdem_demodulate_block(dem1, buf + n*_k, num, sym_out1 + n);
+        n += num;
+        block_len = 3*block_len + 1;
+    }
+
+    // demodulate to soft bits in a single block
+    gmskdem_reset(dem1);
+    gmskdem_demodulate_soft_block(dem1, buf, num_symbols, soft_bits);
+
+    // compare results
+    for (i=0; i<num_symbols; i++) {
+        LIQUID_CHECK(sym_out0[i] == sym_out1[i]);
+        LIQUID_CHECK(sym_out0[i] == (soft_bits[i] > LIQUID_SOFTBIT_ERASURE ? 1 : 0));
+        if (i >= delay) {
+            LIQUID_CHECK(sym_in[i-delay] == sym_out1[i]);
+            // soft bits should be confident for noise-free input
+            LIQUID_CHECK(sym_in[i-delay] ? soft_bits[i] > 192 : soft_bits[i] < 64);
+        }
+    }
+
+    // clean it up
+    gmskmod_destroy(mod);
+    gmskdem_destroy(dem0);
+    gmskdem_destroy(dem1);
+}
+
+LIQUID_AUTOTEST(gmskmodem_block_k2_m3_b030,"","",0.1) { testbench_gmskmodem_block(__q__, 2, 3, 0.30f); }
+LIQUID_AUTOTEST(gmskmodem_block_k4_m3_b025,"","",0.1) { testbench_gmskmodem_block(__q__, 4, 3, 0.25f); }
+LIQUID_AUTOTEST(gmskmodem_block_k5_m2_b050,"","",0.1) { testbench_gmskmodem_block(__q__, 5, 2, 0.50f); }
+
 // test modulator copy
 LIQUID_AUTOTEST(gmskmod_copy,"","",0.1)
 {
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// block soft demodulation tests
+//
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "liquid.autotest.h"
+#include "liquid.internal.h"
+
+// compare block demodulation against brute-force max-log metrics
+void testbench_modemcf_demodsoft_block(liquid_autotest   __q__,
+                                       modulation_scheme _ms)
+{
+    unsigned int n = 53;    // number of samples (not a multiple of batch)
+    float nstd = 0.1f;      // noise standard deviation
+
+    modemcf mod   = modemcf_create(_ms);
+    modemcf demod = modemcf_create(_ms);
+    unsigned int bps = modemcf_get_bps(demod);
+    unsigned int M   = 1 << bps;
+
+    // reference constellation
+    unsigned int i, j, k;
+    float complex c[M];
+    for (j=0; j<M; j++)
+        modemcf_modulate(mod, j, &c[j]);
+
+    // generate noisy samples and noise variance per sample
+    unsigned int  sym_in[n];
+    float complex x[n];
+    float         nvar[n];
+    for (i=0; i<n; i++) {
+        sym_in[i] = modemcf_gen_rand_sym(mod);
+        x[i] = c[sym_in[i]] + nstd*(randnf() + _Complex_I*randnf())*M_SQRT1_2;
+        nvar[i] = 0.5f + 0.01f*i;
+    }
+
+    unsigned int  sym_out[n];
+    unsigned char soft_bits[n*bps];
+    float         llr[n*bps];
+    modemcf_demodulate_soft_block(demod, x, n, sym_out, soft_bits);
+    float evm = modemcf_get_demodulator_evm(demod);
+    modemcf_demodulate_llr_block(demod, x, n, nvar, NULL, llr);
+
+    float esum = 0.0f;
+    for (i=0; i<n; i++) {
+        // brute-force search over all constellation points
+        float dmin_0[bps], dmin_1[bps], dmin = 1e9f;
+        unsigned int s = 0;
+        for (k=0; k<bps; k++) {
+            dmin_0[k] = 1e9f;
+            dmin_1[k] = 1e9f;
+        }
+        for (j=0; j<M; j++) {
+            float d = crealf((x[i]-c[j])*conjf(x[i]-c[j]));
+            if (d < dmin) {
+                dmin = d;
+                s = j;
+            }
+            for (k=0; k<bps; k++) {
+                if ((j >> (bps-k-1)) & 1) dmin_1[k] = d < dmin_1[k] ? d : dmin_1[k];
+                else                      dmin_0[k] = d < dmin_0[k] ? d : dmin_0[k];
+            }
+        }
+        esum += dmin;
+
+        // check hard decision
+        LIQUID_CHECK(sym_out[i] == s);
+
+        for (k=0; k<bps; k++) {
+            // check soft bits agree with metric away from decision boundary
+            float d = dmin_0[k] - dmin_1[k];
+            if (d >  0.05f) LIQUID_CHECK(soft_bits[i*bps+k] > 127);
+            if (d < -0.05f) LIQUID_CHECK(soft_bits[i*bps+k] < 127);
+
+            // check log-likelihood ratios
+            LIQUID_CHECK_DELTA(llr[i*bps+k], d/nvar[i], 1e-3f);
+        }
+    }
+
+    // check rms error vector magnitude over block
+    LIQUID_CHECK_DELTA(evm, sqrtf(esum/n), 1e-4f);
+
+    modemcf_destroy(mod);
+    modemcf_destroy(demod);
+}
+
+// AUTOTESTS: generic schemes
+LIQUID_AUTOTEST(demodsoft_block_psk2,"","",0.1)      { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_PSK2);      }
+LIQUID_AUTOTEST(demodsoft_block_psk8,"","",0.1)      { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_PSK8);      }
+LIQUID_AUTOTEST(demodsoft_block_psk64,"","",0.1)     { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_PSK64);     }
+LIQUID_AUTOTEST(demodsoft_block_ask4,"","",0.1)      { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_ASK4);      }
+LIQUID_AUTOTEST(demodsoft_block_ask16,"","",0.1)     { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_ASK16);     }
+LIQUID_AUTOTEST(demodsoft_block_qam4,"","",0.1)      { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_QAM4);      }
+LIQUID_AUTOTEST(demodsoft_block_qam8,"","",0.1)      { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_QAM8);      }
+LIQUID_AUTOTEST(demodsoft_block_qam32,"","",0.1)     { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_QAM32);     }
+LIQUID_AUTOTEST(demodsoft_block_qam256,"","",0.1)    { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_QAM256);    }
+LIQUID_AUTOTEST(demodsoft_block_apsk16,"","",0.1)    { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_APSK16);    }
+LIQUID_AUTOTEST(demodsoft_block_apsk128,"","",0.1)   { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_APSK128);   }
+
+// AUTOTESTS: specific modems
+LIQUID_AUTOTEST(demodsoft_block_bpsk,"","",0.1)      { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_BPSK);      }
+LIQUID_AUTOTEST(demodsoft_block_qpsk,"","",0.1)      { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_QPSK);      }
+LIQUID_AUTOTEST(demodsoft_block_ook,"","",0.1)       { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_OOK);       }
+LIQUID_AUTOTEST(demodsoft_block_sqam32,"","",0.1)    { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_SQAM32);    }
+LIQUID_AUTOTEST(demodsoft_block_sqam128,"","",0.1)   { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_SQAM128);   }
+LIQUID_AUTOTEST(demodsoft_block_V29,"","",0.1)       { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_V29);       }
+LIQUID_AUTOTEST(demodsoft_block_arb64opt,"","",0.1)  { testbench_modemcf_demodsoft_block(__q__, LIQUID_MODEM_ARB64OPT);  }
+
+// differential schemes must match symbol-by-symbol soft demodulation
+void testbench_modemcf_demodsoft_block_diff(liquid_autotest   __q__,
+                                            modulation_scheme _ms)
+{
+    unsigned int n = 41;
+    modemcf mod    = modemcf_create(_ms);
+    modemcf demod0 = modemcf_create(_ms);
+    modemcf demod1 = modemcf_create(_ms);
+    unsigned int bps = modemcf_get_bps(mod);
+
+    unsigned int  i, k;
+    float complex x[n];
+    for (i=0; i<n; i++) {
+        modemcf_modulate(mod, modemcf_gen_rand_sym(mod), &x[i]);
+        x[i] += 0.05f*(randnf() + _Complex_I*randnf());
+    }
+
+    unsigned int  sym_block[n];
+    unsigned char soft_block[n*bps];
+    modemcf_demodulate_soft_block(demod0, x, n, sym_block, soft_block);
+
+    for (i=0; i<n; i++) {
+        unsigned int  sym;
+        unsigned char soft_bits[bps];
+        modemcf_demodulate_soft(demod1, x[i], &sym, soft_bits);
+        LIQUID_CHECK(sym_block[i] == sym);
+        for (k=0; k<bps; k++)
+            LIQUID_CHECK(soft_block[i*bps+k] == soft_bits[k]);
+    }
+
+    modemcf_destroy(mod);
+    modemcf_destroy(demod0);
+    modemcf_destroy(demod1);
+}
+
+LIQUID_AUTOTEST(demodsoft_block_dpsk4,"","",0.1)     { testbench_modemcf_demodsoft_block_diff(__q__, LIQUID_MODEM_DPSK4);    }
+LIQUID_AUTOTEST(demodsoft_block_dpsk16,"","",0.1)    { testbench_modemcf_demodsoft_block_diff(__q__, LIQUID_MODEM_DPSK16);   }
+LIQUID_AUTOTEST(demodsoft_block_pi4dqpsk,"","",0.1)  { testbench_modemcf_demodsoft_block_diff(__q__, LIQUID_MODEM_PI4DQPSK); }
+
+// LLR output should scale inversely with noise variance
+LIQUID_AUTOTEST(demodsoft_block_nvar,"","",0.1)
+{
+    unsigned int n = 24;
+    modemcf demod = modemcf_create(LIQUID_MODEM_QAM16);
+    float complex x[n];
+    float nvar[n];
+    unsigned int i, k;
+    for (i=0; i<n; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        nvar[i] = 0.25f;
+    }
+
+    float llr0[4*n], llr1[4*n];
+    modemcf_demodulate_llr_block(demod, x, n, NULL, NULL, llr0);
+    modemcf_demodulate_llr_block(demod, x, n, nvar, NULL, llr1);
+    for (i=0; i<n; i++) {
+        for (k=0; k<4; k++)
+            LIQUID_CHECK_DELTA(llr1[4*i+k], 4.0f*llr0[4*i+k], 1e-4f);
+    }
+
+    // evm is again symbol-wise after single-sample demodulation
+    unsigned int sym;
+    float complex x_hat;
+    modemcf_demodulate(demod, x[0], &sym);
+    modemcf_get_demodulator_sample(demod, &x_hat);
+    LIQUID_CHECK_DELTA(modemcf_get_demodulator_evm(demod), cabsf(x[0]-x_hat), 1e-6f);
+    modemcf_destroy(demod);
+}
+
+
+// payload dispatch must match the symbol-by-symbol demodulator for large
+// PSK/APSK constellations and the batched demodulator otherwise
+void testbench_modemcf_demodsoft_block_dispatch(liquid_autotest   __q__,
+                                                modulation_scheme _ms,
+                                                int               _sequential)
+{
+    unsigned int n = 37;
+    modemcf mod    = modemcf_create(_ms);
+    modemcf demod0 = modemcf_create(_ms);
+    modemcf demod1 = modemcf_create(_ms);
+    unsigned int bps = modemcf_get_bps(mod);
+
+    unsigned int  i;
+    float complex x[n];
+    for (i=0; i<n; i++) {
+        modemcf_modulate(mod, modemcf_gen_rand_sym(mod), &x[i]);
+        x[i] += 0.05f*(randnf() + _Complex_I*randnf());
+    }
+
+    unsigned int  sym0[n], sym1[n];
+    unsigned char soft0[n*bps], soft1[n*bps];
+    modemcf_demodsoft_block_dispatch(demod0, x, n, sym0, soft0);
+    if (_sequential) {
+        for (i=0; i<n; i++)
+            modemcf_demodulate_soft(demod1, x[i], &sym1[i], soft1 + i*bps);
+    } else {
+        modemcf_demodulate_soft_block(demod1, x, n, sym1, soft1);
+    }
+    LIQUID_CHECK_ARRAY(sym0,  sym1,  n*sizeof(unsigned int));
+    LIQUID_CHECK_ARRAY(soft0, soft1, n*bps);
+
+    modemcf_destroy(mod);
+    modemcf_destroy(demod0);
+    modemcf_destroy(demod1);
+}
+
+LIQUID_AUTOTEST(demodsoft_block_dispatch_psk32,"","",0.1)    { testbench_modemcf_demodsoft_block_dispatch(__q__, LIQUID_MODEM_PSK32,    0); }
+LIQUID_AUTOTEST(demodsoft_block_dispatch_psk64,"","",0.1)    { testbench_modemcf_demodsoft_block_dispatch(__q__, LIQUID_MODEM_PSK64,    1); }
+LIQUID_AUTOTEST(demodsoft_block_dispatch_apsk32,"","",0.1)   { testbench_modemcf_demodsoft_block_dispatch(__q__, LIQUID_MODEM_APSK32,   0); }
+LIQUID_AUTOTEST(demodsoft_block_dispatch_apsk256,"","",0.1)  { testbench_modemcf_demodsoft_block_dispatch(__q__, LIQUID_MODEM_APSK256,  1); }
+LIQUID_AUTOTEST(demodsoft_block_dispatch_qam256,"","",0.1)   { testbench_modemcf_demodsoft_block_dispatch(__q__, LIQUID_MODEM_QAM256,   0); }
+LIQUID_AUTOTEST(demodsoft_block_dispatch_arb64opt,"","",0.1) { testbench_modemcf_demodsoft_block_dispatch(__q__, LIQUID_MODEM_ARB64OPT, 0); }
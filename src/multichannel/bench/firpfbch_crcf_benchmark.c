@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -85,3 +86,53 @@ void benchmark_firpfbch_crcf_a512    FIRPFBCH_EXECUTE_BENCH_API(512,  2,  LIQUID
 void benchmark_firpfbch_crcf_a1024   FIRPFBCH_EXECUTE_BENCH_API(1024, 2,  LIQUID_ANALYZER)
 
 
+
+#define FIRPFBCH_EXECUTE_BLOCK_BENCH_API(NUM_CHANNELS,M,K)  \
+(   struct rusage *_start,                                  \
+    struct rusage *_finish,                                 \
+    unsigned long int *_num_iterations)                     \
+{ firpfbch_crcf_execute_block_bench(_start, _finish, _num_iterations, NUM_CHANNELS, M, K); }
+
+// Helper function to keep code base small
+void firpfbch_crcf_execute_block_bench(
+    struct rusage *_start,
+    struct rusage *_finish,
+    unsigned long int *_num_iterations,
+    unsigned int _num_channels,
+    unsigned int _m,
+    unsigned int _K)
+{
+    // initialize channelizer
+    float As    = 60.0f;
+    firpfbch_crcf c = firpfbch_crcf_create_kaiser(LIQUID_ANALYZER,_num_channels,_m,As);
+
+    unsigned long int i;
+
+    unsigned int n = _K * _num_channels;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    for (i=0; i<n; i++)
+        x[i] = 1.0f + _Complex_I*1.0f;
+
+    // scale number of iterations to keep execution time
+    // relatively linear (one iteration per block)
+    *_num_iterations /= n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        firpfbch_crcf_analyzer_execute_block(c,x,_K,y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= _K;
+
+    firpfbch_crcf_destroy(c);
+    free(x);
+    free(y);
+}
+
+//
+void benchmark_firpfbch_crcf_a64_block   FIRPFBCH_EXECUTE_BLOCK_BENCH_API(64,   2,  16)
+void benchmark_firpfbch_crcf_a256_block  FIRPFBCH_EXECUTE_BLOCK_BENCH_API(256,  2,  16)
+void benchmark_firpfbch_crcf_a512_block  FIRPFBCH_EXECUTE_BLOCK_BENCH_API(512,  2,  16)
+void benchmark_firpfbch_crcf_a1024_block FIRPFBCH_EXECUTE_BLOCK_BENCH_API(1024, 2,  16)
@@ -28,18 +28,19 @@
 #include <sys/resource.h>
 #include "liquid.h"
 
-#define OFDMFRAMESYNC_RXSYMBOL_BENCH_API(M,CP_LEN)  \
-(   struct rusage *_start,                          \
-    struct rusage *_finish,                         \
-    unsigned long int *_num_iterations)             \
-{ ofdmframesync_rxsymbol_bench(_start, _finish, _num_iterations, M, CP_LEN); }
+#define OFDMFRAMESYNC_RXSYMBOL_BENCH_API(M,CP_LEN,BLOCK)    \
+(   struct rusage *_start,                                  \
+    struct rusage *_finish,                                 \
+    unsigned long int *_num_iterations)                     \
+{ ofdmframesync_rxsymbol_bench(_start, _finish, _num_iterations, M, CP_LEN, BLOCK); }
 
 // Helper function to keep code base small
 void ofdmframesync_rxsymbol_bench(struct rusage *_start,
                                  struct rusage *_finish,
                                  unsigned long int *_num_iterations,
                                  unsigned int _num_subcarriers,
-                                 unsigned int _cp_len)
+                                 unsigned int _cp_len,
+                                 unsigned int _block_size)
 {
     // options
     modulation_scheme ms = LIQUID_MODEM_QPSK;
@@ -54,10 +55,13 @@ void ofdmframesync_rxsymbol_bench(struct rusage *_start,
     modemcf mod = modemcf_create(ms);
 
     ofdmframesync fs = ofdmframesync_create(M,cp_len,taper_len,NULL,NULL,NULL);
+    ofdmframesync_set_block_size(fs, _block_size);
 
     unsigned int i;
-    float complex X[M];         // channelized symbol
-    float complex x[M+cp_len];  // time-domain symbol
+    unsigned int num_symbols = 8;           // symbols per call to execute()
+    unsigned int n = num_symbols*(M+cp_len);
+    float complex * X = (float complex*) malloc(M*sizeof(float complex));  // channelized symbol
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));  // time-domain symbols
 
     // synchronize short sequence (first)
     ofdmframegen_write_S0a(fg, x);
@@ -80,34 +84,47 @@ void ofdmframesync_rxsymbol_bench(struct rusage *_start,
 
     ofdmframegen_writesymbol(fg, X, x);
 
-    // add noise
+    // add noise and repeat symbol
     for (i=0; i<M+cp_len; i++)
         x[i] += 0.02f*randnf()*cexpf(_Complex_I*2*M_PI*randf());
+    for (i=M+cp_len; i<n; i++)
+        x[i] = x[i % (M+cp_len)];
 
     // normalize number of iterations
-    *_num_iterations /= M;
+    *_num_iterations /= 2*M;
+    if (*_num_iterations < 1) *_num_iterations = 1;
 
     // start trials
     getrusage(RUSAGE_SELF, _start);
     for (i=0; i<(*_num_iterations); i++) {
         // receive data symbols (ignoring pilots)
-        ofdmframesync_execute(fs, x, M+cp_len);
-        ofdmframesync_execute(fs, x, M+cp_len);
-        ofdmframesync_execute(fs, x, M+cp_len);
-        ofdmframesync_execute(fs, x, M+cp_len);
+        ofdmframesync_execute(fs, x, n);
     }
     getrusage(RUSAGE_SELF, _finish);
-    *_num_iterations *= 4;
+    *_num_iterations *= num_symbols;
 
     // destroy objects
     ofdmframegen_destroy(fg);
     ofdmframesync_destroy(fs);
     modemcf_destroy(mod);
+    free(X);
+    free(x);
 }
 
-//
-void benchmark_ofdmframesync_rxsymbol_n64   OFDMFRAMESYNC_RXSYMBOL_BENCH_API(64, 8)
-void benchmark_ofdmframesync_rxsymbol_n128  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(128,16)
-void benchmark_ofdmframesync_rxsymbol_n256  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(256,32)
-void benchmark_ofdmframesync_rxsymbol_n512  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(512,64)
-
+// one symbol at a time
+void benchmark_ofdmframesync_rxsymbol_n64   OFDMFRAMESYNC_RXSYMBOL_BENCH_API(64,  8,  1)
+void benchmark_ofdmframesync_rxsymbol_n128  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(128, 16, 1)
+void benchmark_ofdmframesync_rxsymbol_n256  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(256, 32, 1)
+void benchmark_ofdmframesync_rxsymbol_n512  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(512, 64, 1)
+void benchmark_ofdmframesync_rxsymbol_n1024 OFDMFRAMESYNC_RXSYMBOL_BENCH_API(1024,128,1)
+void benchmark_ofdmframesync_rxsymbol_n2048 OFDMFRAMESYNC_RXSYMBOL_BENCH_API(2048,256,1)
+void benchmark_ofdmframesync_rxsymbol_n4096 OFDMFRAMESYNC_RXSYMBOL_BENCH_API(4096,512,1)
+
+// blocks of 8 symbols
+void benchmark_ofdmframesync_rxblock_n64    OFDMFRAMESYNC_RXSYMBOL_BENCH_API(64,  8,  8)
+void benchmark_ofdmframesync_rxblock_n128   OFDMFRAMESYNC_RXSYMBOL_BENCH_API(128, 16, 8)
+void benchmark_ofdmframesync_rxblock_n256   OFDMFRAMESYNC_RXSYMBOL_BENCH_API(256, 32, 8)
+void benchmark_ofdmframesync_rxblock_n512   OFDMFRAMESYNC_RXSYMBOL_BENCH_API(512, 64, 8)
+void benchmark_ofdmframesync_rxblock_n1024  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(1024,128,8)
+void benchmark_ofdmframesync_rxblock_n2048  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(2048,256,8)
+void benchmark_ofdmframesync_rxblock_n4096  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(4096,512,8)
@@ -39,17 +39,39 @@ struct FIRPFBCH(_s) {
     unsigned int h_len;         // filter length
     TC * h;                     // filter coefficients
     
-    // create separate bank of dotprod and window objects
+    // create separate bank of dotprod and window objects (synthesis)
     DOTPROD() * dp;             // dot product object array
     WINDOW() * w;               // window buffer object array
+
+    // channel-interleaved filter matrix and input history (analysis);
+    // row d of the matrix holds tap d of every channel, and each history
+    // row holds one block of num_channels input samples
+    TC * G;                     // filter matrix [size: p x g_stride], aligned
+    unsigned int g_stride;      // matrix row stride (coefficients are
+                                // duplicated for complex inputs to real
+                                // filters to keep rows contiguous)
+    TI * hist;                  // input history [size: (p+1) x num_channels], aligned
     unsigned int filter_index;  // running filter index (analysis)
 
     // fft plan
     FFT_PLAN fft;               // fft|ifft object
     TO * x;                     // fft|ifft transform input array
     TO * X;                     // fft|ifft transform output array
+
+    // batched fft plan (analysis)
+    FFT_PLAN fft_many;          // in-place transform of FIRPFBCH_BATCH blocks
+    TO * Xb;                    // batched transform buffer
+
+    // filter matrix multiply-accumulate kernel (analysis), selected at
+    // runtime
+    void (*mac)(TC * _g, TI * _x, unsigned int _n, int _accum, TO * _y);
+
+    LIQUID_COUNTER_FIELD        // performance counters (when enabled)
 };
 
+// number of blocks transformed together by the analyzer
+#define FIRPFBCH_BATCH (8)
+
 // 
 // forward declaration of internal methods
 //
@@ -60,6 +82,19 @@ int FIRPFBCH(_analyzer_run)(FIRPFBCH()   _q,
                             unsigned int _k,
                             TO *         _X);
 
+int FIRPFBCH(_analyzer_run_block)(FIRPFBCH()   _q,
+                                  TI *         _x,
+                                  unsigned int _K,
+                                  TO *         _y);
+
+// select runtime execution method
+int FIRPFBCH(_runtime_detect)(FIRPFBCH() _q);
+
+// filter matrix multiply-accumulate kernels: always defined but only
+// really implemented on specific architectures
+void FIRPFBCH(_mac_port)(TC * _g, TI * _x, unsigned int _n, int _accum, TO * _y);
+void FIRPFBCH(_mac_neon)(TC * _g, TI * _x, unsigned int _n, int _accum, TO * _y);
+void FIRPFBCH(_mac_avx2)(TC * _g, TI * _x, unsigned int _n, int _accum, TO * _y);
 
 // create FIR polyphase filterbank channelizer object
 //  _type   : channelizer type (LIQUID_ANALYZER | LIQUID_SYNTHESIZER)
@@ -90,29 +125,65 @@ FIRPFBCH() FIRPFBCH(_create)(int          _type,
     // derived values
     q->h_len = q->num_channels * q->p;
 
-    // create bank of filters
-    q->dp = (DOTPROD()*) malloc((q->num_channels)*sizeof(DOTPROD()));
-    q->w  = (WINDOW()*)  malloc((q->num_channels)*sizeof(WINDOW()));
-
     // copy filter coefficients
     q->h = (TC*) malloc((q->h_len)*sizeof(TC));
     unsigned int i;
     for (i=0; i<q->h_len; i++)
         q->h[i] = _h[i];
 
-    // generate bank of sub-samped filters
     unsigned int n;
-    unsigned int h_sub_len = q->p;
-    TC h_sub[h_sub_len];
-    for (i=0; i<q->num_channels; i++) {
-        // sub-sample prototype filter, loading coefficients in reverse order
-        for (n=0; n<h_sub_len; n++) {
-            h_sub[h_sub_len-n-1] = q->h[i + n*(q->num_channels)];
+    if (q->type == LIQUID_SYNTHESIZER) {
+        // create bank of filters
+        q->dp = (DOTPROD()*) malloc((q->num_channels)*sizeof(DOTPROD()));
+        q->w  = (WINDOW()*)  malloc((q->num_channels)*sizeof(WINDOW()));
+
+        // generate bank of sub-samped filters
+        unsigned int h_sub_len = q->p;
+        TC h_sub[h_sub_len];
+        for (i=0; i<q->num_channels; i++) {
+            // sub-sample prototype filter, loading coefficients in reverse order
+            for (n=0; n<h_sub_len; n++) {
+                h_sub[h_sub_len-n-1] = q->h[i + n*(q->num_channels)];
+            }
+            // create window buffer and dotprod object (coefficients
+            // loaded in reverse order)
+            q->dp[i] = DOTPROD(_create)(h_sub,h_sub_len);
+            q->w[i]  = WINDOW(_create)(h_sub_len);
         }
-        // create window buffer and dotprod object (coefficients
-        // loaded in reverse order)
-        q->dp[i] = DOTPROD(_create)(h_sub,h_sub_len);
-        q->w[i]  = WINDOW(_create)(h_sub_len);
+        q->G    = NULL;
+        q->hist = NULL;
+    } else {
+        // channel c of the transform input is filtered with taps
+        // h[M-1-c + d*M], d in [0,p), applied to the d-th most recent
+        // input block at the same position
+#if TC_COMPLEX == TI_COMPLEX
+        q->g_stride = q->num_channels;
+#else
+        q->g_stride = 2*q->num_channels;
+#endif
+        q->G    = (TC*) liquid_aligned_alloc(64, q->p*q->g_stride*sizeof(TC));
+        q->hist = (TI*) liquid_aligned_alloc(64, (q->p+1)*q->num_channels*sizeof(TI));
+        unsigned int c;
+        for (n=0; n<q->p; n++) {
+            for (c=0; c<q->num_channels; c++) {
+                TC g = q->h[q->num_channels-1-c + n*q->num_channels];
+#if TC_COMPLEX == TI_COMPLEX
+                q->G[n*q->g_stride + c] = g;
+#else
+                q->G[n*q->g_stride + 2*c  ] = g;
+                q->G[n*q->g_stride + 2*c+1] = g;
+#endif
+            }
+        }
+        q->dp = NULL;
+        q->w  = NULL;
+
+        // batched transform of several blocks in place
+        q->Xb = (TO*) FFT_MALLOC(FIRPFBCH_BATCH*(q->num_channels)*sizeof(TO));
+        q->fft_many = FFT_CREATE_PLAN_MANY(q->num_channels, FIRPFBCH_BATCH,
+                                           q->Xb, 1, q->num_channels,
+                                           q->Xb, 1, q->num_channels,
+                                           FFT_DIR_FORWARD, FFT_METHOD);
     }
 
     // allocate memory for buffers
@@ -125,7 +196,13 @@ FIRPFBCH() FIRPFBCH(_create)(int          _type,
     else
         q->fft = FFT_CREATE_PLAN(q->num_channels, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD);
 
-    // reset filterbank object
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "firpfbch_" EXTENSION_FULL);
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct FIRPFBCH(_s)) +
+        q->h_len*sizeof(TC) + 2*q->num_channels*sizeof(T));
+
+    // set kernel and reset filterbank object
+    FIRPFBCH(_runtime_detect)(q);
     FIRPFBCH(_reset)(q);
 
     // return filterbank object
@@ -224,15 +301,26 @@ FIRPFBCH() FIRPFBCH(_create_rnyquist)(int          _type,
 // destroy firpfbch object
 int FIRPFBCH(_destroy)(FIRPFBCH() _q)
 {
+    LIQUID_COUNTER_UNREGISTER(_q);
     unsigned int i;
 
-    // free dot product, window objects and arrays
-    for (i=0; i<_q->num_channels; i++) {
-        DOTPROD(_destroy)(_q->dp[i]);
-        WINDOW(_destroy)(_q->w[i]);
+    if (_q->type == LIQUID_SYNTHESIZER) {
+        // free dot product, window objects and arrays
+        for (i=0; i<_q->num_channels; i++) {
+            DOTPROD(_destroy)(_q->dp[i]);
+            WINDOW(_destroy)(_q->w[i]);
+        }
+        free(_q->dp);
+        free(_q->w);
+    } else {
+        // free filter matrix and input history
+        liquid_aligned_free(_q->G);
+        liquid_aligned_free(_q->hist);
+
+        // free batched transform
+        FFT_DESTROY_PLAN(_q->fft_many);
+        FFT_FREE(_q->Xb);
     }
-    free(_q->dp);
-    free(_q->w);
 
     // free transform object
     FFT_DESTROY_PLAN(_q->fft);
@@ -252,10 +340,13 @@ int FIRPFBCH(_reset)(FIRPFBCH() _q)
 {
     unsigned int i;
     for (i=0; i<_q->num_channels; i++) {
-        WINDOW(_reset)(_q->w[i]);
+        if (_q->type == LIQUID_SYNTHESIZER)
+            WINDOW(_reset)(_q->w[i]);
         _q->x[i] = 0;
         _q->X[i] = 0;
     }
+    if (_q->type == LIQUID_ANALYZER)
+        memset(_q->hist, 0x00, (_q->p+1)*_q->num_channels*sizeof(TI));
     _q->filter_index = _q->num_channels-1;
     return LIQUID_OK;
 }
@@ -269,6 +360,32 @@ int FIRPFBCH(_print)(FIRPFBCH() _q)
     return LIQUID_OK;
 }
 
+// select runtime execution method
+int FIRPFBCH(_runtime_select)(FIRPFBCH()       _q,
+                              liquid_runtime_t _select)
+{
+    switch (_select) {
+    case LIQUID_RUNTIME_PORT:
+        liquid_log_trace("firpfbch_%s_runtime_select(), port", EXTENSION_FULL);
+        _q->mac = &FIRPFBCH(_mac_port);
+        return LIQUID_OK;
+    case LIQUID_RUNTIME_NEON:
+        liquid_log_trace("firpfbch_%s_runtime_select(), neon", EXTENSION_FULL);
+        _q->mac = &FIRPFBCH(_mac_neon);
+        return LIQUID_OK;
+    case LIQUID_RUNTIME_AVX2:
+        liquid_log_trace("firpfbch_%s_runtime_select(), avx2", EXTENSION_FULL);
+        _q->mac = &FIRPFBCH(_mac_avx2);
+        return LIQUID_OK;
+    default:;
+    }
+
+    _q->mac = &FIRPFBCH(_mac_port);
+    return liquid_error(LIQUID_EINT,
+        "firpfbch_%s_runtime_select(), invalid selection or mode not available (%d), falling back to portable version",
+        EXTENSION_FULL, _select);
+}
+
 // 
 // SYNTHESIZER
 //
@@ -281,6 +398,7 @@ int FIRPFBCH(_synthesizer_execute)(FIRPFBCH() _q,
                                    TI *       _x,
                                    TO *       _y)
 {
+    LIQUID_COUNTER_START(_q);
     unsigned int i;
 
     // copy channelized symbols to transform input
@@ -299,6 +417,7 @@ int FIRPFBCH(_synthesizer_execute)(FIRPFBCH() _q,
         // normalize by DFT scaling factor
         //_y[i] /= (float) (_q->num_channels);
     }
+    LIQUID_COUNTER_STOP(_q, _q->num_channels);
     return LIQUID_OK;
 }
 
@@ -314,15 +433,40 @@ int FIRPFBCH(_analyzer_execute)(FIRPFBCH() _q,
                                 TI *       _x,
                                 TO *       _y)
 {
-    unsigned int i;
-
-    // push samples into buffers
-    for (i=0; i<_q->num_channels; i++)
-        FIRPFBCH(_analyzer_push)(_q, _x[i]);
+    // batch execution requires separate input and output buffers
+    if (_x == _y) {
+        unsigned int i;
+        for (i=0; i<_q->num_channels; i++)
+            FIRPFBCH(_analyzer_push)(_q, _x[i]);
+        return FIRPFBCH(_analyzer_run)(_q, 0, _y);
+    }
+    return FIRPFBCH(_analyzer_execute_block)(_q, _x, 1, _y);
+}
 
-    // execute analysis filters on the given input starting
-    // with filterbank at index zero
-    return FIRPFBCH(_analyzer_run)(_q, 0, _y);
+// execute filterbank as analyzer on a batch of blocks of samples
+//  _q      :   filterbank channelizer object
+//  _x      :   input time series, [size: _K*num_channels x 1]
+//  _K      :   number of blocks
+//  _y      :   channelized output, [size: _K*num_channels x 1], must
+//              not overlap the input
+int FIRPFBCH(_analyzer_execute_block)(FIRPFBCH()   _q,
+                                      TI *         _x,
+                                      unsigned int _K,
+                                      TO *         _y)
+{
+    // filter all blocks at once when input is aligned to block boundary
+    if (_q->filter_index == _q->num_channels-1)
+        return FIRPFBCH(_analyzer_run_block)(_q, _x, _K, _y);
+
+    // push samples into buffers and execute analysis filters on the
+    // given input starting with filterbank at index zero
+    unsigned int i, k;
+    for (k=0; k<_K; k++) {
+        for (i=0; i<_q->num_channels; i++)
+            FIRPFBCH(_analyzer_push)(_q, _x[k*_q->num_channels + i]);
+        FIRPFBCH(_analyzer_run)(_q, 0, &_y[k*_q->num_channels]);
+    }
+    return LIQUID_OK;
 }
 
 // 
@@ -336,11 +480,17 @@ int FIRPFBCH(_analyzer_execute)(FIRPFBCH() _q,
 int FIRPFBCH(_analyzer_push)(FIRPFBCH() _q,
                              TI         _x)
 {
-    // push sample into filter
-    WINDOW(_push)(_q->w[_q->filter_index], _x);
+    unsigned int M = _q->num_channels;
+
+    // start new block in history when previous one is complete
+    if (_q->filter_index == M-1)
+        memmove(_q->hist, _q->hist + M, _q->p*M*sizeof(TI));
+
+    // push sample into filter, stored at its position within the block
+    _q->hist[_q->p*M + M - 1 - _q->filter_index] = _x;
 
     // decrement filter index
-    _q->filter_index = (_q->filter_index + _q->num_channels - 1) % _q->num_channels;
+    _q->filter_index = (_q->filter_index + M - 1) % M;
     return LIQUID_OK;
 }
 
@@ -352,21 +502,33 @@ int FIRPFBCH(_analyzer_run)(FIRPFBCH()   _q,
                             unsigned int _k,
                             TO *         _y)
 {
-    unsigned int i;
+    LIQUID_COUNTER_START(_q);
+    unsigned int M = _q->num_channels;
+    unsigned int i, d;
 
     // execute filter outputs, reversing order of output (not
     // sure why this is necessary)
-    T * r;  // read pointer
-    unsigned int index;
-    for (i=0; i<_q->num_channels; i++) {
-        // compute appropriate index
-        index = (i+_k) % _q->num_channels;
-
-        // read buffer at specified index
-        WINDOW(_read)(_q->w[index], &r);
-
-        // compute dot product
-        DOTPROD(_execute)(_q->dp[i], r, &_q->X[_q->num_channels-i-1]);
+    for (i=0; i<M; i++) {
+        // compute appropriate filter index and its position in the block
+        unsigned int index = (i+_k) % M;
+        unsigned int col   = M - 1 - index;
+
+        // newest history row for this filter: filters not yet pushed
+        // in a partial block end on the previous block
+        unsigned int newest = (_q->filter_index == M-1 || index > _q->filter_index) ?
+                              _q->p : _q->p - 1;
+
+        // compute dot product with taps of filter i
+        TO v = 0;
+        for (d=0; d<_q->p; d++) {
+#if TC_COMPLEX == TI_COMPLEX
+            TC g = _q->G[d*_q->g_stride + M-1-i];
+#else
+            TC g = _q->G[d*_q->g_stride + 2*(M-1-i)];
+#endif
+            v += g * _q->hist[(newest-d)*M + col];
+        }
+        _q->X[M-i-1] = v;
     }
 
     // execute DFT, store result in buffer 'x'
@@ -374,6 +536,137 @@ int FIRPFBCH(_analyzer_run)(FIRPFBCH()   _q,
 
     // move to output array
     memmove(_y, _q->x, _q->num_channels*sizeof(TO));
+    LIQUID_COUNTER_STOP(_q, M);
+    return LIQUID_OK;
+}
+
+// multiply-accumulate a tile of one filter matrix row with one input
+// block: y[c] = g[c]*x[c] (first tap) or y[c] += g[c]*x[c]
+//  _g      :   filter matrix row tile
+//  _x      :   input block tile, [size: _n x 1]
+//  _n      :   tile length (channels)
+//  _accum  :   accumulate into output?
+//  _y      :   output tile, [size: _n x 1]
+void FIRPFBCH(_mac_port)(TC *         _g,
+                         TI *         _x,
+                         unsigned int _n,
+                         int          _accum,
+                         TO *         _y)
+{
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int j;
+#if TC_COMPLEX == TI_COMPLEX
+    // complex coefficients: interleaved real/imaginary arithmetic
+    float * g = (float*)_g;
+    for (j=0; j<2*_n; j+=2) {
+        float re = g[j]*x[j  ] - g[j+1]*x[j+1];
+        float im = g[j]*x[j+1] + g[j+1]*x[j  ];
+        y[j  ] = _accum ? y[j  ] + re : re;
+        y[j+1] = _accum ? y[j+1] + im : im;
+    }
+#else
+    // real coefficients duplicated for each component
+    if (_accum) {
+        for (j=0; j<2*_n; j++)
+            y[j] += _g[j] * x[j];
+    } else {
+        for (j=0; j<2*_n; j++)
+            y[j] = _g[j] * x[j];
+    }
+#endif
+}
+
+// number of channels filtered at once in a batch, sized so that the
+// filter matrix and input tiles stay resident in L1 cache
+#define FIRPFBCH_TILE (64)
+
+// run filterbank analyzer on a batch of blocks aligned to the block
+// boundary: the filter matrix is applied to all blocks one tile of
+// channels at a time, followed by the DFT of each block
+//  _q      :   filterbank channelizer object
+//  _x      :   input time series, [size: _K*num_channels x 1]
+//  _K      :   number of blocks
+//  _y      :   output array, [size: _K*num_channels x 1]
+int FIRPFBCH(_analyzer_run_block)(FIRPFBCH()   _q,
+                                  TI *         _x,
+                                  unsigned int _K,
+                                  TO *         _y)
+{
+    LIQUID_COUNTER_START(_q);
+    unsigned int M = _q->num_channels;
+    unsigned int p = _q->p;
+    unsigned int c0, b, d;
+
+    // matrix-matrix product over tiles of channels, storing DFT inputs
+    // in the output array
+    for (c0=0; c0<M; c0+=FIRPFBCH_TILE) {
+        unsigned int n = M - c0 < FIRPFBCH_TILE ? M - c0 : FIRPFBCH_TILE;
+#if TC_COMPLEX == TI_COMPLEX
+        unsigned int g0 = c0;
+#else
+        unsigned int g0 = 2*c0;
+#endif
+        for (b=0; b<_K; b++) {
+            for (d=0; d<p; d++) {
+                // input block b-d comes from history when not in this batch
+                int j = (int)b - (int)d;
+                TI * r = j >= 0 ? &_x[j*M] : &_q->hist[(p+1+j)*M];
+                _q->mac(&_q->G[d*_q->g_stride + g0], r + c0, n, d > 0, &_y[b*M + c0]);
+            }
+        }
+    }
+
+    // execute DFT of each block, FIRPFBCH_BATCH blocks at a time
+    for (b=0; b+FIRPFBCH_BATCH<=_K; b+=FIRPFBCH_BATCH) {
+        memmove(_q->Xb, &_y[b*M], FIRPFBCH_BATCH*M*sizeof(TO));
+        FFT_EXECUTE(_q->fft_many);
+        memmove(&_y[b*M], _q->Xb, FIRPFBCH_BATCH*M*sizeof(TO));
+    }
+    for ( ; b<_K; b++) {
+        memmove(_q->X, &_y[b*M], M*sizeof(TO));
+        FFT_EXECUTE(_q->fft);
+        memmove(&_y[b*M], _q->x, M*sizeof(TO));
+    }
+
+    // retain most recent p+1 blocks in history
+    if (_K > p) {
+        memmove(_q->hist, &_x[(_K-p-1)*M], (p+1)*M*sizeof(TI));
+    } else {
+        memmove(_q->hist, &_q->hist[_K*M], (p+1-_K)*M*sizeof(TI));
+        memmove(&_q->hist[(p+1-_K)*M], _x, _K*M*sizeof(TI));
+    }
+    LIQUID_COUNTER_STOP(_q, _K*M);
     return LIQUID_OK;
 }
 
+// detect runtime execution method
+int FIRPFBCH(_runtime_detect)(FIRPFBCH() _q)
+{
+    // implementations
+    struct liquid_cpuinfo_s impl =
+    {
+        .altivec = 0,
+        .neon    = true,
+        .mmx     = 0,
+        .sse     = 0,
+        .sse2    = 0,
+        .sse3    = 0,
+        .ssse3   = 0,
+        .sse41   = 0,
+        .sse42   = 0,
+        .avx     = 0,
+        .fma3    = 0,
+        .avx2    = true,
+        .avx512  = 0,
+        .amx     = 0,
+        .amx101  = 0,
+        .amx102  = 0,
+    };
+
+    // given implementations, find best method
+    liquid_runtime_t selection = liquid_runtime_detect(&impl);
+
+    // invoke selection method
+    return FIRPFBCH(_runtime_select)(_q, selection);
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// polyphase filterbank analyzer filter matrix kernel (AVX2)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_AVX2
+
+// include proper SIMD extensions for x86 AVX2
+#include <immintrin.h>
+
+// multiply-accumulate tile of filter matrix row with input block, four
+// complex values at a time
+void __attribute__((target("avx2")))
+firpfbch_cccf_mac_avx2(float complex * _g,
+                       float complex * _x,
+                       unsigned int    _n,
+                       int             _accum,
+                       float complex * _y)
+{
+    float * g = (float*) _g;
+    float * x = (float*) _x;
+    float * y = (float*) _y;
+
+    // t = 4*(floor(_n/4))
+    unsigned int t = (_n >> 2) << 2;
+    unsigned int j;
+    for (j=0; j<t; j+=4) {
+        __m256 gv = _mm256_loadu_ps(&g[2*j]);
+        __m256 xv = _mm256_loadu_ps(&x[2*j]);
+        __m256 gr = _mm256_moveldup_ps(gv);         // { g.re, g.re, ... }
+        __m256 gi = _mm256_movehdup_ps(gv);         // { g.im, g.im, ... }
+        __m256 xs = _mm256_permute_ps(xv, 0xb1);    // { x.im, x.re, ... }
+        __m256 v  = _mm256_addsub_ps(_mm256_mul_ps(xv, gr), _mm256_mul_ps(xs, gi));
+        if (_accum)
+            v = _mm256_add_ps(_mm256_loadu_ps(&y[2*j]), v);
+        _mm256_storeu_ps(&y[2*j], v);
+    }
+
+    // clean up remaining
+    if (j < _n)
+        firpfbch_cccf_mac_port(&_g[j], &_x[j], _n - j, _accum, &_y[j]);
+}
+
+// build guard
+#else
+
+// invalidated
+void firpfbch_cccf_mac_avx2(float complex * _g,
+                            float complex * _x,
+                            unsigned int    _n,
+                            int             _accum,
+                            float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    firpfbch_cccf_mac_port(_g, _x, _n, _accum, _y);
+}
+
+// build guard
+#endif
+
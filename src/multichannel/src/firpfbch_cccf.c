@@ -51,3 +51,7 @@
 // prototypes
 #include "firpfbch.proto.c"
 
+// SIMD extensions
+#include "firpfbch_cccf.neon.c"
+#include "firpfbch_cccf.avx2.c"
+
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// polyphase filterbank analyzer filter matrix kernel (ARM Neon)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_NEON
+
+// include proper SIMD extensions for ARM Neon
+#include <arm_neon.h>
+
+// multiply-accumulate tile of filter matrix row with input block, four
+// complex values at a time with components de-interleaved on load
+void firpfbch_cccf_mac_neon(float complex * _g,
+                            float complex * _x,
+                            unsigned int    _n,
+                            int             _accum,
+                            float complex * _y)
+{
+    float * g = (float*) _g;
+    float * x = (float*) _x;
+    float * y = (float*) _y;
+
+    // t = 4*(floor(_n/4))
+    unsigned int t = (_n >> 2) << 2;
+    unsigned int j;
+    for (j=0; j<t; j+=4) {
+        float32x4x2_t gv = vld2q_f32(&g[2*j]);
+        float32x4x2_t xv = vld2q_f32(&x[2*j]);
+        float32x4x2_t yv;
+        if (_accum) {
+            yv = vld2q_f32(&y[2*j]);
+        } else {
+            yv.val[0] = vdupq_n_f32(0.0f);
+            yv.val[1] = vdupq_n_f32(0.0f);
+        }
+        // re += g.re*x.re - g.im*x.im, im += g.re*x.im + g.im*x.re
+        yv.val[0] = vmlaq_f32(yv.val[0], gv.val[0], xv.val[0]);
+        yv.val[0] = vmlsq_f32(yv.val[0], gv.val[1], xv.val[1]);
+        yv.val[1] = vmlaq_f32(yv.val[1], gv.val[0], xv.val[1]);
+        yv.val[1] = vmlaq_f32(yv.val[1], gv.val[1], xv.val[0]);
+        vst2q_f32(&y[2*j], yv);
+    }
+
+    // clean up remaining
+    if (j < _n)
+        firpfbch_cccf_mac_port(&_g[j], &_x[j], _n - j, _accum, &_y[j]);
+}
+
+// build guard
+#else
+
+// invalidated
+void firpfbch_cccf_mac_neon(float complex * _g,
+                            float complex * _x,
+                            unsigned int    _n,
+                            int             _accum,
+                            float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"neon extensions not available");
+    firpfbch_cccf_mac_port(_g, _x, _n, _accum, _y);
+}
+
+// build guard
+#endif
+
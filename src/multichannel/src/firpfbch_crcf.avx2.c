@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// polyphase filterbank analyzer filter matrix kernel (AVX2)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_AVX2
+
+// include proper SIMD extensions for x86 AVX2
+#include <immintrin.h>
+
+// multiply-accumulate tile of filter matrix row with input block; real
+// coefficients are duplicated for each component, so the tile is an
+// element-wise product of 2*_n values
+void __attribute__((target("avx2")))
+firpfbch_crcf_mac_avx2(float *         _g,
+                       float complex * _x,
+                       unsigned int    _n,
+                       int             _accum,
+                       float complex * _y)
+{
+    float * x = (float*) _x;
+    float * y = (float*) _y;
+    unsigned int n = 2*_n;
+
+    // t = 8*(floor(n/8))
+    unsigned int t = (n >> 3) << 3;
+    unsigned int j;
+    if (_accum) {
+        for (j=0; j<t; j+=8) {
+            __m256 v = _mm256_mul_ps(_mm256_loadu_ps(&_g[j]), _mm256_loadu_ps(&x[j]));
+            _mm256_storeu_ps(&y[j], _mm256_add_ps(_mm256_loadu_ps(&y[j]), v));
+        }
+        for ( ; j<n; j++)
+            y[j] += _g[j] * x[j];
+    } else {
+        for (j=0; j<t; j+=8)
+            _mm256_storeu_ps(&y[j], _mm256_mul_ps(_mm256_loadu_ps(&_g[j]), _mm256_loadu_ps(&x[j])));
+        for ( ; j<n; j++)
+            y[j] = _g[j] * x[j];
+    }
+}
+
+// build guard
+#else
+
+// invalidated
+void firpfbch_crcf_mac_avx2(float *         _g,
+                            float complex * _x,
+                            unsigned int    _n,
+                            int             _accum,
+                            float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    firpfbch_crcf_mac_port(_g, _x, _n, _accum, _y);
+}
+
+// build guard
+#endif
+
@@ -55,3 +55,7 @@
 #include "firpfbch2.proto.c"    // polyphase filterbank w/ output rate 2 Fs / M
 #include "firpfbchr.proto.c"    // polyphase filterbank w/ output rate P Fs / M
 
+// SIMD extensions
+#include "firpfbch_crcf.neon.c"
+#include "firpfbch_crcf.avx2.c"
+
@@ -76,7 +76,19 @@ int ofdmframesync_estimate_eqgain_poly(ofdmframesync _q,
                                        unsigned int _order);
 
 // recover symbol, correcting for gain, pilot phase, etc.
-int ofdmframesync_rxsymbol(ofdmframesync _q);
+//  _q      :   ofdmframesync object
+//  _X      :   received symbol (freq), corrected in place [size: _M x 1]
+int ofdmframesync_rxsymbol(ofdmframesync   _q,
+                           float complex * _X);
+
+// transform and recover buffered block of symbols, invoking callback
+// for each; returns index of input sample at which frame ended, or _n
+// if all symbols were accepted
+unsigned int ofdmframesync_rxblock(ofdmframesync _q,
+                                   unsigned int  _n);
+
+// (re-)allocate block receive buffers and transform
+int ofdmframesync_block_init(ofdmframesync _q);
 
 struct ofdmframesync_s {
     unsigned int M;         // number of subcarriers
@@ -118,6 +130,22 @@ struct ofdmframesync_s {
     float complex * B;      // subcarrier phase rotation due to backoff
     float complex * R;      // 
 
+    // symbol recovery
+    unsigned int * pilots;  // pilot subcarrier indices (fftshift order)
+    float * fx;             // subcarrier frequency index
+    float * theta;          // phase correction (scratch)
+    float complex * ramp;   // phase correction rotation (scratch)
+
+    // block receive
+    unsigned int block_size;    // number of symbols per batched transform
+    unsigned int block_len;     // number of symbols currently buffered
+    unsigned int * block_index; // input sample index ending each symbol
+    unsigned int input_index;   // index of current input sample
+    float complex * xs;         // carrier-corrected input (scratch)
+    float complex * xb;         // time-domain block buffer
+    float complex * Xb;         // frequency-domain block buffer
+    FFT_PLAN fft_block;         // batched transform
+
     // receiver state
     enum {
         OFDMFRAMESYNC_STATE_SEEKPLCP=0,   // seek initial PLCP
@@ -167,6 +195,8 @@ struct ofdmframesync_s {
     windowf debug_pilot_0;  // pilot polyfit history, p[0]
     windowf debug_pilot_1;  // pilot polyfit history, p[1]
 #endif
+
+    LIQUID_COUNTER_FIELD    // performance counters (when enabled)
 };
 
 // create OFDM framing synchronizer object
@@ -257,6 +287,29 @@ ofdmframesync ofdmframesync_create(unsigned int           _M,
     for (i=0; i<q->M; i++)
         q->B[i] = liquid_cexpjf(i*phi);
 
+    // subcarrier frequency indices and pilot locations for symbol recovery
+    q->pilots = (unsigned int*)  malloc((q->M_pilot)*sizeof(unsigned int));
+    q->fx     = (float*)         malloc((q->M)*sizeof(float));
+    q->theta  = (float*)         malloc((q->M)*sizeof(float));
+    q->ramp   = (float complex*) malloc((q->M)*sizeof(float complex));
+    unsigned int n = 0;
+    for (i=0; i<q->M; i++) {
+        q->fx[i] = (i > q->M2) ? (float)i - (float)(q->M) : (float)i;
+
+        // start at mid-point (effective fftshift)
+        unsigned int k = (i + q->M2) % q->M;
+        if (q->p[k] == OFDMFRAME_SCTYPE_PILOT)
+            q->pilots[n++] = k;
+    }
+
+    // receive one symbol at a time by default
+    q->block_size  = 1;
+    q->block_len   = 0;
+    q->input_index = 0;
+    q->xb          = NULL;
+    q->xs          = (float complex*) malloc((q->M + q->cp_len)*sizeof(float complex));
+    ofdmframesync_block_init(q);
+
     // set callback data
     q->callback = _callback;
     q->userdata = _userdata;
@@ -296,12 +349,18 @@ ofdmframesync ofdmframesync_create(unsigned int           _M,
     q->debug_pilot_1 = NULL;
 #endif
 
+    // register performance counters
+    LIQUID_COUNTER_REGISTER(q, "ofdmframesync");
+    LIQUID_COUNTER_ALLOC(q, sizeof(struct ofdmframesync_s) + 11*q->M*sizeof(float complex) + q->M);
+
     // return object
     return q;
 }
 
 int ofdmframesync_destroy(ofdmframesync _q)
 {
+    LIQUID_COUNTER_UNREGISTER(_q);
+
 #if DEBUG_OFDMFRAMESYNC
     // destroy debugging objects
     if (_q->debug_x         != NULL) windowcf_destroy(_q->debug_x);
@@ -336,6 +395,17 @@ int ofdmframesync_destroy(ofdmframesync _q)
     free(_q->B);
     free(_q->R);
 
+    // free symbol recovery and block receive arrays
+    free(_q->pilots);
+    free(_q->fx);
+    free(_q->theta);
+    free(_q->ramp);
+    free(_q->block_index);
+    free(_q->xs);
+    FFT_FREE(_q->xb);
+    FFT_FREE(_q->Xb);
+    FFT_DESTROY_PLAN(_q->fft_block);
+
     // destroy synchronizer objects
     nco_crcf_destroy(_q->nco_rx);           // numerically-controlled oscillator
     msequence_destroy(_q->ms_pilot);
@@ -378,6 +448,7 @@ int ofdmframesync_reset(ofdmframesync _q)
     _q->s_hat_1 = 0.0f;
     _q->phi_prime = 0.0f;
     _q->p1_prime = 0.0f;
+    _q->block_len = 0;
 
     // set thresholds (increase for small number of subcarriers)
     _q->plcp_detect_thresh = (_q->M > 44) ? 0.35f : 0.35f + 0.01f*(44 - _q->M);
@@ -397,50 +468,104 @@ int ofdmframesync_execute(ofdmframesync   _q,
                           float complex * _x,
                           unsigned int    _n)
 {
-    unsigned int i;
+    LIQUID_COUNTER_START(_q);
+    unsigned int i = 0;
     float complex x;
-    for (i=0; i<_n; i++) {
-        x = _x[i];
+    while (i < _n) {
+        for ( ; i<_n; i++) {
+            // receive payload: correct carrier offset and buffer all samples
+            // up to the next symbol boundary at once
+            if (_q->state == OFDMFRAMESYNC_STATE_RXSYMBOLS) {
+                unsigned int k = _n - i;
+                k = k < _q->timer           ? k : _q->timer;
+                k = k < _q->M + _q->cp_len  ? k : _q->M + _q->cp_len;
+                nco_crcf_mix_block_down(_q->nco_rx, &_x[i], _q->xs, k);
+                windowcf_write(_q->input_buffer, _q->xs, k);
+#if DEBUG_OFDMFRAMESYNC
+                if (_q->debug_enabled) {
+                    unsigned int j;
+                    for (j=0; j<k; j++) {
+                        windowcf_push(_q->debug_x, _q->xs[j]);
+                        windowf_push(_q->debug_rssi, crealf(_q->xs[j])*crealf(_q->xs[j]) + cimagf(_q->xs[j])*cimagf(_q->xs[j]));
+                    }
+                }
+#endif
+                i += k - 1;
+                _q->timer -= k - 1;
+                _q->input_index = i;
+                ofdmframesync_execute_rxsymbols(_q);
+
+                // recover full block; if frame ended early, resume search
+                // for next frame after its last symbol
+                if (_q->block_len == _q->block_size && _q->block_size > 1)
+                    i = ofdmframesync_rxblock(_q, i);
+                continue;
+            }
 
-        // correct for carrier frequency offset
-        if (_q->state != OFDMFRAMESYNC_STATE_SEEKPLCP) {
-            nco_crcf_mix_down(_q->nco_rx, x, &x);
-            nco_crcf_step(_q->nco_rx);
-        }
+            x = _x[i];
+
+            // correct for carrier frequency offset
+            if (_q->state != OFDMFRAMESYNC_STATE_SEEKPLCP) {
+                nco_crcf_mix_down(_q->nco_rx, x, &x);
+                nco_crcf_step(_q->nco_rx);
+            }
 
-        // save input sample to buffer
-        windowcf_push(_q->input_buffer,x);
+            // save input sample to buffer
+            windowcf_push(_q->input_buffer,x);
 
 #if DEBUG_OFDMFRAMESYNC
-        if (_q->debug_enabled) {
-            windowcf_push(_q->debug_x, x);
-            windowf_push(_q->debug_rssi, crealf(x)*crealf(x) + cimagf(x)*cimagf(x));
-        }
+            if (_q->debug_enabled) {
+                windowcf_push(_q->debug_x, x);
+                windowf_push(_q->debug_rssi, crealf(x)*crealf(x) + cimagf(x)*cimagf(x));
+            }
 #endif
 
-        switch (_q->state) {
-        case OFDMFRAMESYNC_STATE_SEEKPLCP:
-            ofdmframesync_execute_seekplcp(_q);
-            break;
-        case OFDMFRAMESYNC_STATE_PLCPSHORT0:
-            ofdmframesync_execute_S0a(_q);
-            break;
-        case OFDMFRAMESYNC_STATE_PLCPSHORT1:
-            ofdmframesync_execute_S0b(_q);
-            break;
-        case OFDMFRAMESYNC_STATE_PLCPLONG:
-            ofdmframesync_execute_S1(_q);
-            break;
-        case OFDMFRAMESYNC_STATE_RXSYMBOLS:
-            ofdmframesync_execute_rxsymbols(_q);
-            break;
-        default:;
-        }
+            switch (_q->state) {
+            case OFDMFRAMESYNC_STATE_SEEKPLCP:
+                ofdmframesync_execute_seekplcp(_q);
+                break;
+            case OFDMFRAMESYNC_STATE_PLCPSHORT0:
+                ofdmframesync_execute_S0a(_q);
+                break;
+            case OFDMFRAMESYNC_STATE_PLCPSHORT1:
+                ofdmframesync_execute_S0b(_q);
+                break;
+            case OFDMFRAMESYNC_STATE_PLCPLONG:
+                ofdmframesync_execute_S1(_q);
+                break;
+            default:;
+            }
 
-    } // for (i=0; i<_n; i++)
+        } // for ( ; i<_n; i++)
+
+        // recover partial block so symbols are not held between calls
+        if (_q->block_len > 0)
+            i = ofdmframesync_rxblock(_q, _n-1) + 1;
+    }
+    LIQUID_COUNTER_STOP(_q, _n);
     return LIQUID_OK;
 } // ofdmframesync_execute()
 
+// set number of payload symbols to transform and recover as a block
+int ofdmframesync_set_block_size(ofdmframesync _q,
+                                 unsigned int  _block_size)
+{
+    if (_block_size == 0)
+        return liquid_error(LIQUID_EICONFIG,"ofdmframesync_set_block_size(), block size must be greater than zero");
+
+    if (_q->block_len > 0)
+        return liquid_error(LIQUID_EIRANGE,"ofdmframesync_set_block_size(), cannot resize block while symbols are buffered");
+
+    _q->block_size = _block_size;
+    return ofdmframesync_block_init(_q);
+}
+
+// get number of payload symbols transformed and recovered as a block
+unsigned int ofdmframesync_get_block_size(ofdmframesync _q)
+{
+    return _q->block_size;
+}
+
 // get receiver RSSI
 float ofdmframesync_get_rssi(ofdmframesync _q)
 {
@@ -734,10 +859,10 @@ int ofdmframesync_execute_S1(ofdmframesync _q)
 #endif
 
 #if 1
-        // compute composite gain
+        // compute composite gain (zero on null subcarriers)
         unsigned int i;
         for (i=0; i<_q->M; i++)
-            _q->R[i] = _q->B[i] / _q->G[i];
+            _q->R[i] = _q->p[i] == OFDMFRAME_SCTYPE_NULL ? 0.0f : _q->B[i] / _q->G[i];
 #endif
         return LIQUID_OK;
     }
@@ -762,14 +887,24 @@ int ofdmframesync_execute_rxsymbols(ofdmframesync _q)
 
     if (_q->timer == 0) {
 
-        // run fft
+        // reset timer
+        _q->timer = _q->M + _q->cp_len;
+
         float complex * rc;
         windowcf_read(_q->input_buffer, &rc);
+        if (_q->block_size > 1) {
+            // buffer symbol for batched transform
+            memmove(&_q->xb[_q->block_len*_q->M], &rc[_q->cp_len-_q->backoff], (_q->M)*sizeof(float complex));
+            _q->block_index[_q->block_len++] = _q->input_index;
+            return LIQUID_OK;
+        }
+
+        // run fft
         memmove(_q->x, &rc[_q->cp_len-_q->backoff], (_q->M)*sizeof(float complex));
         FFT_EXECUTE(_q->fft);
 
         // recover symbol in internal _q->X buffer
-        ofdmframesync_rxsymbol(_q);
+        ofdmframesync_rxsymbol(_q, _q->X);
 
 #if DEBUG_OFDMFRAMESYNC
         if (_q->debug_enabled) {
@@ -787,10 +922,75 @@ int ofdmframesync_execute_rxsymbols(ofdmframesync _q)
             if (retval != 0)
                 ofdmframesync_reset(_q);
         }
+    }
+    return LIQUID_OK;
+}
 
-        // reset timer
-        _q->timer = _q->M + _q->cp_len;
+// transform and recover buffered block of symbols, invoking callback
+// for each; returns index of input sample at which frame ended, or _n
+// if all symbols were accepted
+unsigned int ofdmframesync_rxblock(ofdmframesync _q,
+                                   unsigned int  _n)
+{
+    unsigned int i, num_symbols = _q->block_len;
+    _q->block_len = 0;
+
+    // run all transforms at once for full block, otherwise one at a time
+    if (num_symbols == _q->block_size)
+        FFT_EXECUTE(_q->fft_block);
+
+    for (i=0; i<num_symbols; i++) {
+        float complex * X = &_q->Xb[i*_q->M];
+        if (num_symbols < _q->block_size) {
+            memmove(_q->x, &_q->xb[i*_q->M], (_q->M)*sizeof(float complex));
+            FFT_EXECUTE(_q->fft);
+            X = _q->X;
+        }
+
+        // recover symbol
+        ofdmframesync_rxsymbol(_q, X);
+
+#if DEBUG_OFDMFRAMESYNC
+        if (_q->debug_enabled) {
+            unsigned int k;
+            for (k=0; k<_q->M; k++) {
+                if (_q->p[k] == OFDMFRAME_SCTYPE_DATA)
+                    windowcf_push(_q->debug_framesyms, X[k]);
+            }
+        }
+#endif
+        // invoke callback
+        if (_q->callback != NULL && _q->callback(X, _q->p, _q->M, _q->userdata) != 0)
+            ofdmframesync_reset(_q);
+
+        // discard remaining symbols if frame has ended, either by the
+        // return value or by the callback resetting the synchronizer
+        if (_q->state != OFDMFRAMESYNC_STATE_RXSYMBOLS)
+            return _q->block_index[i];
+    }
+    return _n;
+}
+
+// (re-)allocate block receive buffers and transform
+int ofdmframesync_block_init(ofdmframesync _q)
+{
+    // free existing buffers, if any
+    if (_q->xb != NULL) {
+        free(_q->block_index);
+        FFT_FREE(_q->xb);
+        FFT_FREE(_q->Xb);
+        FFT_DESTROY_PLAN(_q->fft_block);
     }
+
+    // symbols are stored contiguously and transformed in place
+    unsigned int n = _q->block_size * _q->M;
+    _q->block_index = (unsigned int*)  malloc(_q->block_size*sizeof(unsigned int));
+    _q->xb          = (float complex*) FFT_MALLOC(n*sizeof(float complex));
+    _q->Xb          = (float complex*) FFT_MALLOC(n*sizeof(float complex));
+    _q->fft_block   = FFT_CREATE_PLAN_MANY(_q->M, _q->block_size,
+                                           _q->xb, 1, _q->M,
+                                           _q->Xb, 1, _q->M,
+                                           FFT_DIR_FORWARD, FFT_METHOD);
     return LIQUID_OK;
 }
 
@@ -1026,50 +1226,36 @@ int ofdmframesync_estimate_eqgain_poly(ofdmframesync _q,
 }
 
 // recover symbol, correcting for gain, pilot phase, etc.
-int ofdmframesync_rxsymbol(ofdmframesync _q)
+int ofdmframesync_rxsymbol(ofdmframesync   _q,
+                           float complex * _X)
 {
     // apply gain
     unsigned int i;
-    for (i=0; i<_q->M; i++)
-        _q->X[i] *= _q->R[i];
+    liquid_vectorcf_mul(_X, _q->R, _q->M, _X);
 
     // polynomial curve-fit
     float x_phase[_q->M_pilot];
     float y_phase[_q->M_pilot];
     float p_phase[2];
 
-    unsigned int n=0;
     unsigned int k;
     float complex pilot = 1.0f;
-    for (i=0; i<_q->M; i++) {
-
-        // start at mid-point (effective fftshift)
-        k = (i + _q->M2) % _q->M;
-
-        if (_q->p[k]==OFDMFRAME_SCTYPE_PILOT) {
-            if (n == _q->M_pilot)
-                return liquid_error(LIQUID_EINT,"ofdmframesync_estimate_eqgain_poly(), pilot subcarrier mismatch");
+    for (i=0; i<_q->M_pilot; i++) {
+        // pilots stored starting at mid-point (effective fftshift)
+        k = _q->pilots[i];
 
-            pilot = (msequence_advance(_q->ms_pilot) ? 1.0f : -1.0f);
+        pilot = (msequence_advance(_q->ms_pilot) ? 1.0f : -1.0f);
 #if 0
-            printf("pilot[%3u] = %12.4e + j*%12.4e (expected %12.4e + j*%12.4e)\n",
-                    k,
-                    crealf(_q->X[k]), cimagf(_q->X[k]),
-                    crealf(pilot),    cimagf(pilot));
+        printf("pilot[%3u] = %12.4e + j*%12.4e (expected %12.4e + j*%12.4e)\n",
+                k,
+                crealf(_X[k]), cimagf(_X[k]),
+                crealf(pilot), cimagf(pilot));
 #endif
-            // store resulting...
-            x_phase[n] = (k > _q->M2) ? (float)k - (float)(_q->M) : (float)k;
-            y_phase[n] = cargf(_q->X[k]*conjf(pilot));
-
-            // update counter
-            n++;
-
-        }
+        // store resulting...
+        x_phase[i] = _q->fx[k];
+        y_phase[i] = cargf(_X[k]*conjf(pilot));
     }
 
-    if (n != _q->M_pilot)
-        return liquid_error(LIQUID_EINT,"ofdmframesync_estimate_eqgain_poly(), pilot subcarrier mismatch");
-
     // try to unwrap phase
     liquid_unwrap_phase(y_phase, _q->M_pilot);
 
@@ -1096,18 +1282,12 @@ int ofdmframesync_rxsymbol(ofdmframesync _q)
     }
 #endif
 
-    // compensate for phase offset
-    // TODO : find more computationally efficient way to do this
-    for (i=0; i<_q->M; i++) {
-        // only apply to data/pilot subcarriers
-        if (_q->p[i] == OFDMFRAME_SCTYPE_NULL) {
-            _q->X[i] = 0.0f;
-        } else {
-            float fx    = (i > _q->M2) ? (float)i - (float)(_q->M) : (float)i;
-            float theta = polyf_val(p_phase, 2, fx);
-            _q->X[i] *= liquid_cexpjf(-theta);
-        }
-    }
+    // compensate for phase offset: X[i] *= exp{-j(p0 + p1*fx[i])}; null
+    // subcarriers are already zero from gain
+    liquid_vectorf_mulscalar(_q->fx, _q->M, -p_phase[1], _q->theta);
+    liquid_vectorf_addscalar(_q->theta, _q->M, -p_phase[0], _q->theta);
+    liquid_vectorcf_cexpj(_q->theta, _q->M, _q->ramp);
+    liquid_vectorcf_mul(_X, _q->ramp, _q->M, _X);
 
     // adjust NCO frequency based on differential phase
     if (_q->num_symbols > 0) {
@@ -21,8 +21,9 @@
  */
 
 #include <assert.h>
+#include <string.h>
 #include "liquid.autotest.h"
-#include "liquid.h"
+#include "liquid.internal.h"
 
 LIQUID_AUTOTEST(firpfbch_crcf_analysis,"validate firpfbch analysis correctness","",0.1)
 {
@@ -133,3 +134,182 @@ LIQUID_AUTOTEST(firpfbch_crcf_analysis,"validate firpfbch analysis correctness",
     }
 }
 
+
+// compare batched analyzer against running analyzer in place one block at
+// a time, feeding the batched analyzer with batches of varying size
+void testbench_firpfbch_crcf_analyzer_block(liquid_autotest __q__,
+                                            unsigned int    _M,
+                                            unsigned int    _m)
+{
+    float tol = 1e-5f;
+    unsigned int num_blocks = 40;
+    unsigned int num_samples = _M * num_blocks;
+
+    // create filterbank objects
+    firpfbch_crcf q0 = firpfbch_crcf_create_kaiser(LIQUID_ANALYZER, _M, _m, 60.0f);
+    firpfbch_crcf q1 = firpfbch_crcf_create_kaiser(LIQUID_ANALYZER, _M, _m, 60.0f);
+
+    // generate input sequence (complex noise)
+    float complex x[num_samples];
+    float complex y0[num_samples];
+    float complex y1[num_samples];
+    unsigned int i;
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run in place, one block at a time
+    memmove(y0, x, num_samples*sizeof(float complex));
+    for (i=0; i<num_blocks; i++)
+        firpfbch_crcf_analyzer_execute(q0, &y0[i*_M], &y0[i*_M]);
+
+    // run batches of varying size: 1, 2, ..., 7, 1, 2, ...
+    unsigned int k = 0;
+    unsigned int K = 1;
+    while (k < num_blocks) {
+        K = K > num_blocks - k ? num_blocks - k : K;
+        firpfbch_crcf_analyzer_execute_block(q1, &x[k*_M], K, &y1[k*_M]);
+        k += K;
+        K = (K % 7) + 1;
+    }
+
+    // compare results
+    for (i=0; i<num_samples; i++)
+        LIQUID_CHECK_DELTA(cabsf(y0[i] - y1[i]), 0.0f, tol*cabsf(y0[i]) + tol);
+
+    firpfbch_crcf_destroy(q0);
+    firpfbch_crcf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(firpfbch_crcf_analysis_block_4_2,  "batched analyzer","",0.1) { testbench_firpfbch_crcf_analyzer_block(__q__,   4, 2); }
+LIQUID_AUTOTEST(firpfbch_crcf_analysis_block_17_3, "batched analyzer","",0.1) { testbench_firpfbch_crcf_analyzer_block(__q__,  17, 3); }
+LIQUID_AUTOTEST(firpfbch_crcf_analysis_block_100_4,"batched analyzer","",0.1) { testbench_firpfbch_crcf_analyzer_block(__q__, 100, 4); }
+LIQUID_AUTOTEST(firpfbch_crcf_analysis_block_256_2,"batched analyzer","",0.1) { testbench_firpfbch_crcf_analyzer_block(__q__, 256, 2); }
+
+
+// check if runtime is available on this machine
+int firpfbch_autotest_runtime_available(liquid_runtime_t _runtime)
+{
+    struct liquid_cpuinfo_s impl;
+    memset(&impl, 0x00, sizeof(struct liquid_cpuinfo_s));
+    switch (_runtime) {
+    case LIQUID_RUNTIME_PORT:                       break;
+    case LIQUID_RUNTIME_NEON:   impl.neon   = true; break;
+    case LIQUID_RUNTIME_AVX2:   impl.avx2   = true; break;
+    default:;
+    }
+    return liquid_runtime_detect(&impl) == _runtime;
+}
+
+// compare batched analyzer with specific runtime against portable version
+void testbench_firpfbch_crcf_analyzer_runtime(liquid_autotest  __q__,
+                                              unsigned int     _M,
+                                              liquid_runtime_t _runtime)
+{
+    if (!firpfbch_autotest_runtime_available(_runtime)) {
+        LIQUID_WARN("runtime unavailable on this machine");
+        return;
+    }
+    float tol = 1e-5f;
+    unsigned int num_blocks  = 12;
+    unsigned int num_samples = _M * num_blocks;
+
+    // create filterbank objects
+    firpfbch_crcf q0 = firpfbch_crcf_create_kaiser(LIQUID_ANALYZER, _M, 3, 60.0f);
+    firpfbch_crcf q1 = firpfbch_crcf_create_kaiser(LIQUID_ANALYZER, _M, 3, 60.0f);
+    LIQUID_CHECK(firpfbch_crcf_runtime_select(q0, LIQUID_RUNTIME_PORT) == LIQUID_OK);
+    LIQUID_CHECK(firpfbch_crcf_runtime_select(q1, _runtime)            == LIQUID_OK);
+
+    // generate input sequence (complex noise)
+    float complex * x  = (float complex*) malloc(num_samples*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(num_samples*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(num_samples*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run in two batches
+    firpfbch_crcf_analyzer_execute_block(q0, x, num_blocks, y0);
+    firpfbch_crcf_analyzer_execute_block(q1, x, 5, y1);
+    firpfbch_crcf_analyzer_execute_block(q1, &x[5*_M], num_blocks-5, &y1[5*_M]);
+
+    // compare results
+    for (i=0; i<num_samples; i++)
+        LIQUID_CHECK_DELTA(cabsf(y0[i] - y1[i]), 0.0f, tol*cabsf(y0[i]) + tol);
+
+    free(x);
+    free(y0);
+    free(y1);
+    firpfbch_crcf_destroy(q0);
+    firpfbch_crcf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(firpfbch_crcf_analysis_runtime_port_67,  "analyzer kernel","",0.1) { testbench_firpfbch_crcf_analyzer_runtime(__q__,  67, LIQUID_RUNTIME_PORT); }
+LIQUID_AUTOTEST(firpfbch_crcf_analysis_runtime_neon_67,  "analyzer kernel","",0.1) { testbench_firpfbch_crcf_analyzer_runtime(__q__,  67, LIQUID_RUNTIME_NEON); }
+LIQUID_AUTOTEST(firpfbch_crcf_analysis_runtime_avx2_67,  "analyzer kernel","",0.1) { testbench_firpfbch_crcf_analyzer_runtime(__q__,  67, LIQUID_RUNTIME_AVX2); }
+LIQUID_AUTOTEST(firpfbch_crcf_analysis_runtime_neon_256, "analyzer kernel","",0.1) { testbench_firpfbch_crcf_analyzer_runtime(__q__, 256, LIQUID_RUNTIME_NEON); }
+LIQUID_AUTOTEST(firpfbch_crcf_analysis_runtime_avx2_256, "analyzer kernel","",0.1) { testbench_firpfbch_crcf_analyzer_runtime(__q__, 256, LIQUID_RUNTIME_AVX2); }
+
+// compare complex-coefficient analyzer with specific runtime against
+// portable version
+void testbench_firpfbch_cccf_analyzer_runtime(liquid_autotest  __q__,
+                                              unsigned int     _M,
+                                              liquid_runtime_t _runtime)
+{
+    if (!firpfbch_autotest_runtime_available(_runtime)) {
+        LIQUID_WARN("runtime unavailable on this machine");
+        return;
+    }
+    float tol = 1e-5f;
+    unsigned int p           = 6;
+    unsigned int num_blocks  = 12;
+    unsigned int num_samples = _M * num_blocks;
+
+    // create filterbank objects with complex coefficients
+    unsigned int i;
+    float complex h[_M*p];
+    for (i=0; i<_M*p; i++)
+        h[i] = randnf() + _Complex_I*randnf();
+    firpfbch_cccf q0 = firpfbch_cccf_create(LIQUID_ANALYZER, _M, p, h);
+    firpfbch_cccf q1 = firpfbch_cccf_create(LIQUID_ANALYZER, _M, p, h);
+    LIQUID_CHECK(firpfbch_cccf_runtime_select(q0, LIQUID_RUNTIME_PORT) == LIQUID_OK);
+    LIQUID_CHECK(firpfbch_cccf_runtime_select(q1, _runtime)            == LIQUID_OK);
+
+    // generate input sequence (complex noise)
+    float complex * x  = (float complex*) malloc(num_samples*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(num_samples*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(num_samples*sizeof(float complex));
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run in two batches
+    firpfbch_cccf_analyzer_execute_block(q0, x, num_blocks, y0);
+    firpfbch_cccf_analyzer_execute_block(q1, x, 5, y1);
+    firpfbch_cccf_analyzer_execute_block(q1, &x[5*_M], num_blocks-5, &y1[5*_M]);
+
+    // compare results
+    for (i=0; i<num_samples; i++)
+        LIQUID_CHECK_DELTA(cabsf(y0[i] - y1[i]), 0.0f, tol*cabsf(y0[i]) + tol);
+
+    free(x);
+    free(y0);
+    free(y1);
+    firpfbch_cccf_destroy(q0);
+    firpfbch_cccf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(firpfbch_cccf_analysis_runtime_port_67,  "analyzer kernel","",0.1) { testbench_firpfbch_cccf_analyzer_runtime(__q__,  67, LIQUID_RUNTIME_PORT); }
+LIQUID_AUTOTEST(firpfbch_cccf_analysis_runtime_neon_67,  "analyzer kernel","",0.1) { testbench_firpfbch_cccf_analyzer_runtime(__q__,  67, LIQUID_RUNTIME_NEON); }
+LIQUID_AUTOTEST(firpfbch_cccf_analysis_runtime_avx2_67,  "analyzer kernel","",0.1) { testbench_firpfbch_cccf_analyzer_runtime(__q__,  67, LIQUID_RUNTIME_AVX2); }
+LIQUID_AUTOTEST(firpfbch_cccf_analysis_runtime_neon_256, "analyzer kernel","",0.1) { testbench_firpfbch_cccf_analyzer_runtime(__q__, 256, LIQUID_RUNTIME_NEON); }
+LIQUID_AUTOTEST(firpfbch_cccf_analysis_runtime_avx2_256, "analyzer kernel","",0.1) { testbench_firpfbch_cccf_analyzer_runtime(__q__, 256, LIQUID_RUNTIME_AVX2); }
+
+// invalid runtime selection falls back to portable version
+LIQUID_AUTOTEST(firpfbch_crcf_runtime_config,"","",0.1)
+{
+    _liquid_error_downgrade_enable();
+    firpfbch_crcf q = firpfbch_crcf_create_kaiser(LIQUID_ANALYZER, 16, 2, 60.0f);
+    LIQUID_CHECK(firpfbch_crcf_runtime_select(q, LIQUID_RUNTIME_AMX) != LIQUID_OK);
+    LIQUID_CHECK(firpfbch_crcf_runtime_select(q, LIQUID_RUNTIME_PORT) == LIQUID_OK);
+    firpfbch_crcf_destroy(q);
+    _liquid_error_downgrade_disable();
+}
@@ -143,6 +143,134 @@ LIQUID_AUTOTEST(ofdmframesync_acquire_n128,"","",0.1)  { testbench_ofdmframesync
 LIQUID_AUTOTEST(ofdmframesync_acquire_n256,"","",0.1)  { testbench_ofdmframesync_acquire(__q__,256, 32, 0); }
 LIQUID_AUTOTEST(ofdmframesync_acquire_n512,"","",0.1)  { testbench_ofdmframesync_acquire(__q__,512, 64, 0); }
 
+// block receive test context
+struct ofdmframesync_block_autotest_s {
+    float complex * X;          // transmitted data symbol
+    unsigned int    num_symbols;// number of data symbols per frame
+    unsigned int    count;      // number of symbols received
+    unsigned int    num_frames; // number of frames received
+    float           rmse;       // maximum error on data subcarriers
+    ofdmframesync   fs;         // synchronizer to reset at end of frame
+};
+
+// check received symbol and end frame after last data symbol
+int ofdmframesync_block_autotest_callback(float complex * _X,
+                                          unsigned char * _p,
+                                          unsigned int    _M,
+                                          void *          _userdata)
+{
+    struct ofdmframesync_block_autotest_s * c = (struct ofdmframesync_block_autotest_s *) _userdata;
+    unsigned int i;
+    for (i=0; i<_M; i++) {
+        if (_p[i] == OFDMFRAME_SCTYPE_DATA) {
+            float e = cabsf(_X[i] - c->X[i]);
+            c->rmse = e > c->rmse ? e : c->rmse;
+        } else if (_p[i] == OFDMFRAME_SCTYPE_NULL && _X[i] != 0.0f) {
+            c->rmse = 1e3f;
+        }
+    }
+    c->count++;
+    if ((c->count % c->num_symbols) != 0)
+        return 0;
+    c->num_frames++;
+
+    // end frame by resetting synchronizer directly, if requested
+    if (c->fs != NULL) {
+        ofdmframesync_reset(c->fs);
+        return 0;
+    }
+    return 1;
+}
+
+// receive back-to-back frames with payload symbols transformed in blocks
+//  _num_subcarriers    :   number of subcarriers
+//  _block_size         :   number of symbols per block
+//  _chunk              :   number of samples per call to execute()
+//  _reset              :   end frame with reset in callback rather than return value
+void testbench_ofdmframesync_block(liquid_autotest __q__,
+                                   unsigned int _num_subcarriers,
+                                   unsigned int _block_size,
+                                   unsigned int _chunk,
+                                   int          _reset)
+{
+    unsigned int M           = _num_subcarriers;
+    unsigned int cp_len      = M / 8;
+    unsigned int num_symbols = 7;
+    unsigned int num_frames  = 3;
+    unsigned int frame_len   = (3 + num_symbols)*(M + cp_len);
+    unsigned int num_samples = num_frames*frame_len + 2*(M + cp_len);
+    float        dphi        = 0.3f / (float)M;
+
+    ofdmframegen fg = ofdmframegen_create(M, cp_len, 0, NULL);
+    float complex X[M];
+    struct ofdmframesync_block_autotest_s c = {X, num_symbols, 0, 0, 0.0f, NULL};
+    ofdmframesync fs = ofdmframesync_create(M, cp_len, 0, NULL,
+            ofdmframesync_block_autotest_callback, (void*)&c);
+    c.fs = _reset ? fs : NULL;
+    LIQUID_CHECK(ofdmframesync_set_block_size(fs, _block_size) == LIQUID_OK);
+    LIQUID_CHECK(ofdmframesync_get_block_size(fs) == _block_size);
+
+    // same data symbol repeated through each frame
+    unsigned int i, j;
+    for (i=0; i<M; i++)
+        X[i] = cexpf(_Complex_I*2*M_PI*randf());
+
+    // assemble frames back to back, followed by silence
+    float complex * y = (float complex*) malloc(num_samples*sizeof(float complex));
+    unsigned int n = 0;
+    for (i=0; i<num_frames; i++) {
+        ofdmframegen_reset(fg);
+        ofdmframegen_write_S0a(fg, &y[n]); n += M + cp_len;
+        ofdmframegen_write_S0b(fg, &y[n]); n += M + cp_len;
+        ofdmframegen_write_S1 (fg, &y[n]); n += M + cp_len;
+        for (j=0; j<num_symbols; j++) {
+            ofdmframegen_writesymbol(fg, X, &y[n]);
+            n += M + cp_len;
+        }
+    }
+    for ( ; n<num_samples; n++)
+        y[n] = 0.0f;
+
+    // add carrier offset
+    for (i=0; i<num_samples; i++)
+        y[i] *= cexpf(_Complex_I*dphi*i);
+
+    // run receiver in chunks
+    for (i=0; i<num_samples; i+=_chunk)
+        ofdmframesync_execute(fs, &y[i], i+_chunk > num_samples ? num_samples-i : _chunk);
+
+    LIQUID_CHECK(c.num_frames == num_frames);
+    LIQUID_CHECK(c.count      == num_frames*num_symbols);
+    LIQUID_CHECK_DELTA(c.rmse, 0.0f, 0.1f);
+
+    free(y);
+    ofdmframegen_destroy(fg);
+    ofdmframesync_destroy(fs);
+}
+
+LIQUID_AUTOTEST(ofdmframesync_block_n64_b1,  "","",0.1) { testbench_ofdmframesync_block(__q__,  64, 1, 100000, 0); }
+LIQUID_AUTOTEST(ofdmframesync_block_n64_b4,  "","",0.1) { testbench_ofdmframesync_block(__q__,  64, 4, 100000, 0); }
+LIQUID_AUTOTEST(ofdmframesync_block_n64_b4c, "","",0.1) { testbench_ofdmframesync_block(__q__,  64, 4,    100, 0); }
+LIQUID_AUTOTEST(ofdmframesync_block_n256_b3, "","",0.1) { testbench_ofdmframesync_block(__q__, 256, 3, 100000, 0); }
+LIQUID_AUTOTEST(ofdmframesync_block_n256_b8, "","",0.1) { testbench_ofdmframesync_block(__q__, 256, 8,   1000, 0); }
+
+// frames ended by callback resetting synchronizer (as ofdmflexframesync does)
+LIQUID_AUTOTEST(ofdmframesync_block_reset_n64_b1,  "","",0.1) { testbench_ofdmframesync_block(__q__,  64, 1, 100000, 1); }
+LIQUID_AUTOTEST(ofdmframesync_block_reset_n64_b4,  "","",0.1) { testbench_ofdmframesync_block(__q__,  64, 4, 100000, 1); }
+LIQUID_AUTOTEST(ofdmframesync_block_reset_n64_b4c, "","",0.1) { testbench_ofdmframesync_block(__q__,  64, 4,    100, 1); }
+LIQUID_AUTOTEST(ofdmframesync_block_reset_n256_b8, "","",0.1) { testbench_ofdmframesync_block(__q__, 256, 8,   1000, 1); }
+
+LIQUID_AUTOTEST(ofdmframesync_block_config,"","",0.1)
+{
+    _liquid_error_downgrade_enable();
+    ofdmframesync q = ofdmframesync_create(64, 16, 4, NULL, NULL, NULL);
+    LIQUID_CHECK(ofdmframesync_get_block_size(q) == 1);
+    LIQUID_CHECK(ofdmframesync_set_block_size(q, 0) != LIQUID_OK);
+    LIQUID_CHECK(ofdmframesync_get_block_size(q) == 1);
+    ofdmframesync_destroy(q);
+    _liquid_error_downgrade_disable();
+}
+
 LIQUID_AUTOTEST(ofdmframe_common_config,"","",0.1)
 {
     _liquid_error_downgrade_enable();
@@ -99,3 +99,48 @@ void benchmark_nco_mix_block_up(struct rusage *_start,
     nco_crcf_destroy(p);
 }
 
+
+// helper function to keep code base small
+void nco_mix_block_bench(struct rusage *     _start,
+                         struct rusage *     _finish,
+                         unsigned long int * _num_iterations,
+                         int                 _type,
+                         unsigned int        _n)
+{
+    // normalize number of iterations to block length
+    *_num_iterations = *_num_iterations * 16 / _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float complex x[_n], y[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    nco_crcf p = nco_crcf_create(_type);
+    if (_type == LIQUID_VCO_DIRECT) {
+        nco_crcf_set_vcodirect_frequency(p, 7, 37);
+    } else {
+        nco_crcf_set_phase(p, 0.0f);
+        nco_crcf_set_frequency(p, 0.1f);
+    }
+
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        nco_crcf_mix_block_down(p, x, y, _n);
+    getrusage(RUSAGE_SELF, _finish);
+
+    *_num_iterations *= _n;
+    nco_crcf_destroy(p);
+}
+
+#define NCO_MIX_BLOCK_BENCH_API(TYPE,N)     \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ nco_mix_block_bench(_start, _finish, _num_iterations, TYPE, N); }
+
+void benchmark_nco_mix_block_n64    NCO_MIX_BLOCK_BENCH_API(LIQUID_NCO,          64)
+void benchmark_nco_mix_block_n256   NCO_MIX_BLOCK_BENCH_API(LIQUID_NCO,         256)
+void benchmark_nco_mix_block_n1024  NCO_MIX_BLOCK_BENCH_API(LIQUID_NCO,        1024)
+void benchmark_vcoi_mix_block_n256  NCO_MIX_BLOCK_BENCH_API(LIQUID_VCO_INTERP,  256)
+void benchmark_vcod_mix_block_n256  NCO_MIX_BLOCK_BENCH_API(LIQUID_VCO_DIRECT,  256)
@@ -43,6 +43,9 @@
 #define NCO_STATIC_LUT_THETA_ACCUM(theta) \
     ((uint32_t)(theta & ((1LLU << (NCO_STATIC_LUT_WORDBITS-NCO_STATIC_LUT_NBITS))-1)))
 
+// number of phasors generated at a time when mixing blocks
+#define NCO_MIX_BLOCK_LEN           (64)
+
 #define NCO_PLL_BANDWIDTH_DEFAULT   (0.1)
 #define NCO_PLL_GAIN_DEFAULT        (1000)
 
@@ -94,6 +97,16 @@ T NCO(_fp_cos)(T x);
 // compute index for sine/cosine look-up table
 unsigned int NCO(_static_index)(NCO() _q);
 
+// generate block of phasors exp{+/- j theta} and advance phase
+//  _q      : nco object
+//  _v      : output phasors, [size: _n x 1]
+//  _n      : number of phasors, _n <= NCO_MIX_BLOCK_LEN
+//  _down   : conjugate phasors (mixing down)
+int NCO(_phasor_block)(NCO()        _q,
+                       TC *         _v,
+                       unsigned int _n,
+                       int          _down);
+
 // create nco/vco object
 NCO() NCO(_create)(liquid_ncotype _type)
 {
@@ -609,7 +622,6 @@ int NCO(_mix_down)(NCO() _q,
 
 // Rotate input vector array up by NCO angle:
 //      y(t) = x(t) exp{+j (f*t + theta)}
-// TODO : implement NCO/VCO-specific versions
 //  _q      :   nco object
 //  _x      :   input array [size: _n x 1]
 //  _y      :   output sample [size: _n x 1]
@@ -619,36 +631,19 @@ int NCO(_mix_block_up)(NCO()        _q,
                        TC *         _y,
                        unsigned int _n)
 {
+    // generate phasors in blocks and apply with vector multiply
+    TC v[NCO_MIX_BLOCK_LEN];
     unsigned int i;
-    // FIXME: this method should be more efficient but is causing occasional
-    //        errors so instead favor slower but more reliable algorithm
-    //        (anyway it must be rewritten to work with LIQUID_VCO_DIRECT type)
-#if 0
-    T theta =   _q->theta;
-    T d_theta = _q->d_theta;
-    for (i=0; i<_n; i++) {
-        // multiply _x[i] by [cos(theta) + _Complex_I*sin(theta)]
-        _y[i] = _x[i] * liquid_cexpjf(theta);
-
-        theta += d_theta;
-    }
-
-    NCO(_set_phase)(_q, theta);
-#else
-    for (i=0; i<_n; i++) {
-        // mix single sample up
-        NCO(_mix_up)(_q, _x[i], &_y[i]);
-
-        // step NCO phase
-        NCO(_step)(_q);
+    for (i=0; i<_n; i+=NCO_MIX_BLOCK_LEN) {
+        unsigned int n = (_n-i) < NCO_MIX_BLOCK_LEN ? (_n-i) : NCO_MIX_BLOCK_LEN;
+        NCO(_phasor_block)(_q, v, n, 0);
+        VECTOR(_mul)(_x+i, v, n, _y+i);
     }
-#endif
     return LIQUID_OK;
 }
 
 // Rotate input vector array down by NCO angle:
 //      y(t) = x(t) exp{-j (f*t + theta)}
-// TODO : implement NCO/VCO-specific versions
 //  _q      :   nco object
 //  _x      :   input array [size: _n x 1]
 //  _y      :   output sample [size: _n x 1]
@@ -658,30 +653,14 @@ int NCO(_mix_block_down)(NCO()        _q,
                          TC *         _y,
                          unsigned int _n)
 {
+    // generate conjugate phasors in blocks and apply with vector multiply
+    TC v[NCO_MIX_BLOCK_LEN];
     unsigned int i;
-    // FIXME: this method should be more efficient but is causing occasional
-    //        errors so instead favor slower but more reliable algorithm
-    //        (anyway it must be rewritten to work with LIQUID_VCO_DIRECT type)
-#if 0
-    T theta =   _q->theta;
-    T d_theta = _q->d_theta;
-    for (i=0; i<_n; i++) {
-        // multiply _x[i] by [cos(-theta) + _Complex_I*sin(-theta)]
-        _y[i] = _x[i] * liquid_cexpjf(-theta);
-
-        theta += d_theta;
-    }
-
-    NCO(_set_phase)(_q, theta);
-#else
-    for (i=0; i<_n; i++) {
-        // mix single sample down
-        NCO(_mix_down)(_q, _x[i], &_y[i]);
-
-        // step NCO phase
-        NCO(_step)(_q);
+    for (i=0; i<_n; i+=NCO_MIX_BLOCK_LEN) {
+        unsigned int n = (_n-i) < NCO_MIX_BLOCK_LEN ? (_n-i) : NCO_MIX_BLOCK_LEN;
+        NCO(_phasor_block)(_q, v, n, 1);
+        VECTOR(_mul)(_x+i, v, n, _y+i);
     }
-#endif
     return LIQUID_OK;
 }
 
@@ -751,6 +730,74 @@ T NCO(_fp_cos)(T x)
     return COS(x * TFL(M_PI) / ((uint32_t)(INT32_MAX)+1));
 }
 
+// generate block of phasors exp{+/- j theta} and advance phase; the
+// values match NCO(_cexpf)() followed by NCO(_step)() for each sample,
+// but each type runs a branch-free loop over the phase accumulator
+int NCO(_phasor_block)(NCO()        _q,
+                       TC *         _v,
+                       unsigned int _n,
+                       int          _down)
+{
+    T sgn = _down ? TIL(-1) : TIL(1);
+    T s[NCO_MIX_BLOCK_LEN];
+    T c[NCO_MIX_BLOCK_LEN];
+    unsigned int i;
+    const unsigned int shift = NCO_STATIC_LUT_WORDBITS - NCO_STATIC_LUT_NBITS;
+    const uint32_t     theta = _q->theta;
+    const uint32_t   d_theta = _q->d_theta;
+
+    switch (_q->type) {
+    case LIQUID_NCO: {
+        // rounded table index (see NCO(_static_index)())
+        const T * sintab = _q->nco_sintab;
+        for (i=0; i<_n; i++) {
+            uint32_t     t     = theta + (uint32_t)i*d_theta;
+            unsigned int index = ((t + (1u << (shift-1))) >> shift) & (NCO_STATIC_LUT_SIZE-1);
+            s[i] = sintab[index];
+            c[i] = sintab[NCO_STATIC_LUT_INDEX_SHIFTED_PI2(index)];
+        }
+        _q->theta = theta + (uint32_t)_n*d_theta;
+        break;
+    }
+    case LIQUID_VCO_INTERP: {
+        // truncated table index with linear interpolation
+        const vco_tab_e * sintab = _q->vcoi_sintab;
+        for (i=0; i<_n; i++) {
+            uint32_t     t       = theta + (uint32_t)i*d_theta;
+            uint32_t     t_pi2   = NCO_STATIC_LUT_THETA_SHIFTED_PI2(t);
+            unsigned int index   = (t >> shift) & (NCO_STATIC_LUT_SIZE-1);
+            unsigned int index_c = NCO_STATIC_LUT_INDEX_SHIFTED_PI2(index);
+            s[i] = sintab[index  ].value + NCO_STATIC_LUT_THETA_ACCUM(t    ) * sintab[index  ].skew;
+            c[i] = sintab[index_c].value + NCO_STATIC_LUT_THETA_ACCUM(t_pi2) * sintab[index_c].skew;
+        }
+        _q->theta = theta + (uint32_t)_n*d_theta;
+        break;
+    }
+    case LIQUID_VCO_DIRECT: {
+        // copy runs of the direct tables, wrapping the index
+        unsigned int k = 0;
+        while (k < _n) {
+            unsigned int r = _q->vcod_m - _q->vcod_index;
+            r = (_n-k) < r ? (_n-k) : r;
+            memmove(s+k, _q->vcod_sintab + _q->vcod_index, r*sizeof(T));
+            memmove(c+k, _q->vcod_costab + _q->vcod_index, r*sizeof(T));
+            k += r;
+            _q->vcod_index += r;
+            if (_q->vcod_index == _q->vcod_m)
+                _q->vcod_index = 0;
+        }
+        break;
+    }
+    default:
+        return liquid_error(LIQUID_EIMODE,"nco_%s_phasor_block(), unknown type: %u", EXTENSION, _q->type);
+    }
+
+    // interleave into complex phasors
+    for (i=0; i<_n; i++)
+        _v[i] = c[i] + _Complex_I*(sgn*s[i]);
+    return LIQUID_OK;
+}
+
 unsigned int NCO(_static_index)(NCO() _q)
 {
     /* TODO: LIQUID_NCO and LIQUID_VCO_INTERP are expected to share same code.
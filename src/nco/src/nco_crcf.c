@@ -28,6 +28,7 @@
 
 #define NCO(name)   LIQUID_CONCAT(nco_crcf,name)
 #define SYNTH(name) LIQUID_CONCAT(synth_crcf,name)
+#define VECTOR(name) LIQUID_CONCAT(liquid_vectorcf,name)
 #define EXTENSION   "crcf"
 #define T           float
 #define TC          float complex
@@ -90,3 +90,78 @@ LIQUID_AUTOTEST(nco_crcf_mix_vco_7,"","",0.1) { testbench_nco_crcf_mix(__q__,LIQ
 LIQUID_AUTOTEST(nco_crcf_mix_vco_8,"","",0.1) { testbench_nco_crcf_mix(__q__,LIQUID_VCO,  0.000f, -0.123f); }
 LIQUID_AUTOTEST(nco_crcf_mix_vco_9,"","",0.1) { testbench_nco_crcf_mix(__q__,LIQUID_VCO,  0.000f,  1e-5f ); }
 
+
+// compare block mixing against mixing one sample at a time, running the
+// block methods on irregular block sizes to check phase continuity
+void testbench_nco_crcf_mix_block(liquid_autotest __q__,
+                                  int             _type,
+                                  float           _frequency,
+                                  int             _down)
+{
+    // options
+    unsigned int buf_len = 1200;
+    float        tol     = 1e-6f;
+
+    // create objects and initialize
+    nco_crcf q0 = nco_crcf_create(_type);
+    nco_crcf q1 = nco_crcf_create(_type);
+    if (_type == LIQUID_VCO_DIRECT) {
+        nco_crcf_set_vcodirect_frequency(q0, 7, 37);
+        nco_crcf_set_vcodirect_frequency(q1, 7, 37);
+    } else {
+        nco_crcf_set_phase    (q0, 0.3f);
+        nco_crcf_set_phase    (q1, 0.3f);
+        nco_crcf_set_frequency(q0, _frequency);
+        nco_crcf_set_frequency(q1, _frequency);
+    }
+
+    // generate signal (pseudo-random)
+    float complex buf_0[buf_len];
+    float complex buf_1[buf_len];
+    float complex buf_2[buf_len];
+    unsigned int i;
+    for (i=0; i<buf_len; i++)
+        buf_0[i] = cexpf(_Complex_I*2*M_PI*randf());
+
+    // mix one sample at a time
+    for (i=0; i<buf_len; i++) {
+        if (_down) nco_crcf_mix_down(q0, buf_0[i], &buf_1[i]);
+        else       nco_crcf_mix_up  (q0, buf_0[i], &buf_1[i]);
+        nco_crcf_step(q0);
+    }
+
+    // mix in blocks of irregular size
+    unsigned int block_sizes[] = {1, 7, 64, 65, 128, 3, 200};
+    unsigned int n = 0;
+    i = 0;
+    while (n < buf_len) {
+        unsigned int b = block_sizes[i++ % 7];
+        b = (n + b) > buf_len ? buf_len - n : b;
+        if (_down) nco_crcf_mix_block_down(q1, buf_0+n, buf_2+n, b);
+        else       nco_crcf_mix_block_up  (q1, buf_0+n, buf_2+n, b);
+        n += b;
+    }
+
+    // compare results
+    for (i=0; i<buf_len; i++) {
+        LIQUID_CHECK_DELTA( crealf(buf_2[i]), crealf(buf_1[i]), tol);
+        LIQUID_CHECK_DELTA( cimagf(buf_2[i]), cimagf(buf_1[i]), tol);
+    }
+
+    // ensure oscillators finished in the same state
+    float complex v0, v1;
+    nco_crcf_cexpf(q0, &v0);
+    nco_crcf_cexpf(q1, &v1);
+    LIQUID_CHECK( v0 == v1 );
+
+    // destroy objects
+    nco_crcf_destroy(q0);
+    nco_crcf_destroy(q1);
+}
+
+LIQUID_AUTOTEST(nco_crcf_mix_block_nco_up,     "","",0.1) { testbench_nco_crcf_mix_block(__q__,LIQUID_NCO,        0.123f, 0); }
+LIQUID_AUTOTEST(nco_crcf_mix_block_nco_down,   "","",0.1) { testbench_nco_crcf_mix_block(__q__,LIQUID_NCO,       -2.345f, 1); }
+LIQUID_AUTOTEST(nco_crcf_mix_block_vcoi_up,    "","",0.1) { testbench_nco_crcf_mix_block(__q__,LIQUID_VCO_INTERP, 1e-3f,  0); }
+LIQUID_AUTOTEST(nco_crcf_mix_block_vcoi_down,  "","",0.1) { testbench_nco_crcf_mix_block(__q__,LIQUID_VCO_INTERP, 3.000f, 1); }
+LIQUID_AUTOTEST(nco_crcf_mix_block_vcod_up,    "","",0.1) { testbench_nco_crcf_mix_block(__q__,LIQUID_VCO_DIRECT, 0.000f, 0); }
+LIQUID_AUTOTEST(nco_crcf_mix_block_vcod_down,  "","",0.1) { testbench_nco_crcf_mix_block(__q__,LIQUID_VCO_DIRECT, 0.000f, 1); }
@@ -20,6 +20,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+#include <math.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -68,3 +70,90 @@ void benchmark_vectorcf_64      VECTORCF_BENCHMARK_API(64)
 void benchmark_vectorcf_256     VECTORCF_BENCHMARK_API(256)
 void benchmark_vectorcf_1024    VECTORCF_BENCHMARK_API(1024)
 
+// operations for runtime benchmarks
+typedef enum {
+    VECTORCF_BENCH_MUL,
+    VECTORCF_BENCH_CEXPJ,
+    VECTORCF_BENCH_CARG,
+    VECTORCF_BENCH_ABS,
+} vectorcf_bench_op;
+
+// benchmark a single operation on 1024 samples for a particular runtime
+void vectorcf_runtime_bench(struct rusage *     _start,
+                            struct rusage *     _finish,
+                            unsigned long int * _num_iterations,
+                            vectorcf_bench_op   _op,
+                            liquid_runtime_t    _runtime)
+{
+    // check if runtime is available on this machine
+    struct liquid_cpuinfo_s impl;
+    memset(&impl, 0x00, sizeof(struct liquid_cpuinfo_s));
+    switch (_runtime) {
+    case LIQUID_RUNTIME_NEON:   impl.neon   = true; break;
+    case LIQUID_RUNTIME_AVX2:   impl.avx2   = true; break;
+    case LIQUID_RUNTIME_AVX512: impl.avx512 = true; break;
+    default:;
+    }
+    if (liquid_runtime_detect(&impl) != _runtime) {
+        getrusage(RUSAGE_SELF, _start);
+        memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
+        return;
+    }
+
+    // normalize number of iterations
+    unsigned int n = 1024;
+    *_num_iterations = *_num_iterations * 20 / n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // allocate buffers
+    float complex buf_0[n];
+    float complex buf_1[n];
+    float complex buf_2[n];
+    float theta[n];
+    unsigned int i;
+    for (i=0; i<n; i++) {
+        buf_0[i] = randnf() + _Complex_I*randnf();
+        buf_1[i] = randnf() + _Complex_I*randnf();
+        theta[i] = 2*M_PI*randf();
+    }
+    liquid_vectorcf_runtime_select(_runtime);
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        switch (_op) {
+        case VECTORCF_BENCH_MUL  : liquid_vectorcf_mul(buf_0, buf_1, n, buf_2); break;
+        case VECTORCF_BENCH_CEXPJ: liquid_vectorcf_cexpj(theta, n, buf_2); break;
+        case VECTORCF_BENCH_CARG : liquid_vectorcf_carg(buf_0, n, theta); buf_2[0] = theta[0]; break;
+        case VECTORCF_BENCH_ABS  : liquid_vectorcf_abs(buf_0, n, theta); buf_2[0] = theta[0]; break;
+        }
+
+        // ensure the compiler doesn't optimize this out
+        buf_0[i % n] += buf_2[0] * 1e-6f;
+    }
+    *_num_iterations *= n;
+    getrusage(RUSAGE_SELF, _finish);
+
+    // restore automatic selection
+    liquid_vectorcf_runtime_detect();
+}
+
+#define VECTORCF_RUNTIME_BENCHMARK_API(OP,RUNTIME)  \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ vectorcf_runtime_bench(_start, _finish, _num_iterations, OP, RUNTIME); }
+
+void benchmark_vectorcf_mul_port         VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_MUL, LIQUID_RUNTIME_PORT)
+void benchmark_vectorcf_mul_avx2         VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_MUL, LIQUID_RUNTIME_AVX2)
+void benchmark_vectorcf_mul_avx512       VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_MUL, LIQUID_RUNTIME_AVX512)
+void benchmark_vectorcf_cexpj_port       VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_CEXPJ, LIQUID_RUNTIME_PORT)
+void benchmark_vectorcf_cexpj_avx2       VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_CEXPJ, LIQUID_RUNTIME_AVX2)
+void benchmark_vectorcf_cexpj_avx512     VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_CEXPJ, LIQUID_RUNTIME_AVX512)
+void benchmark_vectorcf_carg_port        VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_CARG, LIQUID_RUNTIME_PORT)
+void benchmark_vectorcf_carg_avx2        VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_CARG, LIQUID_RUNTIME_AVX2)
+void benchmark_vectorcf_carg_avx512      VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_CARG, LIQUID_RUNTIME_AVX512)
+void benchmark_vectorcf_abs_port         VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_ABS, LIQUID_RUNTIME_PORT)
+void benchmark_vectorcf_abs_avx2         VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_ABS, LIQUID_RUNTIME_AVX2)
+void benchmark_vectorcf_abs_avx512       VECTORCF_RUNTIME_BENCHMARK_API(VECTORCF_BENCH_ABS, LIQUID_RUNTIME_AVX512)
+
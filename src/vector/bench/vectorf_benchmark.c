@@ -20,6 +20,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+#include <math.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -68,3 +70,84 @@ void benchmark_vectorf_64      VECTORF_BENCHMARK_API(64)
 void benchmark_vectorf_256     VECTORF_BENCHMARK_API(256)
 void benchmark_vectorf_1024    VECTORF_BENCHMARK_API(1024)
 
+// operations for runtime benchmarks
+typedef enum {
+    VECTORF_BENCH_MUL,
+    VECTORF_BENCH_ABS,
+    VECTORF_BENCH_NORM,
+} vectorf_bench_op;
+
+// benchmark a single operation on 1024 samples for a particular runtime
+void vectorf_runtime_bench(struct rusage *     _start,
+                           struct rusage *     _finish,
+                           unsigned long int * _num_iterations,
+                           vectorf_bench_op    _op,
+                           liquid_runtime_t    _runtime)
+{
+    // check if runtime is available on this machine
+    struct liquid_cpuinfo_s impl;
+    memset(&impl, 0x00, sizeof(struct liquid_cpuinfo_s));
+    switch (_runtime) {
+    case LIQUID_RUNTIME_AVX2:   impl.avx2   = true; break;
+    case LIQUID_RUNTIME_AVX512: impl.avx512 = true; break;
+    default:;
+    }
+    if (liquid_runtime_detect(&impl) != _runtime) {
+        getrusage(RUSAGE_SELF, _start);
+        memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
+        return;
+    }
+
+    // normalize number of iterations
+    unsigned int n = 1024;
+    *_num_iterations = *_num_iterations * 20 / n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // allocate buffers
+    float buf_0[n];
+    float buf_1[n];
+    float buf_2[n];
+    float theta[n];
+    unsigned int i;
+    for (i=0; i<n; i++) {
+        buf_0[i] = randnf();
+        buf_1[i] = randnf();
+        theta[i] = 2*M_PI*randf();
+    }
+    liquid_vectorf_runtime_select(_runtime);
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        switch (_op) {
+        case VECTORF_BENCH_MUL  : liquid_vectorf_mul(buf_0, buf_1, n, buf_2); break;
+        case VECTORF_BENCH_ABS  : liquid_vectorf_abs(buf_0, n, theta); buf_2[0] = theta[0]; break;
+        case VECTORF_BENCH_NORM : buf_2[0] = liquid_vectorf_norm(buf_0, n); break;
+        }
+
+        // ensure the compiler doesn't optimize this out
+        buf_0[i % n] += buf_2[0] * 1e-6f;
+    }
+    *_num_iterations *= n;
+    getrusage(RUSAGE_SELF, _finish);
+
+    // restore automatic selection
+    liquid_vectorf_runtime_detect();
+}
+
+#define VECTORF_RUNTIME_BENCHMARK_API(OP,RUNTIME)  \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ vectorf_runtime_bench(_start, _finish, _num_iterations, OP, RUNTIME); }
+
+void benchmark_vectorf_mul_port         VECTORF_RUNTIME_BENCHMARK_API(VECTORF_BENCH_MUL, LIQUID_RUNTIME_PORT)
+void benchmark_vectorf_mul_avx2         VECTORF_RUNTIME_BENCHMARK_API(VECTORF_BENCH_MUL, LIQUID_RUNTIME_AVX2)
+void benchmark_vectorf_mul_avx512       VECTORF_RUNTIME_BENCHMARK_API(VECTORF_BENCH_MUL, LIQUID_RUNTIME_AVX512)
+void benchmark_vectorf_abs_port         VECTORF_RUNTIME_BENCHMARK_API(VECTORF_BENCH_ABS, LIQUID_RUNTIME_PORT)
+void benchmark_vectorf_abs_avx2         VECTORF_RUNTIME_BENCHMARK_API(VECTORF_BENCH_ABS, LIQUID_RUNTIME_AVX2)
+void benchmark_vectorf_abs_avx512       VECTORF_RUNTIME_BENCHMARK_API(VECTORF_BENCH_ABS, LIQUID_RUNTIME_AVX512)
+void benchmark_vectorf_norm_port        VECTORF_RUNTIME_BENCHMARK_API(VECTORF_BENCH_NORM, LIQUID_RUNTIME_PORT)
+void benchmark_vectorf_norm_avx2        VECTORF_RUNTIME_BENCHMARK_API(VECTORF_BENCH_NORM, LIQUID_RUNTIME_AVX2)
+void benchmark_vectorf_norm_avx512      VECTORF_RUNTIME_BENCHMARK_API(VECTORF_BENCH_NORM, LIQUID_RUNTIME_AVX512)
+
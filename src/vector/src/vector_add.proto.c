@@ -33,10 +33,10 @@
 //  _y      :   second array [size: _n x 1]
 //  _n      :   array lengths
 //  _z      :   output array pointer [size: _n x 1]
-void VECTOR(_add)(T *          _x,
-                  T *          _y,
-                  unsigned int _n,
-                  T *          _z)
+void VECTOR(_add_port)(T *          _x,
+                       T *          _y,
+                       unsigned int _n,
+                       T *          _z)
 {
     // t = 4*(floor(_n/4))
     unsigned int t=(_n>>2)<<2; 
@@ -60,10 +60,10 @@ void VECTOR(_add)(T *          _x,
 //  _n      :   array length
 //  _v      :   scalar
 //  _y      :   output array pointer [size: _n x 1]
-void VECTOR(_addscalar)(T *          _x,
-                        unsigned int _n,
-                        T            _v,
-                        T *          _y)
+void VECTOR(_addscalar_port)(T *          _x,
+                             unsigned int _n,
+                             T            _v,
+                             T *          _y)
 {
     // t = 4*(floor(_n/4))
     unsigned int t=(_n>>2)<<2; 
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Generic vector dot products
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+// conjugate of input type
+#if T_COMPLEX
+#  define VECTOR_CONJ(x) conjf(x)
+#else
+#  define VECTOR_CONJ(x) (x)
+#endif
+
+// conjugate dot product, unrolling loop
+//  _x      :   first array  [size: _n x 1]
+//  _y      :   second array [size: _n x 1]
+//  _n      :   array lengths
+T VECTOR(_dotprod_conj_port)(T *          _x,
+                             T *          _y,
+                             unsigned int _n)
+{
+    // t = 4*(floor(_n/4))
+    unsigned int t=(_n>>2)<<2;
+
+    // compute in groups of 4
+    T r = 0;
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        r += VECTOR_CONJ(_x[i  ]) * _y[i  ];
+        r += VECTOR_CONJ(_x[i+1]) * _y[i+1];
+        r += VECTOR_CONJ(_x[i+2]) * _y[i+2];
+        r += VECTOR_CONJ(_x[i+3]) * _y[i+3];
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        r += VECTOR_CONJ(_x[i]) * _y[i];
+
+    return r;
+}
+
+// update array in place and compute conjugate dot product with result
+//  _w      :   input/output array [size: _n x 1]
+//  _n      :   array lengths
+//  _a      :   scalar
+//  _u      :   update array  [size: _n x 1]
+//  _v      :   second array for dot product [size: _n x 1]
+T VECTOR(_axpy_dotprod_conj_port)(T *          _w,
+                                  unsigned int _n,
+                                  T            _a,
+                                  T *          _u,
+                                  T *          _v)
+{
+    // t = 4*(floor(_n/4))
+    unsigned int t=(_n>>2)<<2;
+
+    // compute in groups of 4
+    T r = 0;
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        _w[i  ] += _a * _u[i  ];
+        _w[i+1] += _a * _u[i+1];
+        _w[i+2] += _a * _u[i+2];
+        _w[i+3] += _a * _u[i+3];
+        r += VECTOR_CONJ(_w[i  ]) * _v[i  ];
+        r += VECTOR_CONJ(_w[i+1]) * _v[i+1];
+        r += VECTOR_CONJ(_w[i+2]) * _v[i+2];
+        r += VECTOR_CONJ(_w[i+3]) * _v[i+3];
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++) {
+        _w[i] += _a * _u[i];
+        r += VECTOR_CONJ(_w[i]) * _v[i];
+    }
+
+    return r;
+}
+
+#undef VECTOR_CONJ
@@ -32,8 +32,8 @@
 // compute l2-norm on vector
 //  _x      :   input array [size: _n x 1]
 //  _n      :   array length
-TP VECTOR(_norm)(T *          _x,
-                 unsigned int _n)
+TP VECTOR(_norm_port)(T *          _x,
+                      unsigned int _n)
 {
     // t = 4*(floor(_n/4))
     unsigned int t=(_n>>2)<<2; 
@@ -65,12 +65,12 @@ TP VECTOR(_norm)(T *          _x,
 //  _x      :   input array [size: _n x 1]
 //  _n      :   array length
 //  _y      :   output array [size: _n x 1]
-void VECTOR(_normalize)(T *          _x,
-                        unsigned int _n,
-                        T *          _y)
+void VECTOR(_normalize_port)(T *          _x,
+                             unsigned int _n,
+                             T *          _y)
 {
     // compute l2-norm on vector
-    TP norm = VECTOR(_norm)(_x, _n);
+    TP norm = VECTOR(_norm_port)(_x, _n);
 
     // compute inverse
     TP norm_inv = 1.0 / norm;
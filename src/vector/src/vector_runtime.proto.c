@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Runtime selection of vector kernels
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdatomic.h>
+
+// kernels for a particular extension
+struct VECTOR(_kernels_s) {
+    void (*add)      (T *, T *, unsigned int, T *);
+    void (*addscalar)(T *, unsigned int, T, T *);
+    void (*mul)      (T *, T *, unsigned int, T *);
+    void (*mulscalar)(T *, unsigned int, T, T *);
+    void (*cexpj)    (TP *, unsigned int, T *);
+    void (*carg)     (T *, unsigned int, TP *);
+    void (*abs)      (T *, unsigned int, TP *);
+    TP   (*norm)     (T *, unsigned int);
+    void (*normalize)(T *, unsigned int, T *);
+    T    (*dotprod_conj)     (T *, T *, unsigned int);
+    T    (*axpy_dotprod_conj)(T *, unsigned int, T, T *, T *);
+};
+
+// define constant kernel table with portable kernels except for the
+// multiplies, which are taken from one extension
+#define LIQUID_VECTOR_DEFINE_KERNELS_MUL(EXT)                               \
+static const struct VECTOR(_kernels_s) VECTOR(_kernels_##EXT) = {           \
+    .add       = &VECTOR(_add_port),                                        \
+    .addscalar = &VECTOR(_addscalar_port),                                  \
+    .mul       = &VECTOR(_mul_##EXT),                                       \
+    .mulscalar = &VECTOR(_mulscalar_##EXT),                                 \
+    .cexpj     = &VECTOR(_cexpj_port),                                      \
+    .carg      = &VECTOR(_carg_port),                                       \
+    .abs       = &VECTOR(_abs_port),                                        \
+    .norm      = &VECTOR(_norm_port),                                       \
+    .normalize = &VECTOR(_normalize_port),                                  \
+    .dotprod_conj      = &VECTOR(_dotprod_conj_port),                      \
+    .axpy_dotprod_conj = &VECTOR(_axpy_dotprod_conj_port),                  \
+};
+
+// define constant kernel table with all kernels from one extension
+#define LIQUID_VECTOR_DEFINE_KERNELS_ALL(EXT)                               \
+static const struct VECTOR(_kernels_s) VECTOR(_kernels_##EXT) = {           \
+    .add       = &VECTOR(_add_##EXT),                                       \
+    .addscalar = &VECTOR(_addscalar_##EXT),                                 \
+    .mul       = &VECTOR(_mul_##EXT),                                       \
+    .mulscalar = &VECTOR(_mulscalar_##EXT),                                 \
+    .cexpj     = &VECTOR(_cexpj_##EXT),                                     \
+    .carg      = &VECTOR(_carg_##EXT),                                      \
+    .abs       = &VECTOR(_abs_##EXT),                                       \
+    .norm      = &VECTOR(_norm_##EXT),                                      \
+    .normalize = &VECTOR(_normalize_##EXT),                                 \
+    .dotprod_conj      = &VECTOR(_dotprod_conj_##EXT),                      \
+    .axpy_dotprod_conj = &VECTOR(_axpy_dotprod_conj_##EXT),                 \
+};
+
+LIQUID_VECTOR_DEFINE_KERNELS_ALL(port)
+LIQUID_VECTOR_DEFINE_KERNELS_ALL(avx2)
+LIQUID_VECTOR_DEFINE_KERNELS_ALL(avx512)
+#if T_COMPLEX
+LIQUID_VECTOR_DEFINE_KERNELS_MUL(neon)
+#endif
+
+// Kernel table shared by all callers, selected automatically on first use.
+// The tables themselves are constant, so switching between them is a
+// single atomic store and a concurrent caller always sees a complete table.
+static _Atomic(const struct VECTOR(_kernels_s) *) VECTOR(_kernels) = NULL;
+
+// look up kernel table for runtime, returning NULL if unavailable
+static const struct VECTOR(_kernels_s) * VECTOR(_runtime_kernels)(liquid_runtime_t _select)
+{
+    switch (_select) {
+    case LIQUID_RUNTIME_PORT:   return &VECTOR(_kernels_port);
+#if T_COMPLEX
+    case LIQUID_RUNTIME_NEON:   return &VECTOR(_kernels_neon);
+#endif
+    case LIQUID_RUNTIME_AVX2:   return &VECTOR(_kernels_avx2);
+    case LIQUID_RUNTIME_AVX512: return &VECTOR(_kernels_avx512);
+    default:;
+    }
+    return NULL;
+}
+
+// find best available runtime execution method
+static liquid_runtime_t VECTOR(_runtime_best)(void)
+{
+    // implementations
+    struct liquid_cpuinfo_s impl =
+    {
+        .altivec = 0,
+        .neon    = T_COMPLEX ? true : 0,
+        .mmx     = 0,
+        .sse     = 0,
+        .sse2    = 0,
+        .sse3    = 0,
+        .ssse3   = 0,
+        .sse41   = 0,
+        .sse42   = 0,
+        .avx     = 0,
+        .fma3    = 0,
+        .avx2    = true,
+        .avx512  = true,
+        .amx     = 0,
+        .amx101  = 0,
+        .amx102  = 0,
+    };
+
+    // given implementations, find best method
+    return liquid_runtime_detect(&impl);
+}
+
+// select runtime execution method
+int VECTOR(_runtime_select)(liquid_runtime_t _select)
+{
+    const struct VECTOR(_kernels_s) * k = VECTOR(_runtime_kernels)(_select);
+    if (k == NULL) {
+        atomic_store_explicit(&VECTOR(_kernels), &VECTOR(_kernels_port), memory_order_release);
+        return liquid_error(LIQUID_EINT,
+            "liquid_vector%s_runtime_select(), invalid selection or mode not available (%d), falling back to portable version",
+            EXTENSION_FULL, _select);
+    }
+    liquid_log_trace("liquid_vector%s_runtime_select(), %s", EXTENSION_FULL,
+        k == &VECTOR(_kernels_port) ? "port" :
+        k == &VECTOR(_kernels_avx2) ? "avx2" :
+        k == &VECTOR(_kernels_avx512) ? "avx512" : "neon");
+    atomic_store_explicit(&VECTOR(_kernels), k, memory_order_release);
+    return LIQUID_OK;
+}
+
+// detect runtime execution method
+int VECTOR(_runtime_detect)(void)
+{
+    // invoke selection method
+    return VECTOR(_runtime_select)(VECTOR(_runtime_best)());
+}
+
+// get kernel table, selecting best available on first use; an explicit
+// selection made concurrently by another thread takes precedence
+static const struct VECTOR(_kernels_s) * VECTOR(_get_kernels)(void)
+{
+    const struct VECTOR(_kernels_s) * k =
+        atomic_load_explicit(&VECTOR(_kernels), memory_order_acquire);
+    if (k != NULL)
+        return k;
+
+    const struct VECTOR(_kernels_s) * best = VECTOR(_runtime_kernels)(VECTOR(_runtime_best)());
+    if (best == NULL)
+        best = &VECTOR(_kernels_port);
+    if (atomic_compare_exchange_strong(&VECTOR(_kernels), &k, best))
+        return best;
+    return k;   // set by another thread in the meantime
+}
+
+// add each element pointwise: z[i] = x[i] + y[i]
+void VECTOR(_add)(T *          _x,
+                  T *          _y,
+                  unsigned int _n,
+                  T *          _z)
+{
+    VECTOR(_get_kernels)()->add(_x, _y, _n, _z);
+}
+
+// add scalar to each element: y[i] = x[i] + v
+void VECTOR(_addscalar)(T *          _x,
+                        unsigned int _n,
+                        T            _v,
+                        T *          _y)
+{
+    VECTOR(_get_kernels)()->addscalar(_x, _n, _v, _y);
+}
+
+// multiply each element pointwise: z[i] = x[i] * y[i]
+void VECTOR(_mul)(T *          _x,
+                  T *          _y,
+                  unsigned int _n,
+                  T *          _z)
+{
+    VECTOR(_get_kernels)()->mul(_x, _y, _n, _z);
+}
+
+// multiply each element with scalar: y[i] = x[i] * v
+void VECTOR(_mulscalar)(T *          _x,
+                        unsigned int _n,
+                        T            _v,
+                        T *          _y)
+{
+    VECTOR(_get_kernels)()->mulscalar(_x, _n, _v, _y);
+}
+
+// compute complex phase rotation: x[i] = exp{ j theta[i] }
+void VECTOR(_cexpj)(TP *         _theta,
+                    unsigned int _n,
+                    T *          _x)
+{
+    VECTOR(_get_kernels)()->cexpj(_theta, _n, _x);
+}
+
+// compute angle of each element: theta[i] = arg{ x[i] }
+void VECTOR(_carg)(T *          _x,
+                   unsigned int _n,
+                   TP *         _theta)
+{
+    VECTOR(_get_kernels)()->carg(_x, _n, _theta);
+}
+
+// compute absolute value of each element: y[i] = |x[i]|
+void VECTOR(_abs)(T *          _x,
+                  unsigned int _n,
+                  TP *         _y)
+{
+    VECTOR(_get_kernels)()->abs(_x, _n, _y);
+}
+
+// compute l2-norm on vector
+TP VECTOR(_norm)(T *          _x,
+                 unsigned int _n)
+{
+    return VECTOR(_get_kernels)()->norm(_x, _n);
+}
+
+// scale vector to its l2-norm
+void VECTOR(_normalize)(T *          _x,
+                        unsigned int _n,
+                        T *          _y)
+{
+    VECTOR(_get_kernels)()->normalize(_x, _n, _y);
+}
+
+// compute conjugate dot product: sum{ conj(x[i]) * y[i] }
+T VECTOR(_dotprod_conj)(T *          _x,
+                        T *          _y,
+                        unsigned int _n)
+{
+    return VECTOR(_get_kernels)()->dotprod_conj(_x, _y, _n);
+}
+
+// update in place, w[i] += a * u[i], and compute conjugate dot product
+// with the result: sum{ conj(w[i]) * v[i] }
+T VECTOR(_axpy_dotprod_conj)(T *          _w,
+                             unsigned int _n,
+                             T            _a,
+                             T *          _u,
+                             T *          _v)
+{
+    return VECTOR(_get_kernels)()->axpy_dotprod_conj(_w, _n, _a, _u, _v);
+}
+
+#undef LIQUID_VECTOR_DEFINE_KERNELS_MUL
+#undef LIQUID_VECTOR_DEFINE_KERNELS_ALL
@@ -0,0 +1,491 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// vector operations (AVX2), complex
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_AVX2
+
+// include proper SIMD extensions for x86 AVX2
+#include <immintrin.h>
+
+// largest phase for which the single-precision range reduction in sincos
+// is accurate; larger values are computed with the portable method
+#define LIQUID_VECTORCF_AVX2_SINCOS_MAX (8192.0f)
+
+// compute sine and cosine of eight angles (Cephes single-precision
+// polynomials with extended-precision octant reduction)
+static inline void __attribute__((target("avx2")))
+liquid_vectorcf_sincos_avx2(__m256   _x,
+                            __m256 * _s,
+                            __m256 * _c)
+{
+    __m256 sign     = _mm256_set1_ps(-0.0f);
+    __m256 sign_sin = _mm256_and_ps(_x, sign);
+    __m256 x        = _mm256_andnot_ps(sign, _x);
+
+    // octant j = floor(|x| * 4/pi), rounded up to even
+    __m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(1.27323954473516f)));
+    j = _mm256_add_epi32(j, _mm256_set1_epi32(1));
+    j = _mm256_and_si256(j, _mm256_set1_epi32(~1));
+    __m256 y = _mm256_cvtepi32_ps(j);
+
+    // signs and polynomial selection from octant
+    __m256i four = _mm256_set1_epi32(4);
+    __m256  swap_sin  = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, four), 29));
+    __m256  sign_cos  = _mm256_castsi256_ps(_mm256_slli_epi32(
+                            _mm256_andnot_si256(_mm256_sub_epi32(j, _mm256_set1_epi32(2)), four), 29));
+    __m256  poly_mask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+                            _mm256_and_si256(j, _mm256_set1_epi32(2)), _mm256_setzero_si256()));
+    sign_sin = _mm256_xor_ps(sign_sin, swap_sin);
+
+    // extended-precision reduction: x = |x| - j*pi/4
+    x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(0.78515625f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(2.4187564849853515625e-4f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(3.77489497744594108e-8f)));
+    __m256 z = _mm256_mul_ps(x, x);
+
+    // cosine polynomial on [-pi/4,pi/4]
+    __m256 yc = _mm256_set1_ps(2.443315711809948e-5f);
+    yc = _mm256_add_ps(_mm256_mul_ps(yc, z), _mm256_set1_ps(-1.388731625493765e-3f));
+    yc = _mm256_add_ps(_mm256_mul_ps(yc, z), _mm256_set1_ps( 4.166664568298827e-2f));
+    yc = _mm256_mul_ps(_mm256_mul_ps(yc, z), z);
+    yc = _mm256_sub_ps(yc, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+    yc = _mm256_add_ps(yc, _mm256_set1_ps(1.0f));
+
+    // sine polynomial on [-pi/4,pi/4]
+    __m256 ys = _mm256_set1_ps(-1.9515295891e-4f);
+    ys = _mm256_add_ps(_mm256_mul_ps(ys, z), _mm256_set1_ps( 8.3321608736e-3f));
+    ys = _mm256_add_ps(_mm256_mul_ps(ys, z), _mm256_set1_ps(-1.6666654611e-1f));
+    ys = _mm256_mul_ps(_mm256_mul_ps(ys, z), x);
+    ys = _mm256_add_ps(ys, x);
+
+    // select polynomials and apply signs
+    *_s = _mm256_xor_ps(_mm256_blendv_ps(yc, ys, poly_mask), sign_sin);
+    *_c = _mm256_xor_ps(_mm256_blendv_ps(ys, yc, poly_mask), sign_cos);
+}
+
+// compute four-quadrant arctangent of eight values (Cephes single-precision
+// polynomial after reduction to [0,tan(pi/8)])
+static inline __m256 __attribute__((target("avx2")))
+liquid_vectorcf_atan2_avx2(__m256 _y,
+                           __m256 _x)
+{
+    __m256 sign = _mm256_set1_ps(-0.0f);
+    __m256 one  = _mm256_set1_ps(1.0f);
+    __m256 ax   = _mm256_andnot_ps(sign, _x);
+    __m256 ay   = _mm256_andnot_ps(sign, _y);
+
+    // ratio in [0,1], forced to zero when both inputs are zero
+    __m256 mx = _mm256_max_ps(ax, ay);
+    __m256 a  = _mm256_div_ps(_mm256_min_ps(ax, ay), mx);
+    a = _mm256_and_ps(a, _mm256_cmp_ps(mx, _mm256_setzero_ps(), _CMP_GT_OQ));
+
+    // reduce using atan(a) = pi/4 + atan((a-1)/(a+1))
+    __m256 big = _mm256_cmp_ps(a, _mm256_set1_ps(0.414213562373095f), _CMP_GT_OQ);
+    __m256 r   = _mm256_blendv_ps(a, _mm256_div_ps(_mm256_sub_ps(a, one), _mm256_add_ps(a, one)), big);
+    __m256 z   = _mm256_mul_ps(r, r);
+
+    // polynomial
+    __m256 p = _mm256_set1_ps(8.05374449538e-2f);
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(-1.38776856032e-1f));
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps( 1.99777106478e-1f));
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(-3.33329491539e-1f));
+    p = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(p, z), r), r);
+    p = _mm256_add_ps(p, _mm256_and_ps(big, _mm256_set1_ps((float)M_PI/4)));
+
+    // map to full range: swap axes, reflect for negative x, then apply sign of y
+    __m256 swap = _mm256_cmp_ps(ay, ax, _CMP_GT_OQ);
+    p = _mm256_blendv_ps(p, _mm256_sub_ps(_mm256_set1_ps((float)M_PI/2), p), swap);
+    p = _mm256_blendv_ps(p, _mm256_sub_ps(_mm256_set1_ps((float)M_PI  ), p), _x);
+    return _mm256_xor_ps(p, _mm256_and_ps(_y, sign));
+}
+
+// complex multiplication of four pairs: (a+jb)(c+jd) = (ac-bd) + j(ad+bc)
+static inline __m256 __attribute__((target("avx2")))
+liquid_vectorcf_cmul_avx2(__m256 _a,
+                          __m256 _b_re,
+                          __m256 _b_im)
+{
+    // swap real/imaginary components of a: {b, a, ...}
+    __m256 a_swap = _mm256_permute_ps(_a, _MM_SHUFFLE(2,3,0,1));
+
+    // even: a*c - b*d, odd: b*c + a*d
+    return _mm256_addsub_ps(_mm256_mul_ps(_a, _b_re), _mm256_mul_ps(a_swap, _b_im));
+}
+
+// add each element pointwise: z[i] = x[i] + y[i]
+void __attribute__((target("avx2")))
+liquid_vectorcf_add_avx2(float complex * _x,
+                         float complex * _y,
+                         unsigned int    _n,
+                         float complex * _z)
+{
+    // operate on real and imaginary components independently
+    liquid_vectorf_add_avx2((float*)_x, (float*)_y, 2*_n, (float*)_z);
+}
+
+// add scalar to each element: y[i] = x[i] + v
+void __attribute__((target("avx2")))
+liquid_vectorcf_addscalar_avx2(float complex * _x,
+                               unsigned int    _n,
+                               float complex   _v,
+                               float complex * _y)
+{
+    float vr = crealf(_v);
+    float vi = cimagf(_v);
+    __m256 v = _mm256_setr_ps(vr, vi, vr, vi, vr, vi, vr, vi);
+
+    // t = 4*(floor(_n/4))
+    unsigned int t = (_n >> 2) << 2;
+    unsigned int i;
+    for (i=0; i<t; i+=4)
+        _mm256_storeu_ps((float*)&_y[i], _mm256_add_ps(_mm256_loadu_ps((float*)&_x[i]), v));
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_addscalar_port(_x+t, _n-t, _v, _y+t);
+}
+
+// multiply each element pointwise: z[i] = x[i] * y[i]
+void __attribute__((target("avx2")))
+liquid_vectorcf_mul_avx2(float complex * _x,
+                         float complex * _y,
+                         unsigned int    _n,
+                         float complex * _z)
+{
+    // t = 4*(floor(_n/4))
+    unsigned int t = (_n >> 2) << 2;
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        __m256 x = _mm256_loadu_ps((float*)&_x[i]);
+        __m256 y = _mm256_loadu_ps((float*)&_y[i]);
+        __m256 z = liquid_vectorcf_cmul_avx2(x, _mm256_moveldup_ps(y), _mm256_movehdup_ps(y));
+        _mm256_storeu_ps((float*)&_z[i], z);
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_mul_port(_x+t, _y+t, _n-t, _z+t);
+}
+
+// multiply each element with scalar: y[i] = x[i] * v
+void __attribute__((target("avx2")))
+liquid_vectorcf_mulscalar_avx2(float complex * _x,
+                               unsigned int    _n,
+                               float complex   _v,
+                               float complex * _y)
+{
+    __m256 v_re = _mm256_set1_ps(crealf(_v));
+    __m256 v_im = _mm256_set1_ps(cimagf(_v));
+
+    // t = 4*(floor(_n/4))
+    unsigned int t = (_n >> 2) << 2;
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        __m256 x = _mm256_loadu_ps((float*)&_x[i]);
+        _mm256_storeu_ps((float*)&_y[i], liquid_vectorcf_cmul_avx2(x, v_re, v_im));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_mulscalar_port(_x+t, _n-t, _v, _y+t);
+}
+
+// compute complex phase rotation: x[i] = exp{ j theta[i] }
+void __attribute__((target("avx2")))
+liquid_vectorcf_cexpj_avx2(float *         _theta,
+                           unsigned int    _n,
+                           float complex * _x)
+{
+    __m256 sign = _mm256_set1_ps(-0.0f);
+    __m256 tmax = _mm256_set1_ps(LIQUID_VECTORCF_AVX2_SINCOS_MAX);
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        __m256 theta = _mm256_loadu_ps(&_theta[i]);
+
+        // revert to portable method for large (or invalid) phase values
+        __m256 valid = _mm256_cmp_ps(_mm256_andnot_ps(sign, theta), tmax, _CMP_LE_OQ);
+        if (_mm256_movemask_ps(valid) != 0xff) {
+            liquid_vectorcf_cexpj_port(_theta+i, 8, _x+i);
+            continue;
+        }
+
+        __m256 s, c;
+        liquid_vectorcf_sincos_avx2(theta, &s, &c);
+
+        // interleave {c0,s0,c1,s1,...}
+        __m256 lo = _mm256_unpacklo_ps(c, s);
+        __m256 hi = _mm256_unpackhi_ps(c, s);
+        _mm256_storeu_ps((float*)&_x[i  ], _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps((float*)&_x[i+4], _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_cexpj_port(_theta+t, _n-t, _x+t);
+}
+
+// compute angle of each element: theta[i] = arg{ x[i] }
+void __attribute__((target("avx2")))
+liquid_vectorcf_carg_avx2(float complex * _x,
+                          unsigned int    _n,
+                          float *         _theta)
+{
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        __m256 v0 = _mm256_loadu_ps((float*)&_x[i  ]);
+        __m256 v1 = _mm256_loadu_ps((float*)&_x[i+4]);
+
+        // de-interleave real and imaginary components, restoring order
+        __m256 re = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2,0,2,0));
+        __m256 im = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3,1,3,1));
+        re = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(re), _MM_SHUFFLE(3,1,2,0)));
+        im = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(im), _MM_SHUFFLE(3,1,2,0)));
+
+        _mm256_storeu_ps(&_theta[i], liquid_vectorcf_atan2_avx2(im, re));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_carg_port(_x+t, _n-t, _theta+t);
+}
+
+// compute absolute value of each element: y[i] = |x[i]|
+void __attribute__((target("avx2")))
+liquid_vectorcf_abs_avx2(float complex * _x,
+                         unsigned int    _n,
+                         float *         _y)
+{
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        __m256 v0 = _mm256_loadu_ps((float*)&_x[i  ]);
+        __m256 v1 = _mm256_loadu_ps((float*)&_x[i+4]);
+
+        // sum squares of adjacent components, restoring order
+        __m256 s = _mm256_hadd_ps(_mm256_mul_ps(v0, v0), _mm256_mul_ps(v1, v1));
+        s = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(s), _MM_SHUFFLE(3,1,2,0)));
+
+        _mm256_storeu_ps(&_y[i], _mm256_sqrt_ps(s));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_abs_port(_x+t, _n-t, _y+t);
+}
+
+// compute l2-norm on vector
+float __attribute__((target("avx2")))
+liquid_vectorcf_norm_avx2(float complex * _x,
+                          unsigned int    _n)
+{
+    // operate on real and imaginary components independently
+    return liquid_vectorf_norm_avx2((float*)_x, 2*_n);
+}
+
+// scale vector to its l2-norm
+void __attribute__((target("avx2")))
+liquid_vectorcf_normalize_avx2(float complex * _x,
+                               unsigned int    _n,
+                               float complex * _y)
+{
+    // operate on real and imaginary components independently
+    liquid_vectorf_normalize_avx2((float*)_x, 2*_n, (float*)_y);
+}
+
+// reduce accumulators of products {xr*yr, xi*yi, ...} and swapped products
+// {xr*yi, xi*yr, ...} to conjugate dot product
+static inline float complex __attribute__((target("avx2")))
+liquid_vectorcf_dotprod_conj_reduce_avx2(__m256 _s,
+                                         __m256 _s_swap)
+{
+    // negate odd terms of swapped products for imaginary component
+    _s_swap = _mm256_mul_ps(_s_swap, _mm256_setr_ps(1,-1,1,-1,1,-1,1,-1));
+
+    // horizontal sums of both accumulators
+    __m256 s  = _mm256_hadd_ps(_s, _s_swap);
+    __m128 s4 = _mm_add_ps(_mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1));
+    s4 = _mm_hadd_ps(s4, s4);
+    float v[4];
+    _mm_storeu_ps(v, s4);
+    return v[0] + _Complex_I*v[1];
+}
+
+// conjugate dot product: sum{ conj(x[i]) * y[i] }
+float complex __attribute__((target("avx2")))
+liquid_vectorcf_dotprod_conj_avx2(float complex * _x,
+                                  float complex * _y,
+                                  unsigned int    _n)
+{
+    // accumulate products and swapped products in pairs of registers
+    __m256 s0 = _mm256_setzero_ps(), q0 = _mm256_setzero_ps();
+    __m256 s1 = _mm256_setzero_ps(), q1 = _mm256_setzero_ps();
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        __m256 x0 = _mm256_loadu_ps((float*)&_x[i  ]);
+        __m256 x1 = _mm256_loadu_ps((float*)&_x[i+4]);
+        __m256 y0 = _mm256_loadu_ps((float*)&_y[i  ]);
+        __m256 y1 = _mm256_loadu_ps((float*)&_y[i+4]);
+        s0 = _mm256_add_ps(s0, _mm256_mul_ps(x0, y0));
+        s1 = _mm256_add_ps(s1, _mm256_mul_ps(x1, y1));
+        q0 = _mm256_add_ps(q0, _mm256_mul_ps(x0, _mm256_permute_ps(y0, _MM_SHUFFLE(2,3,0,1))));
+        q1 = _mm256_add_ps(q1, _mm256_mul_ps(x1, _mm256_permute_ps(y1, _MM_SHUFFLE(2,3,0,1))));
+    }
+    float complex r = liquid_vectorcf_dotprod_conj_reduce_avx2(_mm256_add_ps(s0, s1),
+                                                               _mm256_add_ps(q0, q1));
+
+    // cleanup (residual values that do not fit in register)
+    for (; i<_n; i++)
+        r += conjf(_x[i]) * _y[i];
+
+    return r;
+}
+
+// update in place, w[i] += a * u[i], and compute conjugate dot product with
+// the result: sum{ conj(w[i]) * v[i] }
+float complex __attribute__((target("avx2")))
+liquid_vectorcf_axpy_dotprod_conj_avx2(float complex * _w,
+                                       unsigned int    _n,
+                                       float complex   _a,
+                                       float complex * _u,
+                                       float complex * _v)
+{
+    __m256 a_re = _mm256_set1_ps(crealf(_a));
+    __m256 a_im = _mm256_set1_ps(cimagf(_a));
+    __m256 s0 = _mm256_setzero_ps(), q0 = _mm256_setzero_ps();
+    __m256 s1 = _mm256_setzero_ps(), q1 = _mm256_setzero_ps();
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        __m256 w0 = _mm256_add_ps(_mm256_loadu_ps((float*)&_w[i  ]),
+                        liquid_vectorcf_cmul_avx2(_mm256_loadu_ps((float*)&_u[i  ]), a_re, a_im));
+        __m256 w1 = _mm256_add_ps(_mm256_loadu_ps((float*)&_w[i+4]),
+                        liquid_vectorcf_cmul_avx2(_mm256_loadu_ps((float*)&_u[i+4]), a_re, a_im));
+        _mm256_storeu_ps((float*)&_w[i  ], w0);
+        _mm256_storeu_ps((float*)&_w[i+4], w1);
+        __m256 v0 = _mm256_loadu_ps((float*)&_v[i  ]);
+        __m256 v1 = _mm256_loadu_ps((float*)&_v[i+4]);
+        s0 = _mm256_add_ps(s0, _mm256_mul_ps(w0, v0));
+        s1 = _mm256_add_ps(s1, _mm256_mul_ps(w1, v1));
+        q0 = _mm256_add_ps(q0, _mm256_mul_ps(w0, _mm256_permute_ps(v0, _MM_SHUFFLE(2,3,0,1))));
+        q1 = _mm256_add_ps(q1, _mm256_mul_ps(w1, _mm256_permute_ps(v1, _MM_SHUFFLE(2,3,0,1))));
+    }
+    float complex r = liquid_vectorcf_dotprod_conj_reduce_avx2(_mm256_add_ps(s0, s1),
+                                                               _mm256_add_ps(q0, q1));
+
+    // cleanup (residual values that do not fit in register)
+    for (; i<_n; i++) {
+        _w[i] += _a * _u[i];
+        r += conjf(_w[i]) * _v[i];
+    }
+    return r;
+}
+
+// build guard
+#else
+
+// invalidated; fall back to portable versions
+void liquid_vectorcf_add_avx2(float complex * _x, float complex * _y, unsigned int _n, float complex * _z)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorcf_add_port(_x, _y, _n, _z);
+}
+
+void liquid_vectorcf_addscalar_avx2(float complex * _x, unsigned int _n, float complex _v, float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorcf_addscalar_port(_x, _n, _v, _y);
+}
+
+void liquid_vectorcf_mul_avx2(float complex * _x, float complex * _y, unsigned int _n, float complex * _z)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorcf_mul_port(_x, _y, _n, _z);
+}
+
+void liquid_vectorcf_mulscalar_avx2(float complex * _x, unsigned int _n, float complex _v, float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorcf_mulscalar_port(_x, _n, _v, _y);
+}
+
+void liquid_vectorcf_cexpj_avx2(float * _theta, unsigned int _n, float complex * _x)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorcf_cexpj_port(_theta, _n, _x);
+}
+
+void liquid_vectorcf_carg_avx2(float complex * _x, unsigned int _n, float * _theta)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorcf_carg_port(_x, _n, _theta);
+}
+
+void liquid_vectorcf_abs_avx2(float complex * _x, unsigned int _n, float * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorcf_abs_port(_x, _n, _y);
+}
+
+float liquid_vectorcf_norm_avx2(float complex * _x, unsigned int _n)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    return liquid_vectorcf_norm_port(_x, _n);
+}
+
+void liquid_vectorcf_normalize_avx2(float complex * _x, unsigned int _n, float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorcf_normalize_port(_x, _n, _y);
+}
+
+
+float complex liquid_vectorcf_dotprod_conj_avx2(float complex * _x, float complex * _y, unsigned int _n)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    return liquid_vectorcf_dotprod_conj_port(_x, _y, _n);
+}
+
+float complex liquid_vectorcf_axpy_dotprod_conj_avx2(float complex * _w, unsigned int _n, float complex _a, float complex * _u, float complex * _v)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    return liquid_vectorcf_axpy_dotprod_conj_port(_w, _n, _a, _u, _v);
+}
+
+// build guard
+#endif
+
@@ -0,0 +1,497 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// vector operations (AVX-512), complex
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_AVX512
+
+// include proper SIMD extensions for x86 AVX-512
+#include <immintrin.h>
+
+// largest phase for which the single-precision range reduction in sincos
+// is accurate; larger values are computed with the portable method
+#define LIQUID_VECTORCF_AVX512_SINCOS_MAX (8192.0f)
+
+// flip sign bits of x where set in s
+static inline __m512 __attribute__((target("avx512f")))
+liquid_vectorcf_xorsign_avx512(__m512 _x,
+                               __m512 _s)
+{
+    return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_x),
+                                                _mm512_castps_si512(_s)));
+}
+
+// compute sine and cosine of sixteen angles (Cephes single-precision
+// polynomials with extended-precision octant reduction)
+static inline void __attribute__((target("avx512f")))
+liquid_vectorcf_sincos_avx512(__m512   _x,
+                              __m512 * _s,
+                              __m512 * _c)
+{
+    __m512i xi       = _mm512_castps_si512(_x);
+    __m512i signbit  = _mm512_set1_epi32(0x80000000);
+    __m512i sign_sin = _mm512_and_si512(xi, signbit);
+    __m512  x        = _mm512_castsi512_ps(_mm512_andnot_si512(signbit, xi));
+
+    // octant j = floor(|x| * 4/pi), rounded up to even
+    __m512i j = _mm512_cvttps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(1.27323954473516f)));
+    j = _mm512_add_epi32(j, _mm512_set1_epi32(1));
+    j = _mm512_and_si512(j, _mm512_set1_epi32(~1));
+    __m512 y = _mm512_cvtepi32_ps(j);
+
+    // signs and polynomial selection from octant
+    __m512i four = _mm512_set1_epi32(4);
+    __m512i sign_cos = _mm512_slli_epi32(
+                _mm512_andnot_si512(_mm512_sub_epi32(j, _mm512_set1_epi32(2)), four), 29);
+    sign_sin = _mm512_xor_si512(sign_sin, _mm512_slli_epi32(_mm512_and_si512(j, four), 29));
+    __mmask16 poly_mask = _mm512_testn_epi32_mask(j, _mm512_set1_epi32(2));
+
+    // extended-precision reduction: x = |x| - j*pi/4
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(0.78515625f), x);
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(2.4187564849853515625e-4f), x);
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(3.77489497744594108e-8f), x);
+    __m512 z = _mm512_mul_ps(x, x);
+
+    // cosine polynomial on [-pi/4,pi/4]
+    __m512 yc = _mm512_set1_ps(2.443315711809948e-5f);
+    yc = _mm512_fmadd_ps(yc, z, _mm512_set1_ps(-1.388731625493765e-3f));
+    yc = _mm512_fmadd_ps(yc, z, _mm512_set1_ps( 4.166664568298827e-2f));
+    yc = _mm512_mul_ps(_mm512_mul_ps(yc, z), z);
+    yc = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), yc);
+    yc = _mm512_add_ps(yc, _mm512_set1_ps(1.0f));
+
+    // sine polynomial on [-pi/4,pi/4]
+    __m512 ys = _mm512_set1_ps(-1.9515295891e-4f);
+    ys = _mm512_fmadd_ps(ys, z, _mm512_set1_ps( 8.3321608736e-3f));
+    ys = _mm512_fmadd_ps(ys, z, _mm512_set1_ps(-1.6666654611e-1f));
+    ys = _mm512_fmadd_ps(_mm512_mul_ps(ys, z), x, x);
+
+    // select polynomials and apply signs
+    *_s = liquid_vectorcf_xorsign_avx512(_mm512_mask_blend_ps(poly_mask, yc, ys),
+                                         _mm512_castsi512_ps(sign_sin));
+    *_c = liquid_vectorcf_xorsign_avx512(_mm512_mask_blend_ps(poly_mask, ys, yc),
+                                         _mm512_castsi512_ps(sign_cos));
+}
+
+// compute four-quadrant arctangent of sixteen values (Cephes single-precision
+// polynomial after reduction to [0,tan(pi/8)])
+static inline __m512 __attribute__((target("avx512f")))
+liquid_vectorcf_atan2_avx512(__m512 _y,
+                             __m512 _x)
+{
+    __m512 zero = _mm512_setzero_ps();
+    __m512 one  = _mm512_set1_ps(1.0f);
+    __m512 ax   = _mm512_abs_ps(_x);
+    __m512 ay   = _mm512_abs_ps(_y);
+
+    // ratio in [0,1], forced to zero when both inputs are zero
+    __m512 mx = _mm512_max_ps(ax, ay);
+    __mmask16 nonzero = _mm512_cmp_ps_mask(mx, zero, _CMP_GT_OQ);
+    __m512 a = _mm512_maskz_div_ps(nonzero, _mm512_min_ps(ax, ay), mx);
+
+    // reduce using atan(a) = pi/4 + atan((a-1)/(a+1))
+    __mmask16 big = _mm512_cmp_ps_mask(a, _mm512_set1_ps(0.414213562373095f), _CMP_GT_OQ);
+    __m512 r = _mm512_mask_div_ps(a, big, _mm512_sub_ps(a, one), _mm512_add_ps(a, one));
+    __m512 z = _mm512_mul_ps(r, r);
+
+    // polynomial
+    __m512 p = _mm512_set1_ps(8.05374449538e-2f);
+    p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(-1.38776856032e-1f));
+    p = _mm512_fmadd_ps(p, z, _mm512_set1_ps( 1.99777106478e-1f));
+    p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(-3.33329491539e-1f));
+    p = _mm512_fmadd_ps(_mm512_mul_ps(p, z), r, r);
+    p = _mm512_mask_add_ps(p, big, p, _mm512_set1_ps((float)M_PI/4));
+
+    // map to full range: swap axes, reflect for negative x, then apply sign of y
+    __mmask16 swap = _mm512_cmp_ps_mask(ay, ax, _CMP_GT_OQ);
+    __mmask16 neg  = _mm512_test_epi32_mask(_mm512_castps_si512(_x), _mm512_set1_epi32(0x80000000));
+    p = _mm512_mask_sub_ps(p, swap, _mm512_set1_ps((float)M_PI/2), p);
+    p = _mm512_mask_sub_ps(p, neg,  _mm512_set1_ps((float)M_PI  ), p);
+    return liquid_vectorcf_xorsign_avx512(p, _mm512_castsi512_ps(
+            _mm512_and_si512(_mm512_castps_si512(_y), _mm512_set1_epi32(0x80000000))));
+}
+
+// complex multiplication of eight pairs: (a+jb)(c+jd) = (ac-bd) + j(ad+bc)
+static inline __m512 __attribute__((target("avx512f")))
+liquid_vectorcf_cmul_avx512(__m512 _a,
+                            __m512 _b_re,
+                            __m512 _b_im)
+{
+    // swap real/imaginary components of a: {b, a, ...}
+    __m512 a_swap = _mm512_permute_ps(_a, _MM_SHUFFLE(2,3,0,1));
+
+    // even: a*c - b*d, odd: b*c + a*d
+    return _mm512_fmaddsub_ps(_a, _b_re, _mm512_mul_ps(a_swap, _b_im));
+}
+
+// add each element pointwise: z[i] = x[i] + y[i]
+void __attribute__((target("avx512f")))
+liquid_vectorcf_add_avx512(float complex * _x,
+                           float complex * _y,
+                           unsigned int    _n,
+                           float complex * _z)
+{
+    // operate on real and imaginary components independently
+    liquid_vectorf_add_avx512((float*)_x, (float*)_y, 2*_n, (float*)_z);
+}
+
+// add scalar to each element: y[i] = x[i] + v
+void __attribute__((target("avx512f")))
+liquid_vectorcf_addscalar_avx512(float complex * _x,
+                                 unsigned int    _n,
+                                 float complex   _v,
+                                 float complex * _y)
+{
+    float vr = crealf(_v);
+    float vi = cimagf(_v);
+    __m512 v = _mm512_setr_ps(vr, vi, vr, vi, vr, vi, vr, vi,
+                              vr, vi, vr, vi, vr, vi, vr, vi);
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8)
+        _mm512_storeu_ps((float*)&_y[i], _mm512_add_ps(_mm512_loadu_ps((float*)&_x[i]), v));
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_addscalar_port(_x+t, _n-t, _v, _y+t);
+}
+
+// multiply each element pointwise: z[i] = x[i] * y[i]
+void __attribute__((target("avx512f")))
+liquid_vectorcf_mul_avx512(float complex * _x,
+                           float complex * _y,
+                           unsigned int    _n,
+                           float complex * _z)
+{
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        __m512 x = _mm512_loadu_ps((float*)&_x[i]);
+        __m512 y = _mm512_loadu_ps((float*)&_y[i]);
+        __m512 z = liquid_vectorcf_cmul_avx512(x, _mm512_moveldup_ps(y), _mm512_movehdup_ps(y));
+        _mm512_storeu_ps((float*)&_z[i], z);
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_mul_port(_x+t, _y+t, _n-t, _z+t);
+}
+
+// multiply each element with scalar: y[i] = x[i] * v
+void __attribute__((target("avx512f")))
+liquid_vectorcf_mulscalar_avx512(float complex * _x,
+                                 unsigned int    _n,
+                                 float complex   _v,
+                                 float complex * _y)
+{
+    __m512 v_re = _mm512_set1_ps(crealf(_v));
+    __m512 v_im = _mm512_set1_ps(cimagf(_v));
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        __m512 x = _mm512_loadu_ps((float*)&_x[i]);
+        _mm512_storeu_ps((float*)&_y[i], liquid_vectorcf_cmul_avx512(x, v_re, v_im));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_mulscalar_port(_x+t, _n-t, _v, _y+t);
+}
+
+// compute complex phase rotation: x[i] = exp{ j theta[i] }
+void __attribute__((target("avx512f")))
+liquid_vectorcf_cexpj_avx512(float *         _theta,
+                             unsigned int    _n,
+                             float complex * _x)
+{
+    __m512 tmax = _mm512_set1_ps(LIQUID_VECTORCF_AVX512_SINCOS_MAX);
+
+    // interleaving indices {c0,s0,c1,s1,...}
+    __m512i idx_lo = _mm512_setr_epi32(0,16,1,17,2,18,3,19,4,20,5,21,6,22,7,23);
+    __m512i idx_hi = _mm512_setr_epi32(8,24,9,25,10,26,11,27,12,28,13,29,14,30,15,31);
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __m512 theta = _mm512_loadu_ps(&_theta[i]);
+
+        // revert to portable method for large (or invalid) phase values
+        if (_mm512_cmp_ps_mask(_mm512_abs_ps(theta), tmax, _CMP_LE_OQ) != 0xffff) {
+            liquid_vectorcf_cexpj_port(_theta+i, 16, _x+i);
+            continue;
+        }
+
+        __m512 s, c;
+        liquid_vectorcf_sincos_avx512(theta, &s, &c);
+        _mm512_storeu_ps((float*)&_x[i  ], _mm512_permutex2var_ps(c, idx_lo, s));
+        _mm512_storeu_ps((float*)&_x[i+8], _mm512_permutex2var_ps(c, idx_hi, s));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_cexpj_port(_theta+t, _n-t, _x+t);
+}
+
+// compute angle of each element: theta[i] = arg{ x[i] }
+void __attribute__((target("avx512f")))
+liquid_vectorcf_carg_avx512(float complex * _x,
+                            unsigned int    _n,
+                            float *         _theta)
+{
+    // de-interleaving indices
+    __m512i idx_re = _mm512_setr_epi32(0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30);
+    __m512i idx_im = _mm512_setr_epi32(1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31);
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __m512 v0 = _mm512_loadu_ps((float*)&_x[i  ]);
+        __m512 v1 = _mm512_loadu_ps((float*)&_x[i+8]);
+        __m512 re = _mm512_permutex2var_ps(v0, idx_re, v1);
+        __m512 im = _mm512_permutex2var_ps(v0, idx_im, v1);
+        _mm512_storeu_ps(&_theta[i], liquid_vectorcf_atan2_avx512(im, re));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_carg_port(_x+t, _n-t, _theta+t);
+}
+
+// compute absolute value of each element: y[i] = |x[i]|
+void __attribute__((target("avx512f")))
+liquid_vectorcf_abs_avx512(float complex * _x,
+                           unsigned int    _n,
+                           float *         _y)
+{
+    // de-interleaving indices
+    __m512i idx_re = _mm512_setr_epi32(0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30);
+    __m512i idx_im = _mm512_setr_epi32(1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31);
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __m512 v0 = _mm512_loadu_ps((float*)&_x[i  ]);
+        __m512 v1 = _mm512_loadu_ps((float*)&_x[i+8]);
+        __m512 re = _mm512_permutex2var_ps(v0, idx_re, v1);
+        __m512 im = _mm512_permutex2var_ps(v0, idx_im, v1);
+        __m512 s  = _mm512_fmadd_ps(re, re, _mm512_mul_ps(im, im));
+        _mm512_storeu_ps(&_y[i], _mm512_sqrt_ps(s));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorcf_abs_port(_x+t, _n-t, _y+t);
+}
+
+// compute l2-norm on vector
+float __attribute__((target("avx512f")))
+liquid_vectorcf_norm_avx512(float complex * _x,
+                            unsigned int    _n)
+{
+    // operate on real and imaginary components independently
+    return liquid_vectorf_norm_avx512((float*)_x, 2*_n);
+}
+
+// scale vector to its l2-norm
+void __attribute__((target("avx512f")))
+liquid_vectorcf_normalize_avx512(float complex * _x,
+                                 unsigned int    _n,
+                                 float complex * _y)
+{
+    // operate on real and imaginary components independently
+    liquid_vectorf_normalize_avx512((float*)_x, 2*_n, (float*)_y);
+}
+
+// reduce accumulators of products {xr*yr, xi*yi, ...} and swapped products
+// {xr*yi, xi*yr, ...} to conjugate dot product
+static inline float complex __attribute__((target("avx512f")))
+liquid_vectorcf_dotprod_conj_reduce_avx512(__m512 _s,
+                                           __m512 _s_swap)
+{
+    // negate odd terms of swapped products for imaginary component
+    __m512 sign = _mm512_setr_ps(1,-1,1,-1,1,-1,1,-1,1,-1,1,-1,1,-1,1,-1);
+    return _mm512_reduce_add_ps(_s) +
+           _mm512_reduce_add_ps(_mm512_mul_ps(_s_swap, sign))*_Complex_I;
+}
+
+// conjugate dot product: sum{ conj(x[i]) * y[i] }
+float complex __attribute__((target("avx512f")))
+liquid_vectorcf_dotprod_conj_avx512(float complex * _x,
+                                    float complex * _y,
+                                    unsigned int    _n)
+{
+    // accumulate products and swapped products in pairs of registers
+    __m512 s0 = _mm512_setzero_ps(), q0 = _mm512_setzero_ps();
+    __m512 s1 = _mm512_setzero_ps(), q1 = _mm512_setzero_ps();
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __m512 x0 = _mm512_loadu_ps((float*)&_x[i  ]);
+        __m512 x1 = _mm512_loadu_ps((float*)&_x[i+8]);
+        __m512 y0 = _mm512_loadu_ps((float*)&_y[i  ]);
+        __m512 y1 = _mm512_loadu_ps((float*)&_y[i+8]);
+        s0 = _mm512_fmadd_ps(x0, y0, s0);
+        s1 = _mm512_fmadd_ps(x1, y1, s1);
+        q0 = _mm512_fmadd_ps(x0, _mm512_permute_ps(y0, _MM_SHUFFLE(2,3,0,1)), q0);
+        q1 = _mm512_fmadd_ps(x1, _mm512_permute_ps(y1, _MM_SHUFFLE(2,3,0,1)), q1);
+    }
+    float complex r = liquid_vectorcf_dotprod_conj_reduce_avx512(_mm512_add_ps(s0, s1),
+                                                                 _mm512_add_ps(q0, q1));
+
+    // cleanup (residual values that do not fit in register)
+    for (; i<_n; i++)
+        r += conjf(_x[i]) * _y[i];
+
+    return r;
+}
+
+// update in place, w[i] += a * u[i], and compute conjugate dot product with
+// the result: sum{ conj(w[i]) * v[i] }
+float complex __attribute__((target("avx512f")))
+liquid_vectorcf_axpy_dotprod_conj_avx512(float complex * _w,
+                                         unsigned int    _n,
+                                         float complex   _a,
+                                         float complex * _u,
+                                         float complex * _v)
+{
+    __m512 a_re = _mm512_set1_ps(crealf(_a));
+    __m512 a_im = _mm512_set1_ps(cimagf(_a));
+    __m512 s0 = _mm512_setzero_ps(), q0 = _mm512_setzero_ps();
+    __m512 s1 = _mm512_setzero_ps(), q1 = _mm512_setzero_ps();
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __m512 w0 = _mm512_add_ps(_mm512_loadu_ps((float*)&_w[i  ]),
+                        liquid_vectorcf_cmul_avx512(_mm512_loadu_ps((float*)&_u[i  ]), a_re, a_im));
+        __m512 w1 = _mm512_add_ps(_mm512_loadu_ps((float*)&_w[i+8]),
+                        liquid_vectorcf_cmul_avx512(_mm512_loadu_ps((float*)&_u[i+8]), a_re, a_im));
+        _mm512_storeu_ps((float*)&_w[i  ], w0);
+        _mm512_storeu_ps((float*)&_w[i+8], w1);
+        __m512 v0 = _mm512_loadu_ps((float*)&_v[i  ]);
+        __m512 v1 = _mm512_loadu_ps((float*)&_v[i+8]);
+        s0 = _mm512_fmadd_ps(w0, v0, s0);
+        s1 = _mm512_fmadd_ps(w1, v1, s1);
+        q0 = _mm512_fmadd_ps(w0, _mm512_permute_ps(v0, _MM_SHUFFLE(2,3,0,1)), q0);
+        q1 = _mm512_fmadd_ps(w1, _mm512_permute_ps(v1, _MM_SHUFFLE(2,3,0,1)), q1);
+    }
+    float complex r = liquid_vectorcf_dotprod_conj_reduce_avx512(_mm512_add_ps(s0, s1),
+                                                                 _mm512_add_ps(q0, q1));
+
+    // cleanup (residual values that do not fit in register)
+    for (; i<_n; i++) {
+        _w[i] += _a * _u[i];
+        r += conjf(_w[i]) * _v[i];
+    }
+    return r;
+}
+
+// build guard
+#else
+
+
+// invalidated; fall back to portable versions
+void liquid_vectorcf_add_avx512(float complex * _x, float complex * _y, unsigned int _n, float complex * _z)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorcf_add_port(_x, _y, _n, _z);
+}
+
+void liquid_vectorcf_addscalar_avx512(float complex * _x, unsigned int _n, float complex _v, float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorcf_addscalar_port(_x, _n, _v, _y);
+}
+
+void liquid_vectorcf_mul_avx512(float complex * _x, float complex * _y, unsigned int _n, float complex * _z)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorcf_mul_port(_x, _y, _n, _z);
+}
+
+void liquid_vectorcf_mulscalar_avx512(float complex * _x, unsigned int _n, float complex _v, float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorcf_mulscalar_port(_x, _n, _v, _y);
+}
+
+void liquid_vectorcf_cexpj_avx512(float * _theta, unsigned int _n, float complex * _x)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorcf_cexpj_port(_theta, _n, _x);
+}
+
+void liquid_vectorcf_carg_avx512(float complex * _x, unsigned int _n, float * _theta)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorcf_carg_port(_x, _n, _theta);
+}
+
+void liquid_vectorcf_abs_avx512(float complex * _x, unsigned int _n, float * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorcf_abs_port(_x, _n, _y);
+}
+
+float liquid_vectorcf_norm_avx512(float complex * _x, unsigned int _n)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    return liquid_vectorcf_norm_port(_x, _n);
+}
+
+void liquid_vectorcf_normalize_avx512(float complex * _x, unsigned int _n, float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorcf_normalize_port(_x, _n, _y);
+}
+
+
+float complex liquid_vectorcf_dotprod_conj_avx512(float complex * _x, float complex * _y, unsigned int _n)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    return liquid_vectorcf_dotprod_conj_port(_x, _y, _n);
+}
+
+float complex liquid_vectorcf_axpy_dotprod_conj_avx512(float complex * _w, unsigned int _n, float complex _a, float complex * _u, float complex * _v)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    return liquid_vectorcf_axpy_dotprod_conj_port(_w, _n, _a, _u, _v);
+}
+
+// build guard
+#endif
+
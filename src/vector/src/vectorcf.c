@@ -24,6 +24,9 @@
 
 #include "liquid.internal.h"
 
+// naming extensions (useful for print statements)
+#define EXTENSION_FULL  "cf"
+
 #define VECTOR(name)    LIQUID_CONCAT(liquid_vectorcf,name)
 #define T               float complex   // input/output type
 #define TP              float           // primitive type
@@ -31,7 +34,16 @@
 #define T_COMPLEX       1               // is input type complex
 
 #include "vector_add.proto.c"
+#include "vector_dotprod.proto.c"
 #include "vector_mul.proto.c"
 #include "vector_norm.proto.c"
 #include "vector_trig.proto.c"
 
+// runtime selection of kernels
+#include "vector_runtime.proto.c"
+
+// SIMD extensions
+#include "vectorcf.neon.c"
+#include "vectorcf.avx2.c"
+#include "vectorcf.avx512.c"
+
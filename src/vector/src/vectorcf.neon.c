@@ -20,18 +20,108 @@
  * THE SOFTWARE.
  */
 
-// vector operations
+// vector multiplication (ARM Neon)
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
 
 #include "liquid.internal.h"
 
-#define VECTOR(name)    LIQUID_CONCAT(liquid_vectorcf,name)
-#define T               float complex   // input/output type
-#define TP              float           // primitive type
+// build guard
+#if BUILD_NEON
+
+// include proper SIMD extensions for ARM Neon
+#include <arm_neon.h>
+
+// vector multiplication
+// equivalent to:
+// {
+//    unsigned int i;
+//    for (i=0; i<_n; i++)
+//        _y[i] = _v0[i] * _v1[i];
+// }
+void liquid_vectorcf_mul_neon(float complex * _v0,
+                              float complex * _v1,
+                              unsigned int    _n,
+                              float complex * _y)
+{
+    // type cast input as floating point array
+    float * v0 = (float*) _v0;
+    float * v1 = (float*) _v1;
+    float * y  = (float*) _y;
+
+    // double effective length
+    unsigned int n = 2*_n;
+
+    // output accumulators
+    float w0[4];
+    float w1[4];
+
+    // t = 4*(floor(_n/4))
+    unsigned int t = (n >> 2) << 2;
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        // load input
+        // r0: {v0[0].real, v0[0].imag, v0[1].real, v0[1].imag} = {a, b, e, f}
+        // r1: {v1[0].real, v1[0].imag, v1[1].real, v1[1].imag} = {c, d, g, h}
+        float32x4_t _r0 = vld1q_f32(&v0[i]);
+        float32x4_t _r1 = vld1q_f32(&v1[i]);
+
+        // NOTE: vref64q_f32(0,1,2,3) -> (1,0,3,2)
+        // w0: {a*c, b*d, e*g, f*h}
+        // w1: {a*d, b*c, e*h, f*g}
+        float32x4_t _w0 = vmulq_f32(_r0, _r1);
+        float32x4_t _w1 = vmulq_f32(_r0, vrev64q_f32(_r1));
+
+        // unload and combine
+        vst1q_f32(w0, _w0);
+        vst1q_f32(w1, _w1);
+
+        y[i+0] = w0[0] - w0[1]; // a*c - b*d
+        y[i+1] = w1[0] + w1[1]; // a*d + b*c
+        y[i+2] = w0[2] - w0[3]; // e*g - f*h
+        y[i+3] = w1[2] + w1[3]; // e*h + f*g
+    }
+
+    // cleanup
+    for (i=t/2; i<_n; i++)
+        _y[i] = _v0[i] * _v1[i];
+}
+
+// vector scalar multiplication
+void liquid_vectorcf_mulscalar_neon(float complex * _v,
+                                    unsigned int    _n,
+                                    float complex   _s,
+                                    float complex * _y)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _y[i] = _v[i] * _s;
+}
+
+// build guard
+#else
+
+// invalidated; fall back to portable versions
+void liquid_vectorcf_mul_neon(float complex * _v0,
+                              float complex * _v1,
+                              unsigned int    _n,
+                              float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"neon extensions not available");
+    liquid_vectorcf_mul_port(_v0, _v1, _n, _y);
+}
 
-#define T_COMPLEX       1               // is input type complex
+void liquid_vectorcf_mulscalar_neon(float complex * _v,
+                                    unsigned int    _n,
+                                    float complex   _s,
+                                    float complex * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"neon extensions not available");
+    liquid_vectorcf_mulscalar_port(_v, _n, _s, _y);
+}
 
-#include "vector_add.proto.c"
-#include "vectorcf_mul.neon.c"           // neon version
-#include "vector_norm.proto.c"
-#include "vector_trig.proto.c"
+// build guard
+#endif
 
@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// vector operations (AVX2), real
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_AVX2
+
+// include proper SIMD extensions for x86 AVX2
+#include <immintrin.h>
+
+// add each element pointwise: z[i] = x[i] + y[i]
+void __attribute__((target("avx2")))
+liquid_vectorf_add_avx2(float *      _x,
+                        float *      _y,
+                        unsigned int _n,
+                        float *      _z)
+{
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        __m256 x = _mm256_loadu_ps(&_x[i]);
+        __m256 y = _mm256_loadu_ps(&_y[i]);
+        _mm256_storeu_ps(&_z[i], _mm256_add_ps(x, y));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_add_port(_x+t, _y+t, _n-t, _z+t);
+}
+
+// add scalar to each element: y[i] = x[i] + v
+void __attribute__((target("avx2")))
+liquid_vectorf_addscalar_avx2(float *      _x,
+                              unsigned int _n,
+                              float        _v,
+                              float *      _y)
+{
+    __m256 v = _mm256_set1_ps(_v);
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8)
+        _mm256_storeu_ps(&_y[i], _mm256_add_ps(_mm256_loadu_ps(&_x[i]), v));
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_addscalar_port(_x+t, _n-t, _v, _y+t);
+}
+
+// multiply each element pointwise: z[i] = x[i] * y[i]
+void __attribute__((target("avx2")))
+liquid_vectorf_mul_avx2(float *      _x,
+                        float *      _y,
+                        unsigned int _n,
+                        float *      _z)
+{
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        __m256 x = _mm256_loadu_ps(&_x[i]);
+        __m256 y = _mm256_loadu_ps(&_y[i]);
+        _mm256_storeu_ps(&_z[i], _mm256_mul_ps(x, y));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_mul_port(_x+t, _y+t, _n-t, _z+t);
+}
+
+// multiply each element with scalar: y[i] = x[i] * v
+void __attribute__((target("avx2")))
+liquid_vectorf_mulscalar_avx2(float *      _x,
+                              unsigned int _n,
+                              float        _v,
+                              float *      _y)
+{
+    __m256 v = _mm256_set1_ps(_v);
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8)
+        _mm256_storeu_ps(&_y[i], _mm256_mul_ps(_mm256_loadu_ps(&_x[i]), v));
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_mulscalar_port(_x+t, _n-t, _v, _y+t);
+}
+
+// real phase rotation: x[i] = theta[i] > 0 ? 1 : -1
+void __attribute__((target("avx2")))
+liquid_vectorf_cexpj_avx2(float *      _theta,
+                          unsigned int _n,
+                          float *      _x)
+{
+    __m256 zero = _mm256_setzero_ps();
+    __m256 pos  = _mm256_set1_ps( 1.0f);
+    __m256 neg  = _mm256_set1_ps(-1.0f);
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        __m256 mask = _mm256_cmp_ps(_mm256_loadu_ps(&_theta[i]), zero, _CMP_GT_OQ);
+        _mm256_storeu_ps(&_x[i], _mm256_blendv_ps(neg, pos, mask));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_cexpj_port(_theta+t, _n-t, _x+t);
+}
+
+// real angle: theta[i] = x[i] > 0 ? 0 : pi
+void __attribute__((target("avx2")))
+liquid_vectorf_carg_avx2(float *      _x,
+                         unsigned int _n,
+                         float *      _theta)
+{
+    __m256 zero = _mm256_setzero_ps();
+    __m256 pi   = _mm256_set1_ps((float)M_PI);
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        __m256 mask = _mm256_cmp_ps(_mm256_loadu_ps(&_x[i]), zero, _CMP_GT_OQ);
+        _mm256_storeu_ps(&_theta[i], _mm256_andnot_ps(mask, pi));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_carg_port(_x+t, _n-t, _theta+t);
+}
+
+// absolute value of each element: y[i] = |x[i]|
+void __attribute__((target("avx2")))
+liquid_vectorf_abs_avx2(float *      _x,
+                        unsigned int _n,
+                        float *      _y)
+{
+    // clear sign bit
+    __m256 sign = _mm256_set1_ps(-0.0f);
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_n >> 3) << 3;
+    unsigned int i;
+    for (i=0; i<t; i+=8)
+        _mm256_storeu_ps(&_y[i], _mm256_andnot_ps(sign, _mm256_loadu_ps(&_x[i])));
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_abs_port(_x+t, _n-t, _y+t);
+}
+
+// compute l2-norm on vector
+float __attribute__((target("avx2")))
+liquid_vectorf_norm_avx2(float *      _x,
+                         unsigned int _n)
+{
+    // accumulate sum of squares in two registers to hide latency
+    __m256 s0 = _mm256_setzero_ps();
+    __m256 s1 = _mm256_setzero_ps();
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __m256 x0 = _mm256_loadu_ps(&_x[i  ]);
+        __m256 x1 = _mm256_loadu_ps(&_x[i+8]);
+        s0 = _mm256_add_ps(s0, _mm256_mul_ps(x0, x0));
+        s1 = _mm256_add_ps(s1, _mm256_mul_ps(x1, x1));
+    }
+
+    // horizontal sum
+    __m256 s  = _mm256_add_ps(s0, s1);
+    __m128 s4 = _mm_add_ps(_mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1));
+    s4 = _mm_add_ps(s4, _mm_movehl_ps(s4, s4));
+    s4 = _mm_add_ss(s4, _mm_movehdup_ps(s4));
+    float norm = _mm_cvtss_f32(s4);
+
+    // cleanup (residual values that do not fit in register)
+    for (; i<_n; i++)
+        norm += _x[i] * _x[i];
+
+    return sqrtf(norm);
+}
+
+// scale vector to its l2-norm
+void __attribute__((target("avx2")))
+liquid_vectorf_normalize_avx2(float *      _x,
+                              unsigned int _n,
+                              float *      _y)
+{
+    float norm = liquid_vectorf_norm_avx2(_x, _n);
+    liquid_vectorf_mulscalar_avx2(_x, _n, 1.0f / norm, _y);
+}
+
+// horizontal sum of eight values
+static inline float __attribute__((target("avx2")))
+liquid_vectorf_hsum_avx2(__m256 _x)
+{
+    __m128 s4 = _mm_add_ps(_mm256_castps256_ps128(_x), _mm256_extractf128_ps(_x, 1));
+    s4 = _mm_add_ps(s4, _mm_movehl_ps(s4, s4));
+    s4 = _mm_add_ss(s4, _mm_movehdup_ps(s4));
+    return _mm_cvtss_f32(s4);
+}
+
+// conjugate dot product: sum{ x[i] * y[i] }
+float __attribute__((target("avx2")))
+liquid_vectorf_dotprod_conj_avx2(float *      _x,
+                                 float *      _y,
+                                 unsigned int _n)
+{
+    // accumulate in two registers to hide latency
+    __m256 s0 = _mm256_setzero_ps();
+    __m256 s1 = _mm256_setzero_ps();
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        s0 = _mm256_add_ps(s0, _mm256_mul_ps(_mm256_loadu_ps(&_x[i  ]), _mm256_loadu_ps(&_y[i  ])));
+        s1 = _mm256_add_ps(s1, _mm256_mul_ps(_mm256_loadu_ps(&_x[i+8]), _mm256_loadu_ps(&_y[i+8])));
+    }
+    float r = liquid_vectorf_hsum_avx2(_mm256_add_ps(s0, s1));
+
+    // cleanup (residual values that do not fit in register)
+    for (; i<_n; i++)
+        r += _x[i] * _y[i];
+
+    return r;
+}
+
+// update in place, w[i] += a * u[i], and compute dot product with the
+// result: sum{ w[i] * v[i] }
+float __attribute__((target("avx2")))
+liquid_vectorf_axpy_dotprod_conj_avx2(float *      _w,
+                                      unsigned int _n,
+                                      float        _a,
+                                      float *      _u,
+                                      float *      _v)
+{
+    __m256 a  = _mm256_set1_ps(_a);
+    __m256 s0 = _mm256_setzero_ps();
+    __m256 s1 = _mm256_setzero_ps();
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __m256 w0 = _mm256_add_ps(_mm256_loadu_ps(&_w[i  ]), _mm256_mul_ps(a, _mm256_loadu_ps(&_u[i  ])));
+        __m256 w1 = _mm256_add_ps(_mm256_loadu_ps(&_w[i+8]), _mm256_mul_ps(a, _mm256_loadu_ps(&_u[i+8])));
+        _mm256_storeu_ps(&_w[i  ], w0);
+        _mm256_storeu_ps(&_w[i+8], w1);
+        s0 = _mm256_add_ps(s0, _mm256_mul_ps(w0, _mm256_loadu_ps(&_v[i  ])));
+        s1 = _mm256_add_ps(s1, _mm256_mul_ps(w1, _mm256_loadu_ps(&_v[i+8])));
+    }
+    float r = liquid_vectorf_hsum_avx2(_mm256_add_ps(s0, s1));
+
+    // cleanup (residual values that do not fit in register)
+    for (; i<_n; i++) {
+        _w[i] += _a * _u[i];
+        r += _w[i] * _v[i];
+    }
+    return r;
+}
+
+// build guard
+#else
+
+// invalidated; fall back to portable versions
+void liquid_vectorf_add_avx2(float * _x, float * _y, unsigned int _n, float * _z)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorf_add_port(_x, _y, _n, _z);
+}
+
+void liquid_vectorf_addscalar_avx2(float * _x, unsigned int _n, float _v, float * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorf_addscalar_port(_x, _n, _v, _y);
+}
+
+void liquid_vectorf_mul_avx2(float * _x, float * _y, unsigned int _n, float * _z)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorf_mul_port(_x, _y, _n, _z);
+}
+
+void liquid_vectorf_mulscalar_avx2(float * _x, unsigned int _n, float _v, float * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorf_mulscalar_port(_x, _n, _v, _y);
+}
+
+void liquid_vectorf_cexpj_avx2(float * _theta, unsigned int _n, float * _x)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorf_cexpj_port(_theta, _n, _x);
+}
+
+void liquid_vectorf_carg_avx2(float * _x, unsigned int _n, float * _theta)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorf_carg_port(_x, _n, _theta);
+}
+
+void liquid_vectorf_abs_avx2(float * _x, unsigned int _n, float * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorf_abs_port(_x, _n, _y);
+}
+
+float liquid_vectorf_norm_avx2(float * _x, unsigned int _n)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    return liquid_vectorf_norm_port(_x, _n);
+}
+
+void liquid_vectorf_normalize_avx2(float * _x, unsigned int _n, float * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    liquid_vectorf_normalize_port(_x, _n, _y);
+}
+
+
+float liquid_vectorf_dotprod_conj_avx2(float * _x, float * _y, unsigned int _n)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    return liquid_vectorf_dotprod_conj_port(_x, _y, _n);
+}
+
+float liquid_vectorf_axpy_dotprod_conj_avx2(float * _w, unsigned int _n, float _a, float * _u, float * _v)
+{
+    liquid_error(LIQUID_EICONFIG,"avx2 extensions not available");
+    return liquid_vectorf_axpy_dotprod_conj_port(_w, _n, _a, _u, _v);
+}
+
+// build guard
+#endif
+
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2007 - 2026 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// vector operations (AVX-512), real
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+// build guard
+#if BUILD_AVX512
+
+// include proper SIMD extensions for x86 AVX-512
+#include <immintrin.h>
+
+// add each element pointwise: z[i] = x[i] + y[i]
+void __attribute__((target("avx512f")))
+liquid_vectorf_add_avx512(float *      _x,
+                          float *      _y,
+                          unsigned int _n,
+                          float *      _z)
+{
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __m512 x = _mm512_loadu_ps(&_x[i]);
+        __m512 y = _mm512_loadu_ps(&_y[i]);
+        _mm512_storeu_ps(&_z[i], _mm512_add_ps(x, y));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_add_port(_x+t, _y+t, _n-t, _z+t);
+}
+
+// add scalar to each element: y[i] = x[i] + v
+void __attribute__((target("avx512f")))
+liquid_vectorf_addscalar_avx512(float *      _x,
+                                unsigned int _n,
+                                float        _v,
+                                float *      _y)
+{
+    __m512 v = _mm512_set1_ps(_v);
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16)
+        _mm512_storeu_ps(&_y[i], _mm512_add_ps(_mm512_loadu_ps(&_x[i]), v));
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_addscalar_port(_x+t, _n-t, _v, _y+t);
+}
+
+// multiply each element pointwise: z[i] = x[i] * y[i]
+void __attribute__((target("avx512f")))
+liquid_vectorf_mul_avx512(float *      _x,
+                          float *      _y,
+                          unsigned int _n,
+                          float *      _z)
+{
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __m512 x = _mm512_loadu_ps(&_x[i]);
+        __m512 y = _mm512_loadu_ps(&_y[i]);
+        _mm512_storeu_ps(&_z[i], _mm512_mul_ps(x, y));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_mul_port(_x+t, _y+t, _n-t, _z+t);
+}
+
+// multiply each element with scalar: y[i] = x[i] * v
+void __attribute__((target("avx512f")))
+liquid_vectorf_mulscalar_avx512(float *      _x,
+                                unsigned int _n,
+                                float        _v,
+                                float *      _y)
+{
+    __m512 v = _mm512_set1_ps(_v);
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16)
+        _mm512_storeu_ps(&_y[i], _mm512_mul_ps(_mm512_loadu_ps(&_x[i]), v));
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_mulscalar_port(_x+t, _n-t, _v, _y+t);
+}
+
+// real phase rotation: x[i] = theta[i] > 0 ? 1 : -1
+void __attribute__((target("avx512f")))
+liquid_vectorf_cexpj_avx512(float *      _theta,
+                            unsigned int _n,
+                            float *      _x)
+{
+    __m512 zero = _mm512_setzero_ps();
+    __m512 pos  = _mm512_set1_ps( 1.0f);
+    __m512 neg  = _mm512_set1_ps(-1.0f);
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(&_theta[i]), zero, _CMP_GT_OQ);
+        _mm512_storeu_ps(&_x[i], _mm512_mask_blend_ps(mask, neg, pos));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_cexpj_port(_theta+t, _n-t, _x+t);
+}
+
+// real angle: theta[i] = x[i] > 0 ? 0 : pi
+void __attribute__((target("avx512f")))
+liquid_vectorf_carg_avx512(float *      _x,
+                           unsigned int _n,
+                           float *      _theta)
+{
+    __m512 zero = _mm512_setzero_ps();
+    __m512 pi   = _mm512_set1_ps((float)M_PI);
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(&_x[i]), zero, _CMP_GT_OQ);
+        _mm512_storeu_ps(&_theta[i], _mm512_mask_blend_ps(mask, pi, zero));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_carg_port(_x+t, _n-t, _theta+t);
+}
+
+// absolute value of each element: y[i] = |x[i]|
+void __attribute__((target("avx512f")))
+liquid_vectorf_abs_avx512(float *      _x,
+                          unsigned int _n,
+                          float *      _y)
+{
+    // clear sign bit
+    __m512i mask = _mm512_set1_epi32(0x7fffffff);
+
+    // t = 16*(floor(_n/16))
+    unsigned int t = (_n >> 4) << 4;
+    unsigned int i;
+    for (i=0; i<t; i+=16) {
+        __m512i x = _mm512_castps_si512(_mm512_loadu_ps(&_x[i]));
+        _mm512_storeu_ps(&_y[i], _mm512_castsi512_ps(_mm512_and_si512(x, mask)));
+    }
+
+    // cleanup (residual values that do not fit in register)
+    liquid_vectorf_abs_port(_x+t, _n-t, _y+t);
+}
+
+// compute l2-norm on vector
+float __attribute__((target("avx512f")))
+liquid_vectorf_norm_avx512(float *      _x,
+                           unsigned int _n)
+{
+    // accumulate sum of squares in two registers to hide latency
+    __m512 s0 = _mm512_setzero_ps();
+    __m512 s1 = _mm512_setzero_ps();
+
+    // t = 32*(floor(_n/32))
+    unsigned int t = (_n >> 5) << 5;
+    unsigned int i;
+    for (i=0; i<t; i+=32) {
+        __m512 x0 = _mm512_loadu_ps(&_x[i   ]);
+        __m512 x1 = _mm512_loadu_ps(&_x[i+16]);
+        s0 = _mm512_fmadd_ps(x0, x0, s0);
+        s1 = _mm512_fmadd_ps(x1, x1, s1);
+    }
+    float norm = _mm512_reduce_add_ps(_mm512_add_ps(s0, s1));
+
+    // cleanup (residual values that do not fit in register)
+    for (; i<_n; i++)
+        norm += _x[i] * _x[i];
+
+    return sqrtf(norm);
+}
+
+// scale vector to its l2-norm
+void __attribute__((target("avx512f")))
+liquid_vectorf_normalize_avx512(float *      _x,
+                                unsigned int _n,
+                                float *      _y)
+{
+    float norm = liquid_vectorf_norm_avx512(_x, _n);
+    liquid_vectorf_mulscalar_avx512(_x, _n, 1.0f / norm, _y);
+}
+
+// conjugate dot product: sum{ x[i] * y[i] }
+float __attribute__((target("avx512f")))
+liquid_vectorf_dotprod_conj_avx512(float *      _x,
+                                   float *      _y,
+                                   unsigned int _n)
+{
+    // accumulate in two registers to hide latency
+    __m512 s0 = _mm512_setzero_ps();
+    __m512 s1 = _mm512_setzero_ps();
+
+    // t = 32*(floor(_n/32))
+    unsigned int t = (_n >> 5) << 5;
+    unsigned int i;
+    for (i=0; i<t; i+=32) {
+        s0 = _mm512_fmadd_ps(_mm512_loadu_ps(&_x[i   ]), _mm512_loadu_ps(&_y[i   ]), s0);
+        s1 = _mm512_fmadd_ps(_mm512_loadu_ps(&_x[i+16]), _mm512_loadu_ps(&_y[i+16]), s1);
+    }
+    float r = _mm512_reduce_add_ps(_mm512_add_ps(s0, s1));
+
+    // cleanup (residual values that do not fit in register)
+    for (; i<_n; i++)
+        r += _x[i] * _y[i];
+
+    return r;
+}
+
+// update in place, w[i] += a * u[i], and compute dot product with the
+// result: sum{ w[i] * v[i] }
+float __attribute__((target("avx512f")))
+liquid_vectorf_axpy_dotprod_conj_avx512(float *      _w,
+                                        unsigned int _n,
+                                        float        _a,
+                                        float *      _u,
+                                        float *      _v)
+{
+    __m512 a  = _mm512_set1_ps(_a);
+    __m512 s0 = _mm512_setzero_ps();
+    __m512 s1 = _mm512_setzero_ps();
+
+    // t = 32*(floor(_n/32))
+    unsigned int t = (_n >> 5) << 5;
+    unsigned int i;
+    for (i=0; i<t; i+=32) {
+        __m512 w0 = _mm512_fmadd_ps(a, _mm512_loadu_ps(&_u[i   ]), _mm512_loadu_ps(&_w[i   ]));
+        __m512 w1 = _mm512_fmadd_ps(a, _mm512_loadu_ps(&_u[i+16]), _mm512_loadu_ps(&_w[i+16]));
+        _mm512_storeu_ps(&_w[i   ], w0);
+        _mm512_storeu_ps(&_w[i+16], w1);
+        s0 = _mm512_fmadd_ps(w0, _mm512_loadu_ps(&_v[i   ]), s0);
+        s1 = _mm512_fmadd_ps(w1, _mm512_loadu_ps(&_v[i+16]), s1);
+    }
+    float r = _mm512_reduce_add_ps(_mm512_add_ps(s0, s1));
+
+    // cleanup (residual values that do not fit in register)
+    for (; i<_n; i++) {
+        _w[i] += _a * _u[i];
+        r += _w[i] * _v[i];
+    }
+    return r;
+}
+
+// build guard
+#else
+
+// invalidated; fall back to portable versions
+void liquid_vectorf_add_avx512(float * _x, float * _y, unsigned int _n, float * _z)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorf_add_port(_x, _y, _n, _z);
+}
+
+void liquid_vectorf_addscalar_avx512(float * _x, unsigned int _n, float _v, float * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorf_addscalar_port(_x, _n, _v, _y);
+}
+
+void liquid_vectorf_mul_avx512(float * _x, float * _y, unsigned int _n, float * _z)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorf_mul_port(_x, _y, _n, _z);
+}
+
+void liquid_vectorf_mulscalar_avx512(float * _x, unsigned int _n, float _v, float * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorf_mulscalar_port(_x, _n, _v, _y);
+}
+
+void liquid_vectorf_cexpj_avx512(float * _theta, unsigned int _n, float * _x)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorf_cexpj_port(_theta, _n, _x);
+}
+
+void liquid_vectorf_carg_avx512(float * _x, unsigned int _n, float * _theta)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorf_carg_port(_x, _n, _theta);
+}
+
+void liquid_vectorf_abs_avx512(float * _x, unsigned int _n, float * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorf_abs_port(_x, _n, _y);
+}
+
+float liquid_vectorf_norm_avx512(float * _x, unsigned int _n)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    return liquid_vectorf_norm_port(_x, _n);
+}
+
+void liquid_vectorf_normalize_avx512(float * _x, unsigned int _n, float * _y)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    liquid_vectorf_normalize_port(_x, _n, _y);
+}
+
+
+float liquid_vectorf_dotprod_conj_avx512(float * _x, float * _y, unsigned int _n)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    return liquid_vectorf_dotprod_conj_port(_x, _y, _n);
+}
+
+float liquid_vectorf_axpy_dotprod_conj_avx512(float * _w, unsigned int _n, float _a, float * _u, float * _v)
+{
+    liquid_error(LIQUID_EICONFIG,"avx512 extensions not available");
+    return liquid_vectorf_axpy_dotprod_conj_port(_w, _n, _a, _u, _v);
+}
+
+// build guard
+#endif
+
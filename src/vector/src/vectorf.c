@@ -24,6 +24,9 @@
 
 #include "liquid.internal.h"
 
+// naming extensions (useful for print statements)
+#define EXTENSION_FULL  "f"
+
 #define VECTOR(name)    LIQUID_CONCAT(liquid_vectorf,name)
 #define T               float           // input/output type
 #define TP              float           // primitive type
@@ -31,7 +34,15 @@
 #define T_COMPLEX       0               // is input type complex
 
 #include "vector_add.proto.c"
+#include "vector_dotprod.proto.c"
 #include "vector_mul.proto.c"
 #include "vector_norm.proto.c"
 #include "vector_trig.proto.c"
 
+// runtime selection of kernels
+#include "vector_runtime.proto.c"
+
+// SIMD extensions
+#include "vectorf.avx2.c"
+#include "vectorf.avx512.c"
+
@@ -20,6 +20,9 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+#include <math.h>
+
 #include "liquid.autotest.h"
 #include "liquid.internal.h"
 
@@ -150,3 +153,107 @@ LIQUID_AUTOTEST(vectorcf_mul_35,"multiply two complex buffers","",0.1)
     }
 }
 
+LIQUID_AUTOTEST(vectorcf_dotprod_conj,"conjugate dot product with in-place update","",0.1)
+{
+    float complex x[5] = {1+2*_Complex_I, -1, 3*_Complex_I, 0.5f-0.5f*_Complex_I, 2};
+    float complex y[5] = {2-1*_Complex_I,  4, _Complex_I,   2,                    -1+_Complex_I};
+    float complex w[5];
+    float complex a = 0.5f + 0.25f*_Complex_I;
+    unsigned int i;
+    for (i=0; i<5; i++)
+        w[i] = 1.0f - 0.5f*_Complex_I*i;
+
+    // expected: (-5i) + (-4) + (3) + (1+i) + (-2+2i) = -2 - 2i
+    float complex r = liquid_vectorcf_dotprod_conj(x, y, 5);
+    LIQUID_CHECK_DELTA(crealf(r), -2.0f, 1e-6f);
+    LIQUID_CHECK_DELTA(cimagf(r), -2.0f, 1e-6f);
+
+    // update w[i] += a*x[i] and compute conjugate dot product with y
+    float complex w_test[5], r_test = 0;
+    for (i=0; i<5; i++) {
+        w_test[i] = w[i] + a*x[i];
+        r_test   += conjf(w_test[i])*y[i];
+    }
+    r = liquid_vectorcf_axpy_dotprod_conj(w, 5, a, x, y);
+    for (i=0; i<5; i++)
+        LIQUID_CHECK_DELTA(cabsf(w[i] - w_test[i]), 0, 1e-6f);
+    LIQUID_CHECK_DELTA(cabsf(r - r_test), 0, 1e-6f);
+}
+
+// compare all operations for a particular runtime against the portable
+// implementation, restoring automatic selection when done
+void testbench_vectorcf_runtime(liquid_autotest  __q__,
+                                liquid_runtime_t _runtime,
+                                unsigned int     _n)
+{
+    // check if runtime is available on this machine
+    struct liquid_cpuinfo_s impl;
+    memset(&impl, 0x00, sizeof(struct liquid_cpuinfo_s));
+    switch (_runtime) {
+    case LIQUID_RUNTIME_NEON:   impl.neon   = true; break;
+    case LIQUID_RUNTIME_AVX2:   impl.avx2   = true; break;
+    case LIQUID_RUNTIME_AVX512: impl.avx512 = true; break;
+    default:;
+    }
+    if (liquid_runtime_detect(&impl) != _runtime) {
+        LIQUID_WARN("runtime unavailable on this machine");
+        return;
+    }
+
+    // generate random inputs, including a large phase value
+    float complex x[_n], y[_n], v = 0.7f - 1.3f*_Complex_I;
+    float complex w[2][_n];
+    float theta[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        x[i]     = randnf() + _Complex_I*randnf();
+        y[i]     = randnf() + _Complex_I*randnf();
+        w[0][i]  = w[1][i] = randnf() + _Complex_I*randnf();
+        theta[i] = 4*M_PI*(randf() - 0.5f);
+    }
+    theta[_n/2] = 1e4f;
+
+    // run operations for portable version (index 0) and runtime (index 1)
+    float complex add[2][_n], addscalar[2][_n], mul[2][_n], mulscalar[2][_n];
+    float complex cexpj[2][_n], normalize[2][_n];
+    float carg[2][_n], abs[2][_n], norm[2];
+    float complex dotprod[2], axpy_dotprod[2];
+    unsigned int k;
+    for (k=0; k<2; k++) {
+        liquid_vectorcf_runtime_select(k==0 ? LIQUID_RUNTIME_PORT : _runtime);
+        liquid_vectorcf_add      (x, y, _n, add[k]);
+        liquid_vectorcf_addscalar(x, _n, v, addscalar[k]);
+        liquid_vectorcf_mul      (x, y, _n, mul[k]);
+        liquid_vectorcf_mulscalar(x, _n, v, mulscalar[k]);
+        liquid_vectorcf_cexpj    (theta, _n, cexpj[k]);
+        liquid_vectorcf_carg     (x, _n, carg[k]);
+        liquid_vectorcf_abs      (x, _n, abs[k]);
+        liquid_vectorcf_normalize(x, _n, normalize[k]);
+        norm[k] = liquid_vectorcf_norm(x, _n);
+        dotprod[k]      = liquid_vectorcf_dotprod_conj(x, y, _n);
+        axpy_dotprod[k] = liquid_vectorcf_axpy_dotprod_conj(w[k], _n, v, x, y);
+    }
+    liquid_vectorcf_runtime_detect();
+
+    // compare results
+    float tol = 4e-6f;
+    for (i=0; i<_n; i++) {
+        LIQUID_CHECK_DELTA(cabsf(      add[0][i] -       add[1][i]), 0, tol);
+        LIQUID_CHECK_DELTA(cabsf(addscalar[0][i] - addscalar[1][i]), 0, tol);
+        LIQUID_CHECK_DELTA(cabsf(      mul[0][i] -       mul[1][i]), 0, tol);
+        LIQUID_CHECK_DELTA(cabsf(mulscalar[0][i] - mulscalar[1][i]), 0, tol);
+        LIQUID_CHECK_DELTA(cabsf(    cexpj[0][i] -     cexpj[1][i]), 0, tol);
+        LIQUID_CHECK_DELTA(cabsf(normalize[0][i] - normalize[1][i]), 0, tol);
+        LIQUID_CHECK_DELTA(carg[0][i], carg[1][i], tol);
+        LIQUID_CHECK_DELTA( abs[0][i],  abs[1][i], tol);
+        LIQUID_CHECK_DELTA(cabsf(w[0][i] - w[1][i]), 0, tol);
+    }
+    LIQUID_CHECK_DELTA(norm[0], norm[1], tol*norm[0]);
+    LIQUID_CHECK_DELTA(cabsf(     dotprod[0] -      dotprod[1]), 0, tol*_n);
+    LIQUID_CHECK_DELTA(cabsf(axpy_dotprod[0] - axpy_dotprod[1]), 0, tol*_n);
+}
+
+LIQUID_AUTOTEST(vectorcf_runtime_neon,  "compare neon kernels to portable",   "",0.1) { testbench_vectorcf_runtime(__q__, LIQUID_RUNTIME_NEON,  83); }
+LIQUID_AUTOTEST(vectorcf_runtime_avx2,  "compare avx2 kernels to portable",   "",0.1) { testbench_vectorcf_runtime(__q__, LIQUID_RUNTIME_AVX2,  83); }
+LIQUID_AUTOTEST(vectorcf_runtime_avx512,"compare avx512 kernels to portable", "",0.1) { testbench_vectorcf_runtime(__q__, LIQUID_RUNTIME_AVX512,83); }
+
@@ -20,6 +20,9 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+#include <math.h>
+
 #include "liquid.autotest.h"
 #include "liquid.internal.h"
 
@@ -174,3 +177,107 @@ LIQUID_AUTOTEST(vectorf_mulscalar_35,"multiply by scalar","",0.1)
         LIQUID_CHECK_DELTA(buf_test[i], buf_2[i], tol);
 }
 
+
+LIQUID_AUTOTEST(vectorf_abs,"absolute value writes output without modifying input","",0.1)
+{
+    float x[7] = {1.0f, -2.0f, 3.0f, -4.0f, 0.0f, -0.5f, 6.0f};
+    float y[7];
+    liquid_vectorf_abs(x, 7, y);
+
+    unsigned int i;
+    for (i=0; i<7; i++)
+        LIQUID_CHECK(y[i] == fabsf(x[i]));
+    LIQUID_CHECK(x[1] == -2.0f);
+}
+
+LIQUID_AUTOTEST(vectorf_dotprod_conj,"dot product with in-place update","",0.1)
+{
+    float x[7] = {1.0f, -2.0f, 3.0f, -4.0f, 0.0f, -0.5f, 6.0f};
+    float y[7] = {0.5f,  1.0f, 2.0f, -1.0f, 9.0f,  4.0f, 0.0f};
+    float w[7] = {1.0f,  1.0f, 1.0f,  1.0f, 1.0f,  1.0f, 1.0f};
+
+    // 0.5 - 2 + 6 + 4 + 0 - 2 + 0
+    LIQUID_CHECK_DELTA(liquid_vectorf_dotprod_conj(x, y, 7), 6.5f, 1e-6f);
+
+    // w = 1 + 0.5*x, dot product with y
+    float r = liquid_vectorf_axpy_dotprod_conj(w, 7, 0.5f, x, y);
+    unsigned int i;
+    float r_test = 0;
+    for (i=0; i<7; i++) {
+        LIQUID_CHECK(w[i] == 1.0f + 0.5f*x[i]);
+        r_test += w[i]*y[i];
+    }
+    LIQUID_CHECK_DELTA(r, r_test, 1e-6f);
+}
+
+// compare all operations for a particular runtime against the portable
+// implementation, restoring automatic selection when done
+void testbench_vectorf_runtime(liquid_autotest  __q__,
+                               liquid_runtime_t _runtime,
+                               unsigned int     _n)
+{
+    // check if runtime is available on this machine
+    struct liquid_cpuinfo_s impl;
+    memset(&impl, 0x00, sizeof(struct liquid_cpuinfo_s));
+    switch (_runtime) {
+    case LIQUID_RUNTIME_AVX2:   impl.avx2   = true; break;
+    case LIQUID_RUNTIME_AVX512: impl.avx512 = true; break;
+    default:;
+    }
+    if (liquid_runtime_detect(&impl) != _runtime) {
+        LIQUID_WARN("runtime unavailable on this machine");
+        return;
+    }
+
+    // generate random inputs
+    float x[_n], y[_n], v = -0.7f;
+    float w[2][_n];
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        x[i] = randnf();
+        y[i] = randnf();
+        w[0][i] = w[1][i] = randnf();
+    }
+
+    // run operations for portable version (index 0) and runtime (index 1)
+    float add[2][_n], addscalar[2][_n], mul[2][_n], mulscalar[2][_n];
+    float cexpj[2][_n], carg[2][_n], abs[2][_n], normalize[2][_n], norm[2];
+    float dotprod[2], axpy_dotprod[2];
+    unsigned int k;
+    for (k=0; k<2; k++) {
+        liquid_vectorf_runtime_select(k==0 ? LIQUID_RUNTIME_PORT : _runtime);
+        liquid_vectorf_add      (x, y, _n, add[k]);
+        liquid_vectorf_addscalar(x, _n, v, addscalar[k]);
+        liquid_vectorf_mul      (x, y, _n, mul[k]);
+        liquid_vectorf_mulscalar(x, _n, v, mulscalar[k]);
+        liquid_vectorf_cexpj    (x, _n, cexpj[k]);
+        liquid_vectorf_carg     (x, _n, carg[k]);
+        liquid_vectorf_abs      (x, _n, abs[k]);
+        liquid_vectorf_normalize(x, _n, normalize[k]);
+        norm[k] = liquid_vectorf_norm(x, _n);
+        dotprod[k]      = liquid_vectorf_dotprod_conj(x, y, _n);
+        axpy_dotprod[k] = liquid_vectorf_axpy_dotprod_conj(w[k], _n, v, x, y);
+    }
+    liquid_vectorf_runtime_detect();
+
+    // compare results
+    float tol = 4e-6f;
+    for (i=0; i<_n; i++) {
+        LIQUID_CHECK_DELTA(      add[0][i],       add[1][i], tol);
+        LIQUID_CHECK_DELTA(addscalar[0][i], addscalar[1][i], tol);
+        LIQUID_CHECK_DELTA(      mul[0][i],       mul[1][i], tol);
+        LIQUID_CHECK_DELTA(mulscalar[0][i], mulscalar[1][i], tol);
+        LIQUID_CHECK_DELTA(    cexpj[0][i],     cexpj[1][i], tol);
+        LIQUID_CHECK_DELTA(     carg[0][i],      carg[1][i], tol);
+        LIQUID_CHECK_DELTA(      abs[0][i],       abs[1][i], tol);
+        LIQUID_CHECK_DELTA(normalize[0][i], normalize[1][i], tol);
+        LIQUID_CHECK_DELTA(     w[0][i],      w[1][i], tol);
+    }
+    LIQUID_CHECK_DELTA(norm[0], norm[1], tol*norm[0]);
+    LIQUID_CHECK_DELTA(     dotprod[0],      dotprod[1], tol*_n);
+    LIQUID_CHECK_DELTA(axpy_dotprod[0], axpy_dotprod[1], tol*_n);
+}
+
+LIQUID_AUTOTEST(vectorf_runtime_avx2,  "compare avx2 kernels to portable",   "",0.1) { testbench_vectorf_runtime(__q__, LIQUID_RUNTIME_AVX2,  83); }
+LIQUID_AUTOTEST(vectorf_runtime_avx512,"compare avx512 kernels to portable", "",0.1) { testbench_vectorf_runtime(__q__, LIQUID_RUNTIME_AVX512,83); }
+